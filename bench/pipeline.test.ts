@@ -0,0 +1,370 @@
+import { describe, test, beforeAll, expect } from "bun:test"
+import { heapStats } from "bun:jsc"
+import { type BenchResult, loadFontBuffer, loadTextFile, recordResults, toBenchResult } from "./utils"
+import {
+	analyzeLineBreaks,
+	type Bitmap,
+	blendBitmap,
+	BreakOpportunity,
+	clearBitmap,
+	createBitmap,
+	Direction,
+	Font,
+	getScriptDirection,
+	getScriptRuns,
+	getScriptTag,
+	type RasterizedGlyph,
+	rasterizeGlyph,
+	shape,
+	UnicodeBuffer,
+} from "../src"
+import { releaseBuffer } from "../src/shaper/shaper"
+
+/**
+ * Whole-pipeline benchmark: itemization -> shaping -> line breaking ->
+ * rasterization -> compositing over the bench/texts corpora, timed per stage
+ * so interactions between stages (shape plan and glyph cache misses, pooled
+ * buffer reuse, glyph cache eviction) show up where the isolated stage
+ * benchmarks cannot see them.
+ *
+ * Cold passes use a freshly loaded Font and empty caches; warm passes reuse
+ * both. Allocations are each stage's heap growth over one extra pass of each
+ * kind, outside the timed passes; a collection inside a stage makes them an
+ * undercount.
+ */
+
+const BENCH_TEXTS_DIR = "bench/texts"
+// Arial Unicode covers every corpus; PIPELINE_FONT overrides it
+const FONT_PATH = process.env.PIPELINE_FONT ?? "/System/Library/Fonts/Supplemental/Arial Unicode.ttf"
+
+const CORPORA = [
+	{ name: "Russian", textDir: "russian" },
+	{ name: "Ukrainian", textDir: "ukrainian" },
+	{ name: "Belarusian", textDir: "belarusian" },
+	{ name: "Greek", textDir: "greek" },
+	{ name: "Chinese Simplified", textDir: "chinese_simplified" },
+	{ name: "Chinese Traditional", textDir: "chinese_traditional" },
+	{ name: "Japanese", textDir: "japanese" },
+	{ name: "Korean", textDir: "korean" },
+]
+const TEXTS = ["paragraph_short.txt", "paragraph_long.txt"]
+
+const FONT_SIZE = 16
+const LINE_WIDTH_PX = 480
+const LINE_HEIGHT_PX = 20
+// Small enough that long CJK documents evict glyphs between passes
+const GLYPH_CACHE_SIZE = 256
+
+const COLD_PASSES = 5
+const WARM_PASSES = 30
+const WARMUP_PASSES = 3
+
+const STAGES = ["itemize", "shape", "break", "raster", "composite"] as const
+type Stage = (typeof STAGES)[number]
+
+/** Glyph bitmaps with least-recently-used eviction (Map keeps insertion order) */
+class GlyphCache {
+	private readonly entries = new Map<number, RasterizedGlyph | null>()
+
+	constructor(
+		private readonly font: Font,
+		private readonly capacity: number,
+	) {}
+
+	get(glyphId: number): RasterizedGlyph | null {
+		const entries = this.entries
+		let glyph = entries.get(glyphId)
+		if (glyph !== undefined) {
+			entries.delete(glyphId)
+		} else {
+			glyph = rasterizeGlyph(this.font, glyphId, FONT_SIZE)
+			if (entries.size >= this.capacity) {
+				entries.delete(entries.keys().next().value!)
+			}
+		}
+		entries.set(glyphId, glyph)
+		return glyph
+	}
+}
+
+/** Pipeline state; a cold pass gets a fresh one */
+class Pipeline {
+	readonly glyphs: GlyphCache
+	private readonly scale: number
+	private page: Bitmap | null = null
+
+	// Shaped paragraph, flattened across its runs
+	private glyphIds = new Uint16Array(1024)
+	private clusters = new Uint32Array(1024)
+	private advances = new Float32Array(1024)
+	private count = 0
+	// Line starts as glyph indices into the flattened paragraph
+	private lineStarts: number[] = []
+	private lines = 0
+	// Stage outputs handed to the next stage
+	private runs: ReturnType<typeof getScriptRuns> = []
+	private bitmaps: (RasterizedGlyph | null)[] = []
+
+	constructor(readonly font: Font) {
+		this.glyphs = new GlyphCache(font, GLYPH_CACHE_SIZE)
+		this.scale = FONT_SIZE / font.unitsPerEm
+	}
+
+	/**
+	 * One paragraph through every stage, adding each stage's time to `times`
+	 * and, when given, its heap growth to `bytes`
+	 */
+	run(text: string, times: Record<Stage, number>, bytes?: Record<Stage, number>): void {
+		for (const stage of STAGES) {
+			const heapBefore = bytes ? heapStats().heapSize : 0
+			const start = performance.now()
+			switch (stage) {
+				case "itemize":
+					this.runs = getScriptRuns(text)
+					break
+				case "shape":
+					this.shapeRuns(this.runs)
+					break
+				case "break":
+					this.breakLines(text)
+					break
+				case "raster":
+					this.bitmaps = this.rasterize()
+					break
+				case "composite":
+					this.composite(this.bitmaps)
+					break
+			}
+			times[stage] += performance.now() - start
+			if (bytes) bytes[stage] += Math.max(0, heapStats().heapSize - heapBefore)
+		}
+	}
+
+	private shapeRuns(runs: ReturnType<typeof getScriptRuns>): void {
+		this.count = 0
+		for (const run of runs) {
+			const direction = getScriptDirection(run.script)
+			// Clusters stay codepoint indices into the whole paragraph
+			const buffer = new UnicodeBuffer()
+				.addStr(run.text, run.start)
+				.setDirection(direction === "rtl" ? Direction.RTL : Direction.LTR)
+			const glyphs = shape(this.font, buffer, {
+				script: getScriptTag(run.script),
+				direction,
+			})
+			this.reserve(this.count + glyphs.length)
+			for (let i = 0; i < glyphs.length; i++) {
+				const o = this.count + i
+				this.glyphIds[o] = glyphs.infos[i]!.glyphId
+				this.clusters[o] = glyphs.infos[i]!.cluster
+				this.advances[o] = glyphs.positions[i]!.xAdvance * this.scale
+			}
+			this.count += glyphs.length
+			releaseBuffer(glyphs)
+		}
+	}
+
+	private reserve(size: number): void {
+		if (size <= this.glyphIds.length) return
+		const capacity = Math.max(size, this.glyphIds.length * 2)
+		const glyphIds = new Uint16Array(capacity)
+		glyphIds.set(this.glyphIds)
+		this.glyphIds = glyphIds
+		const clusters = new Uint32Array(capacity)
+		clusters.set(this.clusters)
+		this.clusters = clusters
+		const advances = new Float32Array(capacity)
+		advances.set(this.advances)
+		this.advances = advances
+	}
+
+	/** Greedy fill at UAX #14 opportunities, forced break when a word overflows */
+	private breakLines(text: string): void {
+		const breaks = analyzeLineBreaks(text).breaks
+		const starts = this.lineStarts
+		starts.length = 0
+		starts.push(0)
+		let width = 0
+		let lastOpportunity = -1
+		let widthAtOpportunity = 0
+		for (let i = 0; i < this.count; i++) {
+			const cluster = this.clusters[i]!
+			const firstOfCluster = i === 0 || this.clusters[i - 1] !== cluster
+			const lineStart = starts[starts.length - 1]!
+			if (firstOfCluster && i > lineStart) {
+				const opportunity = breaks[cluster]
+				if (opportunity === BreakOpportunity.Mandatory) {
+					starts.push(i)
+					width = 0
+					lastOpportunity = -1
+				} else if (opportunity === BreakOpportunity.Optional) {
+					lastOpportunity = i
+					widthAtOpportunity = width
+				}
+			}
+			width += this.advances[i]!
+			if (width > LINE_WIDTH_PX && i > starts[starts.length - 1]!) {
+				const at = lastOpportunity > starts[starts.length - 1]! ? lastOpportunity : i
+				starts.push(at)
+				width = at === i ? this.advances[i]! : width - widthAtOpportunity
+				lastOpportunity = -1
+			}
+		}
+		this.lines = starts.length
+	}
+
+	private rasterize(): (RasterizedGlyph | null)[] {
+		const bitmaps: (RasterizedGlyph | null)[] = []
+		for (let i = 0; i < this.count; i++) {
+			bitmaps.push(this.glyphs.get(this.glyphIds[i]!))
+		}
+		return bitmaps
+	}
+
+	private composite(bitmaps: (RasterizedGlyph | null)[]): void {
+		const rows = this.lines * LINE_HEIGHT_PX
+		if (!this.page || this.page.rows < rows) {
+			this.page = createBitmap(LINE_WIDTH_PX, rows)
+		} else {
+			clearBitmap(this.page)
+		}
+		const page = this.page
+		const starts = this.lineStarts
+		for (let line = 0; line < this.lines; line++) {
+			const end = line + 1 < this.lines ? starts[line + 1]! : this.count
+			const baseline = line * LINE_HEIGHT_PX + FONT_SIZE
+			let pen = 0
+			for (let i = starts[line]!; i < end; i++) {
+				const glyph = bitmaps[i]
+				if (glyph) {
+					const x = Math.round(pen + glyph.bearingX)
+					blendBitmap(page, glyph.bitmap, x, baseline - glyph.bearingY, 1)
+				}
+				pen += this.advances[i]!
+			}
+		}
+	}
+}
+
+function emptyTimes(): Record<Stage, number> {
+	return { itemize: 0, shape: 0, break: 0, raster: 0, composite: 0 }
+}
+
+function runDocument(pipeline: Pipeline, paragraphs: string[], times: Record<Stage, number>): void {
+	for (const paragraph of paragraphs) pipeline.run(paragraph, times)
+}
+
+/** Heap growth per stage over one pass, in bytes */
+function measureAllocations(pipeline: Pipeline, paragraphs: string[]): Record<Stage, number> {
+	const bytes = emptyTimes()
+	Bun.gc(true)
+	for (const paragraph of paragraphs) pipeline.run(paragraph, emptyTimes(), bytes)
+	return bytes
+}
+
+interface StageReport {
+	cold: BenchResult
+	warm: BenchResult
+	coldBytes: number
+	warmBytes: number
+}
+
+function formatKb(bytes: number): string {
+	return `${(bytes / 1024).toFixed(1)} KB`
+}
+
+function printPipeline(title: string, reports: Map<Stage | "total", StageReport>): void {
+	console.log(`\n${title}`)
+	const header = ["Stage", "cold (ms)", "warm (ms)", "cold alloc", "warm alloc"]
+	const rows = [...reports].map(([stage, r]) => [
+		stage,
+		r.cold.medianMs.toFixed(3),
+		`${r.warm.medianMs.toFixed(3)} ±${((100 * (r.warm.ciHighMs - r.warm.ciLowMs)) / 2 / r.warm.medianMs).toFixed(1)}%`,
+		formatKb(r.coldBytes),
+		formatKb(r.warmBytes),
+	])
+	const widths = header.map((h, c) => Math.max(h.length, ...rows.map((row) => row[c]!.length)))
+	const line = (cells: string[]) =>
+		`│ ${cells.map((cell, c) => (c === 0 ? cell.padEnd(widths[c]!) : cell.padStart(widths[c]!))).join(" │ ")} │`
+	const rule = (l: string, m: string, r: string) => `${l}${widths.map((w) => "─".repeat(w + 2)).join(m)}${r}`
+	console.log(rule("┌", "┬", "┐"))
+	console.log(line(header))
+	console.log(rule("├", "┼", "┤"))
+	for (const row of rows) console.log(line(row))
+	console.log(rule("└", "┴", "┘"))
+
+	recordResults(`${title} (cold)`, [...reports.values()].map((r) => r.cold))
+	recordResults(`${title} (warm)`, [...reports.values()].map((r) => r.warm))
+}
+
+describe("Text Pipeline Benchmark", () => {
+	let fontBuffer: ArrayBuffer | null = null
+	const documents = new Map<string, string[]>()
+
+	beforeAll(async () => {
+		try {
+			fontBuffer = await loadFontBuffer(FONT_PATH)
+		} catch {
+			console.log(`\nSkipping pipeline benchmark: no font at ${FONT_PATH} (set PIPELINE_FONT)`)
+			return
+		}
+		for (const corpus of CORPORA) {
+			for (const file of TEXTS) {
+				try {
+					const text = await loadTextFile(`${BENCH_TEXTS_DIR}/${corpus.textDir}/${file}`)
+					const paragraphs = text.split("\n").map((p) => p.trim()).filter(Boolean)
+					documents.set(`${corpus.name} ${file.replace(".txt", "")}`, paragraphs)
+				} catch {
+					// Skip missing files
+				}
+			}
+		}
+	})
+
+	test("itemize -> shape -> break -> raster -> composite", () => {
+		if (!fontBuffer) return
+		const buffer = fontBuffer
+		for (const [name, paragraphs] of documents) {
+			const stageTimes = new Map<Stage | "total", { cold: number[]; warm: number[] }>()
+			for (const stage of [...STAGES, "total" as const]) stageTimes.set(stage, { cold: [], warm: [] })
+			const collect = (kind: "cold" | "warm", times: Record<Stage, number>) => {
+				let total = 0
+				for (const stage of STAGES) {
+					stageTimes.get(stage)![kind].push(times[stage])
+					total += times[stage]
+				}
+				stageTimes.get("total")![kind].push(total)
+			}
+
+			for (let pass = 0; pass < COLD_PASSES; pass++) {
+				const times = emptyTimes()
+				runDocument(new Pipeline(Font.load(buffer)), paragraphs, times)
+				collect("cold", times)
+			}
+			const coldBytes = measureAllocations(new Pipeline(Font.load(buffer)), paragraphs)
+
+			const warm = new Pipeline(Font.load(buffer))
+			for (let pass = 0; pass < WARMUP_PASSES; pass++) runDocument(warm, paragraphs, emptyTimes())
+			for (let pass = 0; pass < WARM_PASSES; pass++) {
+				const times = emptyTimes()
+				runDocument(warm, paragraphs, times)
+				collect("warm", times)
+			}
+			const warmBytes = measureAllocations(warm, paragraphs)
+
+			const reports = new Map<Stage | "total", StageReport>()
+			for (const [stage, samples] of stageTimes) {
+				const sum = (bytes: Record<Stage, number>) =>
+					stage === "total" ? STAGES.reduce((s, st) => s + bytes[st], 0) : bytes[stage]
+				reports.set(stage, {
+					cold: toBenchResult(stage, samples.cold),
+					warm: toBenchResult(stage, samples.warm),
+					coldBytes: sum(coldBytes),
+					warmBytes: sum(warmBytes),
+				})
+			}
+			printPipeline(`Pipeline - ${name}`, reports)
+			expect(reports.get("total")!.warm.medianMs).toBeGreaterThan(0)
+		}
+	})
+})
@@ -0,0 +1,133 @@
+import { describe, test, beforeAll, expect } from "bun:test"
+import { existsSync, readFileSync } from "node:fs"
+import { measure, printComparison, loadFontBuffer, type BenchResult } from "./utils"
+import { type Bitmap, Font, FillRule, PixelMode, createBitmap } from "../src"
+import { GrayRaster } from "../src/raster/gray-raster"
+import {
+	ensureFillWasmReady,
+	fillGlyphGrayWasm,
+	fillWasmStatus,
+	setFillWasmDenseMaxPixels,
+} from "../src/raster/fill-wasm/index"
+import {
+	ensureAssRasterWasmReady,
+	fillAssCommandsWasm,
+	isAssRasterWasmEnabled,
+} from "../src/raster/ass-wasm/index"
+import {
+	ASS_WORDS,
+	type CorpusGlyph,
+	type CorpusSection,
+	DEFAULT_CORPUS,
+	decodeCorpus,
+	FILL_WORDS,
+	recordSection,
+} from "../tools/raster-bench/corpus"
+
+const FONTS_DIR = "reference/rustybuzz/benches/fonts"
+const SIZES = [12, 24, 48, 96]
+
+// One iteration rasterizes every glyph of a section
+const REPLAY_OPTS = { warmup: 3, iterations: 5, batchSize: 1 }
+
+/**
+ * Replays recorded glyph command streams so the three fill paths are timed
+ * without outline decoding, scaling or shaping in the loop. Uses the corpus
+ * at $RASTER_CORPUS or DEFAULT_CORPUS (see tools/raster-bench/record.ts),
+ * recording NotoSans in memory when neither exists.
+ */
+describe("Raster Replay Benchmark", () => {
+	let sections: CorpusSection[] = []
+	const raster = new GrayRaster()
+
+	beforeAll(async () => {
+		const corpusPath = process.env.RASTER_CORPUS ?? DEFAULT_CORPUS
+		if (existsSync(corpusPath)) {
+			sections = decodeCorpus(new Uint8Array(readFileSync(corpusPath)))
+		} else {
+			const fontPath = `${FONTS_DIR}/NotoSans-Regular.ttf`
+			const font = Font.load(await loadFontBuffer(fontPath))
+			sections = SIZES.map((size) => recordSection(font, fontPath, size))
+		}
+		ensureFillWasmReady()
+		ensureAssRasterWasmReady()
+	})
+
+	function replayScalar(glyph: CorpusGlyph, bitmap: Bitmap): void {
+		bitmap.buffer.fill(0)
+		raster.setClip(0, 0, glyph.width, glyph.height)
+		raster.setBandBounds(0, glyph.height)
+		raster.reset()
+		const cmd = glyph.fill
+		for (let i = 0; i < cmd.length; i += FILL_WORDS) {
+			if (cmd[i] === 0) raster.moveTo(cmd[i + 1]!, cmd[i + 2]!)
+			else raster.lineTo(cmd[i + 1]!, cmd[i + 2]!)
+		}
+		raster.sweep(bitmap, FillRule.NonZero)
+	}
+
+	test("replays every recorded section", () => {
+		expect(sections.length).toBeGreaterThan(0)
+
+		for (const section of sections) {
+			const glyphs = section.glyphs
+			const bitmaps = glyphs.map((g) => createBitmap(g.width, g.height, PixelMode.Gray))
+			const outputs = bitmaps.map((b) => b.buffer)
+			const results: BenchResult[] = []
+
+			results.push(
+				measure(
+					"GrayRaster (scalar)",
+					() => {
+						for (let i = 0; i < glyphs.length; i++) {
+							replayScalar(glyphs[i]!, bitmaps[i]!)
+						}
+					},
+					REPLAY_OPTS,
+				),
+			)
+
+			const replayFill = () => {
+				for (let i = 0; i < glyphs.length; i++) {
+					const g = glyphs[i]!
+					fillGlyphGrayWasm(g.fill, g.fill.length / FILL_WORDS, g.width, g.height, 0, outputs[i]!)
+				}
+			}
+			// Cell-list engine for every glyph, then the dense engine for every
+			// glyph, then the default size-based selection
+			const engines: [string, number | undefined][] = [["fill-wasm (cells)", 0]]
+			if (fillWasmStatus().dense) {
+				engines.push(["fill-wasm (dense)", Infinity], ["fill-wasm (auto)", undefined])
+			}
+			for (const [name, maxPixels] of engines) {
+				setFillWasmDenseMaxPixels(maxPixels)
+				const ok = glyphs.every((g, i) =>
+					fillGlyphGrayWasm(g.fill, g.fill.length / FILL_WORDS, g.width, g.height, 0, outputs[i]!),
+				)
+				if (ok) results.push(measure(name, replayFill, REPLAY_OPTS))
+			}
+			setFillWasmDenseMaxPixels()
+
+			if (isAssRasterWasmEnabled()) {
+				results.push(
+					measure(
+						"ass-wasm",
+						() => {
+							for (let i = 0; i < glyphs.length; i++) {
+								const g = glyphs[i]!
+								fillAssCommandsWasm(g.ass, g.ass.length / ASS_WORDS, g.width, g.height, outputs[i]!)
+							}
+						},
+						REPLAY_OPTS,
+					),
+				)
+			}
+
+			printComparison(
+				`${section.fontPath} @ ${section.pixelSize}px (${glyphs.length} glyphs)`,
+				results,
+				"GrayRaster (scalar)",
+			)
+		}
+	})
+})
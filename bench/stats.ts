@@ -0,0 +1,118 @@
+/**
+ * Robust statistics for benchmark samples: median, MAD, a distribution-free
+ * confidence interval for the median, and a Mann-Whitney U test for
+ * comparing two runs. Timing samples are skewed and outlier-prone (GC, JIT,
+ * other processes), so nothing here assumes normality.
+ */
+
+export interface SampleStats {
+	count: number
+	medianMs: number
+	/** Median absolute deviation, scaled to estimate a standard deviation */
+	madMs: number
+	/** 95% confidence interval for the median */
+	ciLowMs: number
+	ciHighMs: number
+	meanMs: number
+	minMs: number
+	maxMs: number
+}
+
+// MAD * 1.4826 estimates the standard deviation of normal data
+const MAD_SCALE = 1.4826
+const Z_95 = 1.959964
+
+function medianOfSorted(sorted: readonly number[]): number {
+	const n = sorted.length
+	if (n === 0) return NaN
+	const mid = n >> 1
+	return n % 2 === 1 ? sorted[mid]! : (sorted[mid - 1]! + sorted[mid]!) / 2
+}
+
+export function median(values: readonly number[]): number {
+	return medianOfSorted([...values].sort((a, b) => a - b))
+}
+
+/**
+ * 95% interval for the median from order statistics: the ranks
+ * n/2 -+ z*sqrt(n)/2 of the sorted samples (normal approximation to the
+ * binomial). Fewer than 6 samples give the full range.
+ */
+function medianCi(sorted: readonly number[]): [number, number] {
+	const n = sorted.length
+	const half = (Z_95 * Math.sqrt(n)) / 2
+	const lo = Math.max(0, Math.floor(n / 2 - half))
+	const hi = Math.min(n - 1, Math.ceil(n / 2 + half) - 1)
+	return [sorted[lo]!, sorted[Math.max(lo, hi)]!]
+}
+
+export function summarize(samples: readonly number[]): SampleStats {
+	const sorted = [...samples].sort((a, b) => a - b)
+	const medianMs = medianOfSorted(sorted)
+	const deviations = sorted.map((v) => Math.abs(v - medianMs))
+	const [ciLowMs, ciHighMs] = medianCi(sorted)
+	let sum = 0
+	for (const v of sorted) sum += v
+	return {
+		count: sorted.length,
+		medianMs,
+		madMs: median(deviations) * MAD_SCALE,
+		ciLowMs,
+		ciHighMs,
+		meanMs: sum / sorted.length,
+		minMs: sorted[0]!,
+		maxMs: sorted[sorted.length - 1]!,
+	}
+}
+
+/** Half-width of the median's confidence interval relative to the median */
+export function relativeCi(stats: SampleStats): number {
+	return (stats.ciHighMs - stats.ciLowMs) / 2 / stats.medianMs
+}
+
+// Abramowitz-Stegun 7.1.26, accurate to about 1.5e-7
+function erfc(x: number): number {
+	const t = 1 / (1 + 0.3275911 * Math.abs(x))
+	const poly =
+		t *
+		(0.254829592 +
+			t * (-0.284496736 + t * (1.421413741 + t * (-1.453152027 + t * 1.061405429))))
+	const r = poly * Math.exp(-x * x)
+	return x >= 0 ? r : 2 - r
+}
+
+/**
+ * Two-sided Mann-Whitney U test (normal approximation with tie correction).
+ * Returns the p-value for "a and b come from the same distribution".
+ */
+export function mannWhitney(a: readonly number[], b: readonly number[]): number {
+	const n1 = a.length
+	const n2 = b.length
+	if (n1 === 0 || n2 === 0) return 1
+	const all = [
+		...a.map((value) => ({ value, first: true })),
+		...b.map((value) => ({ value, first: false })),
+	].sort((x, y) => x.value - y.value)
+
+	// Average ranks over ties; accumulate the tie correction term
+	let rankSumA = 0
+	let ties = 0
+	for (let i = 0; i < all.length; ) {
+		let j = i
+		while (j < all.length && all[j]!.value === all[i]!.value) j++
+		const rank = (i + j + 1) / 2
+		for (let k = i; k < j; k++) if (all[k]!.first) rankSumA += rank
+		const t = j - i
+		ties += t * t * t - t
+		i = j
+	}
+
+	const n = n1 + n2
+	const u = rankSumA - (n1 * (n1 + 1)) / 2
+	const mean = (n1 * n2) / 2
+	const variance = ((n1 * n2) / 12) * (n + 1 - ties / (n * (n - 1)))
+	if (variance <= 0) return 1
+	// Continuity correction
+	const z = (Math.abs(u - mean) - 0.5) / Math.sqrt(variance)
+	return Math.min(1, erfc(Math.max(0, z) / Math.SQRT2))
+}
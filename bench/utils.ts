@@ -1,18 +1,99 @@
+import { appendFileSync } from "node:fs"
+import { relativeCi, summarize } from "./stats"
+
 export interface BenchResult {
 	name: string
+	/** From the median time per call */
 	opsPerSec: number
 	avgMs: number
 	minMs: number
 	maxMs: number
+	medianMs: number
+	/** Scaled median absolute deviation of the batch times */
+	madMs: number
+	/** 95% confidence interval for the median */
+	ciLowMs: number
+	ciHighMs: number
+	/** Calls timed in total */
 	samples: number
+	/** Per-call time of each timed batch */
+	batchMs: number[]
+}
+
+export interface MeasureOptions {
+	warmup?: number
+	/** Minimum number of timed batches */
+	iterations?: number
+	batchSize?: number
+	/** Stop once the median's 95% CI is within this fraction (default 0.01) */
+	targetCi?: number
+	/** Keep sampling until the CI target or this many batches */
+	maxIterations?: number
+	/** Time budget for sampling beyond the minimum (default $BENCH_MAX_MS or 1000) */
+	maxTimeMs?: number
+}
+
+const DEFAULT_MAX_TIME_MS = Number(process.env.BENCH_MAX_MS ?? 1000)
+
+/**
+ * Adaptive sampling: time at least `iterations` batches, then keep going
+ * until the median is known to within `targetCi`, `maxIterations` batches
+ * were timed or the time budget runs out.
+ */
+class Sampler {
+	readonly times: number[] = []
+	private readonly iterations: number
+	private readonly targetCi: number
+	private readonly maxIterations: number
+	private readonly deadline: number
+
+	constructor(options: MeasureOptions, defaultIterations: number) {
+		this.iterations = options.iterations ?? defaultIterations
+		this.targetCi = options.targetCi ?? 0.01
+		this.maxIterations = Math.max(options.maxIterations ?? 200, this.iterations)
+		this.deadline = performance.now() + (options.maxTimeMs ?? DEFAULT_MAX_TIME_MS)
+	}
+
+	/** Record one batch time; returns true when sampling should stop */
+	add(ms: number): boolean {
+		const times = this.times
+		times.push(ms)
+		if (times.length < this.iterations) return false
+		if (times.length >= this.maxIterations) return true
+		// Below 6 samples the interval is just the sample range
+		if (times.length >= 6 && relativeCi(summarize(times)) <= this.targetCi) return true
+		return performance.now() > this.deadline
+	}
+
+	result(name: string, batchSize: number): BenchResult {
+		return toBenchResult(name, this.times, batchSize)
+	}
+}
+
+/** Summarize per-call times (one per timed batch of `batchSize` calls) */
+export function toBenchResult(name: string, times: number[], batchSize = 1): BenchResult {
+	const stats = summarize(times)
+	return {
+		name,
+		opsPerSec: 1000 / stats.medianMs,
+		avgMs: stats.meanMs,
+		minMs: stats.minMs,
+		maxMs: stats.maxMs,
+		medianMs: stats.medianMs,
+		madMs: stats.madMs,
+		ciLowMs: stats.ciLowMs,
+		ciHighMs: stats.ciHighMs,
+		samples: times.length * batchSize,
+		batchMs: times,
+	}
 }
 
 export function measure(
 	name: string,
 	fn: () => void,
-	options: { warmup?: number; iterations?: number; batchSize?: number } = {},
+	options: MeasureOptions = {},
 ): BenchResult {
-	const { warmup = 100, iterations = 3, batchSize = 1000 } = options
+	const { warmup = 100, batchSize = 1000 } = options
 
 	// Warmup - more iterations to ensure JIT optimization
 	for (let i = 0; i < warmup; i++) {
@@ -21,30 +102,23 @@ export function measure(
 
 	// Measure using batch timing to reduce per-call overhead
 	// Each iteration measures a batch of operations
-	const times: number[] = []
-	for (let i = 0; i < iterations; i++) {
+	const sampler = new Sampler(options, 3)
+	for (;;) {
 		const start = performance.now()
 		for (let j = 0; j < batchSize; j++) {
 			fn()
 		}
-		times.push((performance.now() - start) / batchSize)
+		if (sampler.add((performance.now() - start) / batchSize)) break
 	}
-
-	times.sort((a, b) => a - b)
-	const minMs = times[0]
-	const maxMs = times[times.length - 1]
-	const avgMs = times.reduce((a, b) => a + b, 0) / times.length
-	const opsPerSec = 1000 / avgMs
-
-	return { name, opsPerSec, avgMs, minMs, maxMs, samples: iterations * batchSize }
+	return sampler.result(name, batchSize)
 }
 
 export async function measureAsync(
 	name: string,
 	fn: () => Promise<void>,
-	options: { warmup?: number; iterations?: number } = {},
+	options: MeasureOptions = {},
 ): Promise<BenchResult> {
-	const { warmup = 50, iterations = 500 } = options
+	const { warmup = 50 } = options
 
 	// Warmup
 	for (let i = 0; i < warmup; i++) {
@@ -52,20 +126,13 @@ export async function measureAsync(
 	}
 
 	// Measure
-	const times: number[] = []
-	for (let i = 0; i < iterations; i++) {
+	const sampler = new Sampler(options, 500)
+	for (;;) {
 		const start = performance.now()
 		await fn()
-		times.push(performance.now() - start)
+		if (sampler.add(performance.now() - start)) break
 	}
-
-	times.sort((a, b) => a - b)
-	const minMs = times[0]
-	const maxMs = times[times.length - 1]
-	const avgMs = times.reduce((a, b) => a + b, 0) / times.length
-	const opsPerSec = 1000 / avgMs
-
-	return { name, opsPerSec, avgMs, minMs, maxMs, samples: iterations }
+	return sampler.result(name, 1)
 }
 
 function formatNumber(n: number, decimals = 2): string {
@@ -102,7 +169,7 @@ export function printComparison(title: string, results: BenchResult[], baseline?
 		return {
 			name: r.name,
 			opsPerSec: formatNumber(r.opsPerSec),
-			avgMs: r.avgMs.toFixed(3),
+			avgMs: `${r.medianMs.toFixed(3)} ±${((100 * (r.ciHighMs - r.ciLowMs)) / 2 / r.medianMs).toFixed(1)}%`,
 			comparison,
 		}
 	})
@@ -110,7 +177,7 @@ export function printComparison(title: string, results: BenchResult[], baseline?
 	const cols = {
 		name: Math.max(8, ...rows.map((r) => r.name.length)),
 		opsPerSec: Math.max(8, ...rows.map((r) => r.opsPerSec.length)),
-		avgMs: Math.max(8, ...rows.map((r) => r.avgMs.length)),
+		avgMs: Math.max(11, ...rows.map((r) => r.avgMs.length)),
 		comparison: Math.max(12, ...rows.map((r) => r.comparison.length)),
 	}
 
@@ -120,7 +187,7 @@ export function printComparison(title: string, results: BenchResult[], baseline?
 
 	console.log(top)
 	console.log(
-		`│ ${padRight("Library", cols.name)} │ ${padLeft("ops/sec", cols.opsPerSec)} │ ${padLeft("avg (ms)", cols.avgMs)} │ ${padRight("vs baseline", cols.comparison)} │`,
+		`│ ${padRight("Library", cols.name)} │ ${padLeft("ops/sec", cols.opsPerSec)} │ ${padLeft("median (ms)", cols.avgMs)} │ ${padRight("vs baseline", cols.comparison)} │`,
 	)
 	console.log(line)
 	for (const row of rows) {
@@ -129,6 +196,27 @@ export function printComparison(title: string, results: BenchResult[], baseline?
 		)
 	}
 	console.log(bottom)
+
+	recordResults(title, results)
+}
+
+/** One JSON line per case, for scripts/bench-compare.ts and bench:update */
+export interface BenchRecord extends BenchResult {
+	/** `${title} / ${name}`, unique across the bench suite */
+	case: string
+	title: string
+}
+
+/** Append results to $BENCH_JSON (JSON lines) when it is set */
+export function recordResults(title: string, results: BenchResult[]): void {
+	const path = process.env.BENCH_JSON
+	if (!path) return
+	let lines = ""
+	for (const r of results) {
+		const record: BenchRecord = { case: `${title} / ${r.name}`, title, ...r }
+		lines += `${JSON.stringify(record)}\n`
+	}
+	appendFileSync(path, lines)
 }
 
 export async function loadTextFile(path: string): Promise<string> {
@@ -0,0 +1,143 @@
+#!/usr/bin/env bun
+/**
+ * Runs the benchmarks and compares every case against a stored baseline,
+ * exiting non-zero on statistically significant regressions.
+ *
+ * Usage: bun scripts/bench-compare.ts [options] [bench files...]
+ *   --save              store this run as the new baseline instead
+ *   --baseline=PATH     baseline JSON lines (default bench/.cache/bench-baseline.jsonl)
+ *   --input=PATH        compare an existing run instead of running the benches
+ *   --threshold=0.03    ignore slowdowns smaller than this fraction
+ *   --alpha=0.01        family-wise significance level (Holm-corrected)
+ *
+ * Each case's batch times are compared with a Mann-Whitney U test, so the
+ * verdict does not depend on the noise shape. A case regresses when its
+ * median is slower by more than the threshold and the difference is
+ * significant after correcting for the number of cases compared.
+ */
+
+import { existsSync, mkdirSync, readFileSync, rmSync } from "node:fs"
+import { dirname } from "node:path"
+import { $ } from "bun"
+import { mannWhitney } from "../bench/stats"
+import { type BenchRecord, toBenchResult } from "../bench/utils"
+
+const args = process.argv.slice(2)
+const option = (name: string, fallback: string) =>
+	args.find((a) => a.startsWith(`--${name}=`))?.split("=")[1] ?? fallback
+const save = args.includes("--save")
+const baselinePath = option("baseline", "bench/.cache/bench-baseline.jsonl")
+const inputPath = option("input", "")
+const threshold = parseFloat(option("threshold", "0.03"))
+const alpha = parseFloat(option("alpha", "0.01"))
+const files = args.filter((a) => !a.startsWith("--"))
+
+function readRecords(path: string): Map<string, BenchRecord> {
+	const records = new Map<string, BenchRecord>()
+	for (const line of readFileSync(path, "utf8").split("\n")) {
+		if (!line.trim()) continue
+		const record = JSON.parse(line) as BenchRecord
+		const seen = records.get(record.case)
+		if (!seen) {
+			records.set(record.case, record)
+			continue
+		}
+		// A case printed twice (e.g. repeated runs) keeps every batch, and its
+		// median and CI are recomputed from them
+		records.set(record.case, {
+			...seen,
+			...toBenchResult(seen.name, [...seen.batchMs, ...record.batchMs]),
+			samples: seen.samples + record.samples,
+		})
+	}
+	return records
+}
+
+async function runBenches(outPath: string): Promise<void> {
+	mkdirSync(dirname(outPath), { recursive: true })
+	rmSync(outPath, { force: true })
+	const targets = files.length > 0 ? files.map((f) => `./${f}`) : ["./bench/"]
+	// bun test can exit non-zero on a failed assertion; the records still count
+	await $`bun test ${targets} --timeout 120000`
+		.env({ ...process.env, BENCH_JSON: outPath })
+		.nothrow()
+	if (!existsSync(outPath)) throw new Error("benchmarks produced no results")
+}
+
+interface Comparison {
+	name: string
+	ratio: number
+	p: number
+	significant: boolean
+}
+
+/** Holm step-down: the i-th smallest p-value is tested at alpha / (m - i) */
+function holm(comparisons: Comparison[]): void {
+	const sorted = [...comparisons].sort((a, b) => a.p - b.p)
+	for (let i = 0; i < sorted.length; i++) {
+		if (sorted[i]!.p > alpha / (sorted.length - i)) break
+		sorted[i]!.significant = true
+	}
+}
+
+function percent(ratio: number): string {
+	const delta = (ratio - 1) * 100
+	return `${delta >= 0 ? "+" : ""}${delta.toFixed(1)}%`
+}
+
+async function main() {
+	let currentPath = inputPath
+	if (!currentPath) {
+		currentPath = save ? baselinePath : "bench/.cache/bench-current.jsonl"
+		await runBenches(currentPath)
+	}
+	if (save) {
+		if (inputPath) await Bun.write(baselinePath, Bun.file(inputPath))
+		console.log(`Baseline written to ${baselinePath}`)
+		return
+	}
+	if (!existsSync(baselinePath)) {
+		console.error(`No baseline at ${baselinePath}; run bench:compare --save first`)
+		process.exit(2)
+	}
+
+	const baseline = readRecords(baselinePath)
+	const current = readRecords(currentPath)
+	const comparisons: Comparison[] = []
+	for (const [name, record] of current) {
+		const base = baseline.get(name)
+		if (!base) continue
+		comparisons.push({
+			name,
+			ratio: record.medianMs / base.medianMs,
+			p: mannWhitney(record.batchMs, base.batchMs),
+			significant: false,
+		})
+	}
+	holm(comparisons)
+
+	const regressions = comparisons.filter((c) => c.significant && c.ratio > 1 + threshold)
+	const improvements = comparisons.filter((c) => c.significant && c.ratio < 1 - threshold)
+	const report = (title: string, list: Comparison[]) => {
+		if (list.length === 0) return
+		console.log(`\n${title}:`)
+		for (const c of list.sort((a, b) => b.ratio - a.ratio)) {
+			console.log(`  ${percent(c.ratio).padStart(8)}  p=${c.p.toExponential(1)}  ${c.name}`)
+		}
+	}
+	report("Regressions", regressions)
+	report("Improvements", improvements)
+
+	const missing = [...baseline.keys()].filter((name) => !current.has(name))
+	console.log(
+		`\n${comparisons.length} cases compared, ${regressions.length} regressed, ` +
+			`${improvements.length} improved, ${comparisons.length - regressions.length - improvements.length} unchanged` +
+			(missing.length > 0 ? `, ${missing.length} not run` : ""),
+	)
+	if (regressions.length > 0) process.exit(1)
+}
+
+main().catch((error) => {
+	console.error(error)
+	process.exit(2)
+})
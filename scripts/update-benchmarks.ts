@@ -4,12 +4,9 @@
  * Usage: bun scripts/update-benchmarks.ts [--runs=3] [--commit]
  */
 
+import { existsSync, mkdirSync, readFileSync, rmSync } from "node:fs"
 import { $ } from "bun"
-
-interface BenchmarkResult {
-	title: string
-	results: Map<string, number> // library -> ops/sec
-}
+import type { BenchRecord } from "../bench/utils"
 
 // Parse command line args
 const args = process.argv.slice(2)
@@ -18,6 +15,9 @@ const shouldCommit = args.includes("--commit")
 
 console.log(`Running benchmarks ${runs} time(s)...`)
 
+const RESULTS_PATH = "bench/.cache/update-benchmarks.jsonl"
+mkdirSync("bench/.cache", { recursive: true })
+
 // Benchmark files and their important tests
 const BENCHMARK_FILES = [
 	"bench/path.test.ts",
@@ -29,63 +29,6 @@ const BENCHMARK_FILES = [
 	"bench/clusters.test.ts",
 ]
 
-// Parse ops/sec from formatted string like "1.93M", "138.05k", "33500"
-function parseOps(str: string): number {
-	str = str.trim()
-	if (str.endsWith("M")) return parseFloat(str) * 1_000_000
-	if (str.endsWith("k")) return parseFloat(str) * 1_000
-	return parseFloat(str)
-}
-
-// Parse benchmark output to extract results
-function parseBenchmarkOutput(output: string): BenchmarkResult[] {
-	const results: BenchmarkResult[] = []
-	const lines = output.split("\n")
-
-	let currentTitle = ""
-	let currentResults = new Map<string, number>()
-
-	for (let i = 0; i < lines.length; i++) {
-		const line = lines[i]
-
-		// Look for title line (line before the table border)
-		if (line && !line.startsWith("│") && !line.startsWith("├") && !line.startsWith("┌") && !line.startsWith("└") && line.trim() && !line.includes("PASS") && !line.includes("FAIL") && !line.includes("bun test")) {
-			// Check if next line is a table border
-			const nextLine = lines[i + 1] || ""
-			if (nextLine.startsWith("┌")) {
-				// Save previous result if exists
-				if (currentTitle && currentResults.size > 0) {
-					results.push({ title: currentTitle, results: new Map(currentResults) })
-				}
-				currentTitle = line.trim()
-				currentResults = new Map()
-			}
-		}
-
-		// Parse table rows
-		if (line.startsWith("│") && !line.includes("Library") && !line.includes("ops/sec")) {
-			const parts = line.split("│").map((p) => p.trim()).filter(Boolean)
-			if (parts.length >= 2) {
-				const name = parts[0]
-				const opsStr = parts[1]
-				if (name && opsStr) {
-					const ops = parseOps(opsStr)
-					if (!isNaN(ops) && ops > 0) {
-						currentResults.set(name, ops)
-					}
-				}
-			}
-		}
-	}
-
-	// Save last result
-	if (currentTitle && currentResults.size > 0) {
-		results.push({ title: currentTitle, results: currentResults })
-	}
-
-	return results
-}
-
 // Run benchmarks and collect results
 async function runBenchmarks(numRuns: number): Promise<Map<string, Map<string, number[]>>> {
 	// Map: title -> library -> array of ops/sec values
@@ -97,22 +40,24 @@ async function runBenchmarks(numRuns: number): Promise<Map<string, Map<string, n
 		for (const file of BENCHMARK_FILES) {
 			console.log(`  Running ${file}...`)
 			try {
+				// Results come from the JSON lines printComparison writes to $BENCH_JSON
+				rmSync(RESULTS_PATH, { force: true })
 				// Use .nothrow() since bun test may return non-zero even on success
-				const result = await $`bun test ./${file} 2>&1`.nothrow().text()
-				const parsed = parseBenchmarkOutput(result)
-
-				for (const bench of parsed) {
-					if (!allResults.has(bench.title)) {
-						allResults.set(bench.title, new Map())
+				await $`bun test ./${file}`.env({ ...process.env, BENCH_JSON: RESULTS_PATH }).quiet().nothrow()
+				if (!existsSync(RESULTS_PATH)) continue
+
+				for (const line of readFileSync(RESULTS_PATH, "utf8").split("\n")) {
+					if (!line.trim()) continue
+					const record = JSON.parse(line) as BenchRecord
+					if (!allResults.has(record.title)) {
+						allResults.set(record.title, new Map())
 					}
-					const titleMap = allResults.get(bench.title)!
+					const titleMap = allResults.get(record.title)!
 
-					for (const [lib, ops] of bench.results) {
-						if (!titleMap.has(lib)) {
-							titleMap.set(lib, [])
-						}
-						titleMap.get(lib)!.push(ops)
+					if (!titleMap.has(record.name)) {
+						titleMap.set(record.name, [])
 					}
+					titleMap.get(record.name)!.push(record.opsPerSec)
 				}
 			} catch (e) {
 				console.error(`  Error running ${file}:`, e)
@@ -6,6 +6,68 @@ import {
 	type GlyphPosition,
 } from "../types.ts";
 
+/** Index-assignable sequence (plain arrays and typed arrays) */
+interface MutableSequence<T> {
+	[index: number]: T;
+}
+
+/**
+ * Move the element at `from` to `to`, shifting the elements in between by
+ * one slot. Runs in place in O(|from - to|), so moves bounded by a syllable
+ * stay linear over the whole buffer (unlike splice remove + insert pairs).
+ *
+ * The complex-script reorderers apply this and rotateElements to
+ * `buffer.infos` alone. That is sound because they run in preShape, before
+ * any GSUB or GPOS: every position is still the zeroed default and nothing is
+ * marked deleted, so positions and deletion marks need not move with them.
+ */
+export function moveElement<T>(
+	items: MutableSequence<T>,
+	from: number,
+	to: number,
+): void {
+	if (from === to) return;
+	const item = items[from]!;
+	if (from > to) {
+		for (let i = from; i > to; i--) items[i] = items[i - 1]!;
+	} else {
+		for (let i = from; i < to; i++) items[i] = items[i + 1]!;
+	}
+	items[to] = item;
+}
+
+/**
+ * Rotate [start, end) in place so that the block [mid, end) comes first,
+ * followed by [start, mid). O(end - start) with no allocation.
+ */
+export function rotateElements<T>(
+	items: MutableSequence<T>,
+	start: number,
+	mid: number,
+	end: number,
+): void {
+	if (start >= mid || mid >= end) return;
+	reverseElements(items, start, mid);
+	reverseElements(items, mid, end);
+	reverseElements(items, start, end);
+}
+
+function reverseElements<T>(
+	items: MutableSequence<T>,
+	start: number,
+	end: number,
+): void {
+	let i = start;
+	let j = end - 1;
+	while (i < j) {
+		const tmp = items[i]!;
+		items[i] = items[j]!;
+		items[j] = tmp;
+		i++;
+		j--;
+	}
+}
+
 /**
  * Output buffer containing shaped glyphs.
  * Result of the shaping process.
@@ -112,14 +174,15 @@ export class GlyphBuffer {
 
 	/**
 	 * Initialize from codepoints with direct font access (no closure).
-	 * This is faster than initFromCodepoints for hot paths.
+	 * This is faster than initFromCodepoints for hot paths. Only the first
+	 * `len` entries are used, so pooled arrays can be passed as they are.
 	 */
 	initFromCodepointsWithFont(
 		codepoints: ArrayLike<number>,
 		clusters: ArrayLike<number>,
 		font: Font,
+		len: number = codepoints.length,
 	): void {
-		const len = codepoints.length;
 		const poolLen = this._infoPool.length;
 
 		// Expand pools if needed - batch allocate for efficiency
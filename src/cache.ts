@@ -0,0 +1,360 @@
+/**
+ * Central registry for the library's derived-data caches (paths, parsed
+ * glyphs, hinted outlines, shape plans, ...). Each cache reports an estimated
+ * byte size and can be trimmed, so a long-lived process can bound memory
+ * without dropping Font objects.
+ *
+ * Caches keyed by an owner (a Font, a glyf table, a lookup) hold a Map per
+ * owner, released with the owner. Within a map, entries are evicted least
+ * recently used first (a hit moves the entry to the end of the map), both
+ * for the per-owner entry limit and for the global budget. When
+ * the estimated total exceeds the budget, caches are trimmed in priority
+ * order (cheapest to rebuild first) down to TRIM_TARGET of the budget.
+ *
+ * Byte counts are estimates of the retained JS objects, not exact heap sizes.
+ */
+
+export interface CacheStats {
+	name: string;
+	/** Live entries across all owners */
+	entries: number;
+	/** Estimated retained bytes */
+	bytes: number;
+	/** Per-owner entry limit, Infinity if only the budget bounds it */
+	maxEntries: number;
+	/** Entries dropped by the entry limit, the budget or trimCaches */
+	evictions: number;
+}
+
+export interface CacheManagerStats {
+	/** Byte budget, Infinity if unbounded */
+	budget: number;
+	/** Estimated bytes across all caches */
+	bytes: number;
+	caches: CacheStats[];
+}
+
+/** A cache the registry can measure and trim */
+export interface ManagedCache {
+	readonly name: string;
+	/** Lower priorities are trimmed first when over budget */
+	readonly priority: number;
+	readonly bytes: number;
+	stats(): CacheStats;
+	/** Drop this fraction (0..1) of entries, least recently used first */
+	trim(fraction: number): void;
+}
+
+/** Default budget; setCacheBudget(Infinity) disables it */
+const DEFAULT_BUDGET = 256 * 1024 * 1024;
+/** Over budget, trim down to this fraction so inserts don't trim every time */
+const TRIM_TARGET = 0.75;
+
+const caches: ManagedCache[] = [];
+let budget = DEFAULT_BUDGET;
+let totalBytes = 0;
+let trimming = false;
+
+/** Add a cache to the registry; caches live for the lifetime of the module */
+export function registerCache(cache: ManagedCache): void {
+	caches.push(cache);
+	caches.sort((a, b) => a.priority - b.priority);
+}
+
+/** Record a change in a cache's estimated size, trimming if over budget */
+export function addCacheBytes(delta: number): void {
+	totalBytes += delta;
+	if (totalBytes > budget && !trimming) enforceBudget();
+}
+
+function enforceBudget(): void {
+	trimming = true;
+	try {
+		const target = budget * TRIM_TARGET;
+		for (const cache of caches) {
+			if (totalBytes <= target) break;
+			const bytes = cache.bytes;
+			if (bytes > 0) cache.trim(Math.min(1, (totalBytes - target) / bytes));
+		}
+	} finally {
+		trimming = false;
+	}
+}
+
+/** Estimated size and entry counts of every registered cache */
+export function getCacheStats(): CacheManagerStats {
+	const list = caches.map((cache) => cache.stats());
+	let bytes = 0;
+	for (const stats of list) bytes += stats.bytes;
+	return { budget, bytes, caches: list };
+}
+
+/**
+ * Set the byte budget for all caches combined, trimming immediately if the
+ * current estimate exceeds it. Pass Infinity to disable.
+ */
+export function setCacheBudget(bytes: number): void {
+	if (!(bytes >= 0)) throw new RangeError(`Invalid cache budget: ${bytes}`);
+	budget = bytes;
+	if (totalBytes > budget) enforceBudget();
+}
+
+/**
+ * Drop a fraction of every cache's entries, least recently used first: 0 does
+ * nothing, 0.5 halves each cache, 1 clears everything.
+ */
+export function trimCaches(level: number): void {
+	if (!(level > 0)) return;
+	const fraction = Math.min(1, level);
+	for (const cache of caches) cache.trim(fraction);
+}
+
+/** Rough sizes for estimates: object header and one property or slot */
+export const OBJECT_BYTES = 16;
+export const SLOT_BYTES = 8;
+
+/** An {x, y, onCurve} point and its array slot */
+const POINT_BYTES = OBJECT_BYTES + 4 * SLOT_BYTES;
+
+/** Estimated size of a contour list */
+export function contoursBytes(contours: readonly unknown[][]): number {
+	let bytes = OBJECT_BYTES + contours.length * SLOT_BYTES;
+	for (let i = 0; i < contours.length; i++) {
+		bytes += OBJECT_BYTES + contours[i]!.length * POINT_BYTES;
+	}
+	return bytes;
+}
+
+/** Entries and bytes held for one owner, returned when it is collected */
+export interface CacheUsage {
+	cache: { release(usage: CacheUsage): void };
+	entries: number;
+	bytes: number;
+	/** The cache's weak handle on the owner's entry, dropped with it */
+	ref: WeakRef<object> | null;
+}
+
+// Owners are only weakly reachable from a cache; when one is collected, its
+// entries go with it and the finalizer returns their bytes to the totals.
+const released = new FinalizationRegistry<CacheUsage>((usage) => {
+	usage.cache.release(usage);
+});
+
+/** Shared accounting for the owner-keyed caches */
+abstract class AccountedCache<T extends object> implements ManagedCache {
+	readonly name: string;
+	readonly priority: number;
+	protected entries = 0;
+	protected evictions = 0;
+	/** Weak handles in least recently used order, for trimming */
+	protected readonly live = new Set<WeakRef<T>>();
+	private totalBytes = 0;
+
+	constructor(name: string, priority: number) {
+		this.name = name;
+		this.priority = priority;
+		registerCache(this);
+	}
+
+	get bytes(): number {
+		return this.totalBytes;
+	}
+
+	abstract readonly maxEntries: number;
+
+	abstract trim(fraction: number): void;
+
+	stats(): CacheStats {
+		return {
+			name: this.name,
+			entries: this.entries,
+			bytes: this.totalBytes,
+			maxEntries: this.maxEntries,
+			evictions: this.evictions,
+		};
+	}
+
+	/** Return a collected owner's usage to the totals */
+	release(usage: CacheUsage): void {
+		this.account(usage, -usage.entries, -usage.bytes);
+		if (usage.ref) this.live.delete(usage.ref as WeakRef<T>);
+	}
+
+	protected newUsage(owner: object): CacheUsage {
+		const usage: CacheUsage = { cache: this, entries: 0, bytes: 0, ref: null };
+		released.register(owner, usage, usage);
+		return usage;
+	}
+
+	/** Add `held` (the owner or its entry) to `live` as most recently used */
+	protected track(usage: CacheUsage, held: T): void {
+		const ref = new WeakRef(held);
+		usage.ref = ref;
+		this.live.add(ref);
+	}
+
+	protected account(usage: CacheUsage, entries: number, bytes: number): void {
+		usage.entries += entries;
+		usage.bytes += bytes;
+		this.entries += entries;
+		this.totalBytes += bytes;
+		addCacheBytes(bytes);
+	}
+}
+
+interface OwnerEntry<K, V> {
+	map: Map<K, V>;
+	usage: CacheUsage;
+}
+
+export interface OwnerCacheOptions<V> {
+	/** Estimated retained bytes of one entry, including its key */
+	sizeOf: (value: V) => number;
+	/** Per-owner entry limit (default: only the budget bounds it) */
+	maxEntries?: number;
+	/** Trim priority; cheap-to-rebuild caches should use lower values */
+	priority?: number;
+}
+
+/**
+ * Per-owner cache: a Map of entries for each owner object, held weakly by
+ * owner. Replaces the `WeakMap<Owner, Map<K, V>>` pattern with accounting.
+ */
+export class OwnerCache<O extends object, K, V> extends AccountedCache<
+	OwnerEntry<K, V>
+> {
+	readonly maxEntries: number;
+	private readonly sizeOf: (value: V) => number;
+	private readonly owners = new WeakMap<O, OwnerEntry<K, V>>();
+
+	constructor(name: string, options: OwnerCacheOptions<V>) {
+		super(name, options.priority ?? 0);
+		this.sizeOf = options.sizeOf;
+		this.maxEntries = options.maxEntries ?? Infinity;
+	}
+
+	/** Look up an entry; a hit makes it the most recently used */
+	get(owner: O, key: K): V | undefined {
+		const map = this.owners.get(owner)?.map;
+		if (!map) return undefined;
+		const value = map.get(key);
+		if (value !== undefined) {
+			map.delete(key);
+			map.set(key, value);
+		}
+		return value;
+	}
+
+	has(owner: O, key: K): boolean {
+		return this.owners.get(owner)?.map.has(key) ?? false;
+	}
+
+	set(owner: O, key: K, value: V): void {
+		let entry = this.owners.get(owner);
+		if (!entry) {
+			entry = { map: new Map(), usage: this.newUsage(owner) };
+			this.track(entry.usage, entry);
+			this.owners.set(owner, entry);
+		}
+		const { map, usage } = entry;
+		if (map.has(key)) {
+			this.account(usage, -1, -this.sizeOf(map.get(key) as V));
+			map.delete(key);
+		} else if (map.size >= this.maxEntries) {
+			this.evictOldest(entry, 1);
+		}
+		map.set(key, value);
+		this.account(usage, 1, this.sizeOf(value));
+	}
+
+	trim(fraction: number): void {
+		for (const ref of this.live) {
+			const entry = ref.deref();
+			if (!entry) {
+				this.live.delete(ref);
+				continue;
+			}
+			const size = entry.map.size;
+			this.evictOldest(
+				entry,
+				fraction >= 1 ? size : Math.ceil(size * fraction),
+			);
+		}
+	}
+
+	private evictOldest(entry: OwnerEntry<K, V>, count: number): void {
+		const { map, usage } = entry;
+		let bytes = 0;
+		let removed = 0;
+		for (const [key, value] of map) {
+			if (removed >= count) break;
+			map.delete(key);
+			bytes += this.sizeOf(value);
+			removed++;
+		}
+		this.evictions += removed;
+		this.account(usage, -removed, -bytes);
+	}
+}
+
+export interface WeakCacheOptions<V> {
+	/** Estimated retained bytes of one value */
+	sizeOf: (value: V) => number;
+	/** Trim priority; cheap-to-rebuild caches should use lower values */
+	priority?: number;
+}
+
+/**
+ * One value per owner object, held weakly by owner. Replaces a plain
+ * `WeakMap<Owner, V>` with accounting; trimming drops the values of the
+ * least recently used owners, which are rebuilt on next use.
+ */
+export class WeakCache<O extends object, V> extends AccountedCache<O> {
+	readonly maxEntries = 1;
+	private readonly sizeOf: (value: V) => number;
+	private readonly values = new WeakMap<O, { value: V; usage: CacheUsage }>();
+
+	constructor(name: string, options: WeakCacheOptions<V>) {
+		super(name, options.priority ?? 0);
+		this.sizeOf = options.sizeOf;
+	}
+
+	/** Look up an owner's value; a hit makes the owner the most recently used */
+	get(owner: O): V | undefined {
+		const held = this.values.get(owner);
+		if (!held) return undefined;
+		const ref = held.usage.ref as WeakRef<O>;
+		this.live.delete(ref);
+		this.live.add(ref);
+		return held.value;
+	}
+
+	set(owner: O, value: V): void {
+		const held = this.values.get(owner);
+		if (held) {
+			this.account(held.usage, 0, this.sizeOf(value) - held.usage.bytes);
+			held.value = value;
+			return;
+		}
+		const usage = this.newUsage(owner);
+		this.track(usage, owner);
+		this.values.set(owner, { value, usage });
+		this.account(usage, 1, this.sizeOf(value));
+	}
+
+	trim(fraction: number): void {
+		let count = fraction >= 1 ? Infinity : Math.ceil(this.entries * fraction);
+		for (const ref of this.live) {
+			if (count <= 0) break;
+			this.live.delete(ref);
+			const owner = ref.deref();
+			const held = owner && this.values.get(owner);
+			if (!owner || !held) continue;
+			this.values.delete(owner);
+			released.unregister(held.usage);
+			this.account(held.usage, -1, -held.usage.bytes);
+			this.evictions++;
+			count--;
+		}
+	}
+}
@@ -1,7 +1,21 @@
 /**
  * BitmapBuilder: Fluent builder for raster bitmap operations
  *
- * All operations are eager (applied immediately) and return new builder instances
+ * Builders are immutable and lazy: each operation is recorded and returns a
+ * new builder. Nothing runs until a result is needed (toBitmap, toRGBA,
+ * metrics, accessors). The pending chain is then optimized as a whole:
+ * - runs of pad/shift collapse into one offset copy
+ * - runs of compositing ops share one owned destination; each op is one
+ *   in-place pass over its overlap (not fused into a single pass, so every
+ *   op keeps its SIMD kernel)
+ * - in-place effects reuse buffers the chain already owns instead of copying,
+ *   and a retired buffer of the same shape is recycled as scratch
+ * Compositing, transforms and RGBA export use the wasm kernels when available.
+ *
+ * A Bitmap passed to a compositing op is copied when the op is recorded, so
+ * later edits to it cannot change the result, exactly as with eager
+ * evaluation. A BitmapBuilder operand is immutable and is resolved (and
+ * cached) when the chain runs.
  */
 
 import {
@@ -42,15 +56,116 @@ import {
 } from "../raster/types.ts";
 import type { Matrix2D, Matrix3x3 } from "../render/outline-transform.ts";
 
+/** Bitmap plus bearing produced by a step of a chain */
+interface Placed {
+	bitmap: Bitmap;
+	bearingX: number;
+	bearingY: number;
+}
+
+/** Compositing operators recorded by the builder */
+type BlendKind = "blend" | "composite" | "add" | "sub" | "mul" | "max";
+
+/** A recorded builder operation */
+type BuilderOp =
+	| { kind: "pad"; left: number; top: number; right: number; bottom: number }
+	| { kind: "shift"; dx: number; dy: number }
+	| {
+			kind: "blend";
+			mode: BlendKind;
+			other: () => Bitmap;
+			x: number;
+			y: number;
+			opacity: number;
+	  }
+	/** Bearing-preserving op; `inPlace` ops may modify their argument */
+	| { kind: "effect"; inPlace: boolean; run: (bitmap: Bitmap) => Bitmap }
+	/** Op that moves the bearing; never modifies its argument */
+	| { kind: "place"; run: (input: Placed) => Placed };
+
+/** State of a chain while it executes */
+interface ChainState extends Placed {
+	/** The bitmap was allocated by this chain and may be modified in place */
+	owned: boolean;
+	/** Retired owned bitmap, reused when an op needs one of the same shape */
+	spare: Bitmap | null;
+}
+
 /**
  * BitmapBuilder provides a fluent interface for bitmap manipulations
  */
 export class BitmapBuilder {
+	/** Materialized result (null until resolved) */
+	private _bitmap: Bitmap | null;
+	private _bearingX: number;
+	private _bearingY: number;
+	/** Pending operation and the builder it applies to (null once resolved) */
+	private _parent: BitmapBuilder | null;
+	private _op: BuilderOp | null;
+
 	private constructor(
-		private readonly _bitmap: Bitmap,
-		private readonly _bearingX: number = 0,
-		private readonly _bearingY: number = 0,
-	) {}
+		bitmap: Bitmap | null,
+		bearingX: number = 0,
+		bearingY: number = 0,
+		parent: BitmapBuilder | null = null,
+		op: BuilderOp | null = null,
+	) {
+		this._bitmap = bitmap;
+		this._bearingX = bearingX;
+		this._bearingY = bearingY;
+		this._parent = parent;
+		this._op = op;
+	}
+
+	/** Record `op` on top of this builder */
+	private _then(op: BuilderOp): BitmapBuilder {
+		return new BitmapBuilder(null, 0, 0, this, op);
+	}
+
+	/**
+	 * Run the pending chain back to the nearest resolved ancestor and cache
+	 * the result.
+	 */
+	private _resolve(): Bitmap {
+		if (this._bitmap) return this._bitmap;
+
+		const ops: BuilderOp[] = [];
+		let node: BitmapBuilder = this;
+		while (!node._bitmap) {
+			ops.push(node._op!);
+			node = node._parent!;
+		}
+		ops.reverse();
+
+		const state: ChainState = {
+			bitmap: node._bitmap,
+			bearingX: node._bearingX,
+			bearingY: node._bearingY,
+			owned: false,
+			spare: null,
+		};
+		runChain(state, ops);
+
+		this._bitmap = state.bitmap;
+		this._bearingX = state.bearingX;
+		this._bearingY = state.bearingY;
+		this._parent = null;
+		this._op = null;
+		return state.bitmap;
+	}
+
+	/**
+	 * Operand accessor for compositing ops. Builders resolve at execution
+	 * time; a Bitmap is snapshotted now.
+	 */
+	private static _operand(other: BitmapBuilder | Bitmap): () => Bitmap {
+		if (other instanceof BitmapBuilder) return () => other._resolve();
+		if (!(other?.buffer instanceof Uint8Array)) {
+			throw new TypeError("Compositing operand must be a Bitmap or builder");
+		}
+		const snapshot = copyBitmap(other);
+		return () => snapshot;
+	}
 
 	// === Static Factory Methods ===
 
@@ -134,40 +249,45 @@ export class BitmapBuilder {
 	 * Gaussian blur
 	 */
 	blur(radius: number): BitmapBuilder {
-		const blurred = gaussianBlur(copyBitmap(this._bitmap), radius);
-		return new BitmapBuilder(blurred, this._bearingX, this._bearingY);
+		return this._then({
+			kind: "effect",
+			inPlace: true,
+			run: (bitmap) => gaussianBlur(bitmap, radius),
+		});
 	}
 
 	/**
 	 * Box blur (faster, less smooth)
 	 */
 	boxBlur(radius: number): BitmapBuilder {
-		const blurred = boxBlur(copyBitmap(this._bitmap), radius);
-		return new BitmapBuilder(blurred, this._bearingX, this._bearingY);
+		return this._then({
+			kind: "effect",
+			inPlace: true,
+			run: (bitmap) => boxBlur(bitmap, radius),
+		});
 	}
 
 	/**
 	 * Cascade blur (fast for large radii, O(1) per pixel)
 	 */
 	cascadeBlur(radiusX: number, radiusY?: number): BitmapBuilder {
-		const blurred = cascadeBlur(
-			copyBitmap(this._bitmap),
-			radiusX,
-			radiusY ?? radiusX,
-		);
-		return new BitmapBuilder(blurred, this._bearingX, this._bearingY);
+		// RGBA falls back to the in-place Gaussian
+		return this._then({
+			kind: "effect",
+			inPlace: true,
+			run: (bitmap) => cascadeBlur(bitmap, radiusX, radiusY ?? radiusX),
+		});
 	}
 
 	/**
 	 * Adaptive blur (auto-selects best algorithm based on radius)
 	 */
 	adaptiveBlur(radiusX: number, radiusY?: number): BitmapBuilder {
-		const blurred = adaptiveBlur(
-			copyBitmap(this._bitmap),
-			radiusX,
-			radiusY ?? radiusX,
-		);
-		return new BitmapBuilder(blurred, this._bearingX, this._bearingY);
+		return this._then({
+			kind: "effect",
+			inPlace: true,
+			run: (bitmap) => adaptiveBlur(bitmap, radiusX, radiusY ?? radiusX),
+		});
 	}
 
 	/**
@@ -175,8 +295,11 @@ export class BitmapBuilder {
 	 * Recommended for large radii (> 3 pixels)
 	 */
 	fastBlur(radius: number): BitmapBuilder {
-		const blurred = fastGaussianBlur(copyBitmap(this._bitmap), radius);
-		return new BitmapBuilder(blurred, this._bearingX, this._bearingY);
+		return this._then({
+			kind: "effect",
+			inPlace: true,
+			run: (bitmap) => fastGaussianBlur(bitmap, radius),
+		});
 	}
 
 	// === Transform Effects ===
@@ -185,26 +308,29 @@ export class BitmapBuilder {
 	 * Embolden (dilate) bitmap
 	 */
 	embolden(xStrength: number, yStrength?: number): BitmapBuilder {
-		const emboldened = emboldenBitmap(
-			this._bitmap,
-			xStrength,
-			yStrength ?? xStrength,
-		);
-		return new BitmapBuilder(emboldened, this._bearingX, this._bearingY);
+		return this._then({
+			kind: "effect",
+			inPlace: false,
+			run: (bitmap) =>
+				emboldenBitmap(bitmap, xStrength, yStrength ?? xStrength),
+		});
 	}
 
 	/**
 	 * Embolden bitmap and update bearing to avoid clipping
 	 */
 	emboldenWithBearing(xStrength: number, yStrength?: number): BitmapBuilder {
-		const result = emboldenBitmapWithBearing(
-			this._bitmap,
-			this._bearingX,
-			this._bearingY,
-			xStrength,
-			yStrength ?? xStrength,
-		);
-		return new BitmapBuilder(result.bitmap, result.bearingX, result.bearingY);
+		return this._then({
+			kind: "place",
+			run: (input) =>
+				emboldenBitmapWithBearing(
+					input.bitmap,
+					input.bearingX,
+					input.bearingY,
+					xStrength,
+					yStrength ?? xStrength,
+				),
+		});
 	}
 
 	/**
@@ -214,13 +340,16 @@ export class BitmapBuilder {
 		matrix: Matrix2D,
 		options?: { offsetX26?: number; offsetY26?: number },
 	): BitmapBuilder {
-		const result = transformBitmap2D(this._bitmap, matrix, {
-			bearingX: this._bearingX,
-			bearingY: this._bearingY,
-			offsetX26: options?.offsetX26,
-			offsetY26: options?.offsetY26,
+		return this._then({
+			kind: "place",
+			run: (input) =>
+				transformBitmap2D(input.bitmap, matrix, {
+					bearingX: input.bearingX,
+					bearingY: input.bearingY,
+					offsetX26: options?.offsetX26,
+					offsetY26: options?.offsetY26,
+				}),
 		});
-		return new BitmapBuilder(result.bitmap, result.bearingX, result.bearingY);
 	}
 
 	/**
@@ -230,13 +359,16 @@ export class BitmapBuilder {
 		matrix: Matrix3x3,
 		options?: { offsetX26?: number; offsetY26?: number },
 	): BitmapBuilder {
-		const result = transformBitmap3D(this._bitmap, matrix, {
-			bearingX: this._bearingX,
-			bearingY: this._bearingY,
-			offsetX26: options?.offsetX26,
-			offsetY26: options?.offsetY26,
+		return this._then({
+			kind: "place",
+			run: (input) =>
+				transformBitmap3D(input.bitmap, matrix, {
+					bearingX: input.bearingX,
+					bearingY: input.bearingY,
+					offsetX26: options?.offsetX26,
+					offsetY26: options?.offsetY26,
+				}),
 		});
-		return new BitmapBuilder(result.bitmap, result.bearingX, result.bearingY);
 	}
 
 	/**
@@ -246,13 +378,16 @@ export class BitmapBuilder {
 		amount: number,
 		options?: { offsetX26?: number; offsetY26?: number },
 	): BitmapBuilder {
-		const result = shearBitmapX(this._bitmap, amount, {
-			bearingX: this._bearingX,
-			bearingY: this._bearingY,
-			offsetX26: options?.offsetX26,
-			offsetY26: options?.offsetY26,
+		return this._then({
+			kind: "place",
+			run: (input) =>
+				shearBitmapX(input.bitmap, amount, {
+					bearingX: input.bearingX,
+					bearingY: input.bearingY,
+					offsetX26: options?.offsetX26,
+					offsetY26: options?.offsetY26,
+				}),
 		});
-		return new BitmapBuilder(result.bitmap, result.bearingX, result.bearingY);
 	}
 
 	/**
@@ -262,37 +397,45 @@ export class BitmapBuilder {
 		amount: number,
 		options?: { offsetX26?: number; offsetY26?: number },
 	): BitmapBuilder {
-		const result = shearBitmapY(this._bitmap, amount, {
-			bearingX: this._bearingX,
-			bearingY: this._bearingY,
-			offsetX26: options?.offsetX26,
-			offsetY26: options?.offsetY26,
+		return this._then({
+			kind: "place",
+			run: (input) =>
+				shearBitmapY(input.bitmap, amount, {
+					bearingX: input.bearingX,
+					bearingY: input.bearingY,
+					offsetX26: options?.offsetX26,
+					offsetY26: options?.offsetY26,
+				}),
 		});
-		return new BitmapBuilder(result.bitmap, result.bearingX, result.bearingY);
 	}
 
 	/**
 	 * Shift bitmap position
 	 */
 	shift(dx: number, dy: number): BitmapBuilder {
-		const shifted = shiftBitmap(this._bitmap, dx, dy);
-		return new BitmapBuilder(shifted, this._bearingX + dx, this._bearingY - dy);
+		return this._then({ kind: "shift", dx, dy });
 	}
 
 	/**
 	 * Resize with nearest-neighbor interpolation
 	 */
 	resize(width: number, height: number): BitmapBuilder {
-		const resized = resizeBitmap(this._bitmap, width, height);
-		return new BitmapBuilder(resized, this._bearingX, this._bearingY);
+		return this._then({
+			kind: "effect",
+			inPlace: false,
+			run: (bitmap) => resizeBitmap(bitmap, width, height),
+		});
 	}
 
 	/**
 	 * Resize with bilinear interpolation (smoother, better for downsampling)
 	 */
 	resizeBilinear(width: number, height: number): BitmapBuilder {
-		const resized = resizeBitmapBilinear(this._bitmap, width, height);
-		return new BitmapBuilder(resized, this._bearingX, this._bearingY);
+		return this._then({
+			kind: "effect",
+			inPlace: false,
+			run: (bitmap) => resizeBitmapBilinear(bitmap, width, height),
+		});
 	}
 
 	/**
@@ -310,8 +453,7 @@ export class BitmapBuilder {
 		const t = top ?? leftOrAll;
 		const r = right ?? leftOrAll;
 		const b = bottom ?? leftOrAll;
-		const padded = padBitmap(this._bitmap, l, t, r, b);
-		return new BitmapBuilder(padded, this._bearingX - l, this._bearingY + t);
+		return this._then({ kind: "pad", left: l, top: t, right: r, bottom: b });
 	}
 
 	// === Metrics ===
@@ -320,7 +462,8 @@ export class BitmapBuilder {
 	 * Measure ascent/descent from bitmap coverage
 	 */
 	measure(): { ascent: number; descent: number } {
-		return measureRasterGlyph(this._bitmap, this._bearingX, this._bearingY);
+		const bitmap = this._resolve();
+		return measureRasterGlyph(bitmap, this._bearingX, this._bearingY);
 	}
 
 	/**
@@ -335,9 +478,10 @@ export class BitmapBuilder {
 		descent: number;
 	} {
 		const { ascent, descent } = this.measure();
+		const bitmap = this._resolve();
 		return {
-			width: this._bitmap.width,
-			height: this._bitmap.rows,
+			width: bitmap.width,
+			height: bitmap.rows,
 			bearingX: this._bearingX,
 			bearingY: this._bearingY,
 			ascent,
@@ -380,10 +524,14 @@ export class BitmapBuilder {
 		y: number,
 		opacity: number = 1,
 	): BitmapBuilder {
-		const src = other instanceof BitmapBuilder ? other._bitmap : other;
-		const dst = copyBitmap(this._bitmap);
-		blendBitmap(dst, src, x, y, opacity);
-		return new BitmapBuilder(dst, this._bearingX, this._bearingY);
+		return this._then({
+			kind: "blend",
+			mode: "blend",
+			other: BitmapBuilder._operand(other),
+			x,
+			y,
+			opacity,
+		});
 	}
 
 	/**
@@ -394,10 +542,14 @@ export class BitmapBuilder {
 		x: number = 0,
 		y: number = 0,
 	): BitmapBuilder {
-		const src = other instanceof BitmapBuilder ? other._bitmap : other;
-		const dst = copyBitmap(this._bitmap);
-		compositeBitmaps(dst, src, x, y);
-		return new BitmapBuilder(dst, this._bearingX, this._bearingY);
+		return this._then({
+			kind: "blend",
+			mode: "composite",
+			other: BitmapBuilder._operand(other),
+			x,
+			y,
+			opacity: 1,
+		});
 	}
 
 	/**
@@ -408,10 +560,14 @@ export class BitmapBuilder {
 		x: number = 0,
 		y: number = 0,
 	): BitmapBuilder {
-		const src = other instanceof BitmapBuilder ? other._bitmap : other;
-		const dst = copyBitmap(this._bitmap);
-		addBitmaps(dst, src, x, y);
-		return new BitmapBuilder(dst, this._bearingX, this._bearingY);
+		return this._then({
+			kind: "blend",
+			mode: "add",
+			other: BitmapBuilder._operand(other),
+			x,
+			y,
+			opacity: 1,
+		});
 	}
 
 	/**
@@ -422,10 +578,14 @@ export class BitmapBuilder {
 		x: number = 0,
 		y: number = 0,
 	): BitmapBuilder {
-		const src = other instanceof BitmapBuilder ? other._bitmap : other;
-		const dst = copyBitmap(this._bitmap);
-		subBitmaps(dst, src, x, y);
-		return new BitmapBuilder(dst, this._bearingX, this._bearingY);
+		return this._then({
+			kind: "blend",
+			mode: "sub",
+			other: BitmapBuilder._operand(other),
+			x,
+			y,
+			opacity: 1,
+		});
 	}
 
 	/**
@@ -436,10 +596,14 @@ export class BitmapBuilder {
 		x: number = 0,
 		y: number = 0,
 	): BitmapBuilder {
-		const src = other instanceof BitmapBuilder ? other._bitmap : other;
-		const dst = copyBitmap(this._bitmap);
-		mulBitmaps(dst, src, x, y);
-		return new BitmapBuilder(dst, this._bearingX, this._bearingY);
+		return this._then({
+			kind: "blend",
+			mode: "mul",
+			other: BitmapBuilder._operand(other),
+			x,
+			y,
+			opacity: 1,
+		});
 	}
 
 	/**
@@ -450,10 +614,14 @@ export class BitmapBuilder {
 		x: number = 0,
 		y: number = 0,
 	): BitmapBuilder {
-		const src = other instanceof BitmapBuilder ? other._bitmap : other;
-		const dst = copyBitmap(this._bitmap);
-		maxBitmaps(dst, src, x, y);
-		return new BitmapBuilder(dst, this._bearingX, this._bearingY);
+		return this._then({
+			kind: "blend",
+			mode: "max",
+			other: BitmapBuilder._operand(other),
+			x,
+			y,
+			opacity: 1,
+		});
 	}
 
 	// === Conversion ===
@@ -462,8 +630,11 @@ export class BitmapBuilder {
 	 * Convert to different pixel mode
 	 */
 	convert(targetMode: PixelMode): BitmapBuilder {
-		const converted = convertBitmap(this._bitmap, targetMode);
-		return new BitmapBuilder(converted, this._bearingX, this._bearingY);
+		return this._then({
+			kind: "effect",
+			inPlace: false,
+			run: (bitmap) => convertBitmap(bitmap, targetMode),
+		});
 	}
 
 	// === Output ===
@@ -472,29 +643,30 @@ export class BitmapBuilder {
 	 * Get RGBA pixel array (for canvas ImageData, WebGL textures)
 	 */
 	toRGBA(): Uint8Array {
-		return bitmapToRGBA(this._bitmap);
+		return bitmapToRGBA(this._resolve());
 	}
 
 	/**
 	 * Get grayscale array
 	 */
 	toGray(): Uint8Array {
-		return bitmapToGray(this._bitmap);
+		return bitmapToGray(this._resolve());
 	}
 
 	/**
 	 * Get raw bitmap (cloned)
 	 */
 	toBitmap(): Bitmap {
-		return copyBitmap(this._bitmap);
+		return copyBitmap(this._resolve());
 	}
 
 	/**
 	 * Get bitmap with bearing info
 	 */
 	toRasterizedGlyph(): RasterizedGlyph {
+		const bitmap = this._resolve();
 		return {
-			bitmap: copyBitmap(this._bitmap),
+			bitmap: copyBitmap(bitmap),
 			bearingX: this._bearingX,
 			bearingY: this._bearingY,
 		};
@@ -506,8 +678,9 @@ export class BitmapBuilder {
 	 * afterwards. Zero-copy counterpart of toRasterizedGlyph for hot paths.
 	 */
 	intoRasterizedGlyph(): RasterizedGlyph {
+		const bitmap = this._resolve();
 		return {
-			bitmap: this._bitmap,
+			bitmap,
 			bearingX: this._bearingX,
 			bearingY: this._bearingY,
 		};
@@ -518,7 +691,7 @@ export class BitmapBuilder {
 	 */
 	clone(): BitmapBuilder {
 		return new BitmapBuilder(
-			copyBitmap(this._bitmap),
+			copyBitmap(this._resolve()),
 			this._bearingX,
 			this._bearingY,
 		);
@@ -530,27 +703,28 @@ export class BitmapBuilder {
 	 * Get bitmap width
 	 */
 	get width(): number {
-		return this._bitmap.width;
+		return this._resolve().width;
 	}
 
 	/**
 	 * Get bitmap height (rows)
 	 */
 	get height(): number {
-		return this._bitmap.rows;
+		return this._resolve().rows;
 	}
 
 	/**
 	 * Get pixel mode
 	 */
 	get pixelMode(): PixelMode {
-		return this._bitmap.pixelMode;
+		return this._resolve().pixelMode;
 	}
 
 	/**
 	 * Get horizontal bearing
 	 */
 	get bearingX(): number {
+		this._resolve();
 		return this._bearingX;
 	}
 
@@ -558,6 +732,225 @@ export class BitmapBuilder {
 	 * Get vertical bearing
 	 */
 	get bearingY(): number {
+		this._resolve();
 		return this._bearingY;
 	}
 }
+
+/**
+ * Execute recorded operations in order, updating `state`
+ */
+function runChain(state: ChainState, ops: BuilderOp[]): void {
+	let i = 0;
+	while (i < ops.length) {
+		const op = ops[i]!;
+		if (op.kind === "pad" || op.kind === "shift") {
+			let end = i + 1;
+			while (
+				end < ops.length &&
+				(ops[end]!.kind === "pad" || ops[end]!.kind === "shift")
+			) {
+				end++;
+			}
+			applyPlacement(state, ops, i, end);
+			i = end;
+			continue;
+		}
+
+		if (op.kind === "blend") {
+			// Pointwise run: one owned destination, every op applied in place
+			takeOwnership(state);
+			for (; i < ops.length && ops[i]!.kind === "blend"; i++) {
+				applyBlend(state.bitmap, ops[i] as BlendOp);
+			}
+			continue;
+		}
+
+		if (op.kind === "effect") {
+			if (op.inPlace) takeOwnership(state);
+			replaceBitmap(state, op.run(state.bitmap));
+		} else {
+			const placed = op.run(state);
+			replaceBitmap(state, placed.bitmap);
+			state.bearingX = placed.bearingX;
+			state.bearingY = placed.bearingY;
+		}
+		i++;
+	}
+}
+
+type BlendOp = Extract<BuilderOp, { kind: "blend" }>;
+
+function applyBlend(dst: Bitmap, op: BlendOp): void {
+	const src = op.other();
+	switch (op.mode) {
+		case "blend":
+			blendBitmap(dst, src, op.x, op.y, op.opacity);
+			break;
+		case "composite":
+			compositeBitmaps(dst, src, op.x, op.y);
+			break;
+		case "add":
+			addBitmaps(dst, src, op.x, op.y);
+			break;
+		case "sub":
+			subBitmaps(dst, src, op.x, op.y);
+			break;
+		case "mul":
+			mulBitmaps(dst, src, op.x, op.y);
+			break;
+		case "max":
+			maxBitmaps(dst, src, op.x, op.y);
+			break;
+	}
+}
+
+/** Make the current bitmap safe to modify in place, copying at most once */
+function takeOwnership(state: ChainState): void {
+	if (state.owned) return;
+	const src = state.bitmap;
+	const spare = takeSpare(state, src.width, src.rows, src.pixelMode);
+	if (spare && spare.pitch === src.pitch) {
+		spare.buffer.set(src.buffer);
+		spare.numGrays = src.numGrays;
+		state.bitmap = spare;
+	} else {
+		state.bitmap = copyBitmap(src);
+	}
+	state.owned = true;
+}
+
+/** Install the result of an op, retiring the previous bitmap as scratch */
+function replaceBitmap(state: ChainState, next: Bitmap): void {
+	if (next === state.bitmap) return;
+	if (state.owned) state.spare = state.bitmap;
+	state.bitmap = next;
+	state.owned = true;
+}
+
+/** Take the spare bitmap if it has the requested shape */
+function takeSpare(
+	state: ChainState,
+	width: number,
+	rows: number,
+	pixelMode: PixelMode,
+): Bitmap | null {
+	const spare = state.spare;
+	if (
+		!spare ||
+		spare.width !== width ||
+		spare.rows !== rows ||
+		spare.pixelMode !== pixelMode
+	) {
+		return null;
+	}
+	state.spare = null;
+	return spare;
+}
+
+/**
+ * Apply a run of pad/shift ops as one window copy: the output canvas grows
+ * by the pads, and a single rectangle of source rows lands at the combined
+ * offset. Falls back to the individual ops where that shortcut does not
+ * reproduce them (Mono/RGBA, fractional shifts, negative pads).
+ */
+function applyPlacement(
+	state: ChainState,
+	ops: BuilderOp[],
+	start: number,
+	end: number,
+): void {
+	const src = state.bitmap;
+	const mode = src.pixelMode;
+	let fusable =
+		(mode === PixelMode.Gray ||
+			mode === PixelMode.LCD ||
+			mode === PixelMode.LCD_V) &&
+		src.pitch > 0;
+	for (let i = start; fusable && i < end; i++) {
+		const op = ops[i]!;
+		if (op.kind === "pad") {
+			fusable =
+				Number.isInteger(op.left) &&
+				Number.isInteger(op.top) &&
+				Number.isInteger(op.right) &&
+				Number.isInteger(op.bottom) &&
+				op.left >= 0 &&
+				op.top >= 0 &&
+				op.right >= 0 &&
+				op.bottom >= 0;
+		} else if (op.kind === "shift") {
+			fusable = Number.isInteger(op.dx) && Number.isInteger(op.dy);
+		}
+	}
+
+	if (!fusable) {
+		for (let i = start; i < end; i++) {
+			const op = ops[i]!;
+			if (op.kind === "pad") {
+				replaceBitmap(
+					state,
+					padBitmap(state.bitmap, op.left, op.top, op.right, op.bottom),
+				);
+				state.bearingX -= op.left;
+				state.bearingY += op.top;
+			} else if (op.kind === "shift") {
+				replaceBitmap(state, shiftBitmap(state.bitmap, op.dx, op.dy));
+				state.bearingX += op.dx;
+				state.bearingY -= op.dy;
+			}
+		}
+		return;
+	}
+
+	// Canvas size, source offset within it, and the visible destination rect
+	let width = src.width;
+	let rows = src.rows;
+	let offX = 0;
+	let offY = 0;
+	let x0 = 0;
+	let y0 = 0;
+	let x1 = width;
+	let y1 = rows;
+	for (let i = start; i < end; i++) {
+		const op = ops[i]!;
+		if (op.kind === "pad") {
+			width += op.left + op.right;
+			rows += op.top + op.bottom;
+			offX += op.left;
+			offY += op.top;
+			x0 += op.left;
+			x1 += op.left;
+			y0 += op.top;
+			y1 += op.top;
+			state.bearingX -= op.left;
+			state.bearingY += op.top;
+		} else if (op.kind === "shift") {
+			offX += op.dx;
+			offY += op.dy;
+			x0 = Math.max(x0 + op.dx, 0);
+			x1 = Math.min(x1 + op.dx, width);
+			y0 = Math.max(y0 + op.dy, 0);
+			y1 = Math.min(y1 + op.dy, rows);
+			state.bearingX += op.dx;
+			state.bearingY -= op.dy;
+		}
+	}
+
+	let out = takeSpare(state, width, rows, mode);
+	if (out) out.buffer.fill(0);
+	else out = createBitmap(width, rows, mode);
+
+	if (x1 > x0) {
+		const bpp = mode === PixelMode.Gray ? 1 : 3;
+		const rowBytes = (x1 - x0) * bpp;
+		for (let y = y0; y < y1; y++) {
+			const from = (y - offY) * src.pitch + (x0 - offX) * bpp;
+			out.buffer.set(
+				src.buffer.subarray(from, from + rowBytes),
+				y * out.pitch + x0 * bpp,
+			);
+		}
+	}
+	replaceBitmap(state, out);
+}
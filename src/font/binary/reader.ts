@@ -22,7 +22,8 @@ export class Reader {
 	private pos: number;
 
 	constructor(buffer: ArrayBuffer | DataView, offset = 0, length?: number) {
-		if (buffer instanceof ArrayBuffer) {
+		// Not `instanceof ArrayBuffer`: a SharedArrayBuffer works here too
+		if (!(buffer instanceof DataView)) {
 			this.data = new DataView(buffer);
 			this.start = offset;
 			this.end = length !== undefined ? offset + length : buffer.byteLength;
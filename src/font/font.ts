@@ -20,6 +20,39 @@ function isWoff(buffer: ArrayBuffer): boolean {
 	return view.getUint32(0, false) === WOFF_MAGIC;
 }
 
+/**
+ * The ArrayBuffer behind `bytes`, copied only if it has other data too.
+ * Mappings and Node's readFile results span their whole buffer, so this
+ * normally returns it as is; a view into a shared or pooled buffer (e.g. a
+ * small result concatenated from a pipe) costs one copy of its bytes.
+ */
+function ownBuffer(bytes: Uint8Array): ArrayBuffer {
+	const buffer = bytes.buffer as ArrayBuffer;
+	if (bytes.byteOffset === 0 && bytes.byteLength === buffer.byteLength) {
+		return buffer;
+	}
+	return buffer.slice(bytes.byteOffset, bytes.byteOffset + bytes.byteLength);
+}
+
+/**
+ * Memory-map a font file under Bun, so every worker and process loading it
+ * shares the page cache instead of holding its own copy. Falls back to
+ * reading the file (Node, or files that cannot be mapped): the whole file is
+ * then read onto the heap, one private copy per load.
+ */
+async function mapFontFile(path: string): Promise<ArrayBuffer> {
+	if (typeof Bun !== "undefined") {
+		try {
+			return ownBuffer(Bun.mmap(path, { shared: false }));
+		} catch {
+			// Empty files, pipes and some filesystems cannot be mapped
+			return Bun.file(path).arrayBuffer();
+		}
+	}
+	const { readFile } = await import("node:fs/promises");
+	return ownBuffer(await readFile(path));
+}
+
 import { type AvarTable, parseAvar } from "./tables/avar.ts";
 import { type BaseTable, parseBase } from "./tables/base.ts";
 import {
@@ -293,6 +326,21 @@ export class Font {
 		return Font.loadAsync(buffer, options);
 	}
 
+	/**
+	 * Load font from file path (Bun and Node, supports WOFF2). Under Bun the
+	 * file is memory-mapped: tables are read straight from the mapping, and
+	 * workers loading the same file share its pages instead of each holding
+	 * a copy. Under Node, or when mapping fails, the whole file is read into
+	 * a heap buffer instead: file-sized memory per load, nothing shared.
+	 * The file must not be truncated while the font is in use.
+	 */
+	static async loadFile(
+		path: string,
+		options?: FontLoadOptions,
+	): Promise<Font> {
+		return Font.loadAsync(await mapFontFile(path), options);
+	}
+
 	/** Create a TTC collection helper if buffer is a TrueType Collection */
 	static collection(buffer: ArrayBuffer): FontCollection | null {
 		if (!isTtc(buffer)) return null;
@@ -20,6 +20,8 @@ export interface LigatureCaret {
 export interface MarkGlyphSets {
 	/** Check if glyph is in mark set */
 	has(setIndex: number, glyphId: GlyphId): boolean;
+	/** One bitset per set: bit (g & 31) of word (g >> 5) marks glyph g */
+	bitsets: Uint32Array[];
 }
 
 /** Glyph Definition table */
@@ -38,6 +40,12 @@ export interface GdefTable {
 	/** Mark attachment class definitions */
 	markAttachClassDef: ClassDef;
 
+	/** glyphClassDef as a dense array by glyph ID; read with classAt() */
+	glyphClasses: Uint8Array;
+
+	/** markAttachClassDef as a dense array by glyph ID */
+	markAttachClasses: Uint8Array;
+
 	/** Mark glyph sets (version 1.2+) */
 	markGlyphSets: MarkGlyphSets | null;
 }
@@ -88,6 +96,8 @@ export function parseGdef(reader: Reader): GdefTable {
 		attachList,
 		ligCaretList,
 		markAttachClassDef,
+		glyphClasses: glyphClassDef.toUint8Array(),
+		markAttachClasses: markAttachClassDef.toUint8Array(),
 		markGlyphSets,
 	};
 }
@@ -213,17 +223,17 @@ export function parseMarkGlyphSets(reader: Reader): MarkGlyphSets {
 	const coverageOffsets = reader.uint32Array(markSetCount);
 
 	// Parse each mark set coverage
-	const markSets: Set<GlyphId>[] = [];
+	const glyphSets: GlyphId[][] = [];
 	for (let i = 0; i < coverageOffsets.length; i++) {
 		const offset = coverageOffsets[i]!;
 		const coverageReader = reader.sliceFrom(offset);
 		const coverageFormat = coverageReader.uint16();
 
-		const glyphSet = new Set<GlyphId>();
+		const glyphSet: GlyphId[] = [];
 		if (coverageFormat === 1) {
 			const count = coverageReader.uint16();
 			for (let j = 0; j < count; j++) {
-				glyphSet.add(coverageReader.uint16());
+				glyphSet.push(coverageReader.uint16());
 			}
 		} else if (coverageFormat === 2) {
 			const rangeCount = coverageReader.uint16();
@@ -232,29 +242,55 @@ export function parseMarkGlyphSets(reader: Reader): MarkGlyphSets {
 				const end = coverageReader.uint16();
 				coverageReader.skip(2);
 				for (let g = start; g <= end; g++) {
-					glyphSet.add(g);
+					glyphSet.push(g);
 				}
 			}
 		}
-		markSets.push(glyphSet);
+		glyphSets.push(glyphSet);
+	}
+
+	const bitsets: Uint32Array[] = [];
+	for (let i = 0; i < glyphSets.length; i++) {
+		const glyphSet = glyphSets[i]!;
+		let maxGlyph = -1;
+		for (let j = 0; j < glyphSet.length; j++) {
+			if (glyphSet[j]! > maxGlyph) maxGlyph = glyphSet[j]!;
+		}
+		const bits = new Uint32Array((maxGlyph >> 5) + 1);
+		for (let j = 0; j < glyphSet.length; j++) {
+			const g = glyphSet[j]!;
+			bits[g >> 5] |= 1 << (g & 31);
+		}
+		bitsets.push(bits);
 	}
 
 	return {
 		has(setIndex: number, glyphId: GlyphId): boolean {
-			const set = markSets[setIndex];
-			return set ? set.has(glyphId) : false;
+			const bits = bitsets[setIndex];
+			return bits ? inBitset(bits, glyphId) : false;
 		},
+		bitsets,
 	};
 }
 
+/** Class at glyphId in a dense class array (0 past its end) */
+export function classAt(classes: Uint8Array, glyphId: GlyphId): number {
+	return glyphId < classes.length ? classes[glyphId]! : 0;
+}
+
+/** Whether glyphId is in a mark set bitset */
+export function inBitset(bits: Uint32Array, glyphId: GlyphId): boolean {
+	const word = glyphId >> 5;
+	return word < bits.length && (bits[word]! & (1 << (glyphId & 31))) !== 0;
+}
+
 /** Get glyph class from GDEF */
 export function getGlyphClass(
 	gdef: GdefTable | null,
 	glyphId: GlyphId,
 ): GlyphClass | 0 {
 	if (!gdef) return 0;
-	const cls = gdef.glyphClassDef.get(glyphId);
-	return cls as GlyphClass | 0;
+	return classAt(gdef.glyphClasses, glyphId) as GlyphClass | 0;
 }
 
 /** Check if glyph is a base glyph */
@@ -1,3 +1,10 @@
+import {
+	contoursBytes,
+	OBJECT_BYTES,
+	OwnerCache,
+	SLOT_BYTES,
+} from "../../cache.ts";
+import { incrementCounter, instrumenting } from "../../instrument.ts";
 import type { GlyphId, int16, uint8, uint16 } from "../../types.ts";
 import type { Reader } from "../binary/reader.ts";
 import type { GvarTable, PointDelta } from "./gvar.ts";
@@ -102,18 +109,34 @@ export function parseGlyf(reader: Reader): GlyfTable {
 	return { reader };
 }
 
-const glyphCache = new WeakMap<GlyfTable, Map<GlyphId, Glyph>>();
-const GLYPH_CACHE_SIZE = 512;
-
-function getGlyphCache(glyf: GlyfTable): Map<GlyphId, Glyph> {
-	let cache = glyphCache.get(glyf);
-	if (!cache) {
-		cache = new Map();
-		glyphCache.set(glyf, cache);
+function glyphBytes(glyph: Glyph): number {
+	switch (glyph.type) {
+		case "empty":
+			return OBJECT_BYTES;
+		case "simple":
+			return (
+				OBJECT_BYTES +
+				8 * SLOT_BYTES +
+				contoursBytes(glyph.contours) +
+				glyph.instructions.byteLength
+			);
+		case "composite":
+			return (
+				OBJECT_BYTES +
+				8 * SLOT_BYTES +
+				glyph.components.length * (OBJECT_BYTES + 8 * SLOT_BYTES) +
+				glyph.instructions.byteLength
+			);
 	}
-	return cache;
 }
 
+/** Parsed glyphs, oldest evicted first (per glyf table) */
+const glyphCache = new OwnerCache<GlyfTable, GlyphId, Glyph>("glyf.glyph", {
+	sizeOf: glyphBytes,
+	maxEntries: 512,
+	priority: 2,
+});
+
 /**
  * Parse a single glyph from the glyf table
  */
@@ -122,28 +145,22 @@ export function parseGlyph(
 	loca: LocaTable,
 	glyphId: GlyphId,
 ): Glyph {
-	const cache = getGlyphCache(glyf);
-	const cached = cache.get(glyphId);
+	const cached = glyphCache.get(glyf, glyphId);
+	if (instrumenting) {
+		incrementCounter(cached ? "cache.glyph.hit" : "cache.glyph.miss");
+	}
 	if (cached !== undefined) return cached;
 
 	const location = getGlyphLocation(loca, glyphId);
 	if (!location) {
 		const emptyGlyph: EmptyGlyph = { type: "empty" };
-		if (cache.size >= GLYPH_CACHE_SIZE) {
-			const firstKey = cache.keys().next().value;
-			if (firstKey !== undefined) cache.delete(firstKey);
-		}
-		cache.set(glyphId, emptyGlyph);
+		glyphCache.set(glyf, glyphId, emptyGlyph);
 		return emptyGlyph;
 	}
 
 	const reader = glyf.reader.slice(location.offset, location.length);
 	const glyph = parseGlyphData(reader);
-	if (cache.size >= GLYPH_CACHE_SIZE) {
-		const firstKey = cache.keys().next().value;
-		if (firstKey !== undefined) cache.delete(firstKey);
-	}
-	cache.set(glyphId, glyph);
+	glyphCache.set(glyf, glyphId, glyph);
 	return glyph;
 }
 
@@ -527,14 +544,16 @@ export function flattenCompositeGlyph(
 	return result;
 }
 
-/** LRU cache for composite glyph contours (per glyf table) */
-const compositeCache = new WeakMap<GlyfTable, Map<GlyphId, Contour[]>>();
-const COMPOSITE_CACHE_SIZE = 256;
-const variationContourCache = new WeakMap<
-	GlyfTable,
-	Map<string, Map<GlyphId, Contour[]>>
->();
-const VARIATION_CONTOUR_CACHE_SIZE = 256;
+/** Flattened composite glyph contours, oldest evicted first (per glyf table) */
+const compositeCache = new OwnerCache<GlyfTable, GlyphId, Contour[]>(
+	"glyf.composite",
+	{ sizeOf: contoursBytes, maxEntries: 256, priority: 1 },
+);
+/** Contours with variations applied, keyed by axis coords and glyph ID */
+const variationContourCache = new OwnerCache<GlyfTable, string, Contour[]>(
+	"glyf.variationContours",
+	{ sizeOf: contoursBytes, maxEntries: 1024, priority: 1 },
+);
 
 function getAxisCoordsCacheKey(axisCoords: number[]): string {
 	let key = "";
@@ -545,33 +564,6 @@ function getAxisCoordsCacheKey(axisCoords: number[]): string {
 	return key;
 }
 
-function getCompositeCache(glyf: GlyfTable): Map<GlyphId, Contour[]> {
-	let cache = compositeCache.get(glyf);
-	if (!cache) {
-		cache = new Map();
-		compositeCache.set(glyf, cache);
-	}
-	return cache;
-}
-
-function getVariationContourCache(
-	glyf: GlyfTable,
-	axisCoords: number[],
-): Map<GlyphId, Contour[]> {
-	let byKey = variationContourCache.get(glyf);
-	if (!byKey) {
-		byKey = new Map();
-		variationContourCache.set(glyf, byKey);
-	}
-	const key = getAxisCoordsCacheKey(axisCoords);
-	let cache = byKey.get(key);
-	if (!cache) {
-		cache = new Map();
-		byKey.set(key, cache);
-	}
-	return cache;
-}
-
 /**
  * Get all contours for a glyph, flattening composites
  */
@@ -587,19 +579,12 @@ export function getGlyphContours(
 	} else if (glyph.type === "simple") {
 		return glyph.contours;
 	} else {
-		const cache = getCompositeCache(glyf);
 		// Check cache for composite glyphs using numeric key directly
-		const cached = cache.get(glyphId);
+		const cached = compositeCache.get(glyf, glyphId);
 		if (cached) return cached;
 
 		const result = flattenCompositeGlyph(glyf, loca, glyph);
-
-		// Cache result with LRU eviction
-		if (cache.size >= COMPOSITE_CACHE_SIZE) {
-			const firstKey = cache.keys().next().value;
-			if (firstKey !== undefined) cache.delete(firstKey);
-		}
-		cache.set(glyphId, result);
+		compositeCache.set(glyf, glyphId, result);
 
 		return result;
 	}
@@ -635,15 +620,10 @@ export function getGlyphContoursAndBounds(
 	}
 
 	// Composite glyph - check cache using numeric key directly
-	const cache = getCompositeCache(glyf);
-	let contours = cache.get(glyphId);
+	let contours = compositeCache.get(glyf, glyphId);
 	if (!contours) {
 		contours = flattenCompositeGlyph(glyf, loca, glyph);
-		if (cache.size >= COMPOSITE_CACHE_SIZE) {
-			const firstKey = cache.keys().next().value;
-			if (firstKey !== undefined) cache.delete(firstKey);
-		}
-		cache.set(glyphId, contours);
+		compositeCache.set(glyf, glyphId, contours);
 	}
 	if (contours.length === 0) {
 		return { contours, bounds: null };
@@ -1014,9 +994,12 @@ export function getGlyphContoursWithVariation(
 	glyphId: GlyphId,
 	axisCoords?: number[],
 ): Contour[] {
-	if (axisCoords && axisCoords.length > 0) {
-		const cache = getVariationContourCache(glyf, axisCoords);
-		const cached = cache.get(glyphId);
+	const cacheKey =
+		axisCoords && axisCoords.length > 0
+			? `${getAxisCoordsCacheKey(axisCoords)}:${glyphId}`
+			: null;
+	if (cacheKey !== null) {
+		const cached = variationContourCache.get(glyf, cacheKey);
 		if (cached !== undefined) return cached;
 	}
 
@@ -1061,13 +1044,8 @@ export function getGlyphContoursWithVariation(
 		contours = applyVariationDeltas(contours, deltas);
 	}
 
-	if (axisCoords && axisCoords.length > 0) {
-		const cache = getVariationContourCache(glyf, axisCoords);
-		if (cache.size >= VARIATION_CONTOUR_CACHE_SIZE) {
-			const firstKey = cache.keys().next().value;
-			if (firstKey !== undefined) cache.delete(firstKey);
-		}
-		cache.set(glyphId, contours);
+	if (cacheKey !== null) {
+		variationContourCache.set(glyf, cacheKey, contours);
 	}
 
 	return contours;
@@ -6,6 +6,7 @@ import {
 	type Coverage,
 	parseCoverageAt,
 } from "../../layout/structures/coverage.ts";
+import type { RuleIndexSlots } from "../../layout/structures/rule-index.ts";
 import type { GlyphId, uint16 } from "../../types.ts";
 import type { Reader } from "../binary/reader.ts";
 import type { GposLookup } from "./gpos.ts";
@@ -32,6 +33,8 @@ export interface ContextPosFormat1 {
 	format: 1;
 	coverage: Coverage;
 	ruleSets: (PosContextRule[] | null)[];
+	/** Rule set indexes, filled in by the shaper on first use */
+	ruleIndexes?: RuleIndexSlots<PosContextRule>;
 }
 
 export interface PosContextRule {
@@ -46,6 +49,8 @@ export interface ContextPosFormat2 {
 	coverage: Coverage;
 	classDef: ClassDef;
 	classRuleSets: (PosClassRule[] | null)[];
+	/** Rule set indexes, filled in by the shaper on first use */
+	ruleIndexes?: RuleIndexSlots<PosClassRule>;
 }
 
 export interface PosClassRule {
@@ -77,6 +82,8 @@ export interface ChainingContextPosFormat1 {
 	format: 1;
 	coverage: Coverage;
 	chainRuleSets: (PosChainRule[] | null)[];
+	/** Rule set indexes, filled in by the shaper on first use */
+	ruleIndexes?: RuleIndexSlots<PosChainRule>;
 }
 
 export interface PosChainRule {
@@ -94,6 +101,8 @@ export interface ChainingContextPosFormat2 {
 	inputClassDef: ClassDef;
 	lookaheadClassDef: ClassDef;
 	chainClassRuleSets: (PosChainClassRule[] | null)[];
+	/** Rule set indexes, filled in by the shaper on first use */
+	ruleIndexes?: RuleIndexSlots<PosChainClassRule>;
 }
 
 export interface PosChainClassRule {
@@ -1,3 +1,4 @@
+import { OBJECT_BYTES, SLOT_BYTES, WeakCache } from "../../cache.ts";
 import {
 	type ClassDef,
 	parseClassDefAt,
@@ -858,6 +859,277 @@ export function applyKerningDirect(
 	return false;
 }
 
+// Compiled pair kerning
+
+/**
+ * Largest class1Count * class2Count for which a PairPos format 2 subtable gets
+ * a dense class-pair matrix (2 bytes per cell). Larger subtables use a sparse
+ * map of their non-zero cells instead.
+ */
+export const MAX_DENSE_PAIR_CELLS = 1 << 16;
+
+/** Format 1 subtable flattened into typed arrays */
+export interface CompiledPairFormat1 {
+	format: 1;
+	coverage: Coverage;
+	/** Range of each pair set in the flat arrays, indexed by coverage index */
+	setStarts: Uint32Array;
+	/** Sorted second glyphs of every pair set, concatenated */
+	secondGlyphs: Uint16Array;
+	/** xAdvance applied to the first glyph */
+	advances1: Int16Array;
+	/** xAdvance applied to the second glyph, or null if always zero */
+	advances2: Int16Array | null;
+}
+
+/** Format 2 subtable as a class-pair matrix */
+export interface CompiledPairFormat2 {
+	format: 2;
+	coverage: Coverage;
+	classDef1: ClassDef;
+	classDef2: ClassDef;
+	class1Count: number;
+	class2Count: number;
+	/** Dense [class1][class2] xAdvance for the first glyph */
+	matrix1: Int16Array | null;
+	/** Dense [class1][class2] xAdvance for the second glyph */
+	matrix2: Int16Array | null;
+	/** Sparse fallback: class1 * class2Count + class2 -> xAdvance (first glyph) */
+	sparse1: Map<number, number> | null;
+	/** Sparse fallback for the second glyph */
+	sparse2: Map<number, number> | null;
+}
+
+export type CompiledPairSubtable = CompiledPairFormat1 | CompiledPairFormat2;
+
+/**
+ * PairPos lookup compiled for kerning: only the xAdvance of each value record
+ * is kept, in typed arrays instead of per-record objects.
+ */
+export interface PairKerning {
+	subtables: CompiledPairSubtable[];
+	/** True if the lookup's value records only ever touch xAdvance */
+	kerningOnly: boolean;
+}
+
+function pairKerningBytes(kerning: PairKerning): number {
+	let bytes = OBJECT_BYTES;
+	for (let i = 0; i < kerning.subtables.length; i++) {
+		const st = kerning.subtables[i]!;
+		bytes += 2 * OBJECT_BYTES;
+		if (st.format === 1) {
+			bytes +=
+				st.setStarts.byteLength +
+				st.secondGlyphs.byteLength +
+				st.advances1.byteLength +
+				(st.advances2?.byteLength ?? 0);
+		} else {
+			bytes +=
+				(st.matrix1?.byteLength ?? 0) +
+				(st.matrix2?.byteLength ?? 0) +
+				((st.sparse1?.size ?? 0) + (st.sparse2?.size ?? 0)) *
+					4 *
+					SLOT_BYTES;
+		}
+	}
+	return bytes;
+}
+
+/** Compiled kerning cache, built lazily per lookup */
+const pairKerningCache = new WeakCache<PairPosLookup, PairKerning>(
+	"gpos.pairKerning",
+	{ sizeOf: pairKerningBytes, priority: 3 },
+);
+
+const NON_KERNING_VALUE_FORMAT = ~ValueFormat.XAdvance & 0xffff;
+
+/**
+ * Check whether a PairPos lookup only adjusts xAdvance.
+ * Such lookups commute with each other and can be applied in a single pass.
+ */
+export function isKerningOnlyPairPos(lookup: PairPosLookup): boolean {
+	const subtables = lookup.subtables;
+	for (let i = 0; i < subtables.length; i++) {
+		const st = subtables[i]!;
+		if ((st.valueFormat1 | st.valueFormat2) & NON_KERNING_VALUE_FORMAT) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Get the compiled kerning form of a PairPos lookup, building it on first use.
+ */
+export function getPairKerning(lookup: PairPosLookup): PairKerning {
+	let kerning = pairKerningCache.get(lookup);
+	if (!kerning) {
+		const subtables: CompiledPairSubtable[] = [];
+		for (let i = 0; i < lookup.subtables.length; i++) {
+			const st = lookup.subtables[i]!;
+			subtables.push(
+				st.format === 1 ? compilePairFormat1(st) : compilePairFormat2(st),
+			);
+		}
+		kerning = { subtables, kerningOnly: isKerningOnlyPairPos(lookup) };
+		pairKerningCache.set(lookup, kerning);
+	}
+	return kerning;
+}
+
+function compilePairFormat1(subtable: PairPosFormat1): CompiledPairFormat1 {
+	const pairSets = subtable.pairSets;
+	const setStarts = new Uint32Array(pairSets.length + 1);
+	let total = 0;
+	for (let i = 0; i < pairSets.length; i++) {
+		setStarts[i] = total;
+		total += pairSets[i]!.pairValueRecords.length;
+	}
+	setStarts[pairSets.length] = total;
+
+	const secondGlyphs = new Uint16Array(total);
+	const advances1 = new Int16Array(total);
+	let advances2: Int16Array | null =
+		subtable.valueFormat2 & ValueFormat.XAdvance ? new Int16Array(total) : null;
+
+	let k = 0;
+	for (let i = 0; i < pairSets.length; i++) {
+		const records = pairSets[i]!.pairValueRecords;
+		for (let j = 0; j < records.length; j++, k++) {
+			const record = records[j]!;
+			secondGlyphs[k] = record.secondGlyph;
+			advances1[k] = record.value1.xAdvance ?? 0;
+			if (advances2) advances2[k] = record.value2.xAdvance ?? 0;
+		}
+	}
+	if (advances2 && !advances2.some((v) => v !== 0)) advances2 = null;
+
+	return {
+		format: 1,
+		coverage: subtable.coverage,
+		setStarts,
+		secondGlyphs,
+		advances1,
+		advances2,
+	};
+}
+
+function compilePairFormat2(subtable: PairPosFormat2): CompiledPairFormat2 {
+	const class1Records = subtable.class1Records;
+	const class1Count = class1Records.length;
+	const class2Count = subtable.class2Count;
+	const cells = class1Count * class2Count;
+	const hasAdvance2 = (subtable.valueFormat2 & ValueFormat.XAdvance) !== 0;
+
+	let matrix1: Int16Array | null = null;
+	let matrix2: Int16Array | null = null;
+	let sparse1: Map<number, number> | null = null;
+	let sparse2: Map<number, number> | null = null;
+
+	if (cells <= MAX_DENSE_PAIR_CELLS) {
+		matrix1 = new Int16Array(cells);
+		if (hasAdvance2) matrix2 = new Int16Array(cells);
+	} else {
+		sparse1 = new Map();
+		if (hasAdvance2) sparse2 = new Map();
+	}
+
+	let anyAdvance2 = false;
+	for (let c1 = 0; c1 < class1Count; c1++) {
+		const class2Records = class1Records[c1]!.class2Records;
+		const row = c1 * class2Count;
+		for (let c2 = 0; c2 < class2Count; c2++) {
+			const record = class2Records[c2];
+			if (!record) continue;
+			const adv1 = record.value1.xAdvance ?? 0;
+			const adv2 = record.value2.xAdvance ?? 0;
+			if (adv2 !== 0) anyAdvance2 = true;
+			if (matrix1) {
+				matrix1[row + c2] = adv1;
+				if (matrix2) matrix2[row + c2] = adv2;
+			} else {
+				if (adv1 !== 0) sparse1!.set(row + c2, adv1);
+				if (adv2 !== 0 && sparse2) sparse2.set(row + c2, adv2);
+			}
+		}
+	}
+	if (!anyAdvance2) {
+		matrix2 = null;
+		sparse2 = null;
+	}
+
+	return {
+		format: 2,
+		coverage: subtable.coverage,
+		classDef1: subtable.classDef1,
+		classDef2: subtable.classDef2,
+		class1Count,
+		class2Count,
+		matrix1,
+		matrix2,
+		sparse1,
+		sparse2,
+	};
+}
+
+/**
+ * Apply compiled kerning for one glyph pair.
+ * Same matching rules as applyKerningDirect: the first subtable that covers
+ * the pair wins. Returns true if a subtable matched.
+ */
+export function applyPairKerning(
+	kerning: PairKerning,
+	firstGlyph: GlyphId,
+	secondGlyph: GlyphId,
+	pos1: GlyphPosition,
+	pos2: GlyphPosition,
+): boolean {
+	const subtables = kerning.subtables;
+	for (let i = 0; i < subtables.length; i++) {
+		const st = subtables[i]!;
+		const coverageIndex = st.coverage.get(firstGlyph);
+		if (coverageIndex === null) continue;
+
+		if (st.format === 1) {
+			const setStarts = st.setStarts;
+			if (coverageIndex >= setStarts.length - 1) continue;
+			const glyphs = st.secondGlyphs;
+			let low = setStarts[coverageIndex]!;
+			let high = setStarts[coverageIndex + 1]! - 1;
+			while (low <= high) {
+				const mid = (low + high) >>> 1;
+				const sg = glyphs[mid]!;
+				if (sg < secondGlyph) {
+					low = mid + 1;
+				} else if (sg > secondGlyph) {
+					high = mid - 1;
+				} else {
+					pos1.xAdvance += st.advances1[mid]!;
+					if (st.advances2) pos2.xAdvance += st.advances2[mid]!;
+					return true;
+				}
+			}
+		} else {
+			const class1 = st.classDef1.get(firstGlyph);
+			if (class1 >= st.class1Count) continue;
+			const class2 = st.classDef2.get(secondGlyph);
+			if (class2 >= st.class2Count) continue;
+
+			const cell = class1 * st.class2Count + class2;
+			if (st.matrix1) {
+				pos1.xAdvance += st.matrix1[cell]!;
+				if (st.matrix2) pos2.xAdvance += st.matrix2[cell]!;
+			} else {
+				pos1.xAdvance += st.sparse1!.get(cell) ?? 0;
+				if (st.sparse2) pos2.xAdvance += st.sparse2.get(cell) ?? 0;
+			}
+			return true;
+		}
+	}
+
+	return false;
+}
+
 // Export internal functions for testing
 export const __testing = {
 	parseGposLookup,
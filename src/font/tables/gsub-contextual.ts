@@ -6,6 +6,7 @@ import {
 	type Coverage,
 	parseCoverageAt,
 } from "../../layout/structures/coverage.ts";
+import type { RuleIndexSlots } from "../../layout/structures/rule-index.ts";
 import type { GlyphId, uint16 } from "../../types.ts";
 import type { Reader } from "../binary/reader.ts";
 import type { GsubLookup } from "./gsub.ts";
@@ -32,6 +33,8 @@ export interface ContextSubstFormat1 {
 	format: 1;
 	coverage: Coverage;
 	ruleSets: (ContextRule[] | null)[];
+	/** Rule set indexes, filled in by the shaper on first use */
+	ruleIndexes?: RuleIndexSlots<ContextRule>;
 }
 
 export interface ContextRule {
@@ -46,6 +49,8 @@ export interface ContextSubstFormat2 {
 	coverage: Coverage;
 	classDef: ClassDef;
 	classRuleSets: (ClassRule[] | null)[];
+	/** Rule set indexes, filled in by the shaper on first use */
+	ruleIndexes?: RuleIndexSlots<ClassRule>;
 }
 
 export interface ClassRule {
@@ -77,6 +82,8 @@ export interface ChainingContextFormat1 {
 	format: 1;
 	coverage: Coverage;
 	chainRuleSets: (ChainRule[] | null)[];
+	/** Rule set indexes, filled in by the shaper on first use */
+	ruleIndexes?: RuleIndexSlots<ChainRule>;
 }
 
 export interface ChainRule {
@@ -94,6 +101,8 @@ export interface ChainingContextFormat2 {
 	inputClassDef: ClassDef;
 	lookaheadClassDef: ClassDef;
 	chainClassRuleSets: (ChainClassRule[] | null)[];
+	/** Rule set indexes, filled in by the shaper on first use */
+	ruleIndexes?: RuleIndexSlots<ChainClassRule>;
 }
 
 export interface ChainClassRule {
@@ -88,6 +88,24 @@ export interface LigatureSubstSubtable {
 
 export interface LigatureSet {
 	ligatures: Ligature[];
+	/** Component trie, built on first use by ligatureTrie() */
+	trie?: LigatureTrieNode;
+}
+
+/**
+ * Node of a ligature set's component trie. The root stands for the covered
+ * first glyph; each edge consumes one more component.
+ */
+export interface LigatureTrieNode {
+	/** Ligature formed by the components up to here, or -1 */
+	ligatureGlyph: number;
+	/** Index of that ligature in the set; the earliest matching one wins */
+	rule: number;
+	/** Smallest rule index in this subtree, to stop once nothing can win */
+	minRule: number;
+	/** Next component glyphs, parallel to children */
+	glyphs: GlyphId[];
+	children: LigatureTrieNode[];
 }
 
 export interface Ligature {
@@ -784,6 +802,52 @@ export function applyLigatureSubstDirect(
 	return null;
 }
 
+function newTrieNode(): LigatureTrieNode {
+	return {
+		ligatureGlyph: -1,
+		rule: 0x7fffffff,
+		minRule: 0x7fffffff,
+		glyphs: [],
+		children: [],
+	};
+}
+
+/** Component trie for a ligature set, compiled once and kept on the set */
+export function ligatureTrie(set: LigatureSet): LigatureTrieNode {
+	if (set.trie) return set.trie;
+	const root = newTrieNode();
+	for (let rule = 0; rule < set.ligatures.length; rule++) {
+		const ligature = set.ligatures[rule]!;
+		const components = ligature.componentGlyphIds;
+		let node = root;
+		if (rule < node.minRule) node.minRule = rule;
+		for (let k = 0; k < components.length; k++) {
+			const glyph = components[k]!;
+			let child: LigatureTrieNode | undefined;
+			for (let c = 0; c < node.glyphs.length; c++) {
+				if (node.glyphs[c] === glyph) {
+					child = node.children[c];
+					break;
+				}
+			}
+			if (!child) {
+				child = newTrieNode();
+				node.glyphs.push(glyph);
+				node.children.push(child);
+			}
+			node = child;
+			if (rule < node.minRule) node.minRule = rule;
+		}
+		// A duplicate component sequence never wins over the earlier rule
+		if (node.ligatureGlyph === -1) {
+			node.ligatureGlyph = ligature.ligatureGlyph;
+			node.rule = rule;
+		}
+	}
+	set.trie = root;
+	return root;
+}
+
 // Export internal functions for testing
 export const __testing = {
 	parseGsubLookup,
@@ -4,6 +4,7 @@
  * Main dispatch loop for executing TrueType hinting instructions.
  */
 
+import { incrementCounter, instrumenting } from "../instrument.ts";
 import {
 	ABS,
 	ADD,
@@ -732,6 +733,9 @@ export function runProgram(ctx: ExecContext, range: CodeRange): void {
 	ctx.instructionCount = 0;
 
 	execute(ctx);
+	if (instrumenting) {
+		incrementCounter("hinting.instructions", ctx.instructionCount);
+	}
 }
 
 /**
@@ -62,6 +62,14 @@ export {
 export { GlyphBuffer } from "./buffer/glyph-buffer.ts";
 // Buffers
 export { UnicodeBuffer } from "./buffer/unicode-buffer.ts";
+// Cache management
+export {
+	type CacheManagerStats,
+	type CacheStats,
+	getCacheStats,
+	setCacheBudget,
+	trimCaches,
+} from "./cache.ts";
 // Fluent API - Builder classes
 // Fluent API - Entry points
 // Fluent API - Pipe function
@@ -499,6 +507,14 @@ export {
 	getTsbDelta,
 	getVorgDelta,
 } from "./font/tables/vvar.ts";
+// Instrumentation
+export {
+	getInstrumentationSnapshot,
+	type InstrumentationSnapshot,
+	type InstrumentationTimer,
+	resetInstrumentation,
+	setInstrumentation,
+} from "./instrument.ts";
 // Justification
 export type {
 	JustifyAdjustment,
@@ -677,6 +693,7 @@ export {
 	type ColorStop as GradientColorStop,
 	createGradientBitmap,
 	type Gradient,
+	type GradientRasterizeOptions,
 	interpolateGradient,
 	type LinearGradient,
 	type RadialGradient,
@@ -716,6 +733,7 @@ export {
 	rasterizeGlyphWithVariation,
 	rasterizeGlyphWithTransform,
 	rasterizePath,
+	rasterizePathSpans,
 	rasterizeText,
 	getFillProfile,
 	resetFillProfile,
@@ -725,15 +743,34 @@ export {
 export {
 	assRasterWasmStatus,
 	ensureAssRasterWasmReady,
+	getAssRasterWasmModule,
 	isAssRasterWasmEnabled,
 	setAssRasterWasmEnabled,
 } from "./raster/ass-wasm/index.ts";
 export {
 	ensureFillWasmReady,
 	fillWasmStatus,
+	getFillWasmModule,
 	isFillWasmEnabled,
+	setFillWasmDenseMaxPixels,
 	setFillWasmEnabled,
+	verifyFillWasm,
+	verifyFillWasmAsync,
 } from "./raster/fill-wasm/index.ts";
+// Optional WASM(+SIMD) bitmap compositing / RGBA export fast path
+export {
+	bitmapWasmStatus,
+	ensureBitmapWasmReady,
+	getBitmapWasmModule,
+	isBitmapWasmEnabled,
+	setBitmapWasmEnabled,
+} from "./raster/bitmap-wasm/index.ts";
+// Shared startup for the wasm raster kernels (compile once, post to workers)
+export {
+	initRasterKernels,
+	type RasterKernelInitOptions,
+	type RasterKernelModules,
+} from "./raster/kernels.ts";
 // SDF rendering
 export { renderSdf, type SdfOptions } from "./raster/sdf.ts";
 // Stroker
@@ -756,6 +793,7 @@ export type {
 	RasterizedGlyph,
 	RasterizerMode,
 	RasterizeOptions,
+	RasterClip,
 	Span,
 	TextRasterizeOptions,
 } from "./raster/types.ts";
@@ -893,10 +931,20 @@ export {
 // Shaper
 export {
 	type FontLike,
+	type ShapeBatchResult,
+	measureInto,
 	type ShapeOptions,
 	shape,
+	shapeBatch,
 	shapeInto,
 } from "./shaper/shaper.ts";
+export {
+	type FontSource,
+	ShapingPool,
+	type ShapingPoolOptions,
+	type ShapingWorkerLike,
+	serveShapingWorker,
+} from "./shaper/shaping-pool.ts";
 export * from "./types.ts";
 // BiDi processing (UAX #9)
 export {
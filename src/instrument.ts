@@ -0,0 +1,69 @@
+/**
+ * Library-wide counters and timers, for attributing a regression in
+ * production without attaching a profiler. Off by default; every call site
+ * is guarded by `if (instrumenting)`, so the disabled cost is one branch.
+ *
+ * Counters:
+ * - shapePlan.hit / shapePlan.miss
+ * - gsub.lookup.applied / gsub.lookup.skipped (and gpos.*): lookups run or
+ *   skipped by the buffer digest
+ * - hinting.instructions: TrueType instructions executed
+ * - cache.path.*, cache.glyph.*, cache.hintedGlyph.*: hit / miss
+ * - wasm.<kernel>.calls, wasm.<kernel>.fallback.<reason>: kernel runs and
+ *   declines that fell back to the scalar path
+ * - wasm.bytesIn / wasm.bytesOut: bytes copied into and out of wasm memory
+ *
+ * Timers:
+ * - raster.fill: single-band gray fills (wasm or scalar)
+ */
+
+/** Whether counters and timers are recorded; callers check it first */
+export let instrumenting = false;
+
+const counters = new Map<string, number>();
+const timers = new Map<string, InstrumentationTimer>();
+
+export interface InstrumentationTimer {
+	ms: number;
+	count: number;
+}
+
+export interface InstrumentationSnapshot {
+	counters: Record<string, number>;
+	timers: Record<string, InstrumentationTimer>;
+}
+
+/** Turn recording on or off; recorded values are kept until reset */
+export function setInstrumentation(on: boolean): void {
+	instrumenting = on;
+}
+
+/** Add `n` to a counter */
+export function incrementCounter(name: string, n = 1): void {
+	counters.set(name, (counters.get(name) ?? 0) + n);
+}
+
+/** Add one timed call of `ms` milliseconds to a timer */
+export function recordTime(name: string, ms: number): void {
+	const timer = timers.get(name);
+	if (timer) {
+		timer.ms += ms;
+		timer.count++;
+	} else {
+		timers.set(name, { ms, count: 1 });
+	}
+}
+
+/** Copy of every counter and timer recorded since the last reset */
+export function getInstrumentationSnapshot(): InstrumentationSnapshot {
+	const snapshot: InstrumentationSnapshot = { counters: {}, timers: {} };
+	for (const [name, value] of counters) snapshot.counters[name] = value;
+	for (const [name, timer] of timers) snapshot.timers[name] = { ...timer };
+	return snapshot;
+}
+
+/** Clear every counter and timer */
+export function resetInstrumentation(): void {
+	counters.clear();
+	timers.clear();
+}
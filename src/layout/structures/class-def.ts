@@ -133,6 +133,40 @@ export class ClassDef {
 		return 0;
 	}
 
+	/**
+	 * Class values as a dense array indexed by glyph ID, sized to the highest
+	 * classified glyph. Classes above 255 are stored as 0: no lookup flag can
+	 * select them, and GDEF glyph classes stop at 4.
+	 */
+	toUint8Array(): Uint8Array {
+		if (this.isEmpty) return new Uint8Array(0);
+
+		if (this.classValueArray) {
+			const values = this.classValueArray;
+			const dense = new Uint8Array(this.startGlyphId + values.length);
+			for (let i = 0; i < values.length; i++) {
+				const value = values[i]!;
+				if (value <= 0xff) dense[this.startGlyphId + i] = value;
+			}
+			return dense;
+		}
+
+		const ranges = this.ranges!;
+		let end = 0;
+		for (let i = 0; i < ranges.length; i++) {
+			end = Math.max(end, ranges[i]!.endGlyphId + 1);
+		}
+		const dense = new Uint8Array(end);
+		for (let i = 0; i < ranges.length; i++) {
+			const range = ranges[i]!;
+			if (range.classValue > 0xff || range.endGlyphId < range.startGlyphId) {
+				continue;
+			}
+			dense.fill(range.classValue, range.startGlyphId, range.endGlyphId + 1);
+		}
+		return dense;
+	}
+
 	/**
 	 * Get all glyphs in a specific class
 	 * @param classValue - The class value to search for
@@ -0,0 +1,98 @@
+/**
+ * Rule Index - buckets a contextual rule set by its second input value.
+ *
+ * A Format 1/2 (chaining) context rule set is already selected by the first
+ * input glyph or class, so every rule in it would otherwise be tried at each
+ * covered position. Bucketing by the next input glyph (Format 1) or class
+ * (Format 2) leaves only the rules that can still match. Rules with a
+ * one-glyph input match whatever follows, so they are merged into every
+ * bucket; each bucket keeps the set's rule order, since the first matching
+ * rule wins.
+ *
+ * Indexes are built on first use into slots kept on the subtable, parallel to
+ * its rule sets.
+ */
+export interface RuleIndex<R> {
+	/** Candidate rules keyed by the second input glyph or class */
+	byNext: Map<number, R[]>;
+	/** Rules with a one-glyph input: the candidates for any other key */
+	rest: R[];
+}
+
+/** Per-subtable index slots; null marks a set too small to index */
+export type RuleIndexSlots<R> = (RuleIndex<R> | null | undefined)[];
+
+/** Smaller sets are scanned directly: the bucket lookup would cost more */
+const MIN_INDEXED_RULES = 4;
+
+function buildRuleIndex<R>(
+	rules: readonly R[],
+	input: (rule: R) => readonly number[],
+): RuleIndex<R> {
+	const byNext = new Map<number, R[]>();
+	const rest: R[] = [];
+	for (let r = 0; r < rules.length; r++) {
+		const rule = rules[r]!;
+		const sequence = input(rule);
+		if (sequence.length === 0) {
+			rest.push(rule);
+			for (const bucket of byNext.values()) bucket.push(rule);
+			continue;
+		}
+		const key = sequence[0]!;
+		let bucket = byNext.get(key);
+		if (!bucket) {
+			// Earlier one-glyph rules still come first
+			bucket = rest.slice();
+			byNext.set(key, bucket);
+		}
+		bucket.push(rule);
+	}
+	return { byNext, rest };
+}
+
+/**
+ * Index of glyph rule set `set` (Format 1), keyed by inputSequence[0];
+ * null when the set is small enough to scan
+ */
+export function glyphRuleIndex<R extends { inputSequence: readonly number[] }>(
+	slots: RuleIndexSlots<R>,
+	set: number,
+	rules: readonly R[],
+): RuleIndex<R> | null {
+	let index = slots[set];
+	if (index === undefined) {
+		index =
+			rules.length < MIN_INDEXED_RULES
+				? null
+				: buildRuleIndex(rules, (rule) => rule.inputSequence);
+		slots[set] = index;
+	}
+	return index;
+}
+
+/** Index of class rule set `set` (Format 2), keyed by inputClasses[0] */
+export function classRuleIndex<R extends { inputClasses: readonly number[] }>(
+	slots: RuleIndexSlots<R>,
+	set: number,
+	rules: readonly R[],
+): RuleIndex<R> | null {
+	let index = slots[set];
+	if (index === undefined) {
+		index =
+			rules.length < MIN_INDEXED_RULES
+				? null
+				: buildRuleIndex(rules, (rule) => rule.inputClasses);
+		slots[set] = index;
+	}
+	return index;
+}
+
+/** Candidate rules for a next input value, or `rest` when there is none */
+export function candidateRules<R>(
+	index: RuleIndex<R>,
+	next: number | null,
+): R[] {
+	if (next === null) return index.rest;
+	return index.byNext.get(next) ?? index.rest;
+}
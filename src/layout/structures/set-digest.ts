@@ -28,6 +28,15 @@ export class SetDigest {
 		this.mask2 |= 1 << ((glyphId >> 9) & 0x1f);
 	}
 
+	/**
+	 * Remove all glyphs from the digest
+	 */
+	clear(): void {
+		this.mask0 = 0;
+		this.mask1 = 0;
+		this.mask2 = 0;
+	}
+
 	/**
 	 * Add a range of glyphs to the digest
 	 * @param start - Start glyph ID (inclusive)
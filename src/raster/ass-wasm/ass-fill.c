@@ -15,10 +15,12 @@
  *
  * Freestanding wasm32 scalar port of libass ass_rasterizer.c and the 16x16 C
  * rasterizer template. Input path coordinates are signed 26.6 fixed point.
+ * Also compiles as host C for native profiling (see ../kernel-host.h).
  */
 
 #include <stdint.h>
 #include <stddef.h>
+#include "../kernel-host.h"
 
 typedef int32_t i32;
 typedef int64_t i64;
@@ -48,14 +50,22 @@ typedef struct {
   i32 x_min, x_max, y_min, y_max;
 } Segment;
 
-static Segment *g_line[2];
-static i32 g_size[2];
+/* A polyline with the ping-pong buffers fill_level splits it through */
+typedef struct {
+  Segment *line[2];
+  i32 size[2];
+  i32 x_min, y_min, x_max, y_max;
+} LineSet;
+
+static LineSet g_path;
+static LineSet g_clip;
+static LineSet *g_set;
 static i32 g_capacity;
 static u8 *g_tile;
 static Segment *g_arena;
 static i32 g_arena_used;
 static i32 g_arena_capacity;
-static i32 g_x_min, g_y_min, g_x_max, g_y_max;
+static i32 g_clip_inverse;
 
 static inline i32 imin(i32 a, i32 b) { return a < b ? a : b; }
 static inline i32 imax(i32 a, i32 b) { return a > b ? a : b; }
@@ -71,7 +81,7 @@ static i32 ilog2_u32(uint32_t n) {
 }
 
 static int reserve(i32 index, i32 count) {
-  return count >= 0 && g_size[index] <= g_capacity - count;
+  return count >= 0 && g_set->size[index] <= g_capacity - count;
 }
 
 static int add_line(Point p0, Point p1) {
@@ -80,7 +90,7 @@ static int add_line(Point p0, Point p1) {
   if (!x && !y) return 1;
   if (!reserve(0, 1)) return 0;
 
-  Segment *line = g_line[0] + g_size[0]++;
+  Segment *line = g_set->line[0] + g_set->size[0]++;
   line->flags = SEGFLAG_EXACT_LEFT | SEGFLAG_EXACT_RIGHT |
     SEGFLAG_EXACT_TOP | SEGFLAG_EXACT_BOTTOM;
   if (x < 0) line->flags ^= SEGFLAG_UL_DR;
@@ -89,10 +99,10 @@ static int add_line(Point p0, Point p1) {
   line->x_max = imax(p0.x, p1.x);
   line->y_min = imin(p0.y, p1.y);
   line->y_max = imax(p0.y, p1.y);
-  g_x_min = imin(g_x_min, line->x_min);
-  g_x_max = imax(g_x_max, line->x_max);
-  g_y_min = imin(g_y_min, line->y_min);
-  g_y_max = imax(g_y_max, line->y_max);
+  g_set->x_min = imin(g_set->x_min, line->x_min);
+  g_set->x_max = imax(g_set->x_max, line->x_max);
+  g_set->y_min = imin(g_set->y_min, line->y_min);
+  g_set->y_max = imax(g_set->y_max, line->y_max);
   line->a = y;
   line->b = -x;
   line->c = (i64)y * p0.x - (i64)x * p0.y;
@@ -499,65 +509,160 @@ static Segment *arena_alloc(i32 count) {
   return result;
 }
 
-static int fill_level(u8 *buf, i32 stride, i32 width, i32 height,
+/*
+ * Split the last count lines of set[index] at first (pixels) along y when
+ * vertical, else x: the first part stays in place, the second is appended to
+ * set[index ^ 1].
+ */
+static int split_set(LineSet *set, i32 index, i32 count, i32 vertical,
+                     i32 first, i32 *n_first, i32 *n_second,
+                     i32 *second_winding) {
+  i32 offset = set->size[index] - count;
+  i32 other_offset = set->size[index ^ 1];
+  if (other_offset > g_arena_capacity - count) return 0;
+  Segment *lines = set->line[index] + offset;
+  Segment *second = set->line[index ^ 1] + other_offset;
+  int ok = vertical ?
+    poly_split_vert(lines, count, lines, n_first, second, n_second,
+                    second_winding, first << 6) :
+    poly_split_horz(lines, count, lines, n_first, second, n_second,
+                    second_winding, first << 6);
+  set->size[index] = offset + *n_first;
+  set->size[index ^ 1] = other_offset + *n_second;
+  return ok;
+}
+
+static int fill_level(LineSet *set, u8 *buf, i32 stride,
+                      i32 width, i32 height,
                       i32 index, i32 count, i32 winding) {
-  i32 offset = g_size[index] - count;
-  Segment *lines = g_line[index] + offset;
+  i32 offset = set->size[index] - count;
+  Segment *lines = set->line[index] + offset;
   i32 line_flags = fill_flags(lines, count, winding);
   i32 flags = line_flags ^ FLAG_COMPLEX;
   if (flags & (FLAG_SOLID | FLAG_COMPLEX)) {
     fill_solid(buf, stride, width, height, flags & FLAG_SOLID);
-    g_size[index] = offset;
+    set->size[index] = offset;
     return 1;
   }
   if (!(flags & FLAG_GENERIC) && (line_flags & FLAG_COMPLEX)) {
     fill_halfplane(buf, stride, width, height, lines, flags & FLAG_REVERSE);
-    g_size[index] = offset;
+    set->size[index] = offset;
     return 1;
   }
   if (width == TILE_SIZE && height == TILE_SIZE) {
     fill_generic_tile(buf, stride, lines, count, winding);
-    g_size[index] = offset;
+    set->size[index] = offset;
     return 1;
   }
 
-  i32 other = index ^ 1;
-  i32 other_offset = g_size[other];
-  if (other_offset > g_arena_capacity - count) return 0;
-  Segment *first = lines;
-  Segment *second = g_line[other] + other_offset;
-  i32 n_first = 0, n_second = 0;
+  i32 vertical = width <= height;
+  i32 first = 1 << ilog2_u32((uint32_t)((vertical ? height : width) - 1));
+  i32 n_first, n_second;
   i32 second_winding = winding;
-  int ok;
-  if (width > height) {
-    i32 first_width = 1 << ilog2_u32((uint32_t)(width - 1));
-    ok = poly_split_horz(lines, count, first, &n_first,
-                         second, &n_second, &second_winding,
-                         first_width << 6);
-    g_size[index] = offset + n_first;
-    g_size[other] = other_offset + n_second;
-    if (ok)
-      ok = fill_level(buf, stride, first_width, height,
-                      index, n_first, winding);
-    if (ok)
-      ok = fill_level(buf + first_width, stride, width - first_width, height,
-                      other, n_second, second_winding);
-  } else {
-    i32 first_height = 1 << ilog2_u32((uint32_t)(height - 1));
-    ok = poly_split_vert(lines, count, first, &n_first,
-                         second, &n_second, &second_winding,
-                         first_height << 6);
-    g_size[index] = offset + n_first;
-    g_size[other] = other_offset + n_second;
-    if (ok)
-      ok = fill_level(buf, stride, width, first_height,
-                      index, n_first, winding);
-    if (ok)
-      ok = fill_level(buf + first_height * stride, stride,
-                      width, height - first_height,
-                      other, n_second, second_winding);
+  if (!split_set(set, index, count, vertical, first,
+                 &n_first, &n_second, &second_winding))
+    return 0;
+  if (vertical)
+    return fill_level(set, buf, stride, width, first,
+                      index, n_first, winding) &&
+      fill_level(set, buf + first * stride, stride, width, height - first,
+                 index ^ 1, n_second, second_winding);
+  return fill_level(set, buf, stride, first, height,
+                    index, n_first, winding) &&
+    fill_level(set, buf + first, stride, width - first, height,
+               index ^ 1, n_second, second_winding);
+}
+
+static void mask_tile(u8 *buf, i32 stride, const u8 *tile) {
+  for (i32 y = 0; y < TILE_SIZE; y++) {
+    if (g_clip_inverse) {
+      for (i32 x = 0; x < TILE_SIZE; x++)
+        buf[x] = imax(buf[x] - tile[x], 0);
+    } else {
+      for (i32 x = 0; x < TILE_SIZE; x++) {
+        i32 t = buf[x] * tile[x] + 128;
+        buf[x] = (t + (t >> 8)) >> 8;
+      }
+    }
+    buf += stride; tile += TILE_SIZE;
   }
-  return ok;
+}
+
+/*
+ * fill_level for the path masked by the clip set, both split in lockstep.
+ * Wherever the clip is solid the path fills unmasked or is skipped, and
+ * wherever the path is solid the clip fills alone, so only tiles crossed by
+ * both outlines are rendered twice. The result matches a full-frame clip
+ * mask combined by mulBitmaps (\clip) or subBitmaps (\iclip).
+ */
+static int fill_level_clip(u8 *buf, i32 stride, i32 width, i32 height,
+                           i32 index, i32 count, i32 winding,
+                           i32 clip_index, i32 clip_count,
+                           i32 clip_winding) {
+  i32 offset = g_path.size[index] - count;
+  i32 clip_offset = g_clip.size[clip_index] - clip_count;
+  i32 clip_flags = fill_flags(g_clip.line[clip_index] + clip_offset,
+                              clip_count, clip_winding);
+  if (!(clip_flags & FLAG_COMPLEX)) {
+    g_clip.size[clip_index] = clip_offset;
+    if (!(clip_flags & FLAG_SOLID) != !g_clip_inverse)
+      return fill_level(&g_path, buf, stride, width, height,
+                        index, count, winding);
+    fill_solid(buf, stride, width, height, 0);
+    g_path.size[index] = offset;
+    return 1;
+  }
+  i32 flags = fill_flags(g_path.line[index] + offset, count, winding);
+  if (!(flags & FLAG_COMPLEX)) {
+    g_path.size[index] = offset;
+    if (!(flags & FLAG_SOLID)) {
+      fill_solid(buf, stride, width, height, 0);
+      g_clip.size[clip_index] = clip_offset;
+      return 1;
+    }
+    if (!fill_level(&g_clip, buf, stride, width, height,
+                    clip_index, clip_count, clip_winding))
+      return 0;
+    if (g_clip_inverse) {
+      for (i32 y = 0; y < height; y++)
+        for (i32 x = 0; x < width; x++)
+          buf[y * stride + x] = 255 - buf[y * stride + x];
+    }
+    return 1;
+  }
+  if (width == TILE_SIZE && height == TILE_SIZE) {
+    if (!fill_level(&g_path, buf, stride, width, height,
+                    index, count, winding) ||
+        !fill_level(&g_clip, g_tile, TILE_SIZE, width, height,
+                    clip_index, clip_count, clip_winding))
+      return 0;
+    mask_tile(buf, stride, g_tile);
+    return 1;
+  }
+
+  i32 vertical = width <= height;
+  i32 first = 1 << ilog2_u32((uint32_t)((vertical ? height : width) - 1));
+  i32 n_first, n_second, clip_first, clip_second;
+  i32 second_winding = winding;
+  i32 clip_second_winding = clip_winding;
+  if (!split_set(&g_path, index, count, vertical, first,
+                 &n_first, &n_second, &second_winding) ||
+      !split_set(&g_clip, clip_index, clip_count, vertical, first,
+                 &clip_first, &clip_second, &clip_second_winding))
+    return 0;
+  if (vertical)
+    return fill_level_clip(buf, stride, width, first,
+                           index, n_first, winding,
+                           clip_index, clip_first, clip_winding) &&
+      fill_level_clip(buf + first * stride, stride, width, height - first,
+                      index ^ 1, n_second, second_winding,
+                      clip_index ^ 1, clip_second, clip_second_winding);
+  return fill_level_clip(buf, stride, first, height,
+                         index, n_first, winding,
+                         clip_index, clip_first, clip_winding) &&
+    fill_level_clip(buf + first, stride, width - first, height,
+                    index ^ 1, n_second, second_winding,
+                    clip_index ^ 1, clip_second, clip_second_winding);
 }
 
 static int clip_horz(const Segment **lines, i32 *count, i32 *winding,
@@ -610,22 +715,11 @@ static int clip_vert(const Segment **lines, i32 *count, i32 *winding,
  * Commands are i32[8]: op, x1, y1, x2, y2, x, y, unused.
  * op: 0 move, 1 line, 2 quadratic, 3 cubic, 4 close.
  */
-__attribute__((export_name("ass_fill_path")))
-int ass_fill_path(i32 cmd_off, i32 cmd_count, i32 width, i32 height,
-                  i32 line_off, i32 line_capacity,
-                  i32 arena_off, i32 arena_capacity,
-                  i32 tile_off, i32 out_off) {
-  const i32 *cmd = (const i32 *)(uintptr_t)cmd_off;
-  g_line[0] = (Segment *)(uintptr_t)line_off;
-  g_line[1] = (Segment *)(uintptr_t)arena_off;
-  g_size[0] = g_size[1] = 0;
-  g_capacity = line_capacity;
-  g_arena = (Segment *)(uintptr_t)arena_off;
-  g_arena_used = 0;
-  g_arena_capacity = arena_capacity;
-  g_tile = (u8 *)(uintptr_t)tile_off;
-  g_x_min = g_y_min = 0x7fffffff;
-  g_x_max = g_y_max = -0x7fffffff;
+static int add_path(LineSet *set, const i32 *cmd, i32 cmd_count) {
+  g_set = set;
+  set->size[0] = set->size[1] = 0;
+  set->x_min = set->y_min = 0x7fffffff;
+  set->x_max = set->y_max = -0x7fffffff;
 
   Point current = {0, 0};
   Point start = {0, 0};
@@ -655,37 +749,112 @@ int ass_fill_path(i32 cmd_off, i32 cmd_count, i32 width, i32 height,
       current = start;
     }
   }
+  return 1;
+}
 
-  u8 *out = (u8 *)(uintptr_t)out_off;
-  for (i32 i = 0; i < width * height; i++) out[i] = 0;
-  if (!g_size[0]) return 1;
-
-  const Segment *lines = g_line[0];
-  i32 count = g_size[0];
+/* Clip set's lines to the frame, leaving count lines in set->line[0] */
+static int clip_to_frame(LineSet *set, i32 width, i32 height,
+                         i32 *count_out, i32 *winding_out) {
+  Segment **line = set->line;
+  const Segment *lines = line[0];
+  i32 count = set->size[0];
   i32 winding = 0;
   i32 unused = 0;
-  if (g_x_max >= (width << 6)) {
-    if (!poly_split_horz(lines, count, g_line[0], &count,
-                         g_line[1], &unused, &winding, width << 6)) return 0;
+  if (set->x_max >= (width << 6)) {
+    if (!poly_split_horz(lines, count, line[0], &count,
+                         line[1], &unused, &winding, width << 6)) return 0;
     winding = 0;
-    lines = g_line[0];
+    lines = line[0];
   }
-  if (g_y_max >= (height << 6)) {
-    if (!poly_split_vert(lines, count, g_line[0], &count,
-                         g_line[1], &unused, &winding, height << 6)) return 0;
+  if (set->y_max >= (height << 6)) {
+    if (!poly_split_vert(lines, count, line[0], &count,
+                         line[1], &unused, &winding, height << 6)) return 0;
     winding = 0;
-    lines = g_line[0];
+    lines = line[0];
+  }
+  if (set->x_min <= 0) {
+    if (!poly_split_horz(lines, count, line[1], &unused,
+                         line[0], &count, &winding, 0)) return 0;
+    lines = line[0];
   }
-  if (g_x_min <= 0) {
-    if (!poly_split_horz(lines, count, g_line[1], &unused,
-                         g_line[0], &count, &winding, 0)) return 0;
-    lines = g_line[0];
+  if (set->y_min <= 0) {
+    if (!poly_split_vert(lines, count, line[1], &unused,
+                         line[0], &count, &winding, 0)) return 0;
   }
-  if (g_y_min <= 0) {
-    if (!poly_split_vert(lines, count, g_line[1], &unused,
-                         g_line[0], &count, &winding, 0)) return 0;
+  set->size[0] = count;
+  set->size[1] = 0;
+  *count_out = count;
+  *winding_out = winding;
+  return 1;
+}
+
+static void init_buffers(i32 line_capacity, i32 arena_capacity,
+                         i32 tile_off) {
+  g_capacity = line_capacity;
+  g_arena_used = 0;
+  g_arena_capacity = arena_capacity;
+  g_tile = KERNEL_PTR(u8, tile_off);
+}
+
+KERNEL_EXPORT("ass_fill_path")
+int ass_fill_path(i32 cmd_off, i32 cmd_count, i32 width, i32 height,
+                  i32 line_off, i32 line_capacity,
+                  i32 arena_off, i32 arena_capacity,
+                  i32 tile_off, i32 out_off) {
+  g_path.line[0] = KERNEL_PTR(Segment, line_off);
+  g_path.line[1] = KERNEL_PTR(Segment, arena_off);
+  g_arena = KERNEL_PTR(Segment, arena_off);
+  init_buffers(line_capacity, arena_capacity, tile_off);
+  if (!add_path(&g_path, KERNEL_PTR(const i32, cmd_off), cmd_count))
+    return 0;
+
+  u8 *out = KERNEL_PTR(u8, out_off);
+  for (i32 i = 0; i < width * height; i++) out[i] = 0;
+  if (!g_path.size[0]) return 1;
+
+  i32 count, winding;
+  if (!clip_to_frame(&g_path, width, height, &count, &winding)) return 0;
+  return fill_level(&g_path, out, width, width, height, 0, count, winding);
+}
+
+/*
+ * ass_fill_path masked by a second outline (\clip, or \iclip when inverse):
+ * out = path * clip / 255, or max(path - clip, 0) for inverse. The mask is
+ * intersected per tile inside the recursion instead of being rasterized
+ * over the whole frame. Both outlines get two line buffers of line_capacity
+ * segments each, laid out back to back from line_off.
+ */
+KERNEL_EXPORT("ass_fill_path_clip")
+int ass_fill_path_clip(i32 cmd_off, i32 cmd_count,
+                       i32 clip_off, i32 clip_count, i32 inverse,
+                       i32 width, i32 height,
+                       i32 line_off, i32 line_capacity,
+                       i32 tile_off, i32 out_off) {
+  Segment *lines = KERNEL_PTR(Segment, line_off);
+  g_path.line[0] = lines;
+  g_path.line[1] = lines + line_capacity;
+  g_clip.line[0] = lines + 2 * line_capacity;
+  g_clip.line[1] = lines + 3 * line_capacity;
+  g_arena = g_path.line[1];
+  g_clip_inverse = inverse != 0;
+  init_buffers(line_capacity, line_capacity, tile_off);
+  if (!add_path(&g_path, KERNEL_PTR(const i32, cmd_off), cmd_count) ||
+      !add_path(&g_clip, KERNEL_PTR(const i32, clip_off), clip_count))
+    return 0;
+
+  u8 *out = KERNEL_PTR(u8, out_off);
+  for (i32 i = 0; i < width * height; i++) out[i] = 0;
+  if (!g_path.size[0]) return 1;
+
+  i32 count, winding;
+  if (!clip_to_frame(&g_path, width, height, &count, &winding)) return 0;
+  if (!g_clip.size[0]) {
+    if (!g_clip_inverse) return 1;
+    return fill_level(&g_path, out, width, width, height, 0, count, winding);
   }
-  g_size[0] = count;
-  g_size[1] = 0;
-  return fill_level(out, width, width, height, 0, count, winding);
+  i32 clip_count_in, clip_winding;
+  if (!clip_to_frame(&g_clip, width, height, &clip_count_in, &clip_winding))
+    return 0;
+  return fill_level_clip(out, width, width, height, 0, count, winding,
+                         0, clip_count_in, clip_winding);
 }
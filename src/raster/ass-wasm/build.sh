@@ -22,7 +22,7 @@ fi
 export PATH="$(dirname "$CLANG"):$PATH"
 echo "using clang: $CLANG"
 
-"$CLANG" --target=wasm32 -O3 -msimd128 -nostdlib \
+"$CLANG" --target=wasm32 -O3 -msimd128 -mbulk-memory -nostdlib \
 	-Wl,--no-entry -Wl,--export-dynamic -Wl,--export=__heap_base \
 	-Wl,--initial-memory=1048576 -Wl,--max-memory=67108864 \
 	-o ass-fill.wasm ass-fill.c
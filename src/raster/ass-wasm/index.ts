@@ -3,7 +3,9 @@
 // style scan converter, while this module owns libass curve subdivision and
 // coverage generation end to end.
 
+import { incrementCounter, instrumenting } from "../../instrument.ts";
 import type { GlyphPath } from "../../render/path.ts";
+import { decodeBase64 } from "../wasm-base64.ts";
 import { ASS_FILL_WASM_BASE64 } from "./wasm-bytes.ts";
 
 type Status = "uninit" | "ready" | "disabled";
@@ -18,10 +20,14 @@ let enabled = false;
 let forceDisabled = false;
 let memory: WebAssembly.Memory | null = null;
 let heapBase = 0;
+let compiledModule: WebAssembly.Module | null = null;
 let fillFn: ((...args: number[]) => number) | null = null;
+// Clip-aware entry point; absent from modules built before it was added
+let clipFn: ((...args: number[]) => number) | null = null;
 let u8View: Uint8Array | null = null;
 let i32View: Int32Array | null = null;
 let commandBuffer = new Int32Array(64 * COMMAND_WORDS);
+let clipCommandBuffer = new Int32Array(64 * COMMAND_WORDS);
 
 export function isAssRasterWasmEnabled(): boolean {
 	return enabled && !forceDisabled;
@@ -65,13 +71,6 @@ function ensureMemory(end: number): boolean {
 	return end <= memory.buffer.byteLength;
 }
 
-function decodeBase64(value: string): Uint8Array<ArrayBuffer> {
-	const binary = atob(value);
-	const bytes = new Uint8Array(binary.length);
-	for (let i = 0; i < binary.length; i++) bytes[i] = binary.charCodeAt(i);
-	return bytes as Uint8Array<ArrayBuffer>;
-}
-
 function setup(instance: WebAssembly.Instance): boolean {
 	const exports = instance.exports as Record<string, unknown>;
 	const exportedMemory = exports.memory as WebAssembly.Memory | undefined;
@@ -84,17 +83,21 @@ function setup(instance: WebAssembly.Instance): boolean {
 	if (!exportedMemory || !exportedFill || !exportedHeapBase) return false;
 	memory = exportedMemory;
 	fillFn = exportedFill;
+	clipFn =
+		(exports.ass_fill_path_clip as
+			| ((...args: number[]) => number)
+			| undefined) ?? null;
 	heapBase = align16(Number(exportedHeapBase.value));
 	refreshViews();
 	return true;
 }
 
-function ensureCommandCapacity(commandCount: number): void {
+function growCommands(buffer: Int32Array, commandCount: number): Int32Array {
 	const words = commandCount * COMMAND_WORDS;
-	if (commandBuffer.length >= words) return;
-	let capacity = commandBuffer.length;
+	if (buffer.length >= words) return buffer;
+	let capacity = buffer.length;
 	while (capacity < words) capacity *= 2;
-	commandBuffer = new Int32Array(capacity);
+	return new Int32Array(capacity);
 }
 
 function encodePath(
@@ -103,8 +106,12 @@ function encodePath(
 	offsetX: number,
 	offsetY: number,
 	flipY: boolean,
+	clip = false,
 ): number {
-	ensureCommandCapacity(path.commands.length * 2 + 1);
+	const size = path.commands.length * 2 + 1;
+	if (clip) clipCommandBuffer = growCommands(clipCommandBuffer, size);
+	else commandBuffer = growCommands(commandBuffer, size);
+	const commands = clip ? clipCommandBuffer : commandBuffer;
 	const scaleX = scale * 64;
 	const scaleY = (flipY ? -scale : scale) * 64;
 	const offX = offsetX * 64;
@@ -117,8 +124,8 @@ function encodePath(
 	];
 	const begin = (op: number): number => {
 		const base = count * COMMAND_WORDS;
-		commandBuffer.fill(0, base, base + COMMAND_WORDS);
-		commandBuffer[base] = op;
+		commands.fill(0, base, base + COMMAND_WORDS);
+		commands[base] = op;
 		count++;
 		return base;
 	};
@@ -129,33 +136,33 @@ function encodePath(
 			if (open) begin(4);
 			const base = begin(0);
 			const [x, y] = point(command.x, command.y);
-			commandBuffer[base + 1] = x;
-			commandBuffer[base + 2] = y;
+			commands[base + 1] = x;
+			commands[base + 2] = y;
 			open = true;
 		} else if (command.type === "L") {
 			const base = begin(1);
 			const [x, y] = point(command.x, command.y);
-			commandBuffer[base + 1] = x;
-			commandBuffer[base + 2] = y;
+			commands[base + 1] = x;
+			commands[base + 2] = y;
 		} else if (command.type === "Q") {
 			const base = begin(2);
 			const [cx, cy] = point(command.x1, command.y1);
 			const [x, y] = point(command.x, command.y);
-			commandBuffer[base + 1] = cx;
-			commandBuffer[base + 2] = cy;
-			commandBuffer[base + 3] = x;
-			commandBuffer[base + 4] = y;
+			commands[base + 1] = cx;
+			commands[base + 2] = cy;
+			commands[base + 3] = x;
+			commands[base + 4] = y;
 		} else if (command.type === "C") {
 			const base = begin(3);
 			const [cx1, cy1] = point(command.x1, command.y1);
 			const [cx2, cy2] = point(command.x2, command.y2);
 			const [x, y] = point(command.x, command.y);
-			commandBuffer[base + 1] = cx1;
-			commandBuffer[base + 2] = cy1;
-			commandBuffer[base + 3] = cx2;
-			commandBuffer[base + 4] = cy2;
-			commandBuffer[base + 5] = x;
-			commandBuffer[base + 6] = y;
+			commands[base + 1] = cx1;
+			commands[base + 2] = cy1;
+			commands[base + 3] = cx2;
+			commands[base + 4] = cy2;
+			commands[base + 5] = x;
+			commands[base + 6] = y;
 		} else if (open) {
 			begin(4);
 			open = false;
@@ -165,6 +172,21 @@ function encodePath(
 	return count;
 }
 
+/**
+ * Encode a path into the kernel's 8-word command stream (26.6 coordinates),
+ * e.g. to record it for the native benchmark in tools/raster-bench.
+ */
+export function encodeAssPath(
+	path: GlyphPath,
+	scale: number,
+	offsetX: number,
+	offsetY: number,
+	flipY: boolean,
+): Int32Array {
+	const count = encodePath(path, scale, offsetX, offsetY, flipY);
+	return commandBuffer.slice(0, count * COMMAND_WORDS);
+}
+
 function copyOutput(
 	outOffset: number,
 	paddedWidth: number,
@@ -196,6 +218,25 @@ export function fillAssPathWasm(
 	if (!enabled || forceDisabled || !fillFn || !memory) return false;
 	if (width <= 0 || height <= 0 || out.length !== width * height) return false;
 	const commandCount = encodePath(path, scale, offsetX, offsetY, flipY);
+	return fillAssCommandsWasm(commandBuffer, commandCount, width, height, out);
+}
+
+/**
+ * Run the kernel on an already encoded command stream (see encodeAssPath).
+ * Returns false when the kernel is unavailable or memory can't grow.
+ */
+export function fillAssCommandsWasm(
+	commands: Int32Array,
+	commandCount: number,
+	width: number,
+	height: number,
+	out: Uint8Array,
+): boolean {
+	if (!enabled || forceDisabled || !fillFn || !memory) {
+		if (instrumenting) incrementCounter("wasm.ass.fallback.disabled");
+		return false;
+	}
+	if (width <= 0 || height <= 0 || out.length !== width * height) return false;
 	if (commandCount === 0) {
 		out.fill(0);
 		return true;
@@ -216,11 +257,13 @@ export function fillAssPathWasm(
 		cursor = align16(cursor + TILE_SIZE * TILE_SIZE);
 		const outputOffset = cursor;
 		cursor = align16(cursor + paddedWidth * paddedHeight);
-		if (cursor - heapBase > MAX_WORK_BYTES || !ensureMemory(cursor))
+		if (cursor - heapBase > MAX_WORK_BYTES || !ensureMemory(cursor)) {
+			if (instrumenting) incrementCounter("wasm.ass.fallback.memory");
 			return false;
+		}
 
 		i32View!.set(
-			commandBuffer.subarray(0, commandCount * COMMAND_WORDS),
+			commands.subarray(0, commandCount * COMMAND_WORDS),
 			commandOffset >> 2,
 		);
 		const ok = fillFn(
@@ -235,6 +278,108 @@ export function fillAssPathWasm(
 			tileOffset,
 			outputOffset,
 		);
+		if (ok) {
+			copyOutput(outputOffset, paddedWidth, width, height, out);
+			if (instrumenting) {
+				incrementCounter("wasm.ass.calls");
+				incrementCounter("wasm.bytesIn", commandCount * COMMAND_WORDS * 4);
+				incrementCounter("wasm.bytesOut", width * height);
+			}
+			return true;
+		}
+		capacity *= 2;
+	}
+}
+
+/**
+ * fillAssPathWasm masked by a clip outline in the same coordinate space:
+ * out = path * clip / 255 (mulBitmaps), or with `inverse` (\iclip)
+ * max(path - clip, 0) (subBitmaps). Tiles outside the clip are skipped and
+ * tiles inside it fill unmasked, so no full-size mask is rasterized.
+ */
+export function fillAssPathClipWasm(
+	path: GlyphPath,
+	clipPath: GlyphPath,
+	inverse: boolean,
+	width: number,
+	height: number,
+	scale: number,
+	offsetX: number,
+	offsetY: number,
+	flipY: boolean,
+	out: Uint8Array,
+): boolean {
+	if (!enabled || forceDisabled || !clipFn || !memory) return false;
+	if (width <= 0 || height <= 0 || out.length !== width * height) return false;
+	const commandCount = encodePath(path, scale, offsetX, offsetY, flipY);
+	const clipCount = encodePath(clipPath, scale, offsetX, offsetY, flipY, true);
+	return fillAssCommandsClipWasm(
+		commandBuffer,
+		commandCount,
+		clipCommandBuffer,
+		clipCount,
+		inverse,
+		width,
+		height,
+		out,
+	);
+}
+
+/** fillAssCommandsWasm with a clip command stream (see fillAssPathClipWasm) */
+export function fillAssCommandsClipWasm(
+	commands: Int32Array,
+	commandCount: number,
+	clipCommands: Int32Array,
+	clipCount: number,
+	inverse: boolean,
+	width: number,
+	height: number,
+	out: Uint8Array,
+): boolean {
+	if (!enabled || forceDisabled || !clipFn || !memory) return false;
+	if (width <= 0 || height <= 0 || out.length !== width * height) return false;
+
+	const paddedWidth = pad16(width);
+	const paddedHeight = pad16(height);
+	let capacity = Math.max(64, Math.max(commandCount, clipCount) * 16);
+	for (;;) {
+		let cursor = heapBase;
+		const commandOffset = cursor;
+		cursor = align16(cursor + commandCount * COMMAND_WORDS * 4);
+		const clipOffset = cursor;
+		cursor = align16(cursor + clipCount * COMMAND_WORDS * 4);
+		// Two ping-pong line buffers each for the path and the clip
+		const linesOffset = cursor;
+		cursor = align16(cursor + 4 * capacity * SEGMENT_BYTES);
+		const tileOffset = cursor;
+		cursor = align16(cursor + TILE_SIZE * TILE_SIZE);
+		const outputOffset = cursor;
+		cursor = align16(cursor + paddedWidth * paddedHeight);
+		if (cursor - heapBase > MAX_WORK_BYTES || !ensureMemory(cursor))
+			return false;
+
+		const heap = i32View!;
+		heap.set(
+			commands.subarray(0, commandCount * COMMAND_WORDS),
+			commandOffset >> 2,
+		);
+		heap.set(
+			clipCommands.subarray(0, clipCount * COMMAND_WORDS),
+			clipOffset >> 2,
+		);
+		const ok = clipFn(
+			commandOffset,
+			commandCount,
+			clipOffset,
+			clipCount,
+			inverse ? 1 : 0,
+			paddedWidth,
+			paddedHeight,
+			linesOffset,
+			capacity,
+			tileOffset,
+			outputOffset,
+		);
 		if (ok) {
 			copyOutput(outputOffset, paddedWidth, width, height, out);
 			return true;
@@ -251,6 +396,54 @@ function fnv1a(bytes: Uint8Array): number {
 	return hash;
 }
 
+/**
+ * Differential check of the clip entry point against two unclipped fills
+ * combined here; a mismatch drops only that entry point.
+ */
+function verifyClip(path: GlyphPath, clipPath: GlyphPath): void {
+	if (!clipFn) return;
+	const width = 256;
+	const height = 144;
+	const fill = new Uint8Array(width * height);
+	const mask = new Uint8Array(width * height);
+	const clipped = new Uint8Array(width * height);
+	const render = (p: GlyphPath, out: Uint8Array) =>
+		fillAssPathWasm(p, width, height, 1, 80, 80, false, out);
+	if (!render(path, fill) || !render(clipPath, mask)) {
+		clipFn = null;
+		return;
+	}
+	for (const inverse of [false, true]) {
+		if (
+			!fillAssPathClipWasm(
+				path,
+				clipPath,
+				inverse,
+				width,
+				height,
+				1,
+				80,
+				80,
+				false,
+				clipped,
+			)
+		) {
+			clipFn = null;
+			return;
+		}
+		for (let i = 0; i < clipped.length; i++) {
+			const t = fill[i]! * mask[i]! + 128;
+			const expected = inverse
+				? Math.max(fill[i]! - mask[i]!, 0)
+				: (t + (t >> 8)) >> 8;
+			if (clipped[i] !== expected) {
+				clipFn = null;
+				return;
+			}
+		}
+	}
+}
+
 function selfVerify(): boolean {
 	const paths: Array<[GlyphPath, number]> = [
 		[
@@ -285,17 +478,30 @@ function selfVerify(): boolean {
 		if (!fillAssPathWasm(path, 640, 360, 1, 80, 80, false, out)) return false;
 		if (fnv1a(out) !== expected) return false;
 	}
+	verifyClip(paths[1]![0], paths[0]![0]);
 	return true;
 }
 
-export function ensureAssRasterWasmReady(): void {
+/**
+ * The compiled module once the kernel is ready, for sharing with workers
+ * (see getFillWasmModule). Null until ready.
+ */
+export function getAssRasterWasmModule(): WebAssembly.Module | null {
+	return status === "ready" ? compiledModule : null;
+}
+
+/**
+ * Idempotent: compiles + self-verifies once. Pass a module from
+ * getAssRasterWasmModule() to skip decode + compile.
+ */
+export function ensureAssRasterWasmReady(module?: WebAssembly.Module): void {
 	if (status !== "uninit") return;
 	if (typeof WebAssembly === "undefined") {
 		status = "disabled";
 		return;
 	}
 	try {
-		const module = new WebAssembly.Module(decodeBase64(ASS_FILL_WASM_BASE64));
+		module ??= new WebAssembly.Module(decodeBase64(ASS_FILL_WASM_BASE64));
 		if (!setup(new WebAssembly.Instance(module, {}))) {
 			status = "disabled";
 			return;
@@ -310,16 +516,19 @@ export function ensureAssRasterWasmReady(): void {
 			forceDisabled = previousForceDisabled;
 		}
 		if (verified) {
+			compiledModule = module;
 			status = "ready";
 		} else {
 			enabled = false;
 			fillFn = null;
+			clipFn = null;
 			memory = null;
 			status = "disabled";
 		}
 	} catch {
 		enabled = false;
 		fillFn = null;
+		clipFn = null;
 		memory = null;
 		status = "disabled";
 	}
@@ -1,4 +1,4 @@
 // AUTO-GENERATED by build.sh from ass-fill.c. Do not edit by hand.
 // Freestanding wasm32 libass-compatible tiled rasterizer, base64-embedded.
 export const ASS_FILL_WASM_BASE64 =
-	"AGFzbQEAAAABRAZgCn9/f39/f39/f38Bf2AEf39/fwF/YAd/f39/f39/AX9gCX9/f39/f39/fwF/YAh/f39/f39/fwF/YAZ/f39/fn8AAwkIAAECAwQEAgUEBQFwAQEBBQUBARCACAYPAn8BQYCABAt/AEGwgAQLBzoEBm1lbW9yeQIAD19fc3RhY2tfcG9pbnRlcgMADWFzc19maWxsX3BhdGgAAAtfX2hlYXBfYmFzZQMBCr9KCIcIAQR/I4CAgIAAQRBrIgokgICAgABBACELQQAgBjYChICEgABBACAENgKAgISAAEEAQgA3AoiAhIAAQQAgBTYCkICEgABBACAGNgKUgISAAEEAIAc2ApiAhIAAQQAgCDYCnICEgABBAEH/////BzYCoICEgABBAEH/////BzYCpICEgABBAEGBgICAeDYCqICEgABBAEGBgICAeDYCrICEgAACQAJAAkAgAUEBSA0AQQAhBEEAIQVBACEHQQAhCANAAkACQAJAIAAoAgAiBg0AIABBCGooAgAhByAAQQRqKAIAIQgMAQsCQCAGQQFHDQAgBEUNAAJAIAUgCyAAQQRqKAIAIgYgAEEIaigCACIMEIGAgIAARQ0AQQEhBCAGIQUgDCELDAMLQQAhBgwGCwJAIAZBAkcNACAERQ0AQQAhBiAFIAsgAEEEaigCACAAQQhqKAIAIABBDGooAgAiDCAAQRBqKAIAIg1BABCCgICAAEUNBkEBIQQgDCEFIA0hCwwCCwJAIAZBA0cNACAERQ0AQQAhBiAFIAsgAEEEaigCACAAQQhqKAIAIABBDGooAgAgAEEQaigCACAAQRRqKAIAIgwgAEEYaigCACINQQAQg4CAgABFDQZBASEEIAwhBSANIQsMAgsgBkEERw0BIARFDQEgBSALIAggBxCBgICAAEUNBAtBASEEIAghBSAHIQsLIABBIGohACABQX9qIgENAAsLAkAgAyACbCIAQQFIDQAgAEUNACAJQQAgAPwLAAsCQEEAKAKIgISAACIADQBBASEGDAILQQAoAoCAhIAAIQEgCiAANgIMIApBADYCCCAKQQA2AgQCQEEAKAKsgISAACACQQZ0IgRIDQBBACEGIAEgACABIApBDGpBACgChICEgAAgCkEEaiAKQQhqIAQQhICAgABFDQIgCkEANgIIQQAoAoCAhIAAIQEgCigCDCEAC0EAIQYCQEEAKAKogISAACADQQZ0IgRIDQAgASAAIAEgCkEMakEAKAKEgISAACAKQQRqIApBCGogBBCFgICAAEUNAiAKQQA2AghBACgCgICEgAAhASAKKAIMIQALQQAhBgJAQQAoAqSAhIAAQQBKDQAgASAAQQAoAoSAhIAAIApBBGogASAKQQxqIApBCGpBABCEgICAAEUNAkEAKAKAgISAACEBIAooAgwhAAsCQEEAKAKggISAAEEASg0AQQAhBiABIABBACgChICEgAAgCkEEaiABIApBDGogCkEIakEAEIWAgIAARQ0CIAooAgwhAAtBACAANgKIgISAAEEAQQA2AoyAhIAAIAkgAiACIANBACAAIAooAggQhoCAgAAhBgwBC0EAIQYLIApBEGokgICAgAAgBgvJAwIHfwF+AkACQCACIABHDQBBASEEIAMgAUYNAQtBACEEQQAoAoiAhIAAIgVBACgCkICEgABODQBBASEEQQAgBUEBajYCiICEgABBACgCgICEgAAgBUEobGoiBSAAIAIgACACSBsiBjYCGCAFIAAgAiAAIAJKGyIHNgIcIAUgASADIAEgA0gbIgg2AiAgBSABIAMgASADShsiCTYCJCAFQT5BPCACIABrIgJBAEgbIgogCkEDcyADIAFrIgNBAEgbNgIUQQBBACgCrICEgAAiCiAHIAogB0obNgKsgISAAEEAQQAoAqCAhIAAIgcgCCAHIAhIGzYCoICEgABBAEEAKAKogISAACIHIAkgByAJShs2AqiAhIAAQQBBACgCpICEgAAiByAGIAcgBkgbNgKkgISAACAFQQAgAmsgAiACQR91IgZzIAZrIgYgAyADQR91IgdzIAdrIgcgBiAHSxsiB0EBdmciCEF+aiIGdDYCDCAFIAMgBnQ2AgggBSADrCAArH4gAqwgAax+fSAGrYY3AwAgBSAHIAhBf2p0rSILIAt+QiCIQrPmzJkFfkIgiCALQu/Pmt4LfkIgiH2nQc3EwcB4ajYCEAsgBAvvAgIHfwZ+AkACQCAGQR9KDQAgBCAAayIHIAdBH3UiCHMgCGsiCCAFIAFrIgkgCUEfdSIKcyAKayIKIAggCksbIQsgBkEBaiEKIAVBAmohDCAEQQJqIQ0DQAJAIAMgAWusIg4gCawiD34gAiAAa6wiECAHrCIRfnwiEkIAIAutQgSGIhN9Uw0AIBIgDyAPfiARIBF+fCATfFUNACAOIBF+IBAgD359Ig8gD0I/hyIPhSAPfSATWA0CCwJAIAAgASACIABqQQF1IAMgAWpBAXUgDSAAaiACQQF0akECdSIGIAwgAWogA0EBdGpBAnUiCCAKEIKAgIAADQBBAA8LIAQgBmsiByAHQR91IgFzIAFrIgEgBSAIayIJIAlBH3UiAHMgAGsiACABIABLGyELIAIgBGpBAXUhAiADIAVqQQF1IQMgCCEBIAYhACAKQQFqIgpBIUcNAAwCCwsgACEGIAEhCAsgBiAIIAQgBRCBgICAAAuQBAIKfwh+AkACQCAIQR9KDQAgCEEgIAhBIEobIQkgBkECaiEKIAdBAmohCyAHQQNqIQwgBkEDaiENIAYgAGsiDiAOQR91Ig9zIA9rIg8gByABayIQIBBBH3UiEXMgEWsiESAPIBFLGyESA0ACQCADIAFrrCITIBCsIhR+IAIgAGusIhUgDqwiFn58IhdCACASrUIEhiIYfSIZUw0AIBcgGCAUIBR+IBYgFn58fCIaVQ0AIBMgFn4gFSAUfn0iFyAXQj+HIheFIBd9IBhWDQAgBSABa6wiEyAUfiAEIABrrCIVIBZ+fCIXIBlTDQAgFyAaVQ0AIBMgFn4gFSAUfn0iFCAUQj+HIhSFIBR9IBhYDQILAkAgACABIAIgAGpBAXUgAyABakEBdSAAIAJBAXRqIARqQQJqQQJ1IAEgA0EBdGogBWpBAmpBAnUgDSAAaiAEIAJqQQNsakEDdSIPIAwgAWogBSADakEDbGpBA3UiESAIQQFqIggQg4CAgAANAEEADwsgBiAPayIOIA5BH3UiAXMgAWsiASAHIBFrIhAgEEEfdSIAcyAAayIAIAEgAEsbIRIgCiACaiAEQQF0akECdSECIAsgA2ogBUEBdGpBAnUhAyAEIAZqQQF1IQQgBSAHakEBdSEFIBEhASAPIQAgCSAIRw0ADAILCyAAIQ8gASERCyAPIBEgBiAHEIGAgIAAC6cHBQJ/AX4BfwJ+An8gBUEANgIAIANBADYCAEEBIQgCQCABQQFIDQBBACgCkICEgAAhCSAHrCEKA0AgAEEUaigCACEIQQAhCwJAIABBIGooAgANACAIQRBxRQ0AQX9BASAAQQhqKAIAQX9KGyELCwJAAkACQAJAAkAgCEEIcUUNACAAQRxqKAIAIAdMDQEMAgtCACAAKQMAIABBJEEgIAhBAnEbajQCACAAQQxqNAIAfiAAQQhqNAIAIgwgCn58fSINfSANIAxCAFUbQgBTDQELIAYgBigCACALajYCACAAQRhqKAIAIAdODQICQCADKAIAIgggCUgNAEEADwsgAiAIQShsaiIIIAApAyA3AyAgCCAA/QADEP0LAxAgCCAA/QADAP0LAwAgAiADKAIAQShsaiIIIAgoAhwiCCAHIAggB0gbNgIcIAMhCAwBCwJAAkACQAJAIAhBBHFFDQAgAEEYaigCACAHTg0BDAILQgAgACkDACAAQSBBJCAIQQJxG2o0AgAgAEEMajQCAH4gAEEIajQCACIMIAp+fH0iDX0gDSAMQgBTG0IAUw0BCwJAIAUoAgAiCCAJSA0AQQAPCyAEIAhBKGxqIgggACkDIDcDICAIIAD9AAMQ/QsDECAIIAD9AAMA/QsDACAEIAUoAgBBKGxqIgsgCygCHCAHazYCHCALIAspAwAgCzQCCCAKfn03AwAgCyALKAIYIAdrIghBACAIQQBKIg4bNgIYIAUhCCAODQIgBSEIIAsoAhQiDkEGcUEGRw0CIAsgDkFvcTYCFAwBCwJAIAhBAnFFDQAgBiAGKAIAIAtqNgIAC0EAIQggAygCACILIAlODQQgBSgCACAJTg0EIAIgC0EobGoiCCAAKQMgNwMgIAggAP0AAxD9CwMQIAggAP0AAwD9CwMAIAQgBSgCAEEobGoiCCACIAMoAgBBKGxqIgv9AAMQ/QsDECAIIAspAyA3AyAgCCAL/QADAP0LAwAgCEEANgIYIAggCCkDACALNAIIIAp+fTcDACAIIAgoAhwgB2s2AhwgCyALKAIUQW9xNgIUIAsgBzYCHCAIIAgoAhRBX3EiDzYCFAJAIAsoAhQiDkECcUUNACALIA82AhQgCCAONgIUIAsoAhQhDgsgCyAOQQhyNgIUIAggCCgCFEEEcjYCFCADIAMoAgBBAWo2AgALIAUhCAsgCCAIKAIAQQFqNgIACyAAQShqIQAgAUF/aiIBDQALQQEhCAsgCAunBwUCfwF+AX8CfgJ/IAVBADYCACADQQA2AgBBASEIAkAgAUEBSA0AQQAoApCAhIAAIQkgB6whCgNAIABBFGooAgAhCEEAIQsCQCAAQRhqKAIADQAgCEEEcUUNAEF/QQEgAEEMaigCAEF/ShshCwsCQAJAAkACQAJAIAhBIHFFDQAgAEEkaigCACAHTA0BDAILQgAgACkDACAAQRxBGCAIQQJxG2o0AgAgAEEIajQCAH4gAEEMajQCACIMIAp+fH0iDX0gDSAMQgBVG0IAUw0BCyAGIAYoAgAgC2o2AgAgAEEgaigCACAHTg0CAkAgAygCACIIIAlIDQBBAA8LIAIgCEEobGoiCCAAKQMgNwMgIAggAP0AAxD9CwMQIAggAP0AAwD9CwMAIAIgAygCAEEobGoiCCAIKAIkIgggByAIIAdIGzYCJCADIQgMAQsCQAJAAkACQCAIQRBxRQ0AIABBIGooAgAgB04NAQwCC0IAIAApAwAgAEEYQRwgCEECcRtqNAIAIABBCGo0AgB+IABBDGo0AgAiDCAKfnx9Ig19IA0gDEIAUxtCAFMNAQsCQCAFKAIAIgggCUgNAEEADwsgBCAIQShsaiIIIAApAyA3AyAgCCAA/QADEP0LAxAgCCAA/QADAP0LAwAgBCAFKAIAQShsaiILIAsoAiQgB2s2AiQgCyALKQMAIAs0AgwgCn59NwMAIAsgCygCICAHayIIQQAgCEEASiIOGzYCICAFIQggDg0CIAUhCCALKAIUIg5BEnFBEkcNAiALIA5Be3E2AhQMAQsCQCAIQQJxRQ0AIAYgBigCACALajYCAAtBACEIIAMoAgAiCyAJTg0EIAUoAgAgCU4NBCACIAtBKGxqIgggACkDIDcDICAIIAD9AAMQ/QsDECAIIAD9AAMA/QsDACAEIAUoAgBBKGxqIgggAiADKAIAQShsaiILKQMgNwMgIAggC/0AAxD9CwMQIAggC/0AAwD9CwMAIAhBADYCICAIIAgpAwAgCzQCDCAKfn03AwAgCCAIKAIkIAdrNgIkIAsgCygCFEF7cTYCFCALIAc2AiQgCCAIKAIUQXdxIg82AhQCQCALKAIUIg5BAnFFDQAgCyAPNgIUIAggDjYCFCALKAIUIQ4LIAsgDkEgcjYCFCAIIAgoAhRBEHI2AhQgAyADKAIAQQFqNgIACyAFIQgLIAggCCgCAEEBajYCAAsgAEEoaiEAIAFBf2oiAQ0AC0EBIQgLIAgLySIFCH8Cfg5/Bn4KeyOAgICAAEHQBGsiBySAgICAACAEQQJ0IggoAoCAhIAAIAgoAoiAhIAAIAVrIglBKGxqIQogCEGIgISAAGohCwJAAkACQAJAAkAgBQ0AIAZBAEchCAwBCyAFQQFKDQFBAkEBIAYgCigCFCIIQQZxQQZHIAhzQQFxaiIIQQFGG0EGIAgbIQgLAkAgCEEDcUECRg0AQQEhDAJAIAJBAUgNACADQQFIDQBBACAIQQFxayEKIANBB3EhBAJAIANBCEkNACADQfj///8HcSENA0ACQCACRSIIDQAgACAKIAL8CwALIAAgAWohDgJAIAgNACAOIAogAvwLAAsgDiABaiEOAkAgCA0AIA4gCiAC/AsACyAOIAFqIQ4CQCAIDQAgDiAKIAL8CwALIA4gAWohDgJAIAgNACAOIAogAvwLAAsgDiABaiEOAkAgCA0AIA4gCiAC/AsACyAOIAFqIQ4CQCAIDQAgDiAKIAL8CwALIA4gAWohDgJAIAgNACAOIAogAvwLAAsgDiABaiEAIA1BeGoiDQ0ACyAERQ0BCwNAAkAgAkUNACAAIAogAvwLAAsgACABaiEAIARBf2oiBA0ACwsgCyAJNgIADAMLQQAgCigCECIEayAEIAhBBHEbIQwgCigCCCEIAkAgAkEQRw0AIANBEEcNACAAIAEgCCAKKAIMIAopAwAgDBCHgICAAAwCCyACQQFIDQEgA0EBSA0BIAooAgwiBCAEQR91Ig5zIA5rIAggCEEfdSIOcyAOa2qtQgmGIQ8gBKwgCKx8QgmGIRAgACABaiERIAFBBHQhEiAAIAFBAXRqIRMgACABQQNsaiEUIAAgAUECdGohFSAAIAFBBWxqIRYgACABQQZsaiEXIAAgAUEHbGohBSAAIAFBA3RqIQYgACABQQlsaiEYIAAgAUEKbGohGSAAIAFBC2xqIRogACABQQxsaiEbIAAgAUENbGohHCAAIAFBDmxqIR0gACABQQ9saiEeQgAhHwNAIB9CBIghIEEAIQhCACEhA0AgACAIaiEEAkACQCAQIAopAwAgICAKKAIMIg6sfiAhIAooAggiDax+fEIKhn0iIn0iIyAjQj+HIiSFICR9IA9UDQAgBCAMICNCIIinc0Efda1C/wGDQoGChIiQoMCAAX4iIzcACCAEICM3AAAgESAIaiIEICM3AAggBCAjNwAAIBMgCGoiBCAjNwAIIAQgIzcAACAUIAhqIgQgIzcACCAEICM3AAAgFSAIaiIEICM3AAggBCAjNwAAIBYgCGoiBCAjNwAIIAQgIzcAACAXIAhqIgQgIzcACCAEICM3AAAgBSAIaiIEICM3AAggBCAjNwAAIAYgCGoiBCAjNwAIIAQgIzcAACAYIAhqIgQgIzcACCAEICM3AAAgGSAIaiIEICM3AAggBCAjNwAAIBogCGoiBCAjNwAIIAQgIzcAACAbIAhqIgQgIzcACCAEICM3AAAgHCAIaiIEICM3AAggBCAjNwAAIB0gCGoiBCAjNwAIIAQgIzcAACAeIAhqIgQgIzcACCAEICM3AAAMAQsgBCABIA0gDiAiIAwQh4CAgAALICFCAXwhISACIAhBEGoiCEoNAAsgESASaiERIBMgEmohEyAUIBJqIRQgFSASaiEVIBYgEmohFiAXIBJqIRcgBSASaiEFIAYgEmohBiAYIBJqIRggGSASaiEZIBogEmohGiAbIBJqIRsgHCASaiEcIB0gEmohHSAeIBJqIR4gACASaiEAIAMgH0IQfCIfp0oNAAwCCwsCQCACQRBHDQAgA0EQRw0AIAdB0ABqQQBBgAT8CwAgB0EANgJAIAf9DAAAAAAAAAAAAAAAAAAAAAAiJf0LBDAgByAl/QsEIEEAIRQDQCAHQSBqIAooAiAiBEEGdSIOQQFqIhdBAXRqIgggCC8BACAKKAIUIg1BAnRBBHEiCCAIQQRzIAggDUEEcRsgCigCGBsiDCAIIA1BAnEiFRsiAiAEQT9xIg1sazsBACAHQSBqIA5BAXRqIhEgAiANQcD/A3JsIBEvAQBqOwEAIAdBIGogCigCJCICQQZ1IhNBAXRqIhFBAmoiFiAWLwEAIAggDCAVGyIIIAJBP3EiDGxqOwEAIBEgES8BACAIQcAAIAxrbGo7AQACQCAEIAJGDQAgCikDACEhIAo0AgwhJCAKNAIQISMgCjQCCCEiIAdBADsBACAHICMgIn5CgICAgICAgAF8QjKHIiKnIgg7AQIgByAIQQ9sOwEeIAcgCEEObDsBHCAHIAhBDWw7ARogByAIQQxsOwEYIAcgCEELbDsBFiAHIAhBCmw7ARQgByAI/RD9DAIAAwAEAAUABgAHAAgACQD9lQH9CwIEICQgI35CgICAgICAgAF8QjKHpyICIAJBH3UiBHMgBGshFSAIIAhBH3UiBHMgBGshESAjICFCFYZCIId+QoCAgICAgAR8Qi2IICJCAYggDiACbK18fachBAJAAkAgDQ0AIA4hFwwBCyAHQdAAaiAOQQV0aiEIAkAgEyAORw0AIAggCP0ABAAgBMH9ESImIAf9AAQAIif9pwH9sQEgDCANayIEQQR0IBFrQYAIasEiDkGACCAOQYAISBtBA3TBIg79ESIo/bUBQRD9rAEiKSAEIBEgFSAEbEEGdSITIBEgE0gbQQ50QYCAAmpBEHUiESAMIA1qIAJsQQd1Ig1qIA5sQRB2a8H9ESIq/a4BIiv9DAAAAAAAAAAAAAAAAAAAAAAiJf0/ICsgBEEBdP0RIiz9tgH9TiApIAQgDSARayAObEEQdmvB/REiK/2uASIpICX9PyApICz9tgH9Tv2uAf0M//8AAP//AAD//wAA//8AACIp/U4gJiAn/agB/bEBICj9tQFBEP2sASInICr9rgEiLSAl/T8gLSAs/bYB/U4gJyAr/a4BIicgJf0/ICcgLP22Af1O/a4BICn9Tv2GAf2OAf0LBAAgCCAI/QAEECAmIAf9AAQQIif9pwH9sQEgKP21AUEQ/awBIi0gKv2uASIuICX9PyAuICz9tgH9TiAtICv9rgEiLSAl/T8gLSAs/bYB/U79rgEgKf1OICYgJ/2oAf2xASAo/bUBQRD9rAEiJiAq/a4BIiggJf0/ICggLP22Af1OICYgK/2uASImICX9PyAmICz9tgH9Tv2uASAp/U79hgH9jgH9CwQQDAILIAggCP0ABAAgBMH9ESImIAf9AAQAIif9pwH9sQFBwAAgDWsiDkEEdCARa0GACGrBIhZBgAggFkGACEgbQQN0wSIW/REiKP21AUEQ/awBIikgDiARIBUgDmxBBnYiGCARIBhJG0EOdEGAgAJqQRB2IhggDUHAAHIgAmxBB3UiDWogFmxBEHZrwf0RIir9rgEiK/0MAAAAAAAAAAAAAAAAAAAAACIl/T8gKyAOQQF0/REiLP22Af1OICkgDiANIBhrIBZsQRB2a8H9ESIr/a4BIikgJf0/ICkgLP22Af1O/a4B/Qz//wAA//8AAP//AAD//wAAIin9TiAmICf9qAH9sQEgKP21AUEQ/awBIicgKv2uASItICX9PyAtICz9tgH9TiAnICv9rgEiJyAl/T8gJyAs/bYB/U79rgEgKf1O/YYB/Y4B/QsEACAIIAj9AAQQICYgB/0ABBAiJ/2nAf2xASAo/bUBQRD9rAEiLSAq/a4BIi4gJf0/IC4gLP22Af1OIC0gK/2uASItICX9PyAtICz9tgH9Tv2uASAp/U4gJiAn/agB/bEBICj9tQFBEP2sASImICr9rgEiKCAl/T8gKCAs/bYB/U4gJiAr/a4BIiYgJf0/ICYgLP22Af1O/a4BICn9Tv2GAf2OAf0LBBAgBCACayEECwJAIBMgF0wNACATIBdrIQ4gB0HQAGogF0EFdGohCCAH/QAEECIl/agBISkgJf2nASEnIAf9AAQAIiX9qAEhLSAl/acBIS4gESAVIBEgFUkbQQ50QYCAAmpBEHYiDUGAgIAQIAJBD3RBgIB8cWtBEHUiFmrB/REhJiAWIA1rwf0RISgDQCAIIAj9AAQAIATB/REiKiAu/bEBIisgJv2uAf0MAAAAAAAAAAAAAAAAAAAAACIl/bgB/QwABAAAAAQAAAAEAAAABAAAIiz9tgEgKyAo/a4BICX9uAEgLP22Af2uAUED/a0BICogLf2xASIrICb9rgEgJf24ASAs/bYBICsgKP2uASAl/bgBICz9tgH9rgFBA/2tAf2GAf2OAf0LBAAgCEEQaiINIA39AAQAICogJ/2xASIrICb9rgEgJf24ASAs/bYBICsgKP2uASAl/bgBICz9tgH9rgFBA/2tASAqICn9sQEiKiAm/a4BICX9uAEgLP22ASAqICj9rgEgJf24ASAs/bYB/a4BQQP9rQH9hgH9jgH9CwQAIAhBIGohCCAEIAJrIQQgDkF/aiIODQALCyAMRQ0AIAdB0ABqIBNBBXRqIgggCP0ABAAgBMH9ESImIAf9AAQAIif9pwH9sQEgDEEEdEGACHIgEWvBIgRBgAggBEGACEgbQQN0wSIE/REiKP21AUEQ/awBIikgDCARIBUgDGxBBnYiDiARIA5IG0EOdEGAgAJqQRB2Ig4gDCACbEEHdSINaiAEbEEQdmvB/REiKv2uASIr/QwAAAAAAAAAAAAAAAAAAAAAIiX9PyArIAxBAXT9ESIs/bYB/U4gKSAMIA0gDmsgBGxBEHZrwf0RIiv9rgEiKSAl/T8gKSAs/bYB/U79rgH9DP//AAD//wAA//8AAP//AAAiKf1OICYgJ/2oAf2xASAo/bUBQRD9rAEiJyAq/a4BIi0gJf0/IC0gLP22Af1OICcgK/2uASInICX9PyAnICz9tgH9Tv2uASAp/U79hgH9jgH9CwQAIAggCP0ABBAgJiAH/QAEECIn/acB/bEBICj9tQFBEP2sASItICr9rgEiLiAl/T8gLiAs/bYB/U4gLSAr/a4BIi0gJf0/IC0gLP22Af1O/a4BICn9TiAmICf9qAH9sQEgKP21AUEQ/awBIiYgKv2uASIoICX9PyAoICz9tgH9TiAmICv9rgEiJiAl/T8gJiAs/bYB/U79rgEgKf1O/YYB/Y4B/QsEEAsgCkEoaiEKIBRBAWoiFCAFRw0ACyAGQQh0IQRBACEKIAdB0ABqIQgDQCAAIAj9AAQAIAdBIGogCmovAQAgBGoiBP0QIiz9jgH9gAH9DP8A/wD/AP8A/wD/AP8A/wAiJf2WASAl/U4gCP0ABBAgLP2OAf2AASAl/ZYBICX9Tv1m/QsAACAIQSBqIQggACABaiEAIApBAmoiCkEgRw0ADAILC0EAIQwgBEEBcyINQQJ0IggoAoiAhIAAIg5BACgCmICEgAAgBWtKDQEgCEGIgISAAGohESAIKAKAgISAACEIQQAhDCAHQQA2AlAgB0EANgIgIAcgBjYCACAIIA5BKGxqIQgCQCACIANMDQAgCiAFIAogB0HQAGogCCAHQSBqIAdBwABBICACQX9qQQF2Z2siE3QQhICAgAAhCCALIAcoAlAiCiAJajYCACARIAcoAiAiFCAOajYCACAIRQ0CIAAgAUEBIBN0IgggAyAEIAogBhCGgICAAEUNAiAAIAhqIAEgAiAIayADIA0gFCAHKAIAEIaAgIAAIQwMAgsgCiAFIAogB0HQAGogCCAHQSBqIAdBwABBICADQX9qQQF2Z2siE3QQhYCAgAAhCCALIAcoAlAiCiAJajYCACARIAcoAiAiFCAOajYCACAIRQ0BIAAgASACQQEgE3QiCCAEIAogBhCGgICAAEUNASAAIAEgE3RqIAEgAiADIAhrIA0gFCAHKAIAEIaAgIAAIQwMAQsgCyAJNgIAQQEhDAsgB0HQBGokgICAgAAgDAvIBggBfwF+An8BewR/AXsEfwp7QRAhBiAFrCIHIAKsfkKAgICAgICAAXxCMoenIgIgAkEfdSIFcyAFayIIIAcgA6x+QoCAgICAgIABfEIyh6ciBSAFQR91IgNzIANrIgMgCCADSRtBDnRBgIACakEQdiID/RAgAyACav0aASACQQF0IgggA2r9GgIgAkEDbCIJIANq/RoD/acBIQogAkEMbCILIANq/RAgAkENbCIMIANq/RoBIAJBDmwiDSADav0aAiACQQ9sIg4gA2r9GgP9pwEhDyACQQN0IhAgA2r9ECACQQlsIhEgA2r9GgEgAkEKbCISIANq/RoCIAJBC2wiEyADav0aA/2nASEUIAsgA2v9ECAMIANr/RoBIA0gA2v9GgIgDiADa/0aA/2nASEVIBAgA2v9ECARIANr/RoBIBIgA2v9GgIgEyADa/0aA/2nASEWIAJBAnQiCyADav0QIAJBBWwiDCADav0aASACQQZsIg0gA2r9GgIgAkEHbCIOIANq/RoD/acBIRcgCyADa/0QIAwgA2v9GgEgDSADa/0aAiAOIANr/RoD/acBIRhBACADa/0QIAIgA2v9GgEgCCADa/0aAiAJIANr/RoD/acBIRkgBEIVhkIghyAHfkKAgICAgIAEfEItiCACIAVqQQF1rX2nQYAEaiEDA0AgACADwf0RIhogCv2xAf0MAAAAAAAAAAAAAAAAAAAAACIb/bgB/QwABAAAAAQAAAAEAAAABAAAIhz9tgEgGiAZ/bEBIBv9uAEgHP22Af2uAUED/a0B/Qz/AAAA/wAAAP8AAAD/AAAAIh39twEgGiAX/bEBIBv9uAEgHP22ASAaIBj9sQEgG/24ASAc/bYB/a4BQQP9rQEgHf23Af0NAAQIDBAUGBwAAAAAAAAAACAaIBT9sQEgG/24ASAc/bYBIBogFv2xASAb/bgBIBz9tgH9rgFBA/2tASAd/bcBIBogD/2xASAb/bgBIBz9tgEgGiAV/bEBIBv9uAEgHP22Af2uAUED/a0BIB39twH9DQAECAwQFBgcAAAAAAAAAAD9DQABAgMEBQYHEBESExQVFhf9CwAAIAMgBWshAyAAIAFqIQAgBkF/aiIGDQALCwCiAQRuYW1lAA4NYXNzLWZpbGwud2FzbQF3CAANYXNzX2ZpbGxfcGF0aAEIYWRkX2xpbmUCDWFkZF9xdWFkcmF0aWMDCWFkZF9jdWJpYwQPcG9seV9zcGxpdF9ob3J6BQ9wb2x5X3NwbGl0X3ZlcnQGCmZpbGxfbGV2ZWwHE2ZpbGxfaGFsZnBsYW5lX3RpbGUHEgEAD19fc3RhY2tfcG9pbnRlcgApCXByb2R1Y2VycwEMcHJvY2Vzc2VkLWJ5AQVjbGFuZwkyMy4wLjBnaXQAnQEPdGFyZ2V0X2ZlYXR1cmVzCSsLYnVsay1tZW1vcnkrD2J1bGstbWVtb3J5LW9wdCsWY2FsbC1pbmRpcmVjdC1vdmVybG9uZysKbXVsdGl2YWx1ZSsPbXV0YWJsZS1nbG9iYWxzKxNub250cmFwcGluZy1mcHRvaW50Kw9yZWZlcmVuY2UtdHlwZXMrCHNpZ24tZXh0KwdzaW1kMTI4";
+	"AGFzbQEAAAABbwpgCn9/f39/f39/f38Bf2ADf39/AX9gBX9/f39/AX9gCH9/f39/f39/AX9gBH9/f38Bf2AHf39/f39/fwF/YAl/f39/f39/f38Bf2AGf39/f35/AGAJf39/f39/f39/AGALf39/f39/f39/f38BfwMODQABAgMEBQYDAwcICQAEBQFwAQEBBQUBARCACAYPAn8BQeCIBAt/AEHgiAQLBz0EBm1lbW9yeQIADWFzc19maWxsX3BhdGgAABJhc3NfZmlsbF9wYXRoX2NsaXAACwtfX2hlYXBfYmFzZQMBCol+DZsEAgJ/AXsjgICAgABBEGsiCiSAgICAAEEAIQtBACAGNgKEiICAAEEAIAQ2AoCIgIAAQQAgBjYCoIiAgABBACAFNgLIiICAAEEAIAc2AsyIgIAAQQAgCDYC0IiAgAACQEGAiICAACAAIAEQgYCAgABFDQBBASELAkAgAyACbCIHQQFIDQBBACEFAkAgB0EQSQ0AIAdBcHEiBUFwaiIGQQR2QQFqIghBB3EhAUEAIQACQCAGQfAASQ0AIAhB+P///wFxIQhBACEAA0AgCSAAaiIG/QwAAAAAAAAAAAAAAAAAAAAAIgz9CwAAIAZB8ABqIAz9CwAAIAZB4ABqIAz9CwAAIAZB0ABqIAz9CwAAIAZBwABqIAz9CwAAIAZBMGogDP0LAAAgBkEgaiAM/QsAACAGQRBqIAz9CwAAIABBgAFqIQAgCEF4aiIIDQALCwJAIAFFDQAgCSAAaiEGA0AgBv0MAAAAAAAAAAAAAAAAAAAAAP0LAAAgBkEQaiEGIAFBf2oiAQ0ACwsgByAFRg0BCyAJIAVqIQYgByAFayEAA0AgBkEAOgAAIAZBAWohBiAAQX9qIgANAAsLQQAhBkEAKAKIiICAAEUNAAJAQYCIgIAAIAIgAyAKQQxqIApBCGoQgoCAgABFDQBBgIiAgAAgCSACIAIgA0EAIAooAgwgCigCCBCDgICAACEGCyAGIQsLIApBEGokgICAgAAgCwvbAwEJfyAA/QwAAAAAAAAAAP///3////9//QsCCEEAIQNBACAANgLUiICAACAAQoGAgICYgICAgH83AhgCQCACQQFIDQAgAUEMaiEAQQEhA0EAIQFBACEEQQAhBUEAIQZBACEHQQAhCANAAkACQCAAQXRqKAIAIgkNAEEBIQQgAEF4aigCACIIIQYgAEF8aigCACIHIQUMAQsCQCAJQQFHDQAgBEUNAEEBIQQgBiAFIABBeGooAgAiCSAAQXxqKAIAIgoQhICAgAAhCyAJIQYgCiEFIAsNAQwDCwJAIAlBAkcNACAERQ0AQQEhBCAGIAUgAEF4aigCACAAQXxqKAIAIAAoAgAiCSAAQQRqKAIAIgpBABCFgICAACELIAkhBiAKIQUgCw0BDAMLAkAgCUEDRw0AIARFDQBBASEEIAYgBSAAQXhqKAIAIABBfGooAgAgACgCACAAQQRqKAIAIABBCGooAgAiCSAAQQxqKAIAIgpBABCGgICAACELIAkhBiAKIQUgCw0BDAMLIAlBBEcNACAERQ0AQQEhBCAGIAUgCCAHEISAgIAAIQkgCCEGIAchBSAJRQ0CCyAAQSBqIQAgAUEBaiIBIAJIIQMgAiABRw0ACwsgA0F/c0EBcQv7AgEEfyOAgICAAEEQayIFJICAgIAAIAAoAgAhBiAFIAAoAggiBzYCDEEAIQggBUEANgIIIAVBADYCBAJAAkAgACgCGCABQQZ0IgFIDQAgBiAHIAYgBUEMaiAAKAIEIAVBBGogBUEIaiABEIeAgIAARQ0BIAVBADYCCCAAKAIAIQYLAkAgACgCHCACQQZ0IgFIDQAgBiAFKAIMIAYgBUEMaiAAKAIEIAVBBGogBUEIaiABEIiAgIAARQ0BIAVBADYCCCAAKAIAIQYLQQAhCAJAIAAoAhBBAEoNACAGIAUoAgwgACgCBCAFQQRqIAYgBUEMaiAFQQhqQQAQh4CAgABFDQEgACgCACEGCwJAIAAoAhRBAEoNAEEAIQggBiAFKAIMIAAoAgQgBUEEaiAGIAVBDGogBUEIakEAEIiAgIAARQ0BCyAAIAUoAgwiBjYCCCAAQQxqQQA2AgAgAyAGNgIAIAQgBSgCCDYCAEEBIQgLIAVBEGokgICAgAAgCAuIKQYJfwF7A38IfgF/CXsjgICAgABB0ARrIggkgICAgAAgACAFQQJ0aiIJKAIAIgogCUEIaiILKAIAIAZrIgxBKGxqIQ0CQAJAAkACQAJAIAYNACAHQQBHIQkMAQsgBkEBSg0BQQJBASAKIAxBKGxqKAIUIglBAXEgCUEGcUEGR3MgB2oiCUEBRhtBBiAJGyEJCwJAIAlBA3FBAkYNAEEBIQ4CQCADQQFIDQAgBEEBSA0AIANBcHEhBSADQXBqIgpBBHZBAWoiDUH4////AXEhDyANQQdxIRBBACAJQQFxayIN/Q8hEUEAIQAgA0EQSSESIApB8ABJIRMDQEEAIQkCQAJAIBINAEEAIQoCQCATDQBBACEKIA8hFANAIAEgCmoiCSAR/QsAACAJQfAAaiAR/QsAACAJQeAAaiAR/QsAACAJQdAAaiAR/QsAACAJQcAAaiAR/QsAACAJQTBqIBH9CwAAIAlBIGogEf0LAAAgCUEQaiAR/QsAACAKQYABaiEKIBRBeGoiFA0ACwsCQCAQRQ0AIAEgCmohCSAQIQoDQCAJIBH9CwAAIAlBEGohCSAKQX9qIgoNAAsLIAUhCSAFIANGDQELA0AgASAJaiANOgAAIAMgCUEBaiIJRw0ACwsgASACaiEBIABBAWoiACAERw0ACwsgCyAMNgIADAMLIAlBAnFFDQBBACAKIAxBKGxqIhQoAhAiAGsgACAJQQRxGyEFIBQoAgghCQJAIANBEEcNACAEQRBHDQAgASACIAkgCiAMQShsaigCDCANKQMAIAUQiYCAgAAMAgsgBEEBSA0BIANBAUgNASAUQQhqIRIgFCgCDCIKIApBH3UiAGogAHMgCSAJQR91IgBqIABzaq1CCYYhFSAUQQxqIRAgCqwgCax8QgmGIRZCACEXA0AgF0IEiCEYIAEgF6cgAmxqIQBCACEZA0AgACAZp2ohCgJAAkAgFiANKQMAIBggECgCACIJrH4gGUIEiCASKAIAIhSsfnxCCoZ9Ihp9IhsgG0I/hyIcfCAchSAVVA0AIAogBSAbQiCIp3NBH3UiCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAACAKIAJqIgogCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAACAKIAJqIgogCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAACAKIAJqIgogCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAACAKIAJqIgogCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAACAKIAJqIgogCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAACAKIAJqIgogCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAACAKIAJqIgogCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAACAKIAJqIgogCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAACAKIAJqIgogCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAACAKIAJqIgogCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAACAKIAJqIgogCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAACAKIAJqIgogCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAACAKIAJqIgogCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAACAKIAJqIgogCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAACAKIAJqIgogCToADyAKIAk6AA4gCiAJOgANIAogCToADCAKIAk6AAsgCiAJOgAKIAogCToACSAKIAk6AAggCiAJOgAHIAogCToABiAKIAk6AAUgCiAJOgAEIAogCToAAyAKIAk6AAIgCiAJOgABIAogCToAAAwBCyAKIAIgFCAJIBogBRCJgICAAAsgGUIQfCIZpyADSA0ACyAXQhB8IhenIARIDQAMAgsLAkAgA0EQRw0AIARBEEcNAEEAIQUgCEHQAGpBAEGABPwLACAIQSBqQSBqQQA2AgAgCEEgakEQav0MAAAAAAAAAAAAAAAAAAAAACIR/QsEACAIIBH9CwQgAkAgBkEBSA0AQQAhBANAIAhBIGogDSgCICIKQQZ1IgNBAWoiD0EBdGoiCSAJLwEAIA0oAhQiFEECdEEEcSIJIAlBBHMgCSAUQQRxGyANKAIYGyISIAkgFEECcSITGyIUIApBP3EiHWwiAGs7AQAgCEEgaiADQQF0aiIQIAAgEC8BAGogFEEGdGs7AQAgCEEgaiANKAIkIhRBBnUiEEEBdGoiAEECaiIOIA4vAQAgCSASIBMbIgkgFEE/cSISbCITajsBACAAIAlBBnQgE2sgAC8BAGo7AQACQCAKIBRGDQAgDSkDACEbIA00AgwhHCANNAIQIRkgDTQCCCEaIAhBADsBACAIIBkgGn5CgICAgICAgAF8QiKHpyIKQRB1Igk7AQIgCCAJQQ9sOwEeIAggCUEObDsBHCAIIAlBDWw7ARogCCAJQQxsOwEYIAggCUELbDsBFiAIIAlBCmw7ARQgCCAJQQlsOwESIAggCUEDdDsBECAIIAlBB2w7AQ4gCCAJQQZsOwEMIAggCUEFbDsBCiAIIAlBAnQ7AQggCCAJQQNsOwEGIAggCUEBdDsBBCAcIBl+QoCAgICAgIABfEIyh6ciACAAQR91IhRqIBRzIQ4gCSAKQR91IhRqIBRzIRMgGSAbQhWGQiCHfkKAgICAgIAEfEItiCAKQRF1rSADIABsrXx9pyEKAkACQCAdDQAgAyEPDAELAkAgECADRw0AIAhB0ABqIAMgEyAIIAAgDiAKQRB0QRB1IB0gEhCKgICAAAwCCyAIQdAAaiADIBMgCCAAIA4gCkEQdEEQdSAdQcAAEIqAgIAAIAogAGshCgsCQCAPIBBODQAgECAPayEDIAj9AAQQIhEgEf0NCAkAAAoLAAAMDQAADg8AAEEQ/asBQRD9rAEhHiARIBH9DQABAAACAwAABAUAAAYHAABBEP2rAUEQ/awBIR8gCP0ABAAiESAR/Q0ICQAACgsAAAwNAAAODwAAQRD9qwFBEP2sASEgIBEgEf0NAAEAAAIDAAAEBQAABgcAAEEQ/asBQRD9rAEhISAIQdAAaiAPQQV0aiEJQYCAgBAgAEEPdEGAgHxxa0EQdSIUIBMgDiATIA5JG0EOdEGAgAJqQRB2Ig9rQRB0QRB1/REhIiAPIBRqQRB0QRB1/REhIwNAIAkgCf0ABAAgCkEQdEEQdf0RIiQgIf2xASIlICP9rgH9DAAEAAAABAAAAAQAAAAEAAAiEf22Af0MAAAAAAAAAAAAAAAAAAAAACIm/bgBICUgIv2uASAR/bYBICb9uAH9rgFBA/2tASAkICD9sQEiJSAj/a4BIBH9tgEgJv24ASAlICL9rgEgEf22ASAm/bgB/a4BQQP9rQH9hgH9jgH9CwQAIAlBEGoiFCAU/QAEACAkIB/9sQEiJSAj/a4BIBH9tgEgJv24ASAlICL9rgEgEf22ASAm/bgB/a4BQQP9rQEgJCAe/bEBIiQgI/2uASAR/bYBICb9uAEgJCAi/a4BIBH9tgEgJv24Af2uAUED/a0B/YYB/Y4B/QsEACAJQSBqIQkgCiAAayEKIANBf2oiAw0ACwsgEkUNACAIQdAAaiAQQQV0aiIJIAn9AAQA/QwAAAAAAAAAAAAAAAAAAAAAIhEgCkEQdEEQdf0RIiIgCP0ABAAiHyAR/Q0AAQAAAgMAAAQFAAAGBwAAQRD9qwFBEP2sAf2xASASQQR0IBNrQYAIaiIKQYAIIApBEHRBEHVBgAhIG0ETdEEQdSIK/REiI/21AUEQ/awBIh4gEiATIBIgDmxBCnRBEHUiAyADIBNKG0EOdEGAgAJqQRB1IgMgEiAAbEEJdEEQdSIUaiAKbEEQdmtBEHRBEHX9ESIk/a4BIiUgEkEBdP0RIib9tgEgJSAR/Tn9UiARIB4gEiAUIANrIApsQRB2a0EQdEEQdf0RIiX9rgEiHiAm/bYBIB4gEf05/VL9rgH9DP//AAD//wAA//8AAP//AAAiHv1OIBEgIiAfIBH9DQgJAAAKCwAADA0AAA4PAABBEP2rAUEQ/awB/bEBICP9tQFBEP2sASIfICT9rgEiICAm/bYBICAgEf05/VIgESAfICX9rgEiHyAm/bYBIB8gEf05/VL9rgEgHv1O/YYB/Y4B/QsEACAJIAn9AAQQIBEgIiAI/QAEECIfIBH9DQABAAACAwAABAUAAAYHAABBEP2rAUEQ/awB/bEBICP9tQFBEP2sASIgICT9rgEiISAm/bYBICEgEf05/VIgESAgICX9rgEiICAm/bYBICAgEf05/VL9rgEgHv1OIBEgIiAfIBH9DQgJAAAKCwAADA0AAA4PAABBEP2rAUEQ/awB/bEBICP9tQFBEP2sASIiICT9rgEiIyAm/bYBICMgEf05/VIgESAiICX9rgEiIiAm/bYBICIgEf05/VL9rgEgHv1O/YYB/Y4B/QsEEAsgDUEoaiENIARBAWoiBCAGRw0ACwsgB0EIdCEKIAhB0ABqIQkDQCABIAn9AAQAIAhBIGogBWovAQAgCmoiCv0QIhH9jgH9gAH9DP8A/wD/AP8A/wD/AP8A/wAiJv2WASAR/Q0AAgQGCAoMDgAAAAAAAAAAIAlBEGr9AAQAIBH9jgH9gAEgJv2WASAR/Q0AAgQGCAoMDgAAAAAAAAAA/Q0AAQIDBAUGBxAREhMUFRYX/QsAACAJQSBqIQkgASACaiEBIAVBAmoiBUEgRw0ADAILC0EAIQ5BACEKAkAgAyAEIAMgBEoiEhtBf2oiCUECSQ0AQQAhCgNAIApBAWohCiAJQQNLIRQgCUEBdiEJIBQNAAsLIAggBzYCACAAIAVBAXMiFEECdGpBCGoiECgCACIJQQAoAsyIgIAAIAZrSg0BIAAgFEECdGooAgAgCUEobGohD0EBIAp0IhNBBnQhHQJAAkAgEg0AIA0gBiANIAhB0ABqIA8gCEEgaiAIIB0QiICAgAAhDQwBCyANIAYgDSAIQdAAaiAPIAhBIGogCCAdEIeAgIAAIQ0LIAsgCCgCUCIPIAxqNgIAIBAgCCgCICIGIAlqNgIAIA1FDQECQCASDQAgACABIAIgAyATIAUgDyAHEIOAgIAARQ0CIAAgASACIAp0aiACIAMgBCATayAUIAYgCCgCABCDgICAAEEARyEODAILIAAgASACIBMgBCAFIA8gBxCDgICAAEUNASAAIAEgE2ogAiADIBNrIAQgFCAGIAgoAgAQg4CAgABBAEchDgwBCyALIAw2AgBBASEOCyAIQdAEaiSAgICAACAOC+8DAgl/AX5BASEEAkAgAiAAayIFIAMgAWsiBnJFDQBBACEEQQAoAtSIgIAAIgcoAggiCEEAKALIiICAAE4NAEEBIQQgByAIQQFqNgIIIAcoAgAgCEEobGoiCCAAIAIgAiAAShsiCTYCGCAIIAAgAiACIABIGyIKNgIcIAggASADIAMgAUobIgs2AiAgCCAGNgIIQQAhAiAIQQAgBWsiDDYCDCAIIAEgAyADIAFIGyIDNgIkIAggBqwgAKx+IAWsIAGsfn0iDTcDACAIQT5BPCAFQQBIGyIAIABBA3MgBkEASBs2AhQgByAHKAIQIgAgCSAAIAlIGzYCECAHIAcoAhgiACAKIAAgCkobNgIYIAcgBygCFCIAIAsgACALSBs2AhQgByAHKAIcIgAgAyAAIANKGzYCHCAIQQxqIQcgCEEIaiEJAkAgBSAFQR91IgBqIABzIgAgBiAGQR91IgFqIAFzIgEgACABSxsiA0ECSQ0AQQAhAiADIQADQCACQQFqIQIgAEEDSyEBIABBAXYhACABDQALCyAHIAxBHiACayIAdDYCACAJIAYgAHQ2AgAgCCANIACthjcDACAIIANBHyACa3StIg0gDX5CIIhCs+bMmQV+QiCIIA1C78+a3gt+QiCIfULNxMHACHw+AhALIAQLpQIGAX8CfgF/A34BfwF+AkACQCAGQR9KDQAgBSABayIHrCIIIAMgAWusIgl+IAQgAGsiCqwiCyACIABrrCIMfnwiDUIAIAogCkEfdSIOaiAOcyIKIAcgB0EfdSIOaiAOcyIHIAogB0sbrUIEhiIPfVMNASANIAggCH4gCyALfnwgD3xVDQEgCyAJfiAIIAx+fSIIIAhCP4ciCHwgCIUgD1YNAQsgACABIAQgBRCEgICAAA8LAkAgACABIAIgAGpBAXUgAyABakEBdSAAIAJBAXRqIARqQQJqQQJ1IgcgASADQQF0aiAFakECakECdSIKIAZBAWoiBhCFgICAAA0AQQAPCyAHIAogBCACakEBdSAFIANqQQF1IAQgBSAGEIWAgIAAQQBHC7UDBgF/An4BfwN+AX8DfgJAAkAgCEEfSg0AIAcgAWsiCawiCiADIAFrrCILfiAGIABrIgysIg0gAiAAa6wiDn58Ig9CACAMIAxBH3UiEGogEHMiDCAJIAlBH3UiEGogEHMiCSAMIAlLG61CBIYiEX0iElMNASAPIBEgCiAKfiANIA1+fHwiE1UNASANIAt+IAogDn59Ig8gD0I/hyIPfCAPhSARVg0BIAogBSABa6wiC34gDSAEIABrrCIOfnwiDyASUw0BIA8gE1UNASANIAt+IAogDn59IgogCkI/hyIKfCAKhSARVg0BCyAAIAEgBiAHEISAgIAADwsCQCAAIAEgAiAAakEBdSADIAFqQQF1IAAgAkEBdGogBGpBAmpBAnUgASADQQF0aiAFakECakECdSAAIAZqIAQgAmpBA2xqQQNqQQN1IgkgASAHaiAFIANqQQNsakEDakEDdSIMIAhBAWoiCBCGgICAAA0AQQAPCyAJIAwgAiAEQQF0aiAGakECakECdSADIAVBAXRqIAdqQQJqQQJ1IAYgBGpBAXUgByAFakEBdSAGIAcgCBCGgICAAEEARwuWCAQCfwF+A38CfiAFQQA2AgAgA0EANgIAQQEhCAJAIAFBAUgNACAAQSRqIQBBACgCyIiAgAAhCSAHrCEKA0AgAEFwaigCACEIQQAhCwJAIABBfGoiDCgCAA0AIAhBEHFFDQBBf0EBIABBZGooAgBBf0obIQsLAkACQCAIQQhxRQ0AIABBeGooAgAgB0whDQwBC0IAIABBXGopAwAgACAMIAhBAnEbNAIAIABBaGo0AgB+IABBZGo0AgAiDiAKfnx9Ig99IA8gDkIAVRtCP4inQQFzIQ0LAkACQAJAIA1FDQAgBiAGKAIAIAtqNgIAIABBdGooAgAgB04NAgJAIAMoAgAiCCAJSA0AQQAPCyACIAhBKGxqIgggAEFcaiIL/QADAP0LAwAgCEEgaiALQSBqKQMANwMAIAhBEGogC0EQav0AAwD9CwMAIAIgAygCAEEobGoiCCAIKAIcIgggByAIIAdIGzYCHCADIQgMAQsCQAJAIAhBBHFFDQAgAEF0aigCACAHTiENDAELQgAgAEFcaikDACAMIAAgCEECcRs0AgAgAEFoajQCAH4gAEFkajQCACIOIAp+fH0iD30gDyAOQgBTG0I/iKdBAXMhDQsCQAJAIA1FDQACQCAFKAIAIgggCUgNAEEADwsgBCAIQShsaiIIIABBXGoiC/0AAwD9CwMAIAhBIGogC0EgaikDADcDACAIQRBqIAtBEGr9AAMA/QsDACAEIAUoAgBBKGxqIgsgCygCHCAHazYCHCALIAspAwAgCzQCCCAKfn03AwAgCyALKAIYIAdrIghBACAIQQBKIg0bNgIYIAUhCCANDQIgBSEIIAsoAhQiDUEGcUEGRw0CIAtBFGogDUFvcTYCAAwBCwJAIAhBAnFFDQAgBiAGKAIAIAtqNgIAC0EAIQggAygCACILIAlODQQgBSgCACAJTg0EIAIgC0EobGoiCCAAQVxqIgv9AAMA/QsDACAIQSBqIAtBIGopAwA3AwAgCEEQaiALQRBq/QADAP0LAwAgBCAFKAIAQShsaiIIQRBqIAIgAygCAEEobGoiC0EQav0AAwD9CwMAIAggC/0AAwD9CwMAIAhBIGogC0EgaikDADcDACAIQRhqQQA2AgAgCCAIKQMAIAtBCGo0AgAgCn59NwMAIAggCCgCHCAHazYCHCALIAsoAhRBb3E2AhQgCyAHNgIcIAggCCgCFEFfcSIMNgIUIAhBFGohCCALQRRqIQ0CQCALKAIUIgtBAnFFDQAgDSAMNgIAIAggCzYCACANKAIAIQsLIA0gC0EIcjYCACAIIAgoAgBBBHI2AgAgAyADKAIAQQFqNgIACyAFIQgLIAggCCgCAEEBajYCAAsgAEEoaiEAIAFBf2oiAQ0AC0EBIQgLIAgL+wcFAn8BfgJ/An4BfyAFQQA2AgAgA0EANgIAQQEhCAJAIAFBAUgNAEEAKALIiICAACEJIAesIQoDQCAAQRRqKAIAIQhBACELAkAgAEEYaigCAA0AIAhBBHFFDQBBf0EBIABBDGooAgBBf0obIQsLAkACQCAIQSBxRQ0AIABBJGooAgAgB0whDAwBC0IAIAApAwAgAEEcQRggCEECcRtqNAIAIABBCGo0AgB+IABBDGo0AgAiDSAKfnx9Ig59IA4gDUIAVRtCP4inQQFzIQwLAkACQAJAIAxFDQAgBiAGKAIAIAtqNgIAIABBIGoiCCgCACAHTg0CAkAgAygCACILIAlIDQBBAA8LIAIgC0EobGoiCyAA/QADAP0LAwAgC0EgaiAIKQMANwMAIAtBEGogAEEQav0AAwD9CwMAIAIgAygCAEEobGoiCCAIKAIkIgggByAIIAdIGzYCJCADIQgMAQsCQAJAIAhBEHFFDQAgAEEgaigCACAHTiEMDAELQgAgACkDACAAQRhBHCAIQQJxG2o0AgAgAEEIajQCAH4gAEEMajQCACINIAp+fH0iDn0gDiANQgBTG0I/iKdBAXMhDAsCQAJAIAxFDQACQCAFKAIAIgggCUgNAEEADwsgBCAIQShsaiIIIAD9AAMA/QsDACAIQSBqIABBIGopAwA3AwAgCEEQaiAAQRBq/QADAP0LAwAgBCAFKAIAQShsaiILIAsoAiQgB2s2AiQgCyALKQMAIAs0AgwgCn59NwMAIAsgCygCICAHayIIQQAgCEEASiIMGzYCICAFIQggDA0CIAUhCCALKAIUIgxBEnFBEkcNAiALQRRqIAxBe3E2AgAMAQsCQCAIQQJxRQ0AIAYgBigCACALajYCAAtBACEIIAMoAgAiCyAJTg0EIAUoAgAgCU4NBCACIAtBKGxqIgggAP0AAwD9CwMAIAhBIGogAEEgaikDADcDACAIQRBqIABBEGr9AAMA/QsDACAEIAUoAgBBKGxqIghBIGoiDCACIAMoAgBBKGxqIgtBIGopAwA3AwAgCCAL/QADAP0LAwAgCEEQaiALQRBq/QADAP0LAwAgDEEANgIAIAggCCkDACALNAIMIAp+fTcDACAIIAgoAiQgB2s2AiQgCyALKAIUQXtxNgIUIAsgBzYCJCAIIAgoAhRBd3EiDzYCFCAIQRRqIQggC0EUaiEMAkAgCygCFCILQQJxRQ0AIAwgDzYCACAIIAs2AgAgDCgCACELCyAMIAtBIHI2AgAgCCAIKAIAQRByNgIAIAMgAygCAEEBajYCAAsgBSEICyAIIAgoAgBBAWo2AgALIABBKGohACABQX9qIgENAAtBASEICyAIC6EJBAF/AX4Hfwx7I4CAgIAAQcAAayIGIAWsIgcgAqx+QoCAgICAgIABfEIih6ciAkEQdSIIIAJBH3UiAmogAnMiAiAHIAOsfkKAgICAgICAAXxCIoenIgNBEHUiBSADQR91IgNqIANzIgMgAiADSRtBDnRBgIACakEQdiICOwEAIAZBACACazsBICAGIAggAms7ASIgBiAIIAJqOwECIAYgCEEBdCIDIAJrOwEkIAYgAyACajsBBCAGIAhBA2wiAyACazsBJiAGIAMgAmo7AQYgBiAIQQJ0IgMgAms7ASggBiADIAJqOwEIIAYgCEEFbCIDIAJrOwEqIAYgAyACajsBCiAGIAhBBmwiAyACazsBLCAGIAMgAmo7AQwgBiAIQQdsIgMgAms7AS4gBiADIAJqOwEOIAYgCEEDdCIDIAJrOwEwIAYgAyACajsBECAGIAhBCWwiAyACajsBEiAGIAhBCmwiCSACajsBFCAGIAhBC2wiCiACajsBFiAGIAhBDGwiCyACajsBGCAGIAhBDWwiDCACajsBGiAGIAhBDmwiDSACajsBHCAGIAhBD2wiDiACajsBHiAGIAMgAms7ATIgBiAJIAJrOwE0IAYgCiACazsBNiAGIAsgAms7ATggBiAMIAJrOwE6IAYgDSACazsBPCAGIA4gAms7AT4gBEIVhkIghyAHfkKAgICAgIAEfEItiCAIIAVqQQF2rX2nQYAEaiECIAb9AAQAIg8gD/0NCAkAAAoLAAAMDQAADg8AAEEQ/asBQRD9rAEhECAPIA/9DQABAAACAwAABAUAAAYHAABBEP2rAUEQ/awBIREgBv0ABCAiDyAP/Q0ICQAACgsAAAwNAAAODwAAQRD9qwFBEP2sASESIA8gD/0NAAEAAAIDAAAEBQAABgcAAEEQ/asBQRD9rAEhEyAG/QAEECIPIA/9DQgJAAAKCwAADA0AAA4PAABBEP2rAUEQ/awBIRQgDyAP/Q0AAQAAAgMAAAQFAAAGBwAAQRD9qwFBEP2sASEVIAb9AAQwIg8gD/0NCAkAAAoLAAAMDQAADg8AAEEQ/asBQRD9rAEhFiAPIA/9DQABAAACAwAABAUAAAYHAABBEP2rAUEQ/awBIRdBECEGA0AgACACQRB0QRB1/REiDyAR/bEB/QwABAAAAAQAAAAEAAAABAAAIhj9tgH9DAAAAAAAAAAAAAAAAAAAAAAiGf24ASAPIBP9sQEgGP22ASAZ/bgB/a4BQQP9rQH9DP8AAAD/AAAA/wAAAP8AAAAiGv23ASAPIBD9sQEgGP22ASAZ/bgBIA8gEv2xASAY/bYBIBn9uAH9rgFBA/2tASAa/bcB/Q0ABAgMEBQYHAAAAAAAAAAAIA8gFf2xASAY/bYBIBn9uAEgDyAX/bEBIBj9tgEgGf24Af2uAUED/a0BIBr9twEgDyAU/bEBIBj9tgEgGf24ASAPIBb9sQEgGP22ASAZ/bgB/a4BQQP9rQEgGv23Af0NAAQIDBAUGBwAAAAAAAAAAP0NAAECAwQFBgcQERITFBUWF/0LAAAgAiAFayECIAAgAWohACAGQX9qIgYNAAsLoAYCAn8KeyAIIAdrIgkgBCAIIAdqbEEJdEEQdSIIIAIgBSAJQRB0QRB1bEEKdEEQdSIHIAcgAkobQQ50QYCAAmpBEHUiB2sgCUEEdCACa0GACGoiAkGACCACQRB0QRB1QYAISBtBE3RBEHUiBGxBEHZrQRB0QRB1IQUgCSAHIAhqIARsQRB2a0EQdEEQdSEKIAlBEXRBEHUhCQJAAkAgACABQQV0aiIAIANBIGpPDQAgAEEgaiADTQ0AQQAhAgNAIAAgAmoiCCAILwEAQQAgCSAGIAMgAmouAQBrIARsQRB1IgcgCmoiCCAIIAlKGyAIQQBIG0EAIAkgByAFaiIIIAggCUobIAhBAEgbamo7AQAgAkECaiICQSBHDQAMAgsLIAAgAP0AAQD9DAAAAAAAAAAAAAAAAAAAAAAiCyAG/REiDCAD/QABACINIAv9DQABAAACAwAABAUAAAYHAABBEP2rAUEQ/awB/bEBIAT9ESIO/bUBQRD9rAEiDyAK/REiEP2uASIRIAn9ESIS/bYBIBEgC/05/VIgCyAPIAX9ESIR/a4BIg8gEv22ASAPIAv9Of1S/a4B/Qz//wAA//8AAP//AAD//wAAIg/9TiALIAwgDSAL/Q0ICQAACgsAAAwNAAAODwAAQRD9qwFBEP2sAf2xASAO/bUBQRD9rAEiDSAQ/a4BIhMgEv22ASATIAv9Of1SIAsgDSAR/a4BIg0gEv22ASANIAv9Of1S/a4BIA/9Tv2GAf2OAf0LAQAgACAA/QABECALIAwgA/0AARAiDSAL/Q0AAQAAAgMAAAQFAAAGBwAAQRD9qwFBEP2sAf2xASAO/bUBQRD9rAEiEyAQ/a4BIhQgEv22ASAUIAv9Of1SIAsgEyAR/a4BIhMgEv22ASATIAv9Of1S/a4BIA/9TiALIAwgDSAL/Q0ICQAACgsAAAwNAAAODwAAQRD9qwFBEP2sAf2xASAO/bUBQRD9rAEiDCAQ/a4BIg4gEv22ASAOIAv9Of1SIAsgDCAR/a4BIgwgEv22ASAMIAv9Of1S/a4BIA/9Tv2GAf2OAf0LARALC8sFAgJ/AXsjgICAgABBEGsiCySAgICAAEEAIQxBACAHNgKAiICAAEEAIAg2AsiIgIAAQQAgCDYCzIiAgABBACAJNgLQiICAAEEAIARBAEc2AsSIgIAAQQAgByAIQShsaiIENgKEiICAAEEAIAcgCEH4AGxqNgKoiICAAEEAIAcgCEHQAGxqNgKkiICAAEEAIAQ2AqCIgIAAAkBBgIiAgAAgACABEIGAgIAARQ0AQaSIgIAAIAIgAxCBgICAAEUNAEEBIQwCQCAGIAVsIgRBAUgNAEEAIQkCQCAEQRBJDQAgBEFwcSIJQXBqIghBBHZBAWoiAUEHcSEAQQAhBwJAIAhB8ABJDQAgAUH4////AXEhAUEAIQcDQCAKIAdqIgj9DAAAAAAAAAAAAAAAAAAAAAAiDf0LAAAgCEHwAGogDf0LAAAgCEHgAGogDf0LAAAgCEHQAGogDf0LAAAgCEHAAGogDf0LAAAgCEEwaiAN/QsAACAIQSBqIA39CwAAIAhBEGogDf0LAAAgB0GAAWohByABQXhqIgENAAsLAkAgAEUNACAKIAdqIQgDQCAI/QwAAAAAAAAAAAAAAAAAAAAA/QsAACAIQRBqIQggAEF/aiIADQALCyAEIAlGDQELIAogCWohCCAEIAlrIQcDQCAIQQA6AAAgCEEBaiEIIAdBf2oiBw0ACwtBACgCiIiAgABFDQBBACEMQYCIgIAAIAUgBiALQQxqIAtBCGoQgoCAgABFDQBBACEMAkBBACgCrIiAgAANAAJAQQAoAsSIgIAADQBBASEMDAILQYCIgIAAIAogBSAFIAZBACALKAIMIAsoAggQg4CAgAAhDAwBC0GkiICAACAFIAYgC0EEaiALEIKAgIAARQ0AIAogBSAFIAZBACALKAIMIAsoAghBACALKAIEIAsoAgAQjICAgAAhDAsgC0EQaiSAgICAACAMC48bAwp/AXsFfyOAgICAAEEgayIKJICAgIAAIAdBAnQiC0GsiICAAGoiDCgCACAIayENIARBAnRBiIiAgABqIg4oAgAgBWshDyALQaSIgIAAaiEQAkACQAJAAkAgCA0AIAlBAEchCwwBCyAIQQFKDQFBAkEBIBAoAgAgDUEobGooAhQiC0EBcSALQQZxQQZHcyAJaiILQQFGG0EGIAsbIQsLIAtBAnENACAMIA02AgACQCALQX9zQQFxQQAoAsSIgIAARUYNAEGAiICAACAAIAEgAiADIAQgBSAGEIOAgIAAIREMAgsCQCACQQFIDQAgA0EBSA0AIAJBcHEhBSACQXBqIgtBBHZBAWoiEkH4////AXEhCSASQQdxIQQgAkEQSSEIIAtB8ABJIQdBACERA0BBACELAkACQCAIDQBBACESAkAgBw0AQQAhEiAJIRMDQCAAIBJqIgv9DAAAAAAAAAAAAAAAAAAAAAAiFP0LAAAgC0HwAGogFP0LAAAgC0HgAGogFP0LAAAgC0HQAGogFP0LAAAgC0HAAGogFP0LAAAgC0EwaiAU/QsAACALQSBqIBT9CwAAIAtBEGogFP0LAAAgEkGAAWohEiATQXhqIhMNAAsLAkAgBEUNACAAIBJqIQsgBCESA0AgC/0MAAAAAAAAAAAAAAAAAAAAAP0LAAAgC0EQaiELIBJBf2oiEg0ACwsgBSELIAUgAkYNAQsDQCAAIAtqQQA6AAAgAiALQQFqIgtHDQALCyAAIAFqIQAgEUEBaiIRIANHDQALCyAOIA82AgBBASERDAELIARBAnRBgIiAgABqKAIAIRUCQAJAAkAgBQ0AIAZBAEchCwwBCyAFQQFKDQFBAkEBIBUgD0EobGooAhQiC0EBcSALQQZxQQZHcyAGaiILQQFGG0EGIAsbIQsLIAtBAnENACAOIA82AgACQCALQQFxDQACQCACQQFIDQAgA0EBSA0AIAJBcHEhBSACQXBqIgtBBHZBAWoiEkH4////AXEhCSASQQdxIQQgAkEQSSEIIAtB8ABJIQdBACERA0BBACELAkACQCAIDQBBACESAkAgBw0AQQAhEiAJIRMDQCAAIBJqIgv9DAAAAAAAAAAAAAAAAAAAAAAiFP0LAAAgC0HwAGogFP0LAAAgC0HgAGogFP0LAAAgC0HQAGogFP0LAAAgC0HAAGogFP0LAAAgC0EwaiAU/QsAACALQSBqIBT9CwAAIAtBEGogFP0LAAAgEkGAAWohEiATQXhqIhMNAAsLAkAgBEUNACAAIBJqIQsgBCESA0AgC/0MAAAAAAAAAAAAAAAAAAAAAP0LAAAgC0EQaiELIBJBf2oiEg0ACwsgBSELIAUgAkYNAQsDQCAAIAtqQQA6AAAgAiALQQFqIgtHDQALCyAAIAFqIQAgEUEBaiIRIANHDQALCyAMIA02AgBBASERDAILAkBBpIiAgAAgACABIAIgAyAHIAggCRCDgICAAA0AQQAhEQwCC0EBIRFBACgCxIiAgABFDQEgA0EBSA0BIAJBAUgNASACQXBxIQQgAkFwaiILQQR2QQFqIhJB/P///wFxIQYgEkEDcSEHQQAhCCACQRBJIQUgC0EwSSEJA0BBACELAkACQCAFDQBBACESAkAgCQ0AQQAhEiAGIRMDQCAAIBJqIgsgC/0AAAD9Tf0LAAAgC0EQaiIRIBH9AAAA/U39CwAAIAtBIGoiESAR/QAAAP1N/QsAACALQTBqIgsgC/0AAAD9Tf0LAAAgEkHAAGohEiATQXxqIhMNAAsLAkAgB0UNACAAIBJqIQsgByESA0AgCyAL/QAAAP1N/QsAACALQRBqIQsgEkF/aiISDQALCyAEIQsgBCACRg0BCwNAIAAgC2oiEiASLQAAQX9zOgAAIAIgC0EBaiILRw0ACwsgACABaiEAQQEhESAIQQFqIgggA0cNAAwCCwsCQCACQRBHDQAgA0EQRw0AAkBBgIiAgAAgACABQRBBECAEIAUgBhCDgICAAA0AQQAhEQwCC0EAIRFBpIiAgABBACgC0IiAgABBEEEQQRAgByAIIAkQg4CAgABFDQFBACgC0IiAgAAhEwJAQQAoAsSIgIAARQ0AIABBD2ohC0EAIQIDQCALQXFqIgAgAC0AACATIAJqIgAtAABrIhJBACASQQBKGzoAAEEBIREgC0FyaiISIBItAAAgAEEBai0AAGsiEkEAIBJBAEobOgAAIAtBc2oiEiASLQAAIABBAmotAABrIhJBACASQQBKGzoAACALQXRqIhIgEi0AACAAQQNqLQAAayISQQAgEkEAShs6AAAgC0F1aiISIBItAAAgAEEEai0AAGsiEkEAIBJBAEobOgAAIAtBdmoiEiASLQAAIABBBWotAABrIhJBACASQQBKGzoAACALQXdqIhIgEi0AACAAQQZqLQAAayISQQAgEkEAShs6AAAgC0F4aiISIBItAAAgAEEHai0AAGsiEkEAIBJBAEobOgAAIAtBeWoiEiASLQAAIABBCGotAABrIhJBACASQQBKGzoAACALQXpqIhIgEi0AACAAQQlqLQAAayISQQAgEkEAShs6AAAgC0F7aiISIBItAAAgAEEKai0AAGsiEkEAIBJBAEobOgAAIAtBfGoiEiASLQAAIABBC2otAABrIhJBACASQQBKGzoAACALQX1qIhIgEi0AACAAQQxqLQAAayISQQAgEkEAShs6AAAgC0F+aiISIBItAAAgAEENai0AAGsiEkEAIBJBAEobOgAAIAtBf2oiEiASLQAAIABBDmotAABrIhJBACASQQBKGzoAACALIAstAAAgAEEPai0AAGsiAEEAIABBAEobOgAAIAsgAWohCyACQRBqIgJBgAJHDQAMAwsLIABBD2ohC0EAIQIDQCALQXFqIhIgEyACaiIALQAAIBItAABsQYABaiISQQh2IBJqQQh2OgAAQQEhESALQXJqIhIgAEEBai0AACASLQAAbEGAAWoiEkEIdiASakEIdjoAACALQXNqIhIgAEECai0AACASLQAAbEGAAWoiEkEIdiASakEIdjoAACALQXRqIhIgAEEDai0AACASLQAAbEGAAWoiEkEIdiASakEIdjoAACALQXVqIhIgAEEEai0AACASLQAAbEGAAWoiEkEIdiASakEIdjoAACALQXZqIhIgAEEFai0AACASLQAAbEGAAWoiEkEIdiASakEIdjoAACALQXdqIhIgAEEGai0AACASLQAAbEGAAWoiEkEIdiASakEIdjoAACALQXhqIhIgAEEHai0AACASLQAAbEGAAWoiEkEIdiASakEIdjoAACALQXlqIhIgAEEIai0AACASLQAAbEGAAWoiEkEIdiASakEIdjoAACALQXpqIhIgAEEJai0AACASLQAAbEGAAWoiEkEIdiASakEIdjoAACALQXtqIhIgAEEKai0AACASLQAAbEGAAWoiEkEIdiASakEIdjoAACALQXxqIhIgAEELai0AACASLQAAbEGAAWoiEkEIdiASakEIdjoAACALQX1qIhIgAEEMai0AACASLQAAbEGAAWoiEkEIdiASakEIdjoAACALQX5qIhIgAEENai0AACASLQAAbEGAAWoiEkEIdiASakEIdjoAACALQX9qIhIgAEEOai0AACASLQAAbEGAAWoiEkEIdiASakEIdjoAACALIABBD2otAAAgCy0AAGxBgAFqIgBBCHYgAGpBCHY6AAAgCyABaiELIAJBEGoiAkGAAkcNAAwCCwtBACERQQAhEgJAIAIgAyACIANKIg0bQX9qIgtBAkkNAEEAIRIDQCASQQFqIRIgC0EDSyETIAtBAXYhCyATDQALCyAKIAY2AgwgCiAJNgIIIARBAXMiE0ECdEGIiICAAGoiFigCACILQQAoAsyIgIAAIAVrSg0AIBUgD0EobGohFSATQQJ0QYCIgIAAaigCACALQShsaiEXQQEgEnQiGEEGdCEZAkACQCANDQAgFSAFIBUgCkEcaiAXIApBGGogCkEMaiAZEIiAgIAAIQUMAQsgFSAFIBUgCkEcaiAXIApBGGogCkEMaiAZEIeAgIAAIQULIA4gCigCHCIVIA9qNgIAIBYgCigCGCIPIAtqNgIAIAVFDQBBACERIAdBAXMiFkECdCIFQayIgIAAaiIOKAIAIgtBACgCzIiAgAAgCGtKDQAgBUGkiICAAGooAgAgC0EobGohFyAQKAIAIAwoAgAgCGsiEEEobGohBQJAAkAgDQ0AIAUgCCAFIApBFGogFyAKQRBqIApBCGogGRCIgICAACEIDAELIAUgCCAFIApBFGogFyAKQRBqIApBCGogGRCHgICAACEICyAMIAooAhQiBSAQajYCACAOIAooAhAiDCALajYCACAIRQ0AAkAgDQ0AIAAgASACIBggBCAVIAYgByAFIAkQjICAgABFDQEgACABIBJ0aiABIAIgAyAYayATIA8gCigCDCAWIAwgCigCCBCMgICAAEEARyERDAELIAAgASAYIAMgBCAVIAYgByAFIAkQjICAgABFDQAgACAYaiABIAIgGGsgAyATIA8gCigCDCAWIAwgCigCCBCMgICAAEEARyERCyAKQSBqJICAgIAAIBELAPUBBG5hbWUADg1hc3MtZmlsbC53YXNtAckBDQANYXNzX2ZpbGxfcGF0aAEIYWRkX3BhdGgCDWNsaXBfdG9fZnJhbWUDCmZpbGxfbGV2ZWwECGFkZF9saW5lBQ1hZGRfcXVhZHJhdGljBglhZGRfY3ViaWMHD3BvbHlfc3BsaXRfaG9yeggPcG9seV9zcGxpdF92ZXJ0CRNmaWxsX2hhbGZwbGFuZV90aWxlChJ1cGRhdGVfYm9yZGVyX2xpbmULEmFzc19maWxsX3BhdGhfY2xpcAwPZmlsbF9sZXZlbF9jbGlwBxIBAA9fX3N0YWNrX3BvaW50ZXIALQlwcm9kdWNlcnMBDHByb2Nlc3NlZC1ieQEMRGViaWFuIGNsYW5nBjE0LjAuNgAnD3RhcmdldF9mZWF0dXJlcwIrC2J1bGstbWVtb3J5KwdzaW1kMTI4";
@@ -6,6 +6,7 @@
  */
 
 import type { Font } from "../font/font.ts";
+import { GrayExpand, grayToRGBAWasm } from "./bitmap-wasm/index.ts";
 import { rasterizeGlyph } from "./rasterize.ts";
 import {
 	type AtlasOptions,
@@ -301,23 +302,29 @@ function nextPowerOf2(n: number): number {
 
 /**
  * Export atlas to formats suitable for GPU upload
+ * @param out Optional destination (at least width * rows * 4 bytes)
  */
-export function atlasToRGBA(atlas: GlyphAtlas): Uint8Array {
+export function atlasToRGBA(atlas: GlyphAtlas, out?: Uint8Array): Uint8Array {
 	const { bitmap } = atlas;
-	const rgba = new Uint8Array(bitmap.width * bitmap.rows * 4);
-
-	for (let y = 0; y < bitmap.rows; y++) {
-		for (let x = 0; x < bitmap.width; x++) {
-			const srcIdx = y * bitmap.pitch + x;
-			const dstIdx = (y * bitmap.width + x) * 4;
-
-			const alpha = bitmap.buffer[srcIdx] ?? 0;
+	const { width, rows, pitch, buffer } = bitmap;
+	const size = width * rows * 4;
+	const rgba = out ?? new Uint8Array(size);
+	if (rgba.length < size) {
+		throw new RangeError(`Output buffer too small: ${rgba.length} < ${size}`);
+	}
 
-			// White text on transparent background
-			rgba[dstIdx] = 255;
-			rgba[dstIdx + 1] = 255;
-			rgba[dstIdx + 2] = 255;
-			rgba[dstIdx + 3] = alpha;
+	// White text on transparent background
+	if (grayToRGBAWasm(GrayExpand.Alpha, buffer, 0, pitch, width, rows, rgba)) {
+		return rgba;
+	}
+	for (let y = 0; y < rows; y++) {
+		let src = y * pitch;
+		let dst = y * width * 4;
+		for (let x = 0; x < width; x++, src++, dst += 4) {
+			rgba[dst] = 255;
+			rgba[dst + 1] = 255;
+			rgba[dst + 2] = 255;
+			rgba[dst + 3] = buffer[src] ?? 0;
 		}
 	}
 
@@ -4,6 +4,18 @@
 
 import { type Bitmap, createBitmap, PixelMode } from "./types.ts";
 import type { Matrix2D, Matrix3x3 } from "../render/outline-transform.ts";
+import {
+	BlendOp,
+	blendRectScaledWasm,
+	blendRectWasm,
+} from "./bitmap-wasm/index.ts";
+import {
+	createResampleSource,
+	type PerspectiveMapping,
+	type ResampleSource,
+	resampleAffine,
+	resamplePerspective,
+} from "./resample.ts";
 
 export interface BitmapTransformOptions {
 	/** Glyph bearing X (left edge from origin) */
@@ -258,7 +270,9 @@ export function convertBitmap(bitmap: Bitmap, targetMode: PixelMode): Bitmap {
 }
 
 /**
- * Alpha blend src bitmap onto dst bitmap at position (x, y)
+ * Additively blend src bitmap onto dst bitmap at position (x, y):
+ * dst = min(255, dst + src * opacity). Full opacity runs the wasm add kernel,
+ * partial opacity its opacity-scaled variant; both fall back to JS.
  * @param dst Destination bitmap to blend onto (modified in place)
  * @param src Source bitmap to blend
  * @param x X position in destination
@@ -277,24 +291,44 @@ export function blendBitmap(
 	}
 
 	opacity = Math.max(0, Math.min(1, opacity));
+	if (opacity === 1) {
+		blendBitmaps(BlendOp.Add, dst, src, x, y);
+		return;
+	}
 
 	const startX = Math.max(0, -x);
 	const startY = Math.max(0, -y);
 	const endX = Math.min(src.width, dst.width - x);
 	const endY = Math.min(src.rows, dst.rows - y);
+	if (endX <= startX || endY <= startY) return;
+	if (
+		blendRectScaledWasm(
+			dst.buffer,
+			(y + startY) * dst.pitch + x + startX,
+			dst.pitch,
+			src.buffer,
+			startY * src.pitch + startX,
+			src.pitch,
+			endX - startX,
+			endY - startY,
+			opacity,
+		)
+	) {
+		return;
+	}
 
+	// src * opacity for every source byte, so the loop body is a table load
+	const scaled = blendOpacityLut;
+	for (let v = 0; v < 256; v++) scaled[v] = v * opacity;
+
+	const dstBuf = dst.buffer;
+	const srcBuf = src.buffer;
 	for (let sy = startY; sy < endY; sy++) {
+		const srcRow = sy * src.pitch;
+		const dstRow = (y + sy) * dst.pitch + x;
 		for (let sx = startX; sx < endX; sx++) {
-			const dx = x + sx;
-			const dy = y + sy;
-
-			if (dx >= 0 && dx < dst.width && dy >= 0 && dy < dst.rows) {
-				const srcVal = src.buffer[sy * src.pitch + sx] ?? 0;
-				const dstVal = dst.buffer[dy * dst.pitch + dx] ?? 0;
-
-				const blended = dstVal + srcVal * opacity;
-				dst.buffer[dy * dst.pitch + dx] = Math.min(255, Math.floor(blended));
-			}
+			const blended = dstBuf[dstRow + sx]! + scaled[srcBuf[srcRow + sx]!]!;
+			dstBuf[dstRow + sx] = blended >= 255 ? 255 : blended;
 		}
 	}
 }
@@ -393,77 +427,43 @@ export function resizeBitmapBilinear(
 	newWidth: number,
 	newHeight: number,
 ): Bitmap {
-	const result = createBitmap(newWidth, newHeight, bitmap.pixelMode);
-
-	const xRatio = (bitmap.width - 1) / Math.max(1, newWidth - 1);
-	const yRatio = (bitmap.rows - 1) / Math.max(1, newHeight - 1);
-
-	if (bitmap.pixelMode === PixelMode.Gray) {
-		for (let y = 0; y < newHeight; y++) {
-			const srcY = y * yRatio;
-			const y0 = Math.floor(srcY);
-			const y1 = Math.min(y0 + 1, bitmap.rows - 1);
-			const yFrac = srcY - y0;
-
-			for (let x = 0; x < newWidth; x++) {
-				const srcX = x * xRatio;
-				const x0 = Math.floor(srcX);
-				const x1 = Math.min(x0 + 1, bitmap.width - 1);
-				const xFrac = srcX - x0;
-
-				const p00 = bitmap.buffer[y0 * bitmap.pitch + x0] ?? 0;
-				const p10 = bitmap.buffer[y0 * bitmap.pitch + x1] ?? 0;
-				const p01 = bitmap.buffer[y1 * bitmap.pitch + x0] ?? 0;
-				const p11 = bitmap.buffer[y1 * bitmap.pitch + x1] ?? 0;
-
-				const top = p00 + (p10 - p00) * xFrac;
-				const bottom = p01 + (p11 - p01) * xFrac;
-				const value = top + (bottom - top) * yFrac;
-
-				result.buffer[y * result.pitch + x] = Math.round(value);
-			}
-		}
-	} else if (bitmap.pixelMode === PixelMode.Mono) {
+	const mode = bitmap.pixelMode;
+	if (mode === PixelMode.Mono) {
 		// For mono, fall back to nearest-neighbor (bilinear doesn't make sense for 1-bit)
 		return resizeBitmap(bitmap, newWidth, newHeight);
-	} else if (
-		bitmap.pixelMode === PixelMode.LCD ||
-		bitmap.pixelMode === PixelMode.LCD_V
+	}
+	if (
+		mode !== PixelMode.Gray &&
+		mode !== PixelMode.LCD &&
+		mode !== PixelMode.LCD_V
 	) {
-		for (let y = 0; y < newHeight; y++) {
-			const srcY = y * yRatio;
-			const y0 = Math.floor(srcY);
-			const y1 = Math.min(y0 + 1, bitmap.rows - 1);
-			const yFrac = srcY - y0;
-
-			for (let x = 0; x < newWidth; x++) {
-				const srcX = x * xRatio;
-				const x0 = Math.floor(srcX);
-				const x1 = Math.min(x0 + 1, bitmap.width - 1);
-				const xFrac = srcX - x0;
-
-				const idx00 = y0 * bitmap.pitch + x0 * 3;
-				const idx10 = y0 * bitmap.pitch + x1 * 3;
-				const idx01 = y1 * bitmap.pitch + x0 * 3;
-				const idx11 = y1 * bitmap.pitch + x1 * 3;
-
-				for (let c = 0; c < 3; c++) {
-					const p00 = bitmap.buffer[idx00 + c] ?? 0;
-					const p10 = bitmap.buffer[idx10 + c] ?? 0;
-					const p01 = bitmap.buffer[idx01 + c] ?? 0;
-					const p11 = bitmap.buffer[idx11 + c] ?? 0;
-
-					const top = p00 + (p10 - p00) * xFrac;
-					const bottom = p01 + (p11 - p01) * xFrac;
-					const value = top + (bottom - top) * yFrac;
-
-					result.buffer[y * result.pitch + x * 3 + c] = Math.round(value);
-				}
-			}
-		}
+		return createBitmap(newWidth, newHeight, mode);
 	}
 
-	return result;
+	// Corner-aligned: the first and last pixels map onto each other; edge
+	// pixels repeat so the last column/row interpolates against itself
+	const xRatio = (bitmap.width - 1) / Math.max(1, newWidth - 1);
+	const yRatio = (bitmap.rows - 1) / Math.max(1, newHeight - 1);
+	return resampleBitmap(
+		bitmap,
+		newWidth,
+		newHeight,
+		"clamp",
+		(src, dst, pitch) =>
+			resampleAffine(
+				src,
+				dst,
+				pitch,
+				newWidth,
+				newHeight,
+				0,
+				0,
+				xRatio,
+				0,
+				0,
+				yRatio,
+			),
+	);
 }
 
 /**
@@ -481,28 +481,7 @@ export function addBitmaps(
 	srcX: number = 0,
 	srcY: number = 0,
 ): void {
-	if (dst.pixelMode !== PixelMode.Gray || src.pixelMode !== PixelMode.Gray) {
-		return;
-	}
-
-	const startX = Math.max(0, -srcX);
-	const startY = Math.max(0, -srcY);
-	const endX = Math.min(src.width, dst.width - srcX);
-	const endY = Math.min(src.rows, dst.rows - srcY);
-
-	for (let sy = startY; sy < endY; sy++) {
-		const dy = srcY + sy;
-		if (dy < 0 || dy >= dst.rows) continue;
-
-		for (let sx = startX; sx < endX; sx++) {
-			const dx = srcX + sx;
-			if (dx < 0 || dx >= dst.width) continue;
-
-			const srcVal = src.buffer[sy * src.pitch + sx] ?? 0;
-			const dstVal = dst.buffer[dy * dst.pitch + dx] ?? 0;
-			dst.buffer[dy * dst.pitch + dx] = Math.min(255, srcVal + dstVal);
-		}
-	}
+	blendBitmaps(BlendOp.Add, dst, src, srcX, srcY);
 }
 
 /**
@@ -520,31 +499,7 @@ export function mulBitmaps(
 	srcX: number = 0,
 	srcY: number = 0,
 ): void {
-	if (dst.pixelMode !== PixelMode.Gray || src.pixelMode !== PixelMode.Gray) {
-		return;
-	}
-
-	const startX = Math.max(0, -srcX);
-	const startY = Math.max(0, -srcY);
-	const endX = Math.min(src.width, dst.width - srcX);
-	const endY = Math.min(src.rows, dst.rows - srcY);
-
-	for (let sy = startY; sy < endY; sy++) {
-		const dy = srcY + sy;
-		if (dy < 0 || dy >= dst.rows) continue;
-
-		for (let sx = startX; sx < endX; sx++) {
-			const dx = srcX + sx;
-			if (dx < 0 || dx >= dst.width) continue;
-
-			const srcVal = src.buffer[sy * src.pitch + sx] ?? 0;
-			const dstVal = dst.buffer[dy * dst.pitch + dx] ?? 0;
-			// Use integer math for speed: (a * b + 127) / 255 ≈ (a * b) >> 8
-			dst.buffer[dy * dst.pitch + dx] = Math.floor(
-				(srcVal * dstVal + 127) / 255,
-			);
-		}
-	}
+	blendBitmaps(BlendOp.Mul, dst, src, srcX, srcY);
 }
 
 /**
@@ -562,28 +517,7 @@ export function subBitmaps(
 	srcX: number = 0,
 	srcY: number = 0,
 ): void {
-	if (dst.pixelMode !== PixelMode.Gray || src.pixelMode !== PixelMode.Gray) {
-		return;
-	}
-
-	const startX = Math.max(0, -srcX);
-	const startY = Math.max(0, -srcY);
-	const endX = Math.min(src.width, dst.width - srcX);
-	const endY = Math.min(src.rows, dst.rows - srcY);
-
-	for (let sy = startY; sy < endY; sy++) {
-		const dy = srcY + sy;
-		if (dy < 0 || dy >= dst.rows) continue;
-
-		for (let sx = startX; sx < endX; sx++) {
-			const dx = srcX + sx;
-			if (dx < 0 || dx >= dst.width) continue;
-
-			const srcVal = src.buffer[sy * src.pitch + sx] ?? 0;
-			const dstVal = dst.buffer[dy * dst.pitch + dx] ?? 0;
-			dst.buffer[dy * dst.pitch + dx] = Math.max(0, dstVal - srcVal);
-		}
-	}
+	blendBitmaps(BlendOp.Sub, dst, src, srcX, srcY);
 }
 
 /**
@@ -601,30 +535,7 @@ export function compositeBitmaps(
 	srcX: number = 0,
 	srcY: number = 0,
 ): void {
-	if (dst.pixelMode !== PixelMode.Gray || src.pixelMode !== PixelMode.Gray) {
-		return;
-	}
-
-	const startX = Math.max(0, -srcX);
-	const startY = Math.max(0, -srcY);
-	const endX = Math.min(src.width, dst.width - srcX);
-	const endY = Math.min(src.rows, dst.rows - srcY);
-
-	for (let sy = startY; sy < endY; sy++) {
-		const dy = srcY + sy;
-		if (dy < 0 || dy >= dst.rows) continue;
-
-		for (let sx = startX; sx < endX; sx++) {
-			const dx = srcX + sx;
-			if (dx < 0 || dx >= dst.width) continue;
-
-			const srcVal = src.buffer[sy * src.pitch + sx] ?? 0;
-			const dstVal = dst.buffer[dy * dst.pitch + dx] ?? 0;
-			// src + dst * (255 - src) / 255
-			const result = srcVal + Math.floor((dstVal * (255 - srcVal) + 127) / 255);
-			dst.buffer[dy * dst.pitch + dx] = Math.min(255, result);
-		}
-	}
+	blendBitmaps(BlendOp.Over, dst, src, srcX, srcY);
 }
 
 /**
@@ -760,6 +671,24 @@ export function maxBitmaps(
 	src: Bitmap,
 	srcX: number = 0,
 	srcY: number = 0,
+): void {
+	blendBitmaps(BlendOp.Max, dst, src, srcX, srcY);
+}
+
+/** Scratch table for blendBitmap (src * opacity per byte value) */
+const blendOpacityLut = new Float64Array(256);
+
+/**
+ * Blend the part of `src` that lands inside `dst` (at srcX, srcY) with one of
+ * the BlendOp operators. Large rectangles go through the wasm SIMD kernel
+ * when it is available; the scalar loops below are bit-identical to it.
+ */
+function blendBitmaps(
+	op: BlendOp,
+	dst: Bitmap,
+	src: Bitmap,
+	srcX: number,
+	srcY: number,
 ): void {
 	if (dst.pixelMode !== PixelMode.Gray || src.pixelMode !== PixelMode.Gray) {
 		return;
@@ -769,22 +698,76 @@ export function maxBitmaps(
 	const startY = Math.max(0, -srcY);
 	const endX = Math.min(src.width, dst.width - srcX);
 	const endY = Math.min(src.rows, dst.rows - srcY);
+	const width = endX - startX;
+	const height = endY - startY;
+	if (width <= 0 || height <= 0) return;
 
-	for (let sy = startY; sy < endY; sy++) {
-		const dy = srcY + sy;
-		if (dy < 0 || dy >= dst.rows) continue;
-
-		for (let sx = startX; sx < endX; sx++) {
-			const dx = srcX + sx;
-			if (dx < 0 || dx >= dst.width) continue;
+	const dstOffset = (srcY + startY) * dst.pitch + srcX + startX;
+	const srcOffset = startY * src.pitch + startX;
+	if (
+		blendRectWasm(
+			op,
+			dst.buffer,
+			dstOffset,
+			dst.pitch,
+			src.buffer,
+			srcOffset,
+			src.pitch,
+			width,
+			height,
+		)
+	) {
+		return;
+	}
 
-			const srcVal = src.buffer[sy * src.pitch + sx] ?? 0;
-			const dstVal = dst.buffer[dy * dst.pitch + dx] ?? 0;
-			dst.buffer[dy * dst.pitch + dx] = Math.max(srcVal, dstVal);
+	const dstBuf = dst.buffer;
+	const srcBuf = src.buffer;
+	for (let row = 0; row < height; row++) {
+		let d = dstOffset + row * dst.pitch;
+		let s = srcOffset + row * src.pitch;
+		const dEnd = d + width;
+		switch (op) {
+			case BlendOp.Add:
+				for (; d < dEnd; d++, s++) {
+					const v = dstBuf[d]! + srcBuf[s]!;
+					dstBuf[d] = v > 255 ? 255 : v;
+				}
+				break;
+			case BlendOp.Sub:
+				for (; d < dEnd; d++, s++) {
+					const v = dstBuf[d]! - srcBuf[s]!;
+					dstBuf[d] = v < 0 ? 0 : v;
+				}
+				break;
+			case BlendOp.Mul:
+				for (; d < dEnd; d++, s++) {
+					dstBuf[d] = div255(dstBuf[d]! * srcBuf[s]!);
+				}
+				break;
+			case BlendOp.Max:
+				for (; d < dEnd; d++, s++) {
+					const a = dstBuf[d]!;
+					const b = srcBuf[s]!;
+					dstBuf[d] = a > b ? a : b;
+				}
+				break;
+			default:
+				for (; d < dEnd; d++, s++) {
+					const b = srcBuf[s]!;
+					dstBuf[d] = b + div255(dstBuf[d]! * (255 - b));
+				}
 		}
 	}
 }
 
+/**
+ * floor((x + 127) / 255) for 0 <= x <= 65025, without a division
+ */
+function div255(x: number): number {
+	const t = x + 128;
+	return (t + (t >> 8)) >> 8;
+}
+
 /**
  * Create a padded copy of a bitmap with extra space around edges
  * Useful before blur operations to prevent edge artifacts
@@ -898,62 +881,33 @@ function getRowOffset(bitmap: Bitmap, y: number): number {
 	return origin + y * pitch;
 }
 
-function getPixelChannel(
+/**
+ * Run a resample into a fresh bitmap of the source's pixel mode. Mono sources
+ * are resampled as coverage and thresholded at 50%.
+ */
+function resampleBitmap(
 	bitmap: Bitmap,
-	x: number,
-	y: number,
-	channel: number,
-): number {
-	if (x < 0 || y < 0 || x >= bitmap.width || y >= bitmap.rows) return 0;
-	const row = getRowOffset(bitmap, y);
-	switch (bitmap.pixelMode) {
-		case PixelMode.Gray:
-			return bitmap.buffer[row + x] ?? 0;
-		case PixelMode.Mono: {
-			const byteIdx = row + (x >> 3);
-			const bitIdx = 7 - (x & 7);
-			const bit = ((bitmap.buffer[byteIdx] ?? 0) >> bitIdx) & 1;
-			return bit ? 255 : 0;
-		}
-		case PixelMode.LCD:
-		case PixelMode.LCD_V: {
-			const idx = row + x * 3 + channel;
-			return bitmap.buffer[idx] ?? 0;
-		}
-		case PixelMode.RGBA: {
-			const idx = row + x * 4 + channel;
-			return bitmap.buffer[idx] ?? 0;
-		}
+	width: number,
+	height: number,
+	edge: "zero" | "clamp",
+	run: (src: ResampleSource, dst: Uint8Array, dstPitch: number) => void,
+): Bitmap {
+	const src = createResampleSource(bitmap, edge);
+	const result = createBitmap(width, height, bitmap.pixelMode);
+	if (bitmap.pixelMode !== PixelMode.Mono) {
+		run(src, result.buffer, result.pitch);
+		return result;
 	}
-}
 
-function sampleBilinear(
-	bitmap: Bitmap,
-	x: number,
-	y: number,
-	channels: number,
-	out: number[],
-): void {
-	const x0 = Math.floor(x);
-	const y0 = Math.floor(y);
-	const x1 = x0 + 1;
-	const y1 = y0 + 1;
-
-	const wx = x - x0;
-	const wy = y - y0;
-	const w00 = (1 - wx) * (1 - wy);
-	const w10 = wx * (1 - wy);
-	const w01 = (1 - wx) * wy;
-	const w11 = wx * wy;
-
-	for (let c = 0; c < channels; c++) {
-		const p00 = getPixelChannel(bitmap, x0, y0, c);
-		const p10 = getPixelChannel(bitmap, x1, y0, c);
-		const p01 = getPixelChannel(bitmap, x0, y1, c);
-		const p11 = getPixelChannel(bitmap, x1, y1, c);
-		const value = p00 * w00 + p10 * w10 + p01 * w01 + p11 * w11;
-		out[c] = Math.min(255, Math.max(0, Math.round(value)));
+	const gray = new Uint8Array(width * height);
+	run(src, gray, width);
+	for (let y = 0; y < height; y++) {
+		const row = y * result.pitch;
+		for (let x = 0, i = y * width; x < width; x++, i++) {
+			if (gray[i]! >= 128) result.buffer[row + (x >> 3)] |= 0x80 >> (x & 7);
+		}
 	}
+	return result;
 }
 
 function invert2D(
@@ -1184,35 +1138,17 @@ export function transformBitmap2D(
 	const right = left + bitmap.width;
 	const bottom = top - bitmap.rows;
 
-	const corners = [
-		{
-			x: adjusted[0] * left + adjusted[2] * top + adjusted[4],
-			y: adjusted[1] * left + adjusted[3] * top + adjusted[5],
-		},
-		{
-			x: adjusted[0] * right + adjusted[2] * top + adjusted[4],
-			y: adjusted[1] * right + adjusted[3] * top + adjusted[5],
-		},
-		{
-			x: adjusted[0] * left + adjusted[2] * bottom + adjusted[4],
-			y: adjusted[1] * left + adjusted[3] * bottom + adjusted[5],
-		},
-		{
-			x: adjusted[0] * right + adjusted[2] * bottom + adjusted[4],
-			y: adjusted[1] * right + adjusted[3] * bottom + adjusted[5],
-		},
-	];
-
-	let minX = Infinity;
-	let maxX = -Infinity;
-	let minY = Infinity;
-	let maxY = -Infinity;
-	for (const p of corners) {
-		minX = Math.min(minX, p.x);
-		maxX = Math.max(maxX, p.x);
-		minY = Math.min(minY, p.y);
-		maxY = Math.max(maxY, p.y);
-	}
+	// Corners: x = a*px + c*py + e, y = b*px + d*py + f
+	const e2 = adjusted[4];
+	const f2 = adjusted[5];
+	const minX =
+		e2 + Math.min(a * left, a * right) + Math.min(c * top, c * bottom);
+	const maxX =
+		e2 + Math.max(a * left, a * right) + Math.max(c * top, c * bottom);
+	const minY =
+		f2 + Math.min(b * left, b * right) + Math.min(d * top, d * bottom);
+	const maxY =
+		f2 + Math.max(b * left, b * right) + Math.max(d * top, d * bottom);
 
 	if (!Number.isFinite(minX) || !Number.isFinite(minY)) {
 		return {
@@ -1230,61 +1166,44 @@ export function transformBitmap2D(
 	const outWidth = Math.max(1, outMaxX - outMinX);
 	const outHeight = Math.max(1, outMaxY - outMinY);
 
-	const result = createBitmap(outWidth, outHeight, bitmap.pixelMode);
 	const inverse = invert2D(adjusted);
 	if (!inverse) {
-		return { bitmap: result, bearingX: outMinX, bearingY: outMaxY };
+		return {
+			bitmap: createBitmap(outWidth, outHeight, bitmap.pixelMode),
+			bearingX: outMinX,
+			bearingY: outMaxY,
+		};
 	}
 	const inv = inverse.inv;
 
-	const channels =
-		bitmap.pixelMode === PixelMode.LCD || bitmap.pixelMode === PixelMode.LCD_V
-			? 3
-			: bitmap.pixelMode === PixelMode.RGBA
-				? 4
-				: 1;
-	const sampleBuffer = new Array<number>(channels).fill(0);
-
-	for (let y = 0; y < outHeight; y++) {
-		for (let x = 0; x < outWidth; x++) {
-			const gx = outMinX + x + 0.5;
-			const gy = outMaxY - y - 0.5;
-
-			const sxg = inv[0] * gx + inv[2] * gy + inv[4];
-			const syg = inv[1] * gx + inv[3] * gy + inv[5];
-
-			const sx = sxg - bearingX - 0.5;
-			const sy = bearingY - syg - 0.5;
-
-			sampleBilinear(bitmap, sx, sy, channels, sampleBuffer);
-
-			if (bitmap.pixelMode === PixelMode.Mono) {
-				const val = sampleBuffer[0] ?? 0;
-				if (val >= 128) {
-					const byteIdx = y * result.pitch + (x >> 3);
-					const bitIdx = 7 - (x & 7);
-					result.buffer[byteIdx] |= 1 << bitIdx;
-				}
-			} else if (bitmap.pixelMode === PixelMode.Gray) {
-				result.buffer[y * result.pitch + x] = sampleBuffer[0] ?? 0;
-			} else if (
-				bitmap.pixelMode === PixelMode.LCD ||
-				bitmap.pixelMode === PixelMode.LCD_V
-			) {
-				const idx = y * result.pitch + x * 3;
-				result.buffer[idx] = sampleBuffer[0] ?? 0;
-				result.buffer[idx + 1] = sampleBuffer[1] ?? 0;
-				result.buffer[idx + 2] = sampleBuffer[2] ?? 0;
-			} else if (bitmap.pixelMode === PixelMode.RGBA) {
-				const idx = y * result.pitch + x * 4;
-				result.buffer[idx] = sampleBuffer[0] ?? 0;
-				result.buffer[idx + 1] = sampleBuffer[1] ?? 0;
-				result.buffer[idx + 2] = sampleBuffer[2] ?? 0;
-				result.buffer[idx + 3] = sampleBuffer[3] ?? 0;
-			}
-		}
-	}
-
+	// Destination pixel (x, y) has its center at global
+	// (outMinX + x + 0.5, outMaxY - y - 0.5); map that through the inverse
+	// into source pixel coordinates (y down, pixel centers at integers)
+	const gx0 = outMinX + 0.5;
+	const gy0 = outMaxY - 0.5;
+	const u0 = inv[0] * gx0 + inv[2] * gy0 + inv[4] - bearingX - 0.5;
+	const v0 = bearingY - 0.5 - (inv[1] * gx0 + inv[3] * gy0 + inv[5]);
+
+	const result = resampleBitmap(
+		bitmap,
+		outWidth,
+		outHeight,
+		"zero",
+		(src, dst, pitch) =>
+			resampleAffine(
+				src,
+				dst,
+				pitch,
+				outWidth,
+				outHeight,
+				u0,
+				v0,
+				inv[0],
+				-inv[1],
+				-inv[2],
+				inv[3],
+			),
+	);
 	return { bitmap: result, bearingX: outMinX, bearingY: outMaxY };
 }
 
@@ -1345,59 +1264,42 @@ export function transformBitmap3D(
 
 	const outWidth = Math.max(1, outMaxX - outMinX);
 	const outHeight = Math.max(1, outMaxY - outMinY);
-	const result = createBitmap(outWidth, outHeight, bitmap.pixelMode);
 
-	const inverse = invert3x3(adjusted);
-	if (!inverse) {
-		return { bitmap: result, bearingX: outMinX, bearingY: outMaxY };
+	const inv = invert3x3(adjusted);
+	if (!inv) {
+		return {
+			bitmap: createBitmap(outWidth, outHeight, bitmap.pixelMode),
+			bearingX: outMinX,
+			bearingY: outMaxY,
+		};
 	}
 
-	const channels =
-		bitmap.pixelMode === PixelMode.LCD || bitmap.pixelMode === PixelMode.LCD_V
-			? 3
-			: bitmap.pixelMode === PixelMode.RGBA
-				? 4
-				: 1;
-	const sampleBuffer = new Array<number>(channels).fill(0);
-
-	for (let y = 0; y < outHeight; y++) {
-		for (let x = 0; x < outWidth; x++) {
-			const gx = outMinX + x + 0.5;
-			const gy = outMaxY - y - 0.5;
-
-			const src = transformPoint3x3Safe(gx, gy, inverse);
-			const sx = src.x - bearingX - 0.5;
-			const sy = bearingY - src.y - 0.5;
-
-			sampleBilinear(bitmap, sx, sy, channels, sampleBuffer);
-
-			if (bitmap.pixelMode === PixelMode.Mono) {
-				const val = sampleBuffer[0] ?? 0;
-				if (val >= 128) {
-					const byteIdx = y * result.pitch + (x >> 3);
-					const bitIdx = 7 - (x & 7);
-					result.buffer[byteIdx] |= 1 << bitIdx;
-				}
-			} else if (bitmap.pixelMode === PixelMode.Gray) {
-				result.buffer[y * result.pitch + x] = sampleBuffer[0] ?? 0;
-			} else if (
-				bitmap.pixelMode === PixelMode.LCD ||
-				bitmap.pixelMode === PixelMode.LCD_V
-			) {
-				const idx = y * result.pitch + x * 3;
-				result.buffer[idx] = sampleBuffer[0] ?? 0;
-				result.buffer[idx + 1] = sampleBuffer[1] ?? 0;
-				result.buffer[idx + 2] = sampleBuffer[2] ?? 0;
-			} else if (bitmap.pixelMode === PixelMode.RGBA) {
-				const idx = y * result.pitch + x * 4;
-				result.buffer[idx] = sampleBuffer[0] ?? 0;
-				result.buffer[idx + 1] = sampleBuffer[1] ?? 0;
-				result.buffer[idx + 2] = sampleBuffer[2] ?? 0;
-				result.buffer[idx + 3] = sampleBuffer[3] ?? 0;
-			}
-		}
-	}
+	// Homogeneous source coordinates are affine in the destination pixel;
+	// step them along each row and divide per pixel
+	const gx0 = outMinX + 0.5;
+	const gy0 = outMaxY - 0.5;
+	const mapping: PerspectiveMapping = [
+		inv[0][0] * gx0 + inv[0][1] * gy0 + inv[0][2],
+		inv[1][0] * gx0 + inv[1][1] * gy0 + inv[1][2],
+		inv[2][0] * gx0 + inv[2][1] * gy0 + inv[2][2],
+		inv[0][0],
+		inv[1][0],
+		inv[2][0],
+		-inv[0][1],
+		-inv[1][1],
+		-inv[2][1],
+		bearingX + 0.5,
+		bearingY - 0.5,
+	];
 
+	const result = resampleBitmap(
+		bitmap,
+		outWidth,
+		outHeight,
+		"zero",
+		(src, dst, pitch) =>
+			resamplePerspective(src, dst, pitch, outWidth, outHeight, mapping),
+	);
 	return { bitmap: result, bearingX: outMinX, bearingY: outMaxY };
 }
 
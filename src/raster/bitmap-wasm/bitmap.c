@@ -0,0 +1,336 @@
+// Freestanding wasm32 + SIMD128 kernels for 8-bit bitmap compositing,
+// pixel-format expansion and bilinear resampling (../bitmap-utils.ts,
+// ../rasterize.ts, ../atlas.ts, ../lcd-filter.ts, ../resample.ts).
+//
+// Every kernel is bit-exact with the scalar TS fallbacks. Division by 255 uses
+// the exact rounding identity
+//   floor((x + 127) / 255) == (t + (t >> 8)) >> 8,  t = x + 128,  0 <= x <= 65025
+// evaluated in u16 lanes. Rectangles are pre-clipped by the caller; rows are
+// addressed with explicit pitches so packed and padded layouts both work.
+//
+// Build: see build.sh. All pointer args are byte offsets into linear memory.
+
+#include <wasm_simd128.h>
+#include <stdint.h>
+
+typedef int32_t i32;
+typedef uint8_t u8;
+typedef uint16_t u16;
+
+// Blend operators (must match BlendOp in index.ts)
+#define OP_ADD  0 // dst = min(255, dst + src)
+#define OP_SUB  1 // dst = max(0, dst - src)
+#define OP_MUL  2 // dst = dst * src / 255
+#define OP_MAX  3 // dst = max(dst, src)
+#define OP_OVER 4 // dst = src + dst * (255 - src) / 255
+
+// Gray expansion modes (must match GrayExpand in index.ts)
+#define EXPAND_INVERT 0 // (255-a, 255-a, 255-a, 255): black on white
+#define EXPAND_ALPHA  1 // (255, 255, 255, a): white on transparent
+
+static inline u8 div255(i32 x) {
+  i32 t = x + 128;
+  return (u8)((t + (t >> 8)) >> 8);
+}
+
+static inline v128_t div255_u16(v128_t x) {
+  v128_t t = wasm_i16x8_add(x, wasm_i16x8_splat(128));
+  return wasm_u16x8_shr(wasm_i16x8_add(t, wasm_u16x8_shr(t, 8)), 8);
+}
+
+// (a * b) / 255 per byte lane, rounded like the scalar path
+static inline v128_t mul255_u8(v128_t a, v128_t b) {
+  v128_t lo = wasm_i16x8_mul(wasm_u16x8_extend_low_u8x16(a),
+                             wasm_u16x8_extend_low_u8x16(b));
+  v128_t hi = wasm_i16x8_mul(wasm_u16x8_extend_high_u8x16(a),
+                             wasm_u16x8_extend_high_u8x16(b));
+  return wasm_u8x16_narrow_i16x8(div255_u16(lo), div255_u16(hi));
+}
+
+static inline u8 blend_scalar(i32 op, u8 d, u8 s) {
+  switch (op) {
+    case OP_ADD: { i32 v = d + s; return (u8)(v > 255 ? 255 : v); }
+    case OP_SUB: return (u8)(d > s ? d - s : 0);
+    case OP_MUL: return div255(d * s);
+    case OP_MAX: return d > s ? d : s;
+    default: return (u8)(s + div255(d * (255 - s)));
+  }
+}
+
+static inline v128_t blend_simd(i32 op, v128_t d, v128_t s) {
+  switch (op) {
+    case OP_ADD: return wasm_u8x16_add_sat(d, s);
+    case OP_SUB: return wasm_u8x16_sub_sat(d, s);
+    case OP_MUL: return mul255_u8(d, s);
+    case OP_MAX: return wasm_u8x16_max(d, s);
+    default:
+      return wasm_u8x16_add_sat(
+          s, mul255_u8(d, wasm_v128_xor(s, wasm_i8x16_splat(-1))));
+  }
+}
+
+__attribute__((export_name("blend_rect")))
+void blend_rect(i32 op, u8 *dst, i32 dstPitch, const u8 *src, i32 srcPitch,
+                i32 width, i32 height) {
+  for (i32 y = 0; y < height; y++) {
+    u8 *d = dst + y * dstPitch;
+    const u8 *s = src + y * srcPitch;
+    i32 x = 0;
+    for (; x + 16 <= width; x += 16) {
+      v128_t r = blend_simd(op, wasm_v128_load(d + x), wasm_v128_load(s + x));
+      wasm_v128_store(d + x, r);
+    }
+    for (; x < width; x++) d[x] = blend_scalar(op, d[x], s[x]);
+  }
+}
+
+// dst + src * k for the low two i32 lanes, in f64. The product and sum round
+// exactly like the JS doubles in blendBitmap (-ffp-contract=off keeps them
+// from fusing), so the truncated result matches the scalar path bit for bit.
+static inline v128_t add_scaled_f64(v128_t d, v128_t s, v128_t k) {
+  v128_t df = wasm_f64x2_convert_low_i32x4(d);
+  v128_t sf = wasm_f64x2_convert_low_i32x4(s);
+  return wasm_f64x2_add(df, wasm_f64x2_mul(sf, k));
+}
+
+// Four i32 lanes of dst + src * k, truncated toward zero
+static inline v128_t add_scaled_u32(v128_t d, v128_t s, v128_t k) {
+  v128_t lo = add_scaled_f64(d, s, k);
+  v128_t hi = add_scaled_f64(wasm_i32x4_shuffle(d, d, 2, 3, 2, 3),
+                             wasm_i32x4_shuffle(s, s, 2, 3, 2, 3), k);
+  return wasm_i32x4_shuffle(wasm_i32x4_trunc_sat_f64x2_zero(lo),
+                            wasm_i32x4_trunc_sat_f64x2_zero(hi), 0, 1, 4, 5);
+}
+
+// dst = min(255, trunc(dst + src * opacity)), 0 <= opacity <= 1: the additive
+// blend at partial opacity. Sums stay below 511, so the unsigned narrows clamp
+// to 255 exactly where the scalar path does.
+__attribute__((export_name("blend_rect_scaled")))
+void blend_rect_scaled(u8 *dst, i32 dstPitch, const u8 *src, i32 srcPitch,
+                       i32 width, i32 height, double opacity) {
+  const v128_t k = wasm_f64x2_splat(opacity);
+  for (i32 y = 0; y < height; y++) {
+    u8 *d = dst + y * dstPitch;
+    const u8 *s = src + y * srcPitch;
+    i32 x = 0;
+    for (; x + 16 <= width; x += 16) {
+      v128_t dv = wasm_v128_load(d + x), sv = wasm_v128_load(s + x);
+      v128_t dl = wasm_u16x8_extend_low_u8x16(dv);
+      v128_t dh = wasm_u16x8_extend_high_u8x16(dv);
+      v128_t sl = wasm_u16x8_extend_low_u8x16(sv);
+      v128_t sh = wasm_u16x8_extend_high_u8x16(sv);
+      v128_t r0 = add_scaled_u32(wasm_u32x4_extend_low_u16x8(dl),
+                                 wasm_u32x4_extend_low_u16x8(sl), k);
+      v128_t r1 = add_scaled_u32(wasm_u32x4_extend_high_u16x8(dl),
+                                 wasm_u32x4_extend_high_u16x8(sl), k);
+      v128_t r2 = add_scaled_u32(wasm_u32x4_extend_low_u16x8(dh),
+                                 wasm_u32x4_extend_low_u16x8(sh), k);
+      v128_t r3 = add_scaled_u32(wasm_u32x4_extend_high_u16x8(dh),
+                                 wasm_u32x4_extend_high_u16x8(sh), k);
+      wasm_v128_store(d + x, wasm_u8x16_narrow_i16x8(
+                                 wasm_u16x8_narrow_i32x4(r0, r1),
+                                 wasm_u16x8_narrow_i32x4(r2, r3)));
+    }
+    for (; x < width; x++) {
+      double v = (double)d[x] + (double)s[x] * opacity;
+      d[x] = v >= 255 ? 255 : (u8)v;
+    }
+  }
+}
+
+__attribute__((export_name("gray_to_rgba")))
+void gray_to_rgba(i32 mode, u8 *out, const u8 *src, i32 srcPitch, i32 width,
+                  i32 height) {
+  const v128_t ff = wasm_i8x16_splat(-1);
+  for (i32 y = 0; y < height; y++) {
+    const u8 *s = src + y * srcPitch;
+    u8 *o = out + y * width * 4;
+    i32 x = 0;
+    if (mode == EXPAND_INVERT) {
+      for (; x + 16 <= width; x += 16) {
+        v128_t v = wasm_v128_xor(wasm_v128_load(s + x), ff);
+        u8 *p = o + x * 4;
+        wasm_v128_store(p, wasm_i8x16_shuffle(v, ff, 0, 0, 0, 16, 1, 1, 1, 16,
+                                              2, 2, 2, 16, 3, 3, 3, 16));
+        wasm_v128_store(p + 16, wasm_i8x16_shuffle(v, ff, 4, 4, 4, 16, 5, 5, 5,
+                                                   16, 6, 6, 6, 16, 7, 7, 7, 16));
+        wasm_v128_store(p + 32,
+                        wasm_i8x16_shuffle(v, ff, 8, 8, 8, 16, 9, 9, 9, 16, 10,
+                                           10, 10, 16, 11, 11, 11, 16));
+        wasm_v128_store(p + 48,
+                        wasm_i8x16_shuffle(v, ff, 12, 12, 12, 16, 13, 13, 13, 16,
+                                           14, 14, 14, 16, 15, 15, 15, 16));
+      }
+      for (; x < width; x++) {
+        u8 v = (u8)(255 - s[x]);
+        o[x * 4] = v; o[x * 4 + 1] = v; o[x * 4 + 2] = v; o[x * 4 + 3] = 255;
+      }
+    } else {
+      for (; x + 16 <= width; x += 16) {
+        v128_t a = wasm_v128_load(s + x);
+        u8 *p = o + x * 4;
+        wasm_v128_store(p, wasm_i8x16_shuffle(ff, a, 0, 0, 0, 16, 0, 0, 0, 17,
+                                              0, 0, 0, 18, 0, 0, 0, 19));
+        wasm_v128_store(p + 16, wasm_i8x16_shuffle(ff, a, 0, 0, 0, 20, 0, 0, 0,
+                                                   21, 0, 0, 0, 22, 0, 0, 0, 23));
+        wasm_v128_store(p + 32, wasm_i8x16_shuffle(ff, a, 0, 0, 0, 24, 0, 0, 0,
+                                                   25, 0, 0, 0, 26, 0, 0, 0, 27));
+        wasm_v128_store(p + 48, wasm_i8x16_shuffle(ff, a, 0, 0, 0, 28, 0, 0, 0,
+                                                   29, 0, 0, 0, 30, 0, 0, 0, 31));
+      }
+      for (; x < width; x++) {
+        o[x * 4] = 255; o[x * 4 + 1] = 255; o[x * 4 + 2] = 255;
+        o[x * 4 + 3] = s[x];
+      }
+    }
+  }
+}
+
+// LCD (3 bytes per pixel) -> (255-r, 255-g, 255-b, 255). Each 16-byte load
+// covers 4 pixels (12 bytes); the loop stops 16 bytes before the row end so
+// the over-read never leaves the row.
+__attribute__((export_name("lcd_to_rgba")))
+void lcd_to_rgba(u8 *out, const u8 *src, i32 srcPitch, i32 width, i32 height) {
+  const v128_t ff = wasm_i8x16_splat(-1);
+  for (i32 y = 0; y < height; y++) {
+    const u8 *s = src + y * srcPitch;
+    u8 *o = out + y * width * 4;
+    i32 x = 0;
+    for (; (x + 4) * 3 + 4 <= width * 3; x += 4) {
+      v128_t v = wasm_v128_xor(wasm_v128_load(s + x * 3), ff);
+      wasm_v128_store(o + x * 4,
+                      wasm_i8x16_shuffle(v, ff, 0, 1, 2, 16, 3, 4, 5, 16, 6, 7,
+                                         8, 16, 9, 10, 11, 16));
+    }
+    for (; x < width; x++) {
+      o[x * 4] = (u8)(255 - s[x * 3]);
+      o[x * 4 + 1] = (u8)(255 - s[x * 3 + 1]);
+      o[x * 4 + 2] = (u8)(255 - s[x * 3 + 2]);
+      o[x * 4 + 3] = 255;
+    }
+  }
+}
+
+// --- bilinear resampling (../resample.ts) ----------------------------------
+// `src` has a one-pixel border (stride bytes per row), so all four taps are in
+// bounds for every coordinate the caller lets through. Coordinates carry
+// `shift` fraction bits; the filter uses the top 8 of them as weights:
+//   top = p00 * (256 - fx) + p10 * fx
+//   bot = p01 * (256 - fx) + p11 * fx
+//   out = (top * (256 - fy) + bot * fy + 32768) >> 16
+
+static inline u8 sample_fixed(const u8 *src, i32 stride, i32 u, i32 v,
+                              i32 shift) {
+  i32 fx = (u >> (shift - 8)) & 255;
+  i32 fy = (v >> (shift - 8)) & 255;
+  const u8 *p = src + ((v >> shift) + 1) * stride + (u >> shift) + 1;
+  i32 top = p[0] * (256 - fx) + p[1] * fx;
+  i32 bot = p[stride] * (256 - fx) + p[stride + 1] * fx;
+  return (u8)((top * (256 - fy) + bot * fy + 32768) >> 16);
+}
+
+// Affine: spans holds [xStart, xEnd, u, v] per row (u, v at xStart); u and v
+// advance by du / dv per pixel. Pixels outside the span are written as 0.
+// Four pixels per step: coordinates and weights in i32x4 lanes, taps loaded
+// per lane (wasm has no gather).
+__attribute__((export_name("resample_affine")))
+void resample_affine(u8 *dst, i32 dstPitch, i32 width, i32 height,
+                     const u8 *src, i32 stride, const i32 *spans, i32 du,
+                     i32 dv, i32 shift) {
+  const v128_t lane = wasm_i32x4_make(0, 1, 2, 3);
+  const v128_t stepU = wasm_i32x4_mul(lane, wasm_i32x4_splat(du));
+  const v128_t stepV = wasm_i32x4_mul(lane, wasm_i32x4_splat(dv));
+  const v128_t mask = wasm_i32x4_splat(255);
+  const v128_t w256 = wasm_i32x4_splat(256);
+  const v128_t one = wasm_i32x4_splat(1);
+  const v128_t vstride = wasm_i32x4_splat(stride);
+  const v128_t round = wasm_i32x4_splat(32768);
+  const uint32_t du4 = (uint32_t)du * 4u;
+  const uint32_t dv4 = (uint32_t)dv * 4u;
+
+  for (i32 y = 0; y < height; y++) {
+    u8 *d = dst + y * dstPitch;
+    i32 start = spans[y * 4];
+    i32 end = spans[y * 4 + 1];
+    i32 u = spans[y * 4 + 2];
+    i32 v = spans[y * 4 + 3];
+    for (i32 x = 0; x < start; x++) d[x] = 0;
+
+    i32 x = start;
+    for (; x + 4 <= end; x += 4) {
+      v128_t vu = wasm_i32x4_add(wasm_i32x4_splat(u), stepU);
+      v128_t vv = wasm_i32x4_add(wasm_i32x4_splat(v), stepV);
+      v128_t fx = wasm_v128_and(wasm_i32x4_shr(vu, shift - 8), mask);
+      v128_t fy = wasm_v128_and(wasm_i32x4_shr(vv, shift - 8), mask);
+      v128_t idx = wasm_i32x4_add(
+          wasm_i32x4_mul(wasm_i32x4_add(wasm_i32x4_shr(vv, shift), one),
+                         vstride),
+          wasm_i32x4_add(wasm_i32x4_shr(vu, shift), one));
+      i32 i0 = wasm_i32x4_extract_lane(idx, 0);
+      i32 i1 = wasm_i32x4_extract_lane(idx, 1);
+      i32 i2 = wasm_i32x4_extract_lane(idx, 2);
+      i32 i3 = wasm_i32x4_extract_lane(idx, 3);
+      v128_t p00 = wasm_i32x4_make(src[i0], src[i1], src[i2], src[i3]);
+      v128_t p10 =
+          wasm_i32x4_make(src[i0 + 1], src[i1 + 1], src[i2 + 1], src[i3 + 1]);
+      v128_t p01 = wasm_i32x4_make(src[i0 + stride], src[i1 + stride],
+                                   src[i2 + stride], src[i3 + stride]);
+      v128_t p11 =
+          wasm_i32x4_make(src[i0 + stride + 1], src[i1 + stride + 1],
+                          src[i2 + stride + 1], src[i3 + stride + 1]);
+      v128_t ifx = wasm_i32x4_sub(w256, fx);
+      v128_t ify = wasm_i32x4_sub(w256, fy);
+      v128_t top = wasm_i32x4_add(wasm_i32x4_mul(p00, ifx),
+                                  wasm_i32x4_mul(p10, fx));
+      v128_t bot = wasm_i32x4_add(wasm_i32x4_mul(p01, ifx),
+                                  wasm_i32x4_mul(p11, fx));
+      v128_t val = wasm_i32x4_shr(
+          wasm_i32x4_add(wasm_i32x4_add(wasm_i32x4_mul(top, ify),
+                                        wasm_i32x4_mul(bot, fy)),
+                         round),
+          16);
+      v128_t w16 = wasm_i16x8_narrow_i32x4(val, val);
+      v128_t b8 = wasm_u8x16_narrow_i16x8(w16, w16);
+      wasm_v128_store32_lane(d + x, b8, 0);
+      u = (i32)((uint32_t)u + du4);
+      v = (i32)((uint32_t)v + dv4);
+    }
+    for (; x < end; x++) {
+      d[x] = sample_fixed(src, stride, u, v, shift);
+      u = (i32)((uint32_t)u + (uint32_t)du);
+      v = (i32)((uint32_t)v + (uint32_t)dv);
+    }
+    for (x = end > start ? end : start; x < width; x++) d[x] = 0;
+  }
+}
+
+// Perspective: m = [X0, Y0, W0, dX, dY, dW, dXRow, dYRow, dWRow, bx, by] (see
+// PerspectiveMapping in ../resample.ts). Same f64 operation order as the TS
+// loop, so the fixed-point coordinates (and the output) match bit for bit.
+__attribute__((export_name("resample_perspective")))
+void resample_perspective(u8 *dst, i32 dstPitch, i32 width, i32 height,
+                          const u8 *src, i32 stride, i32 srcW, i32 srcH,
+                          const double *m, i32 shift) {
+  const double scale = (double)(1 << shift);
+  const double minW = 1e-6;
+  for (i32 y = 0; y < height; y++) {
+    u8 *d = dst + y * dstPitch;
+    const double xr = m[0] + (double)y * m[6];
+    const double yr = m[1] + (double)y * m[7];
+    const double wr = m[2] + (double)y * m[8];
+    for (i32 x = 0; x < width; x++) {
+      double w = wr + (double)x * m[5];
+      if (w < minW && w > -minW) w = w < 0 ? -minW : minW;
+      const double sx = (xr + (double)x * m[3]) / w - m[9];
+      const double sy = m[10] - (yr + (double)x * m[4]) / w;
+      if (!(sx >= -1.0 && sx < (double)srcW && sy >= -1.0 &&
+            sy < (double)srcH)) {
+        d[x] = 0;
+        continue;
+      }
+      i32 u = (i32)__builtin_floor(sx * scale);
+      i32 v = (i32)__builtin_floor(sy * scale);
+      d[x] = sample_fixed(src, stride, u, v, shift);
+    }
+  }
+}
@@ -0,0 +1,654 @@
+// Optional WASM(+SIMD) fast path for 8-bit bitmap compositing (add / sub / mul
+// / max / over, and add at partial opacity), gray / LCD -> RGBA expansion and
+// single-channel bilinear resampling.
+//
+// The scalar loops in ../bitmap-utils.ts, ../rasterize.ts, ../atlas.ts,
+// ../lcd-filter.ts and ../resample.ts stay the default/baseline. This module
+// is used ONLY when WebAssembly is present, the embedded module compiles, and
+// the kernels are proven byte-identical to the scalar formulas over a
+// self-verification corpus at init. Any failure leaves the JS path in place.
+// Small rectangles also stay in JS: copying them in and out of linear memory
+// costs more than the kernel saves.
+//
+// Kernel: freestanding wasm32 + SIMD128 (see bitmap.c / build.sh).
+
+import type { PerspectiveMapping, ResampleSource } from "../resample.ts";
+import { decodeBase64 } from "../wasm-base64.ts";
+import { BITMAP_WASM_BASE64 } from "./wasm-bytes.ts";
+
+type Status = "uninit" | "ready" | "disabled";
+
+/** Blend operators (must match OP_* in bitmap.c) */
+export const BlendOp = {
+	/** dst = min(255, dst + src) */
+	Add: 0,
+	/** dst = max(0, dst - src) */
+	Sub: 1,
+	/** dst = dst * src / 255 (rounded) */
+	Mul: 2,
+	/** dst = max(dst, src) */
+	Max: 3,
+	/** dst = src + dst * (255 - src) / 255 (rounded) */
+	Over: 4,
+} as const;
+export type BlendOp = (typeof BlendOp)[keyof typeof BlendOp];
+
+/** Gray -> RGBA expansion modes (must match EXPAND_* in bitmap.c) */
+export const GrayExpand = {
+	/** (255-a, 255-a, 255-a, 255): black on white */
+	Invert: 0,
+	/** (255, 255, 255, a): white on transparent */
+	Alpha: 1,
+} as const;
+export type GrayExpand = (typeof GrayExpand)[keyof typeof GrayExpand];
+
+/** Below this many pixels the scalar JS loop is faster than the round trip */
+const MIN_WASM_PIXELS = 4096;
+const MAX_WORK_BYTES = 256 * 1024 * 1024;
+
+let status: Status = "uninit";
+let enabled = false;
+let forceDisabled = false;
+
+let memory: WebAssembly.Memory | null = null;
+let heapBase = 0;
+let blendFn: ((...a: number[]) => void) | null = null;
+let scaledFn: ((...a: number[]) => void) | null = null;
+let grayFn: ((...a: number[]) => void) | null = null;
+let lcdFn: ((...a: number[]) => void) | null = null;
+let affineFn: ((...a: number[]) => void) | null = null;
+let perspectiveFn: ((...a: number[]) => void) | null = null;
+let u8view: Uint8Array | null = null;
+let compiledModule: WebAssembly.Module | null = null;
+
+export function isBitmapWasmEnabled(): boolean {
+	return enabled && !forceDisabled;
+}
+export function setBitmapWasmEnabled(v: boolean): void {
+	forceDisabled = !v;
+}
+export function bitmapWasmStatus(): {
+	status: Status;
+	enabled: boolean;
+	forceDisabled: boolean;
+} {
+	return { status, enabled, forceDisabled };
+}
+
+function align16(n: number): number {
+	return (n + 15) & ~15;
+}
+
+function ensureCapacity(end: number): boolean {
+	if (!memory) return false;
+	if (end - heapBase > MAX_WORK_BYTES) return false;
+	if (end <= memory.buffer.byteLength) return true;
+	const pages = Math.ceil((end - memory.buffer.byteLength) / 65536);
+	try {
+		if (memory.grow(pages) === -1) return false;
+	} catch {
+		return false;
+	}
+	u8view = new Uint8Array(memory.buffer);
+	return end <= memory.buffer.byteLength;
+}
+
+function setupInstance(inst: WebAssembly.Instance): boolean {
+	const ex = inst.exports as Record<string, unknown>;
+	const mem = ex.memory as WebAssembly.Memory | undefined;
+	const blend = ex.blend_rect as ((...a: number[]) => void) | undefined;
+	const scaled = ex.blend_rect_scaled as
+		| ((...a: number[]) => void)
+		| undefined;
+	const gray = ex.gray_to_rgba as ((...a: number[]) => void) | undefined;
+	const lcd = ex.lcd_to_rgba as ((...a: number[]) => void) | undefined;
+	const affine = ex.resample_affine as ((...a: number[]) => void) | undefined;
+	const perspective = ex.resample_perspective as
+		| ((...a: number[]) => void)
+		| undefined;
+	const hb = ex.__heap_base as WebAssembly.Global | undefined;
+	if (!mem || !blend || !scaled || !gray || !lcd || !affine) return false;
+	if (!perspective || !hb) return false;
+	memory = mem;
+	blendFn = blend;
+	scaledFn = scaled;
+	grayFn = gray;
+	lcdFn = lcd;
+	affineFn = affine;
+	perspectiveFn = perspective;
+	heapBase = align16(Number(hb.value));
+	u8view = new Uint8Array(mem.buffer);
+	return true;
+}
+
+/** Copy `rows` rows of `rowBytes` bytes into packed rows of linear memory */
+function copyRectIn(
+	src: Uint8Array,
+	offset: number,
+	pitch: number,
+	rowBytes: number,
+	rows: number,
+	to: number,
+): void {
+	const u8 = u8view!;
+	if (pitch === rowBytes) {
+		u8.set(src.subarray(offset, offset + rowBytes * rows), to);
+		return;
+	}
+	for (let y = 0; y < rows; y++) {
+		const start = offset + y * pitch;
+		u8.set(src.subarray(start, start + rowBytes), to + y * rowBytes);
+	}
+}
+
+function usable(pixels: number): boolean {
+	if (status === "uninit") ensureBitmapWasmReady();
+	return enabled && !forceDisabled && pixels >= MIN_WASM_PIXELS;
+}
+
+/**
+ * Blend a pre-clipped `width` x `height` rectangle of `src` into `dst`.
+ * Offsets address the first pixel of the rectangle; pitches must be positive.
+ * Returns false (caller uses JS) when the kernel is unavailable or declines.
+ */
+export function blendRectWasm(
+	op: BlendOp,
+	dst: Uint8Array,
+	dstOffset: number,
+	dstPitch: number,
+	src: Uint8Array,
+	srcOffset: number,
+	srcPitch: number,
+	width: number,
+	height: number,
+): boolean {
+	if (!usable(width * height) || dstPitch <= 0 || srcPitch <= 0) return false;
+
+	const size = width * height;
+	const dstOff = heapBase;
+	const srcOff = align16(dstOff + size);
+	if (!ensureCapacity(align16(srcOff + size))) return false;
+
+	copyRectIn(dst, dstOffset, dstPitch, width, height, dstOff);
+	copyRectIn(src, srcOffset, srcPitch, width, height, srcOff);
+	blendFn!(op, dstOff, width, srcOff, width, width, height);
+	copyRowsOut(dstOff, dst, dstPitch, width, height, dstOffset);
+	return true;
+}
+
+/**
+ * Additive blend at partial opacity over a pre-clipped rectangle:
+ * dst = min(255, trunc(dst + src * opacity)), the formula of blendBitmap.
+ * Same addressing as blendRectWasm; `opacity` must lie in [0, 1].
+ * Returns false (caller uses JS) when the kernel is unavailable or declines.
+ */
+export function blendRectScaledWasm(
+	dst: Uint8Array,
+	dstOffset: number,
+	dstPitch: number,
+	src: Uint8Array,
+	srcOffset: number,
+	srcPitch: number,
+	width: number,
+	height: number,
+	opacity: number,
+): boolean {
+	if (!usable(width * height) || dstPitch <= 0 || srcPitch <= 0) return false;
+	if (!(opacity >= 0 && opacity <= 1)) return false;
+
+	const size = width * height;
+	const dstOff = heapBase;
+	const srcOff = align16(dstOff + size);
+	if (!ensureCapacity(align16(srcOff + size))) return false;
+
+	copyRectIn(dst, dstOffset, dstPitch, width, height, dstOff);
+	copyRectIn(src, srcOffset, srcPitch, width, height, srcOff);
+	scaledFn!(dstOff, width, srcOff, width, width, height, opacity);
+	copyRowsOut(dstOff, dst, dstPitch, width, height, dstOffset);
+	return true;
+}
+
+/**
+ * Expand 8-bit coverage rows into packed RGBA (`out` holds width*height*4).
+ * Returns false (caller uses JS) when the kernel is unavailable or declines.
+ */
+export function grayToRGBAWasm(
+	mode: GrayExpand,
+	src: Uint8Array,
+	srcOffset: number,
+	srcPitch: number,
+	width: number,
+	height: number,
+	out: Uint8Array,
+): boolean {
+	if (!usable(width * height) || srcPitch <= 0) return false;
+
+	const srcOff = heapBase;
+	const outOff = align16(srcOff + width * height);
+	const outBytes = width * height * 4;
+	if (!ensureCapacity(align16(outOff + outBytes))) return false;
+
+	copyRectIn(src, srcOffset, srcPitch, width, height, srcOff);
+	grayFn!(mode, outOff, srcOff, width, width, height);
+	out.set(u8view!.subarray(outOff, outOff + outBytes));
+	return true;
+}
+
+/**
+ * Expand LCD (3 bytes per pixel) rows into black-on-white RGBA
+ * (255-r, 255-g, 255-b, 255). Returns false (caller uses JS) when the kernel
+ * is unavailable or declines.
+ */
+export function lcdToRGBAWasm(
+	src: Uint8Array,
+	srcOffset: number,
+	srcPitch: number,
+	width: number,
+	height: number,
+	out: Uint8Array,
+): boolean {
+	if (!usable(width * height) || srcPitch <= 0) return false;
+
+	const rowBytes = width * 3;
+	const srcOff = heapBase;
+	const outOff = align16(srcOff + rowBytes * height);
+	const outBytes = width * height * 4;
+	if (!ensureCapacity(align16(outOff + outBytes))) return false;
+
+	copyRectIn(src, srcOffset, srcPitch, rowBytes, height, srcOff);
+	lcdFn!(outOff, srcOff, rowBytes, width, height);
+	out.set(u8view!.subarray(outOff, outOff + outBytes));
+	return true;
+}
+
+/** Copy packed `width`-byte rows from linear memory into `dst` */
+function copyRowsOut(
+	from: number,
+	dst: Uint8Array,
+	dstPitch: number,
+	width: number,
+	height: number,
+	dstOffset = 0,
+): void {
+	const u8 = u8view!;
+	if (dstPitch === width) {
+		dst.set(u8.subarray(from, from + width * height), dstOffset);
+		return;
+	}
+	for (let y = 0; y < height; y++) {
+		const start = from + y * width;
+		dst.set(u8.subarray(start, start + width), dstOffset + y * dstPitch);
+	}
+}
+
+/**
+ * Affine bilinear resample of a single-channel padded source. `spans` holds
+ * [xStart, xEnd, u, v] per destination row (see ../resample.ts); every
+ * destination byte of the `width` x `height` rectangle is written.
+ * Returns false (caller uses JS) when the kernel is unavailable or declines.
+ */
+export function resampleAffineWasm(
+	src: ResampleSource,
+	spans: Int32Array,
+	du: number,
+	dv: number,
+	dst: Uint8Array,
+	dstPitch: number,
+	width: number,
+	height: number,
+): boolean {
+	if (!usable(width * height) || src.channels !== 1) return false;
+
+	const srcOff = heapBase;
+	const spansOff = align16(srcOff + src.data.length);
+	const outOff = align16(spansOff + spans.byteLength);
+	if (!ensureCapacity(align16(outOff + width * height))) return false;
+
+	const u8 = u8view!;
+	u8.set(src.data, srcOff);
+	u8.set(
+		new Uint8Array(spans.buffer, spans.byteOffset, spans.byteLength),
+		spansOff,
+	);
+	affineFn!(
+		outOff,
+		width,
+		width,
+		height,
+		srcOff,
+		src.stride,
+		spansOff,
+		du,
+		dv,
+		src.shift,
+	);
+	copyRowsOut(outOff, dst, dstPitch, width, height);
+	return true;
+}
+
+/**
+ * Perspective bilinear resample of a single-channel padded source (mapping as
+ * in ../resample.ts). Every destination byte is written.
+ * Returns false (caller uses JS) when the kernel is unavailable or declines.
+ */
+export function resamplePerspectiveWasm(
+	src: ResampleSource,
+	mapping: PerspectiveMapping,
+	dst: Uint8Array,
+	dstPitch: number,
+	width: number,
+	height: number,
+): boolean {
+	if (!usable(width * height) || src.channels !== 1) return false;
+
+	const mapOff = heapBase;
+	const srcOff = align16(mapOff + mapping.length * 8);
+	const outOff = align16(srcOff + src.data.length);
+	if (!ensureCapacity(align16(outOff + width * height))) return false;
+
+	new Float64Array(memory!.buffer, mapOff, mapping.length).set(mapping);
+	u8view!.set(src.data, srcOff);
+	perspectiveFn!(
+		outOff,
+		width,
+		width,
+		height,
+		srcOff,
+		src.stride,
+		src.width,
+		src.rows,
+		mapOff,
+		src.shift,
+	);
+	copyRowsOut(outOff, dst, dstPitch, width, height);
+	return true;
+}
+
+// --- self-verification corpus ---------------------------------------------
+// Every (dst, src) byte pair through every blend operator, plus odd-width
+// expansions that exercise the SIMD body and the scalar tail. Ground truth is
+// the scalar formula used by the TS fallbacks.
+
+function expectedBlend(op: number, d: number, s: number): number {
+	switch (op) {
+		case BlendOp.Add:
+			return Math.min(255, d + s);
+		case BlendOp.Sub:
+			return Math.max(0, d - s);
+		case BlendOp.Mul:
+			return Math.floor((d * s + 127) / 255);
+		case BlendOp.Max:
+			return Math.max(d, s);
+		default:
+			return Math.min(255, s + Math.floor((d * (255 - s) + 127) / 255));
+	}
+}
+
+/** Scalar bilinear tap, the formula shared with ../resample.ts */
+function expectedSample(
+	data: Uint8Array,
+	stride: number,
+	u: number,
+	v: number,
+	shift: number,
+): number {
+	const fx = (u >> (shift - 8)) & 255;
+	const fy = (v >> (shift - 8)) & 255;
+	const p = ((v >> shift) + 1) * stride + (u >> shift) + 1;
+	const top = data[p]! * (256 - fx) + data[p + 1]! * fx;
+	const bot = data[p + stride]! * (256 - fx) + data[p + stride + 1]! * fx;
+	return (top * (256 - fy) + bot * fy + 32768) >> 16;
+}
+
+function verifyResample(): boolean {
+	// 53 x 41 padded source, 64 x 64 destination (above MIN_WASM_PIXELS)
+	const srcW = 53;
+	const srcH = 41;
+	const stride = srcW + 2;
+	const data = new Uint8Array(stride * (srcH + 2));
+	for (let y = 1; y <= srcH; y++) {
+		for (let x = 1; x <= srcW; x++) {
+			data[y * stride + x] = (x * 29 + y * 83 + x * y) & 255;
+		}
+	}
+	const src: ResampleSource = {
+		data,
+		stride,
+		width: srcW,
+		rows: srcH,
+		channels: 1,
+		shift: 16,
+	};
+	const size = 64;
+	const out = new Uint8Array(size * size);
+
+	// Rotation + scale; spans are the in-range runs of each row, found by
+	// stepping (the TS caller solves for them directly)
+	const du = 49807;
+	const dv = 21742;
+	const spans = new Int32Array(size * 4);
+	for (let y = 0; y < size; y++) {
+		const u0 = -300000 - y * 21742;
+		const v0 = -200000 + y * 49807;
+		let start = 0;
+		const inside = (x: number): boolean => {
+			const u = u0 + x * du;
+			const v = v0 + x * dv;
+			return (
+				u >= -65536 && u < srcW * 65536 && v >= -65536 && v < srcH * 65536
+			);
+		};
+		while (start < size && !inside(start)) start++;
+		let end = start;
+		while (end < size && inside(end)) end++;
+		spans[y * 4] = start;
+		spans[y * 4 + 1] = end;
+		spans[y * 4 + 2] = u0 + start * du;
+		spans[y * 4 + 3] = v0 + start * dv;
+	}
+	out.fill(7);
+	if (!resampleAffineWasm(src, spans, du, dv, out, size, size, size)) {
+		return false;
+	}
+	for (let y = 0; y < size; y++) {
+		const start = spans[y * 4]!;
+		const end = spans[y * 4 + 1]!;
+		for (let x = 0; x < size; x++) {
+			const want =
+				x >= start && x < end
+					? expectedSample(
+							data,
+							stride,
+							spans[y * 4 + 2]! + (x - start) * du,
+							spans[y * 4 + 3]! + (x - start) * dv,
+							16,
+						)
+					: 0;
+			if (out[y * size + x] !== want) return false;
+		}
+	}
+
+	const m: PerspectiveMapping = [
+		-3.1, 50.2, 1.05, 0.83, -0.21, 0.0021, 0.19, -0.77, -0.0013, 0.5, 40.5,
+	];
+	out.fill(7);
+	if (!resamplePerspectiveWasm(src, m, out, size, size, size)) return false;
+	for (let y = 0; y < size; y++) {
+		const xr = m[0] + y * m[6];
+		const yr = m[1] + y * m[7];
+		const wr = m[2] + y * m[8];
+		for (let x = 0; x < size; x++) {
+			let w = wr + x * m[5];
+			if (Math.abs(w) < 1e-6) w = w < 0 ? -1e-6 : 1e-6;
+			const sx = (xr + x * m[3]) / w - m[9];
+			const sy = m[10] - (yr + x * m[4]) / w;
+			const want =
+				sx >= -1 && sx < srcW && sy >= -1 && sy < srcH
+					? expectedSample(
+							data,
+							stride,
+							Math.floor(sx * 65536),
+							Math.floor(sy * 65536),
+							16,
+						)
+					: 0;
+			if (out[y * size + x] !== want) return false;
+		}
+	}
+	return true;
+}
+
+function selfVerify(): boolean {
+	// 256 x 256 rectangle covering every byte pair; the spare column per row
+	// must stay untouched
+	const pitch = 257;
+	const dst0 = new Uint8Array(pitch * 256);
+	const src = new Uint8Array(pitch * 256);
+	for (let d = 0; d < 256; d++) {
+		for (let s = 0; s < 256; s++) {
+			dst0[d * pitch + s] = d;
+			src[d * pitch + s] = s;
+		}
+	}
+	for (let op = 0; op <= BlendOp.Over; op++) {
+		const dst = dst0.slice();
+		if (
+			!blendRectWasm(op as BlendOp, dst, 0, pitch, src, 0, pitch, 256, 256)
+		) {
+			return false;
+		}
+		for (let d = 0; d < 256; d++) {
+			for (let s = 0; s < pitch; s++) {
+				const i = d * pitch + s;
+				const want = s < 256 ? expectedBlend(op, d, s) : dst0[i]!;
+				if (dst[i] !== want) return false;
+			}
+		}
+	}
+	// Opacities whose products land on or next to integers, where a
+	// rounding slip in the f64 lanes would show
+	for (const opacity of [0, 0.1, 0.29, 0.3, 1 / 3, 0.7, 0.999]) {
+		const dst = dst0.slice();
+		if (
+			!blendRectScaledWasm(dst, 0, pitch, src, 0, pitch, 256, 256, opacity)
+		) {
+			return false;
+		}
+		for (let d = 0; d < 256; d++) {
+			for (let s = 0; s < pitch; s++) {
+				const i = d * pitch + s;
+				const want =
+					s < 256 ? Math.min(255, Math.trunc(d + s * opacity)) : dst0[i]!;
+				if (dst[i] !== want) return false;
+			}
+		}
+	}
+
+	const width = 77;
+	const height = 61;
+	const gray = new Uint8Array(80 * height);
+	for (let i = 0; i < gray.length; i++) gray[i] = (i * 37 + 11) & 255;
+	const rgba = new Uint8Array(width * height * 4);
+	for (let mode = 0; mode <= GrayExpand.Alpha; mode++) {
+		if (!grayToRGBAWasm(mode as GrayExpand, gray, 0, 80, width, height, rgba)) {
+			return false;
+		}
+		for (let y = 0; y < height; y++) {
+			for (let x = 0; x < width; x++) {
+				const a = gray[y * 80 + x]!;
+				const p = (y * width + x) * 4;
+				const c = mode === GrayExpand.Invert ? 255 - a : 255;
+				const alpha = mode === GrayExpand.Invert ? 255 : a;
+				if (rgba[p] !== c || rgba[p + 1] !== c || rgba[p + 2] !== c) {
+					return false;
+				}
+				if (rgba[p + 3] !== alpha) return false;
+			}
+		}
+	}
+
+	const lcd = new Uint8Array(240 * height);
+	for (let i = 0; i < lcd.length; i++) lcd[i] = (i * 53 + 7) & 255;
+	if (!lcdToRGBAWasm(lcd, 0, 240, width, height, rgba)) return false;
+	for (let y = 0; y < height; y++) {
+		for (let x = 0; x < width; x++) {
+			const s = y * 240 + x * 3;
+			const p = (y * width + x) * 4;
+			if (rgba[p] !== 255 - lcd[s]! || rgba[p + 1] !== 255 - lcd[s + 1]!) {
+				return false;
+			}
+			if (rgba[p + 2] !== 255 - lcd[s + 2]! || rgba[p + 3] !== 255) {
+				return false;
+			}
+		}
+	}
+	return verifyResample();
+}
+
+function disable(): void {
+	enabled = false;
+	blendFn = null;
+	scaledFn = null;
+	grayFn = null;
+	lcdFn = null;
+	affineFn = null;
+	perspectiveFn = null;
+	memory = null;
+	u8view = null;
+	status = "disabled";
+}
+
+/**
+ * The compiled module once the kernels are ready, for sharing with workers
+ * (see getFillWasmModule). Null until ready.
+ */
+export function getBitmapWasmModule(): WebAssembly.Module | null {
+	return status === "ready" ? compiledModule : null;
+}
+
+/**
+ * Idempotent: compiles + self-verifies once. Called lazily by the first
+ * kernel request; call it up front to move the (small) compile off the hot
+ * path. Pass a module from getBitmapWasmModule() to skip decode + compile.
+ */
+export function ensureBitmapWasmReady(module?: WebAssembly.Module): void {
+	if (status !== "uninit") return;
+	if (typeof WebAssembly === "undefined") {
+		status = "disabled";
+		return;
+	}
+	try {
+		const mod =
+			module ?? new WebAssembly.Module(decodeBase64(BITMAP_WASM_BASE64));
+		const inst = new WebAssembly.Instance(mod, {});
+		if (!setupInstance(inst)) {
+			status = "disabled";
+			return;
+		}
+		// Enable provisionally so the kernels run inside selfVerify, ignoring
+		// the external force-disable switch (see fill-wasm).
+		const previousForceDisabled = forceDisabled;
+		enabled = true;
+		forceDisabled = false;
+		status = "ready";
+		let verified = false;
+		try {
+			verified = selfVerify();
+		} finally {
+			forceDisabled = previousForceDisabled;
+		}
+		if (verified) compiledModule = mod;
+		else disable();
+	} catch {
+		disable();
+	}
+}
+
+export const __testing = {
+	/** Drop back to the uninitialized state of a fresh worker */
+	reset(): void {
+		disable();
+		compiledModule = null;
+		status = "uninit";
+	},
+};
@@ -0,0 +1,4 @@
+// AUTO-GENERATED by build.sh from bitmap.c. Do not edit by hand.
+// Freestanding wasm32+SIMD bitmap compositing kernels, base64-embedded.
+export const BITMAP_WASM_BASE64 =
+	"AGFzbQEAAAABMwVgB39/f39/f38AYAd/f39/f398AGAGf39/f39/AGAFf39/f38AYAp/f39/f39/f39/AAMHBgABAgMEBAQFAXABAQEFBQEBEIBABg8CfwFBgIgEC38AQYCIBAsHfwgGbWVtb3J5AgAKYmxlbmRfcmVjdAAAEWJsZW5kX3JlY3Rfc2NhbGVkAAEMZ3JheV90b19yZ2JhAAILbGNkX3RvX3JnYmEAAw9yZXNhbXBsZV9hZmZpbmUABBRyZXNhbXBsZV9wZXJzcGVjdGl2ZQAFC19faGVhcF9iYXNlAwEK0mMG/w0CCn8FewJAIAZBAUgNAAJAIAVBEEgNACABQRBqIQcgA0EQaiEIIAVBcGohCUEAIQoDQCAHIQsgCCEMQQAhDQNAIAwhDiALIQ8gAyANIhBq/QAAACERIAEgEGoiDf0AAAAhEgJAAkACQAJAAkACQCAADgQAAQIDBAsgEiAR/XAhEQwECyASIBH9cyERDAMLIBEgEv2eAf0MgACAAIAAgACAAIAAgACAACIT/Y4BIhRBCP2NASAU/Y4BQQj9jQEgESAS/Z8BIBP9jgEiEUEI/Y0BIBH9jgFBCP2NAf1mIREMAgsgEiAR/XkhEQwBCyARIBH9TSITIBL9ngH9DIAAgACAAIAAgACAAIAAgAAiFP2OASIVQQj9jQEgFf2OAUEI/Y0BIBMgEv2fASAU/Y4BIhJBCP2NASAS/Y4BQQj9jQH9Zv1wIRELIA0gEf0LAAAgD0EQaiELIA5BEGohDCAQQRBqIQ0gEEEgaiAFTA0ACwJAIA0gBU4NACAJIBBrIQsDQCAOLQAAIQ0gDy0AACEQAkACQAJAAkACQAJAIAAOBAABAgMECyANIBBqIhBB/wEgEEH/AUkbIRAMBAtBACAQIA1rIg0gDSAQSxshEAwDCyANIBBsQYABaiIQQQh2IBBqQQh2IRAMAgsgECANIBAgDUsbIRAMAQsgDSANQf8BcyAQbEGAAWoiEEEIdiAQakEIdmohEAsgDyAQOgAAIA9BAWohDyAOQQFqIQ4gC0F/aiILDQALCyAHIAJqIQcgCCAEaiEIIAMgBGohAyABIAJqIQEgCkEBaiIKIAZHDQAMAgsLIAVBAUgNAAJAAkACQAJAAkAgAA4EAAECAwQLIAVBfnEhByAFQQFxIQggAyAEIABsaiELIAEgAiAAbGohDANAQQAhEAJAIAVBAUYNAEEAIRADQCAMIBBqIg8gCyAQaiIOLQAAIA8tAABqIg1B/wEgDUH/AUkbOgAAIA9BAWoiDyAOQQFqLQAAIA8tAABqIg9B/wEgD0H/AUkbOgAAIAcgEEECaiIQRw0ACwsCQCAIRQ0AIAEgACACbGogEGoiDyADIAAgBGxqIBBqLQAAIA8tAABqIhBB/wEgEEH/AUkbOgAACyALIARqIQsgDCACaiEMIABBAWoiACAGRw0ADAULCyAFQX5xIQcgBUEBcSEKIAMhDCABIQBBACEIA0BBACEQAkAgBUEBRg0AQQAhEANAIAAgEGoiD0EAIA8tAAAiDiAMIBBqIg0tAABrIgsgCyAOSxs6AAAgD0EBaiIPQQAgDy0AACIPIA1BAWotAABrIg4gDiAPSxs6AAAgByAQQQJqIhBHDQALCwJAIApFDQAgASAIIAJsaiAQaiIPQQAgDy0AACIPIAMgCCAEbGogEGotAABrIhAgECAPSxs6AAALIAwgBGohDCAAIAJqIQAgCEEBaiIIIAZHDQAMBAsLIAVBfnEhACAFQQFxIQhBACEHIAMhCyABIQwDQEEAIRACQCAFQQFGDQBBACEQA0AgDCAQaiIPIAsgEGoiDi0AACAPLQAAbEGAAWoiDUEIdiANakEIdjoAACAPQQFqIg8gDkEBai0AACAPLQAAbEGAAWoiD0EIdiAPakEIdjoAACAAIBBBAmoiEEcNAAsLAkAgCEUNACABIAcgAmxqIBBqIg8gAyAHIARsaiAQai0AACAPLQAAbEGAAWoiEEEIdiAQakEIdjoAAAsgCyAEaiELIAwgAmohDCAHQQFqIgcgBkcNAAwDCwsgBUF+cSEHIAVBAXEhCkEAIQggAyEMIAEhAANAQQAhEAJAIAVBAUYNAEEAIRADQCAAIBBqIg8gDy0AACIOIAwgEGoiDS0AACILIA4gC0sbOgAAIA9BAWoiDyAPLQAAIg8gDUEBai0AACIOIA8gDksbOgAAIAcgEEECaiIQRw0ACwsCQCAKRQ0AIAEgCCACbGogEGoiDyAPLQAAIg8gAyAIIARsaiAQai0AACIQIA8gEEsbOgAACyAMIARqIQwgACACaiEAIAhBAWoiCCAGRw0ADAILCyAFQX5xIQAgBUEBcSEIQQAhByADIQsgASEMA0BBACEQAkAgBUEBRg0AQQAhEANAIAwgEGoiDyALIBBqIg4tAAAiDSANQX9zQf8BcSAPLQAAbEGAAWoiDUEIdiANakEIdmo6AAAgD0EBaiIPIA5BAWotAAAiDiAOQX9zQf8BcSAPLQAAbEGAAWoiD0EIdiAPakEIdmo6AAAgACAQQQJqIhBHDQALCwJAIAhFDQAgASAHIAJsaiAQaiIPIAMgByAEbGogEGotAAAiECAQQX9zQf8BcSAPLQAAbEGAAWoiEEEIdiAQakEIdmo6AAALIAsgBGohCyAMIAJqIQwgB0EBaiIHIAZHDQALCwuoJBUBexJ/B3sBfAF/AXwBfwF8AX8BfAF/AXwBfwF8AX8BfAF/AXwDfwF8CH8CQCAFQQFIDQACQCAEQRBIDQAgBv0UIQcgBEFwaiEIIABBEGohCSACQRBqIQpBACAEayELIAIhDCAAIQ1BACEOA0AgAiAOIANsIg9qIRAgACAOIAFsIhFqIRIgAiAPIARqaiETIAAgESAEamohFCAJIRUgCiEWIAQhF0EAIREDQCAWIRggFSEZAkACQCAHIAwgESIPav0AAAAiGv2KASIb/aoBIhz9/gH98gEgDSAPaiIR/QAAACId/YoBIh79qgEiH/3+Af3wASIg/SEBIiGZRAAAAAAAAOBBY0UNACAhqiEiDAELQYCAgIB4ISILAkACQCAg/SEAIiOZRAAAAAAAAOBBY0UNACAjqiEkDAELQYCAgIB4ISQLAkACQCAHIBwgB/0NCAkKCwwNDg8AAAAAAAAAAP3+Af3yASAfIAf9DQgJCgsMDQ4PAAAAAAAAAAD9/gH98AEiHP0hACIlmUQAAAAAAADgQWNFDQAgJaohJgwBC0GAgICAeCEmCwJAAkAgHP0hASInmUQAAAAAAADgQWNFDQAgJ6ohKAwBC0GAgICAeCEoCwJAAkAgByAb/akBIhv9/gH98gEgHv2pASIc/f4B/fABIh79IQEiKZlEAAAAAAAA4EFjRQ0AICmqISoMAQtBgICAgHghKgsCQAJAIB79IQAiK5lEAAAAAAAA4EFjRQ0AICuqISwMAQtBgICAgHghLAsCQAJAIAcgGyAH/Q0ICQoLDA0ODwAAAAAAAAAA/f4B/fIBIBwgB/0NCAkKCwwNDg8AAAAAAAAAAP3+Af3wASIb/SEAIi2ZRAAAAAAAAOBBY0UNACAtqiEuDAELQYCAgIB4IS4LICNEAAAAAAAA4MFmIRUgK0QAAAAAAADgwWYhFgJAAkAgG/0hASIvmUQAAAAAAADgQWNFDQAgL6ohMAwBC0GAgICAeCEwCyAhRAAAAAAAAODBZiExICRBgICAgHggFRshFSAjRAAAwP///99BZCEkIClEAAAAAAAA4MFmITIgLEGAgICAeCAWGyEWICtEAADA////30FkISwCQAJAIAcgGv2JASIa/aoBIhv9/gH98gEgHf2JASIc/aoBIh39/gH98AEiHv0hASIzmUQAAAAAAADgQWNFDQAgM6ohNAwBC0GAgICAeCE0CyAiQYCAgIB4IDEbITEgIUQAAMD////fQWQhIkH/////ByAVICQbIRUgIyAjYiEkICVEAAAAAAAA4MFmITUgKkGAgICAeCAyGyEyIClEAADA////30FkISpB/////wcgFiAsGyEWICsgK2IhLCAtRAAAAAAAAODBZiE2IDNEAAAAAAAA4MFmITcgHv0hACIjRAAAAAAAAODBZiE4AkACQCAjmUQAAAAAAADgQWNFDQAgI6ohOQwBC0GAgICAeCE5C0H/////ByAxICIbITEgISAhYiEiQQAgFSAkGyEVICZBgICAgHggNRshJCAlRAAAwP///99BZCE1ICdEAAAAAAAA4MFmISZB/////wcgMiAqGyEyICkgKWIhKkEAIBYgLBshFiAuQYCAgIB4IDYbISwgLUQAAMD////fQWQhNiAvRAAAAAAAAODBZiEuIDRBgICAgHggNxshNyAzRAAAwP///99BZCE0Qf////8HIDlBgICAgHggOBsgI0QAAMD////fQWQbITggIyAjYiE5IAcgGyAH/Q0ICQoLDA0ODwAAAAAAAAAA/f4B/fIBIB0gB/0NCAkKCwwNDg8AAAAAAAAAAP3+Af3wASIb/SEAIiFEAAAAAAAA4MFmIToCQAJAICGZRAAAAAAAAOBBY0UNACAhqiE7DAELQYCAgIB4ITsLQQAgMSAiGyExIBX9ESEdQf////8HICQgNRshFSAlICViISQgKEGAgICAeCAmGyEiICdEAADA////30FkITVBACAyICobITIgFv0RIR5B/////wcgLCA2GyEWIC0gLWIhLCAwQYCAgIB4IC4bISogL0QAAMD////fQWQhNkH/////ByA3IDQbITcgMyAzYiEmQQAgOCA5GyE4IDtBgICAgHggOhshLiAhRAAAwP///99BZCE0IBv9IQEiI0QAAAAAAADgwWYhOQJAAkAgI5lEAAAAAAAA4EFjRQ0AICOqIToMAQtBgICAgHghOgsgHSAx/RwBIRtBACAVICQbIRVB/////wcgIiA1GyExICcgJ2IhJCAeIDL9HAEhHUEAIBYgLBshFkH/////ByAqIDYbITIgLyAvYiEsQQAgNyAmGyEiIDj9ESEeQf////8HIC4gNBshNSAhICFiISogOkGAgICAeCA5GyE2ICNEAADA////30FkITcgByAa/akBIhr9/gH98gEgHP2pASIc/f4B/fABIh/9IQEiIUQAAAAAAADgwWYhOAJAAkAgIZlEAAAAAAAA4EFjRQ0AICGqISYMAQtBgICAgHghJgsgGyAV/RwCIRtBACAxICQbIRUgHSAW/RwCIR1BACAyICwbIRYgHiAi/RwBIR5BACA1ICobITFB/////wcgNiA3GyEkICMgI2IhMkEAQf////8HICZBgICAgHggOBsgIUQAAMD////fQWQbICEgIWIbISwgH/0hACIhRAAAAAAAAODBZiEiAkACQCAhmUQAAAAAAADgQWNFDQAgIaohNQwBC0GAgICAeCE1CyAbIBX9HAMhGyAdIBb9HAMhHSAeIDH9HAIhHkEAICQgMhshFUEAQf////8HIDVBgICAgHggIhsgIUQAAMD////fQWQbICEgIWIb/REgLP0cASEfIAcgGiAH/Q0ICQoLDA0ODwAAAAAAAAAA/f4B/fIBIBwgB/0NCAkKCwwNDg8AAAAAAAAAAP3+Af3wASIa/SEAIiFEAAAAAAAA4MFmIRYCQAJAICGZRAAAAAAAAOBBY0UNACAhqiExDAELQYCAgIB4ITELIB0gG/2GASEbIB4gFf0cAyEcIB9BAEH/////ByAxQYCAgIB4IBYbICFEAADA////30FkGyAhICFiG/0cAiEdIBr9IQEiIUQAAAAAAADgwWYhFQJAAkAgIZlEAAAAAAAA4EFjRQ0AICGqIRYMAQtBgICAgHghFgsgESAdQQBB/////wcgFkGAgICAeCAVGyAhRAAAwP///99BZBsgISAhYhv9HAMgHP2GASAb/Wb9CwAAIBlBEGohFSAYQRBqIRYgF0FwaiEXIA9BEGohESAPQSBqIARMDQALAkAgESAETg0AAkAgBCARayIWQRBJDQACQCANIBFqIBNPDQAgDCARaiAUSQ0BCyAWQXBxITEgCCAPa0FwcSEPIBdBcHEgEWohEQNAAkACQCAHIBj9AAAAIhr9FgC4/RQgGv0WAbj9IgH98gEgGf0AAAAiG/0WALj9FCAb/RYBuP0iAf3wAf0MAAAAAADgb0AAAAAAAOBvQCIc/fQBIh39IQEiIUQAAAAAAADwQWMgIUQAAAAAAAAAAGZxRQ0AICGrIRcMAQtBACEXCwJAAkAgHf0hACIhRAAAAAAAAPBBYyAhRAAAAAAAAAAAZnFFDQAgIashFQwBC0EAIRULIBX9DyAX/RcBIR0CQAJAIAcgGv0WArj9FCAa/RYDuP0iAf3yASAb/RYCuP0UIBv9FgO4/SIB/fABIBz99AEiHv0hACIhRAAAAAAAAPBBYyAhRAAAAAAAAAAAZnFFDQAgIashFwwBC0EAIRcLIB0gF/0XAiEdAkACQCAe/SEBIiFEAAAAAAAA8EFjICFEAAAAAAAAAABmcUUNACAhqyEXDAELQQAhFwsgHSAX/RcDIR0CQAJAIAcgGv0WBLj9FCAa/RYFuP0iAf3yASAb/RYEuP0UIBv9FgW4/SIB/fABIBz99AEiHv0hACIhRAAAAAAAAPBBYyAhRAAAAAAAAAAAZnFFDQAgIashFwwBC0EAIRcLIB0gF/0XBCEdAkACQCAe/SEBIiFEAAAAAAAA8EFjICFEAAAAAAAAAABmcUUNACAhqyEXDAELQQAhFwsgHSAX/RcFIR0CQAJAIAcgGv0WBrj9FCAa/RYHuP0iAf3yASAb/RYGuP0UIBv9Fge4/SIB/fABIBz99AEiHv0hACIhRAAAAAAAAPBBYyAhRAAAAAAAAAAAZnFFDQAgIashFwwBC0EAIRcLIB0gF/0XBiEdAkACQCAe/SEBIiFEAAAAAAAA8EFjICFEAAAAAAAAAABmcUUNACAhqyEXDAELQQAhFwsgHSAX/RcHIR0CQAJAIAcgGv0WCLj9FCAa/RYJuP0iAf3yASAb/RYIuP0UIBv9Fgm4/SIB/fABIBz99AEiHv0hACIhRAAAAAAAAPBBYyAhRAAAAAAAAAAAZnFFDQAgIashFwwBC0EAIRcLIB0gF/0XCCEdAkACQCAe/SEBIiFEAAAAAAAA8EFjICFEAAAAAAAAAABmcUUNACAhqyEXDAELQQAhFwsgHSAX/RcJIR0CQAJAIAcgGv0WCrj9FCAa/RYLuP0iAf3yASAb/RYKuP0UIBv9Fgu4/SIB/fABIBz99AEiHv0hACIhRAAAAAAAAPBBYyAhRAAAAAAAAAAAZnFFDQAgIashFwwBC0EAIRcLIB0gF/0XCiEdAkACQCAe/SEBIiFEAAAAAAAA8EFjICFEAAAAAAAAAABmcUUNACAhqyEXDAELQQAhFwsgHSAX/RcLIR0CQAJAIAcgGv0WDLj9FCAa/RYNuP0iAf3yASAb/RYMuP0UIBv9Fg24/SIB/fABIBz99AEiHv0hACIhRAAAAAAAAPBBYyAhRAAAAAAAAAAAZnFFDQAgIashFwwBC0EAIRcLIB0gF/0XDCEdAkACQCAe/SEBIiFEAAAAAAAA8EFjICFEAAAAAAAAAABmcUUNACAhqyEXDAELQQAhFwsgHSAX/RcNIR0CQAJAIAcgGv0WDrj9FCAa/RYPuP0iAf3yASAb/RYOuP0UIBv9Fg+4/SIB/fABIBz99AEiGv0hACIhRAAAAAAAAPBBYyAhRAAAAAAAAAAAZnFFDQAgIashFwwBC0EAIRcLIB0gF/0XDiEbAkACQCAa/SEBIiFEAAAAAAAA8EFjICFEAAAAAAAAAABmcUUNACAhqyEXDAELQQAhFwsgGSAbIBf9Fw/9CwAAIBlBEGohGSAYQRBqIRggD0FwaiIPDQALIBYgMUYNAQsgEUF/cyEPAkAgBCARa0EBcUUNAAJAAkAgECARai0AALggBqIgEiARaiIZLQAAuKBEAAAAAADgb0CkIiFEAAAAAAAA8EFjICFEAAAAAAAAAABmcUUNACAhqyEYDAELQQAhGAsgGSAYOgAAIBFBAWohEQsgDyALRg0AA0ACQAJAIAwgEWoiGS0AALggBqIgDSARaiIPLQAAuKBEAAAAAADgb0CkIiFEAAAAAAAA8EFjICFEAAAAAAAAAABmcUUNACAhqyEYDAELQQAhGAsgDyAYOgAAAkACQCAZQQFqLQAAuCAGoiAPQQFqIg8tAAC4oEQAAAAAAOBvQKQiIUQAAAAAAADwQWMgIUQAAAAAAAAAAGZxRQ0AICGrIRkMAQtBACEZCyAPIBk6AAAgBCARQQJqIhFHDQALCyAJIAFqIQkgCiADaiEKIAwgA2ohDCANIAFqIQ0gDkEBaiIOIAVHDQAMAgsLIARBAUgNACAEQX5xIRYgBEEBcSEkQQAhMSACIRcgACEVA0BBACEPAkAgBEEBRg0AQQAhDwNAAkACQCAXIA9qIhktAAC4IAaiIBUgD2oiES0AALigRAAAAAAA4G9ApCIhRAAAAAAAAPBBYyAhRAAAAAAAAAAAZnFFDQAgIashGAwBC0EAIRgLIBEgGDoAAAJAAkAgGUEBai0AALggBqIgEUEBaiIRLQAAuKBEAAAAAADgb0CkIiFEAAAAAAAA8EFjICFEAAAAAAAAAABmcUUNACAhqyEZDAELQQAhGQsgESAZOgAAIBYgD0ECaiIPRw0ACwsCQCAkRQ0AAkACQCACIDEgA2xqIA9qLQAAuCAGoiAAIDEgAWxqIA9qIg8tAAC4oEQAAAAAAOBvQKQiIUQAAAAAAADwQWMgIUQAAAAAAAAAAGZxRQ0AICGrIREMAQtBACERCyAPIBE6AAALIBcgA2ohFyAVIAFqIRUgMUEBaiIxIAVHDQALCwuOHAcHfwJ7An8EewF/BXsFfwJAIAVBAUgNACAEQQJ0IQYCQCAADQBBACEHIARBEEghCCACIQkgASEKA0BBACELAkAgCA0AQQAhDCAKIQADQCAAQTBqIAkgDGr9AAAA/U0iDf0M/wAAAAAAAAAAAAAAAAAAACIO/Q0MDAwQDQ0NEA4ODhAPDw8Q/QsAACAAQSBqIA0gDv0NCAgIEAkJCRAKCgoQCwsLEP0LAAAgAEEQaiANIA79DQQEBBAFBQUQBgYGEAcHBxD9CwAAIAAgDSAO/Q0AAAAQAQEBEAICAhADAwMQ/QsAACAAQcAAaiEAIAxBIGohDyAMQRBqIgshDCAPIARMDQALCwJAIAsgBE4NAAJAIAQgC2siEEEQSQ0AAkAgASAGIAdsIgxqIgAgC0ECdGogAiAHIANsIg8gBGpqTw0AIAIgD2ogC2ogASAGIAxqakkNAQsgCSALaiEMIAv9ESIN/QwMAAAADQAAAA4AAAAPAAAA/VAhESAN/QwIAAAACQAAAAoAAAALAAAA/VAhEiAN/QwEAAAABQAAAAYAAAAHAAAA/VAhEyAN/QwAAAAAAQAAAAIAAAADAAAA/VAhFCALIBBBcHEiFWohCyAVIQ8DQCAAIBRBAv2rASIO/RsAaiAM/QAAAP1NIg39WAAAACAAIA79DAEAAAABAAAAAQAAAAEAAAAiFv1QIhf9GwBqIA39WAAAACAAIA79GwFqIA39WAAAASAAIBf9GwFqIA39WAAAASAAIA79GwJqIA39WAAAAiAAIBf9GwJqIA39WAAAAiAAIA79GwNqIA39WAAAAyAAIBf9GwNqIA39WAAAAyAAIBNBAv2rASIX/RsAaiAN/VgAAAQgACAXIBb9UCIY/RsAaiAN/VgAAAQgACAX/RsBaiAN/VgAAAUgACAY/RsBaiAN/VgAAAUgACAX/RsCaiAN/VgAAAYgACAY/RsCaiAN/VgAAAYgACAX/RsDaiAN/VgAAAcgACAY/RsDaiAN/VgAAAcgACASQQL9qwEiGP0bAGogDf1YAAAIIAAgGCAW/VAiGf0bAGogDf1YAAAIIAAgGP0bAWogDf1YAAAJIAAgGf0bAWogDf1YAAAJIAAgGP0bAmogDf1YAAAKIAAgGf0bAmogDf1YAAAKIAAgGP0bA2ogDf1YAAALIAAgGf0bA2ogDf1YAAALIAAgEUEC/asBIhn9GwBqIA39WAAADCAAIBkgFv1QIhb9GwBqIA39WAAADCAAIBn9GwFqIA39WAAADSAAIBb9GwFqIA39WAAADSAAIBn9GwJqIA39WAAADiAAIBb9GwJqIA39WAAADiAAIBn9GwNqIA39WAAADyAAIBb9GwNqIA39WAAADyAAIA79DAIAAAACAAAAAgAAAAIAAAAiFv1QIhr9GwBqIA39WAAAACAAIBr9GwFqIA39WAAAASAAIBr9GwJqIA39WAAAAiAAIBr9GwNqIA39WAAAAyAAIBcgFv1QIhr9GwBqIA39WAAABCAAIBr9GwFqIA39WAAABSAAIBr9GwJqIA39WAAABiAAIBr9GwNqIA39WAAAByAAIBggFv1QIhr9GwBqIA39WAAACCAAIBr9GwFqIA39WAAACSAAIBr9GwJqIA39WAAACiAAIBr9GwNqIA39WAAACyAAIBkgFv1QIhb9GwBqIA39WAAADCAAIBb9GwFqIA39WAAADSAAIBb9GwJqIA39WAAADiAAIBb9GwNqIA39WAAADyAAIA79DAMAAAADAAAAAwAAAAMAAAAiDf1QIg79GwBqQf8BOgAAIAAgDv0bAWpB/wE6AAAgACAO/RsCakH/AToAACAAIA79GwNqQf8BOgAAIAAgFyAN/VAiDv0bAGpB/wE6AAAgACAO/RsBakH/AToAACAAIA79GwJqQf8BOgAAIAAgDv0bA2pB/wE6AAAgACAYIA39UCIO/RsAakH/AToAACAAIA79GwFqQf8BOgAAIAAgDv0bAmpB/wE6AAAgACAO/RsDakH/AToAACAAIBkgDf1QIg39GwBqQf8BOgAAIAAgDf0bAWpB/wE6AAAgACAN/RsCakH/AToAACAAIA39GwNqQf8BOgAAIBT9DBAAAAAQAAAAEAAAABAAAAAiDf2uASEUIAxBEGohDCATIA39rgEhEyASIA39rgEhEiARIA39rgEhESAPQXBqIg8NAAsgECAVRg0BCyAKIAtBAnRqIQADQCAJIAtqLQAAIQwgAEEDakH/AToAACAAQQJqIAxBf3MiDDoAACAAQQFqIAw6AAAgACAMOgAAIABBBGohACAEIAtBAWoiC0cNAAsLIAkgA2ohCSAKIAZqIQogB0EBaiIHIAVHDQAMAgsLAkAgBEEQSA0AIARBcGohGyACQRBqIRwgBEECdCEdQQAhECACIQcgASEVA0AgASAGIBBsaiEAIAIgECADbCAEamohHiABIAYgHSAQbGpqIR8gHCEKIAQhDyAVIQxBACELA0AgDEEwav0M/wAAAAAAAAAAAAAAAAAAACINIAcgCyIJav0AAAAiDv0NAAAAHAAAAB0AAAAeAAAAH/0LAAAgDEEgaiANIA79DQAAABgAAAAZAAAAGgAAABv9CwAAIAxBEGogDSAO/Q0AAAAUAAAAFQAAABYAAAAX/QsAACAMIA0gDv0NAAAAEAAAABEAAAASAAAAE/0LAAAgCiIIQRBqIQogD0FwaiEPIAxBwABqIQwgCUEQaiELIAlBIGogBEwNAAsCQCALIARODQACQCAEIAtrIgpBEEkNAAJAIAwgHk8NACAHIAtqIB9JDQELIApBcHEhHiAL/REiDf0MDAAAAA0AAAAOAAAADwAAAP1QIRogDf0MCAAAAAkAAAAKAAAACwAAAP1QIREgDf0MBAAAAAUAAAAGAAAABwAAAP1QIRIgDf0MAAAAAAEAAAACAAAAAwAAAP1QIRMgGyAJa0FwcSEMIA9BcHEgC2ohCwNAIAAgE0EC/asBIg39GwBqQf8BOgAAIAAgDf0MAQAAAAEAAAABAAAAAQAAACIZ/VAiDv0bAGpB/wE6AAAgACAN/RsBakH/AToAACAAIA79GwFqQf8BOgAAIAAgDf0bAmpB/wE6AAAgACAO/RsCakH/AToAACAAIA39GwNqQf8BOgAAIAAgDv0bA2pB/wE6AAAgACASQQL9qwEiDv0bAGpB/wE6AAAgACAOIBn9UCIX/RsAakH/AToAACAAIA79GwFqQf8BOgAAIAAgF/0bAWpB/wE6AAAgACAO/RsCakH/AToAACAAIBf9GwJqQf8BOgAAIAAgDv0bA2pB/wE6AAAgACAX/RsDakH/AToAACAAIBFBAv2rASIX/RsAakH/AToAACAAIBcgGf1QIhj9GwBqQf8BOgAAIAAgF/0bAWpB/wE6AAAgACAY/RsBakH/AToAACAAIBf9GwJqQf8BOgAAIAAgGP0bAmpB/wE6AAAgACAX/RsDakH/AToAACAAIBj9GwNqQf8BOgAAIAAgGkEC/asBIhj9GwBqQf8BOgAAIAAgGCAZ/VAiGf0bAGpB/wE6AAAgACAY/RsBakH/AToAACAAIBn9GwFqQf8BOgAAIAAgGP0bAmpB/wE6AAAgACAZ/RsCakH/AToAACAAIBj9GwNqQf8BOgAAIAAgGf0bA2pB/wE6AAAgACAN/QwCAAAAAgAAAAIAAAACAAAAIhn9UCIW/RsAakH/AToAACAAIBb9GwFqQf8BOgAAIAAgFv0bAmpB/wE6AAAgACAW/RsDakH/AToAACAAIA4gGf1QIhb9GwBqQf8BOgAAIAAgFv0bAWpB/wE6AAAgACAW/RsCakH/AToAACAAIBb9GwNqQf8BOgAAIAAgFyAZ/VAiFv0bAGpB/wE6AAAgACAW/RsBakH/AToAACAAIBb9GwJqQf8BOgAAIAAgFv0bA2pB/wE6AAAgACAYIBn9UCIZ/RsAakH/AToAACAAIBn9GwFqQf8BOgAAIAAgGf0bAmpB/wE6AAAgACAZ/RsDakH/AToAACAAIA39DAMAAAADAAAAAwAAAAMAAAAiGf1QIhb9GwBqIAj9AAAAIg39WAAAACAAIBb9GwFqIA39WAAAASAAIBb9GwJqIA39WAAAAiAAIBb9GwNqIA39WAAAAyAAIA4gGf1QIg79GwBqIA39WAAABCAAIA79GwFqIA39WAAABSAAIA79GwJqIA39WAAABiAAIA79GwNqIA39WAAAByAAIBcgGf1QIg79GwBqIA39WAAACCAAIA79GwFqIA39WAAACSAAIA79GwJqIA39WAAACiAAIA79GwNqIA39WAAACyAAIBggGf1QIg79GwBqIA39WAAADCAAIA79GwFqIA39WAAADSAAIA79GwJqIA39WAAADiAAIA79GwNqIA39WAAADyAT/QwQAAAAEAAAABAAAAAQAAAAIg39rgEhEyAIQRBqIQggEiAN/a4BIRIgESAN/a4BIREgGiAN/a4BIRogDEFwaiIMDQALIAogHkYNAQsgFSALQQJ0aiEAA0AgAEH//wM7AAAgAEECakH/AToAACAAQQNqIAcgC2otAAA6AAAgAEEEaiEAIAQgC0EBaiILRw0ACwsgHCADaiEcIAcgA2ohByAVIAZqIRUgEEEBaiIQIAVHDQAMAgsLIARBAUgNAEEAIQkDQCABIQAgAiEMIAQhCwNAIABB//8DOwAAIABBAmpB/wE6AAAgAEEDaiAMLQAAOgAAIABBBGohACAMQQFqIQwgC0F/aiILDQALIAEgBmohASACIANqIQIgCUEBaiIJIAVHDQALCwv9AwEOfwJAIARBAUgNACADQQJ0IQUCQCADQQNsIgZBEEgNACABQQxqIQcgAEEQaiEIIANBfGohCUEAIQoDQEEQIQsgByEMIAghDSAAIQ5BACEPA0AgDiABIAtqQXBq/QAAAP0M////////////////AAAAAP1R/Qz/AAAAAAAAAAAAAAAAAAAA/Q0AAQIQAwQFEAYHCBAJCgsQ/QsAACAMIhBBDGohDCANIhFBEGohDSAOQRBqIQ4gDyISQQRqIQ8gC0EMaiILIAZMDQALAkAgDyADTg0AIAkgEmshCwNAIBEgEC0AAEF/czoAACARQQFqIBBBAWotAABBf3M6AAAgEEECai0AACEOIBFBA2pB/wE6AAAgEUECaiAOQX9zOgAAIBBBA2ohECARQQRqIREgC0F/aiILDQALCyAHIAJqIQcgCCAFaiEIIAAgBWohACABIAJqIQEgCkEBaiIKIARHDQAMAgsLIANBAUgNACAAQQNqIQ9BACEMA0AgASEQIA8hESADIQsDQCARQX1qIBAtAABBf3M6AAAgEUF+aiAQQQFqLQAAQX9zOgAAIBBBAmotAAAhDiARQf8BOgAAIBFBf2ogDkF/czoAACAQQQNqIRAgEUEEaiERIAtBf2oiCw0ACyABIAJqIQEgDyAFaiEPIAxBAWoiDCAERw0ACwsLxwwIAn8EewN/AXsKfwF7DX8DewJAIANBAUgNACAIQQJ0IQogB0ECdCELIAj9Ef0MAAAAAAEAAAACAAAAAwAAACIM/bUBIQ0gB/0RIAz9tQEhDiAF/REhDyAEQQFqIRAgBUEBaiERIAlBeGohEiAJQR9x/REhDCAJQRhqQR9x/REhE0EAIRQDQCAGIBRBBHRqIhVBDGooAgAhFiAVQQhqKAIAIRcgFUEEaigCACEYAkAgFSgCACIZQQFIDQBBACEVAkAgGUEQSQ0AIBlBcHEiFUFwaiIaQQR2QQFqIhtBB3EhHEEAIR0CQCAaQfAASQ0AIBtB+P///wFxIRtBACEdA0AgACAdaiIa/QwAAAAAAAAAAAAAAAAAAAAAIh79CwAAIBpB8ABqIB79CwAAIBpB4ABqIB79CwAAIBpB0ABqIB79CwAAIBpBwABqIB79CwAAIBpBMGogHv0LAAAgGkEgaiAe/QsAACAaQRBqIB79CwAAIB1BgAFqIR0gG0F4aiIbDQALCwJAIBxFDQAgACAdaiEaA0AgGv0MAAAAAAAAAAAAAAAAAAAAAP0LAAAgGkEQaiEaIBxBf2oiHA0ACwsgGSAVRg0BCwNAIAAgFWpBADoAACAZIBVBAWoiFUcNAAsLIBkhFQJAIBlBBGogGEoNAANAIAAgFWogBCAX/REgDv2uASIe/RsAIhogDP0bACIddf0RIB79GwEiHCAM/RsBIht1/RwBIB79GwIiHyAM/RsCIiB1/RwCIB79GwMiISAM/RsDIiJ1/RwDIBb9ESAN/a4BIh79GwAiIyAddf0RIB79GwEiHSAbdf0cASAe/RsCIhsgIHX9HAIgHv0bAyIgICJ1/RwD/QwBAAAAAQAAAAEAAAABAAAAIh79rgEgD/21Af2uASAe/a4BIh79GwAiImoiJEEBai0AAP0RIAQgHv0bASIlaiImQQFqLQAA/RwBIAQgHv0bAiInaiIoQQFqLQAA/RwCIAQgHv0bAyIpaiIqQQFqLQAA/RwDIBogE/0bACIrdf0RIBwgE/0bASIadf0cASAfIBP9GwIiHHX9HAIgISAT/RsDIh91/RwD/Qz/AAAA/wAAAP8AAAD/AAAAIiz9TiIe/bUBICQtAAD9ESAmLQAA/RwBICgtAAD9HAIgKi0AAP0cA/0MAAEAAAABAAAAAQAAAAEAACItIB79sQEiLv21Af2uASAtICMgK3X9ESAdIBp1/RwBIBsgHHX9HAIgICAfdf0cAyAs/U4iLP2xAf21ASAEICIgBWpqIhpBAWotAAD9ESAEICUgBWpqIh1BAWotAAD9HAEgBCAnIAVqaiIcQQFqLQAA/RwCIAQgKSAFamoiG0EBai0AAP0cAyAe/bUBIBotAAD9ESAdLQAA/RwBIBwtAAD9HAIgGy0AAP0cAyAu/bUB/a4BICz9tQH9rgH9DACAAAAAgAAAAIAAAACAAAD9rgFBEP2sASIeIB79hQEiHiAe/Wb9WgAAACAWIApqIRYgFyALaiEXIBVBCGohGiAVQQRqIRUgGiAYTA0ACwsCQCAVIBhODQADQCAAIBVqIBcgEnVB/wFxIh0gECAWIAl1QQFqIAVsaiAXIAl1aiIaLQABbEGAAiAdayIcIBotAABsakGAAiAWIBJ1Qf8BcSIba2wgHSAaIBFqLQAAbCAcIBogBWotAABsaiAbbGpBgIACakEQdjoAACAWIAhqIRYgFyAHaiEXIBggFUEBaiIVRw0ACwsCQCAYIBkgGCAZShsiFSACTg0AAkAgAiAVayIcQRBJDQAgHEFwcSIbQXBqIhZBBHZBAWoiHUEDcSEaQQAhFwJAIBZBMEkNACAAIBVqIRggHUH8////AXEhHUEAIRcDQCAYIBdqIhb9DAAAAAAAAAAAAAAAAAAAAAAiHv0LAAAgFkEwaiAe/QsAACAWQSBqIB79CwAAIBZBEGogHv0LAAAgF0HAAGohFyAdQXxqIh0NAAsLAkAgGkUNACAAIBcgFWpqIRYDQCAW/QwAAAAAAAAAAAAAAAAAAAAA/QsAACAWQRBqIRYgGkF/aiIaDQALCyAcIBtGDQEgFSAbaiEVCwNAIAAgFWpBADoAACACIBVBAWoiFUcNAAsLIAAgAWohACAUQQFqIhQgA0cNAAsLC8wEBgF8An8CfAJ/B3wDfwJAIANBAUgNACACQQFIDQBBASAJdLchCiAFQQFqIQsgCUF4aiEMIAe3IQ0gBrchDiAEQQFqIQ9BACEQRAAAAAAAAAAAIREDQCAIKwMQIAgrA0AgEaKgIRIgCCsDCCAIKwM4IBGioCETIAgrAwAgCCsDMCARoqAhFCACIQcgACEERAAAAAAAAAAAIRUDQEEAIQYCQCAUIAgrAxggFaKgRI3ttaD3xrC+RI3ttaD3xrA+IBIgCCsDKCAVoqAiFkQAAAAAAAAAAGMbIBYgFkSN7bWg98awvmQbIBYgFkSN7bWg98awPmMbIhejIAgrA0ihIhZEAAAAAAAA8L9mRQ0AIBYgDmNFDQAgCCsDUCATIAgrAyAgFaKgIBejoSIXRAAAAAAAAPC/ZkUNACAXIA1jRQ0AAkACQCAWIAqinCIWmUQAAAAAAADgQWNFDQAgFqohBgwBC0GAgICAeCEGCyAGIAl1IRgCQAJAIBcgCqKcIhaZRAAAAAAAAOBBY0UNACAWqiEZDAELQYCAgIB4IRkLIAYgDHVB/wFxIhogDyAZIAl1QQFqIAVsaiAYaiIGLQABbEGAAiAaayIYIAYtAABsakGAAiAZIAx1Qf8BcSIZa2wgGiAGIAtqLQAAbCAYIAYgBWotAABsaiAZbGpBgIACakEQdiEGCyAEIAY6AAAgBEEBaiEEIBVEAAAAAAAA8D+gIRUgB0F/aiIHDQALIAAgAWohACARRAAAAAAAAPA/oCERIBBBAWoiECADRw0ACwsLAI8BBG5hbWUAEA9iaXRtYXAtbmV3Lndhc20BYgYACmJsZW5kX3JlY3QBEWJsZW5kX3JlY3Rfc2NhbGVkAgxncmF5X3RvX3JnYmEDC2xjZF90b19yZ2JhBA9yZXNhbXBsZV9hZmZpbmUFFHJlc2FtcGxlX3BlcnNwZWN0aXZlBxIBAA9fX3N0YWNrX3BvaW50ZXIALQlwcm9kdWNlcnMBDHByb2Nlc3NlZC1ieQEMRGViaWFuIGNsYW5nBjE0LjAuNgAaD3RhcmdldF9mZWF0dXJlcwErB3NpbWQxMjg=";
@@ -10,10 +10,26 @@
 //   - cell area/cover stored as i32 with Int32Array wrap semantics,
 //   - `>> 9` applied to ToInt32(value) exactly like JS `x >> 9`.
 //
+// fill_glyph_dense is a second engine over the same line walker for small
+// glyphs: instead of per-row sorted cell lists it accumulates area/cover into
+// dense per-pixel i32 planes (no list walk, no pool overflow) and the sweep is
+// a running prefix sum of cover, four lanes at a time with SIMD128. Cover and
+// area only ever feed `(i32)cover - area`, so wrapping i32 sums give the same
+// low 32 bits as the list engine's i64 accumulation and the output matches.
+//
+// fill_glyph_spans runs the cell engine but sweeps into (y, x, len, coverage)
+// runs instead of a bitmap, merging horizontally adjacent runs of equal
+// coverage, so sparse shapes can be blended without a width*height buffer.
+//
 // Build: see build.sh. All pointer args are byte offsets into linear memory.
+// The file also compiles as host C (without SIMD) for native profiling; see
+// ../kernel-host.h and tools/raster-bench.
 
+#ifdef __wasm_simd128__
 #include <wasm_simd128.h>
+#endif
 #include <stdint.h>
+#include "../kernel-host.h"
 
 typedef int32_t  i32;
 typedef int64_t  i64;
@@ -37,9 +53,14 @@ static i32  g_width, g_height;
 static i32  g_nullIndex;
 static i32  g_freeIndex;
 
-// current-cell tracking (mirrors CellBuffer)
+// current-cell tracking (mirrors CellBuffer); in dense mode g_curIdx is the
+// pixel index into the area/cover planes
 static i32 g_curX, g_curY, g_curIdx;
 
+// dense mode planes (width*height i32 each), null when using the cell lists
+static i32 *g_denseArea;
+static i32 *g_denseCover;
+
 // bounds of active cells (for sweep tightening; matches JS output regardless)
 static i32 g_minY, g_maxY;
 
@@ -55,12 +76,19 @@ static int setCurrentCellPixel(i32 px, i32 py) {
 
   // clip: [0,width) x [0,height)
   if (py < 0 || py >= g_height || px < 0 || px >= g_width) {
-    g_curIdx = g_nullIndex;
+    g_curIdx = g_denseArea ? -1 : g_nullIndex;
     g_curX = px; g_curY = py;
     return 1;
   }
   g_curX = px; g_curY = py;
 
+  if (g_denseArea) {
+    g_curIdx = py * g_width + px;
+    if (py < g_minY) g_minY = py;
+    if (py > g_maxY) g_maxY = py;
+    return 1;
+  }
+
   i32 rowIndex = py; // bandMinY = 0
   i32 *cells = g_cells;
   i32 nullIndex = g_nullIndex;
@@ -94,6 +122,14 @@ static int setCurrentCellPixel(i32 px, i32 py) {
 }
 
 static inline void addArea(i32 area, i32 cover) {
+  if (g_denseArea) {
+    if (g_curIdx >= 0) {
+      i32 i = g_curIdx;
+      g_denseArea[i] = (i32)((uint32_t)g_denseArea[i] + (uint32_t)area);
+      g_denseCover[i] = (i32)((uint32_t)g_denseCover[i] + (uint32_t)cover);
+    }
+    return;
+  }
   if (g_curIdx >= 0) {
     i32 b = g_curIdx * 4;
     g_cells[b + OFF_AREA]  = (i32)((i64)g_cells[b + OFF_AREA] + area);
@@ -260,8 +296,10 @@ static inline i32 applyFillRule(i32 value, i32 fillRule) {
 // Fill a contiguous gray span [start,end) in row with value gray (SIMD memset).
 static inline void fillSpan(u8 *out, i32 start, i32 end, u8 gray) {
   i32 x = start;
+#ifdef __wasm_simd128__
   v128_t g = wasm_i8x16_splat((int8_t)gray);
   for (; x + 16 <= end; x += 16) wasm_v128_store(out + x, g);
+#endif
   for (; x < end; x++) out[x] = gray;
 }
 
@@ -316,37 +354,125 @@ static void sweepGray(u8 *out, i32 fillRule) {
   }
 }
 
-// --- exported entry --------------------------------------------------------
-// cmdOff: i32[cmdCount*3] triples (op,x,y); op 0=move,1=line (subpixel coords)
-// cellsOff: i32[poolSize*4] arena; ycellsOff: i32[height]; outOff: u8[width*height]
-// returns 1 on success, 0 on pool overflow (caller falls back to scalar JS).
-__attribute__((export_name("fill_glyph")))
-int fill_glyph(i32 cmdOff, i32 cmdCount, i32 width, i32 height, i32 fillRule,
-               i32 cellsOff, i32 ycellsOff, i32 outOff, i32 poolSize) {
-  const i32 *cmd = (const i32 *)(uintptr_t)cmdOff;
-  g_cells = (i32 *)(uintptr_t)cellsOff;
-  g_ycells = (i32 *)(uintptr_t)ycellsOff;
-  u8 *out = (u8 *)(uintptr_t)outOff;
+// Sweep the dense planes -> gray bitmap. Per row, cover is prefix-summed left
+// to right and each pixel gets applyFillRule(((cover << 9) - area) >> 9),
+// which is what sweepGray produces both inside cells and across spans.
+static void sweepDense(u8 *out, i32 fillRule) {
+  i32 w = g_width;
+  if (g_maxY < g_minY) return;
+  i32 startRow = g_minY < 0 ? 0 : g_minY;
+  i32 endRow = g_maxY + 1;
+  if (endRow > g_height) endRow = g_height;
 
-  g_width = width;
-  g_height = height;
-  g_nullIndex = poolSize - 1;
-  g_freeIndex = 0;
-  g_minYclip = 0;
-  g_maxYclip = height;
-  g_minY = 0x7fffffff;
-  g_maxY = -0x7fffffff;
-  g_curX = 0; g_curY = 0; g_curIdx = -1;
+  for (i32 y = startRow; y < endRow; y++) {
+    const i32 *area = g_denseArea + y * w;
+    const i32 *cov = g_denseCover + y * w;
+    u8 *row = out + y * w;
+    uint32_t cover = 0;
+    i32 x = 0;
+#ifdef __wasm_simd128__
+    v128_t carry = wasm_i32x4_splat(0);
+    const v128_t zero = wasm_i32x4_splat(0);
+    const v128_t max = wasm_i32x4_splat(255);
+    const v128_t mask = wasm_i32x4_splat(511);
+    const v128_t full = wasm_i32x4_splat(512);
+    for (; x + 16 <= w; x += 16) {
+      v128_t gray[4];
+      for (int k = 0; k < 4; k++) {
+        v128_t c = wasm_v128_load(cov + x + k * 4);
+        // in-register inclusive scan: add lanes shifted by 1, then by 2
+        c = wasm_i32x4_add(c, wasm_i32x4_shuffle(zero, c, 3, 4, 5, 6));
+        c = wasm_i32x4_add(c, wasm_i32x4_shuffle(zero, c, 2, 3, 4, 5));
+        c = wasm_i32x4_add(c, carry);
+        carry = wasm_i32x4_shuffle(c, c, 3, 3, 3, 3);
+        v128_t v = wasm_i32x4_sub(wasm_i32x4_shl(c, PIXEL_BITS + 1),
+                                  wasm_v128_load(area + x + k * 4));
+        v = wasm_i32x4_abs(wasm_i32x4_shr(v, PIXEL_BITS + 1));
+        if (fillRule == 1) {
+          v = wasm_v128_and(v, mask);
+          v = wasm_i32x4_min(v, wasm_i32x4_sub(full, v));
+        }
+        gray[k] = wasm_i32x4_min(v, max);
+      }
+      v128_t lo = wasm_u16x8_narrow_i32x4(gray[0], gray[1]);
+      v128_t hi = wasm_u16x8_narrow_i32x4(gray[2], gray[3]);
+      wasm_v128_store(row + x, wasm_u8x16_narrow_i16x8(lo, hi));
+    }
+    cover = (uint32_t)wasm_i32x4_extract_lane(carry, 0);
+#endif
+    for (; x < w; x++) {
+      cover += (uint32_t)cov[x];
+      i32 v = (i32)((cover << (PIXEL_BITS + 1)) - (uint32_t)area[x]);
+      row[x] = (u8)applyFillRule(v >> (PIXEL_BITS + 1), fillRule);
+    }
+  }
+}
 
-  // init ycells to null sentinel
-  for (i32 i = 0; i < height; i++) g_ycells[i] = g_nullIndex;
-  // init null cell
-  i32 nb = g_nullIndex * 4;
-  g_cells[nb + OFF_X] = CELL_MAX_X;
-  g_cells[nb + OFF_AREA] = 0;
-  g_cells[nb + OFF_COVER] = 0;
-  g_cells[nb + OFF_NEXT] = -1;
+// span output (fill_glyph_spans): i32 quads y, x, len, coverage
+static i32 *g_spans;
+static i32 g_spanCount, g_spanCapacity;
+
+// Append a run, extending the previous one when it continues it. returns 0
+// when the span buffer is full.
+static inline int emitSpan(i32 y, i32 x, i32 len, i32 gray) {
+  if (g_spanCount > 0) {
+    i32 *last = g_spans + (g_spanCount - 1) * 4;
+    if (last[0] == y && last[1] + last[2] == x && last[3] == gray) {
+      last[2] += len;
+      return 1;
+    }
+  }
+  if (g_spanCount >= g_spanCapacity) return 0;
+  i32 *span = g_spans + g_spanCount++ * 4;
+  span[0] = y; span[1] = x; span[2] = len; span[3] = gray;
+  return 1;
+}
+
+// Sweep single band -> span runs. Same coverage as sweepGray, pixel for pixel.
+// returns 0 on span buffer overflow.
+static int sweepSpans(i32 fillRule) {
+  i32 *cells = g_cells;
+  i32 nullIndex = g_nullIndex;
+  i32 w = g_width;
+  if (g_maxY < g_minY) return 1;
+  i32 startRow = g_minY < 0 ? 0 : g_minY;
+  i32 endRow = g_maxY + 1;
+  if (endRow > g_height) endRow = g_height;
+
+  for (i32 y = startRow; y < endRow; y++) {
+    i32 cellIndex = g_ycells[y];
+    i64 cover = 0;
+    i32 x = 0;
+
+    while (cellIndex != nullIndex) {
+      i32 base = cellIndex * 4;
+      i32 cx = cells[base + OFF_X];
 
+      if (cx > x && cover != 0) {
+        i32 gray = applyFillRule((i32)cover >> (PIXEL_BITS + 1), fillRule);
+        i32 e = cx > w ? w : cx;
+        if (gray > 0 && e > x && !emitSpan(y, x, e - x, gray)) return 0;
+      }
+
+      cover += (i64)cells[base + OFF_COVER] * (ONE_PIXEL * 2);
+      i32 area = (i32)(cover - (i64)cells[base + OFF_AREA]);
+      i32 gray = applyFillRule(area >> (PIXEL_BITS + 1), fillRule);
+      if (gray > 0 && cx >= 0 && cx < w && !emitSpan(y, cx, 1, gray)) return 0;
+
+      x = cx + 1;
+      cellIndex = cells[base + OFF_NEXT];
+    }
+
+    if (x < w && cover != 0) {
+      i32 gray = applyFillRule((i32)cover >> (PIXEL_BITS + 1), fillRule);
+      if (gray > 0 && !emitSpan(y, x, w - x, gray)) return 0;
+    }
+  }
+  return 1;
+}
+
+// Feed the (op,x,y) command stream through renderLine. returns 0 on overflow.
+static int renderCommands(const i32 *cmd, i32 cmdCount) {
   i32 curX = 0, curY = 0;
   for (i32 c = 0; c < cmdCount; c++) {
     i32 op = cmd[c * 3 + 0];
@@ -360,7 +486,104 @@ int fill_glyph(i32 cmdOff, i32 cmdCount, i32 width, i32 height, i32 fillRule,
       curX = px; curY = py;
     }
   }
+  return 1;
+}
+
+static void resetState(i32 width, i32 height) {
+  g_width = width;
+  g_height = height;
+  g_minYclip = 0;
+  g_maxYclip = height;
+  g_minY = 0x7fffffff;
+  g_maxY = -0x7fffffff;
+  g_curX = 0; g_curY = 0; g_curIdx = -1;
+}
+
+static void resetCells(i32 height, i32 poolSize) {
+  g_nullIndex = poolSize - 1;
+  g_freeIndex = 0;
+  for (i32 i = 0; i < height; i++) g_ycells[i] = g_nullIndex;
+  i32 nb = g_nullIndex * 4;
+  g_cells[nb + OFF_X] = CELL_MAX_X;
+  g_cells[nb + OFF_AREA] = 0;
+  g_cells[nb + OFF_COVER] = 0;
+  g_cells[nb + OFF_NEXT] = -1;
+}
+
+// --- exported entry --------------------------------------------------------
+// cmdOff: i32[cmdCount*3] triples (op,x,y); op 0=move,1=line (subpixel coords)
+// cellsOff: i32[poolSize*4] arena; ycellsOff: i32[height]; outOff: u8[width*height]
+// returns 1 on success, 0 on pool overflow (caller falls back to scalar JS).
+KERNEL_EXPORT("fill_glyph")
+int fill_glyph(i32 cmdOff, i32 cmdCount, i32 width, i32 height, i32 fillRule,
+               i32 cellsOff, i32 ycellsOff, i32 outOff, i32 poolSize) {
+  const i32 *cmd = KERNEL_PTR(const i32, cmdOff);
+  g_cells = KERNEL_PTR(i32, cellsOff);
+  g_ycells = KERNEL_PTR(i32, ycellsOff);
+  u8 *out = KERNEL_PTR(u8, outOff);
+
+  g_denseArea = 0;
+  g_denseCover = 0;
+  resetState(width, height);
+  resetCells(height, poolSize);
 
+  if (!renderCommands(cmd, cmdCount)) return 0;
   sweepGray(out, fillRule);
   return 1;
 }
+
+// Like fill_glyph, but writes up to spanCapacity (y, x, len, coverage) i32
+// quads at spansOff instead of a bitmap, in row-major order. returns the span
+// count, -1 on pool overflow, or -2 when spanCapacity is too small.
+KERNEL_EXPORT("fill_glyph_spans")
+int fill_glyph_spans(i32 cmdOff, i32 cmdCount, i32 width, i32 height,
+                     i32 fillRule, i32 cellsOff, i32 ycellsOff, i32 spansOff,
+                     i32 spanCapacity, i32 poolSize) {
+  const i32 *cmd = KERNEL_PTR(const i32, cmdOff);
+  g_cells = KERNEL_PTR(i32, cellsOff);
+  g_ycells = KERNEL_PTR(i32, ycellsOff);
+  g_spans = KERNEL_PTR(i32, spansOff);
+  g_spanCount = 0;
+  g_spanCapacity = spanCapacity;
+
+  g_denseArea = 0;
+  g_denseCover = 0;
+  resetState(width, height);
+  resetCells(height, poolSize);
+
+  if (!renderCommands(cmd, cmdCount)) return -1;
+  if (!sweepSpans(fillRule)) return -2;
+  return g_spanCount;
+}
+
+// Same contract as fill_glyph, but with dense planes instead of the cell pool.
+// areaOff/coverOff: i32[width*height] each, zeroed here. Always returns 1.
+KERNEL_EXPORT("fill_glyph_dense")
+int fill_glyph_dense(i32 cmdOff, i32 cmdCount, i32 width, i32 height,
+                     i32 fillRule, i32 areaOff, i32 coverOff, i32 outOff) {
+  const i32 *cmd = KERNEL_PTR(const i32, cmdOff);
+  u8 *out = KERNEL_PTR(u8, outOff);
+  g_denseArea = KERNEL_PTR(i32, areaOff);
+  g_denseCover = KERNEL_PTR(i32, coverOff);
+  resetState(width, height);
+
+  i32 n = width * height;
+  i32 i = 0;
+#ifdef __wasm_simd128__
+  v128_t zero = wasm_i32x4_splat(0);
+  for (; i + 4 <= n; i += 4) {
+    wasm_v128_store(g_denseArea + i, zero);
+    wasm_v128_store(g_denseCover + i, zero);
+  }
+#endif
+  for (; i < n; i++) {
+    g_denseArea[i] = 0;
+    g_denseCover[i] = 0;
+  }
+
+  renderCommands(cmd, cmdCount);
+  sweepDense(out, fillRule);
+  g_denseArea = 0;
+  g_denseCover = 0;
+  return 1;
+}
@@ -3,10 +3,11 @@
 //
 // The pure-TS GrayRaster in ../gray-raster.ts stays the default/baseline. This
 // module is used ONLY when: WebAssembly is present, the module compiles, and the
-// compiled kernel is proven byte-identical to the JS scalar sweep over a
-// self-verification corpus at init. Any failure leaves the JS path in place.
-// The .wasm is base64-embedded (no runtime fetch, CSP-safe) and instantiated
-// per module/worker.
+// compiled kernel reproduces a golden hash of the JS scalar sweep over a small
+// corpus at init (the full differential corpus is opt-in, see verifyFillWasm).
+// Any failure leaves the JS path in place. The .wasm is base64-embedded (no
+// runtime fetch, CSP-safe) and instantiated per module/worker; a compiled
+// module can be shared with workers via getFillWasmModule.
 //
 // Kernel: freestanding wasm32 + SIMD128 (see fill.c / build.sh). It reproduces
 // GrayRaster.renderLine + renderScanline + CellBuffer find/create/accumulate +
@@ -14,14 +15,30 @@
 // storage with Int32Array wrap, `>> 9` on ToInt32 values, FreeType coverage +
 // fill-rule math). The bezier subdivision (subdivConic/subdivCubic) stays in JS
 // and is unchanged; only the post-flatten polyline is shipped to wasm.
+//
+// Glyphs up to DENSE_MAX_PIXELS go through fill_glyph_dense instead, which
+// accumulates into dense per-pixel area/cover planes and prefix-sums them in
+// the sweep. Same output, no cell-list walk, and no pool overflow fallback.
+// fill_glyph_spans sweeps the cell lists into (y, x, len, coverage) runs
+// instead of a bitmap (fillGlyphSpansWasm).
 
+import { incrementCounter, instrumenting } from "../../instrument.ts";
 import { GrayRaster } from "../gray-raster.ts";
 import { createBitmap, FillRule, PixelMode } from "../types.ts";
+import { decodeBase64 } from "../wasm-base64.ts";
 import { FILL_WASM_BASE64 } from "./wasm-bytes.ts";
 
 /** Cell pool size (must match cell.ts DEFAULT_POOL_SIZE). */
 const POOL_SIZE = 16384;
 
+/**
+ * Largest bitmap (width*height) routed to the dense engine. Its cost scales
+ * with pixel count rather than cell count, so it wins at text sizes and loses
+ * to the cell lists on large glyphs; 128x128 is the crossover measured with
+ * tools/raster-bench.
+ */
+const DENSE_MAX_PIXELS = 128 * 128;
+
 type Status = "uninit" | "ready" | "disabled";
 
 let status: Status = "uninit";
@@ -31,6 +48,10 @@ let forceDisabled = false; // test/perf override
 let memory: WebAssembly.Memory | null = null;
 let heapBase = 0;
 let fillFn: ((...a: number[]) => number) | null = null;
+let denseFn: ((...a: number[]) => number) | null = null;
+let spansFn: ((...a: number[]) => number) | null = null;
+let compiledModule: WebAssembly.Module | null = null;
+let denseMaxPixels = DENSE_MAX_PIXELS;
 let u8view: Uint8Array | null = null;
 let i32view: Int32Array | null = null;
 
@@ -50,16 +71,17 @@ export function fillWasmStatus(): {
 	status: Status;
 	enabled: boolean;
 	forceDisabled: boolean;
+	dense: boolean;
 } {
-	return { status, enabled, forceDisabled };
+	return { status, enabled, forceDisabled, dense: denseFn !== null };
 }
 
-function b64ToBytes(b64: string): Uint8Array {
-	const bin = atob(b64);
-	const n = bin.length;
-	const out = new Uint8Array(n);
-	for (let i = 0; i < n; i++) out[i] = bin.charCodeAt(i);
-	return out;
+/**
+ * Override the dense engine cutoff (test/perf); 0 always uses the cell lists,
+ * Infinity always uses the dense planes. Pass no argument to restore.
+ */
+export function setFillWasmDenseMaxPixels(pixels = DENSE_MAX_PIXELS): void {
+	denseMaxPixels = pixels;
 }
 
 function refreshViews(): void {
@@ -94,6 +116,9 @@ function setupInstance(inst: WebAssembly.Instance): boolean {
 	if (!mem || !fn || !hb) return false;
 	memory = mem;
 	fillFn = fn;
+	// Optional: builds from before the dense engine only export fill_glyph
+	denseFn = (ex.fill_glyph_dense as typeof denseFn | undefined) ?? null;
+	spansFn = (ex.fill_glyph_spans as typeof spansFn | undefined) ?? null;
 	heapBase = align16(Number(hb.value));
 	refreshViews();
 	return true;
@@ -112,8 +137,14 @@ export function fillGlyphGrayWasm(
 	fillRule: number,
 	outBuffer: Uint8Array,
 ): boolean {
-	if (!enabled || forceDisabled || !fillFn || !memory) return false;
+	if (!enabled || forceDisabled || !fillFn || !memory) {
+		if (instrumenting) incrementCounter("wasm.fill.fallback.disabled");
+		return false;
+	}
 	if (width <= 0 || height <= 0) return false;
+	if (denseFn && width * height <= denseMaxPixels) {
+		return fillDense(cmd, cmdCount, width, height, fillRule, outBuffer);
+	}
 
 	let p = heapBase;
 	const cmdOff = p;
@@ -126,8 +157,7 @@ export function fillGlyphGrayWasm(
 	p = align16(p + width * height);
 
 	const workBytes = p - heapBase;
-	if (workBytes > MAX_FILL_WASM_WORK_BYTES) return false;
-	if (!ensureCapacity(workBytes)) return false;
+	if (!reserveWork(workBytes)) return false;
 	const u8 = u8view!;
 	const i32 = i32view!;
 
@@ -145,29 +175,169 @@ export function fillGlyphGrayWasm(
 		outOff,
 		POOL_SIZE,
 	);
-	if (!ok) return false;
+	if (!ok) {
+		// Cell pool overflow
+		if (instrumenting) incrementCounter("wasm.fill.fallback.poolOverflow");
+		return false;
+	}
 
 	outBuffer.set(u8.subarray(outOff, outOff + width * height));
+	if (instrumenting) countFill(cmdCount, width * height);
+	return true;
+}
+
+/** Grow wasm memory for a fill, counting why a fill had to decline */
+function reserveWork(workBytes: number): boolean {
+	if (workBytes > MAX_FILL_WASM_WORK_BYTES) {
+		if (instrumenting) incrementCounter("wasm.fill.fallback.tooLarge");
+		return false;
+	}
+	if (!ensureCapacity(workBytes)) {
+		if (instrumenting) incrementCounter("wasm.fill.fallback.memory");
+		return false;
+	}
+	return true;
+}
+
+function countFill(cmdCount: number, pixels: number): void {
+	incrementCounter("wasm.fill.calls");
+	incrementCounter("wasm.bytesIn", cmdCount * 3 * 4);
+	incrementCounter("wasm.bytesOut", pixels);
+}
+
+function fillDense(
+	cmd: Int32Array,
+	cmdCount: number,
+	width: number,
+	height: number,
+	fillRule: number,
+	outBuffer: Uint8Array,
+): boolean {
+	const pixels = width * height;
+	let p = heapBase;
+	const cmdOff = p;
+	p = align16(p + cmdCount * 3 * 4);
+	const areaOff = p;
+	p = align16(p + pixels * 4);
+	const coverOff = p;
+	p = align16(p + pixels * 4);
+	const outOff = p;
+	p = align16(p + pixels);
+
+	const workBytes = p - heapBase;
+	if (!reserveWork(workBytes)) return false;
+	const u8 = u8view!;
+
+	i32view!.set(cmd.subarray(0, cmdCount * 3), cmdOff >> 2);
+	u8.fill(0, outOff, outOff + pixels);
+	denseFn!(
+		cmdOff,
+		cmdCount,
+		width,
+		height,
+		fillRule,
+		areaOff,
+		coverOff,
+		outOff,
+	);
+	outBuffer.set(u8.subarray(outOff, outOff + pixels));
+	if (instrumenting) countFill(cmdCount, pixels);
 	return true;
 }
 
-// --- self-verification corpus ---------------------------------------------
+/**
+ * Span-output variant of fillGlyphGrayWasm. Returns (y, x, len, coverage)
+ * quads in row-major order, with horizontally adjacent runs of equal coverage
+ * merged; expanding them reproduces the gray bitmap exactly. Returns null
+ * (caller uses JS) when the kernel or its span export is unavailable, memory
+ * can't grow, or the cell pool overflows.
+ */
+export function fillGlyphSpansWasm(
+	cmd: Int32Array,
+	cmdCount: number,
+	width: number,
+	height: number,
+	fillRule: number,
+): Int32Array | null {
+	if (!enabled || forceDisabled || !spansFn || !memory) return null;
+	if (width <= 0 || height <= 0) return null;
+
+	let p = heapBase;
+	const cmdOff = p;
+	p = align16(p + cmdCount * 3 * 4);
+	const cellsOff = p;
+	p = align16(p + POOL_SIZE * 4 * 4);
+	const ycellsOff = p;
+	p = align16(p + height * 4);
+	const spansOff = p;
+
+	// Runs start at a cell, right after one, or at a row start, which bounds
+	// the count; most outlines need far fewer
+	let capacity = Math.min(
+		Math.max(64, height * 4 + cmdCount * 2),
+		POOL_SIZE * 2 + height,
+	);
+	for (;;) {
+		const workBytes = spansOff + capacity * 16 - heapBase;
+		if (workBytes > MAX_FILL_WASM_WORK_BYTES) return null;
+		if (!ensureCapacity(workBytes)) return null;
+		i32view!.set(cmd.subarray(0, cmdCount * 3), cmdOff >> 2);
+
+		const count = spansFn(
+			cmdOff,
+			cmdCount,
+			width,
+			height,
+			fillRule,
+			cellsOff,
+			ycellsOff,
+			spansOff,
+			capacity,
+			POOL_SIZE,
+		);
+		if (count === -1) return null;
+		if (count >= 0) {
+			const start = spansOff >> 2;
+			if (instrumenting) countFill(cmdCount, count * 16);
+			return i32view!.slice(start, start + count * 4);
+		}
+		capacity *= 2;
+	}
+}
+
+// --- self-verification ------------------------------------------------------
 // Random self-intersecting polylines exercise both fill rules, small + banded
-// heights, and out-of-clip coordinates. Ground truth is GrayRaster's scalar
-// replay + sweep; any byte mismatch disables the wasm path.
+// heights, and out-of-clip coordinates. Init only checks the first
+// GOLDEN_CASES against a precomputed FNV-1a hash of GrayRaster's scalar output
+// (cheap enough for the first rasterize call); verifyFillWasm/-Async replay
+// the full corpus against the scalar sweep. Any mismatch disables the kernel.
 
-function selfVerify(): boolean {
-	const raster = new GrayRaster();
+/** Cases hashed at init (a prefix of the full corpus) */
+const GOLDEN_CASES = 24;
+/** FNV-1a of the scalar sweep over those cases, back to back */
+const GOLDEN_HASH = 0x0113403e;
+/** Cases replayed by the full differential verification */
+const FULL_CASES = 600;
+
+interface VerifyCase {
+	cmd: Int32Array;
+	count: number;
+	width: number;
+	height: number;
+	fillRule: FillRule;
+}
+
+/** Deterministic case stream; every call starts the same corpus over */
+function verifyCases(): () => VerifyCase {
 	let seed = 0x1234_5678 >>> 0;
 	const rnd = () => {
 		seed = (seed * 1103515245 + 12345) & 0x7fffffff;
 		return seed / 0x7fffffff;
 	};
-
-	for (let t = 0; t < 600; t++) {
+	return () => {
 		const width = 1 + Math.floor(rnd() * 160);
 		const height = 1 + Math.floor(rnd() * 320);
-		const fr = rnd() < 0.5 ? FillRule.NonZero : FillRule.EvenOdd;
+		const fillRule = rnd() < 0.5 ? FillRule.NonZero : FillRule.EvenOdd;
 		const nPts = 3 + Math.floor(rnd() * 20);
 		const cmd: number[] = [];
 		const sx = Math.floor(rnd() * width * 256);
@@ -183,82 +353,201 @@ function selfVerify(): boolean {
 		}
 		cmd.push(1, sx, sy);
 		const cmdA = new Int32Array(cmd);
-		const count = cmdA.length / 3;
-
-		// wasm output
-		const ws = new Uint8Array(width * height);
-		let ok: boolean;
-		try {
-			ok = fillGlyphGrayWasm(cmdA, count, width, height, fr, ws);
-		} catch {
-			return false;
+		return { cmd: cmdA, count: cmdA.length / 3, width, height, fillRule };
+	};
+}
+
+function fnv1a(hash: number, bytes: Uint8Array): number {
+	for (let i = 0; i < bytes.length; i++) {
+		hash = Math.imul(hash ^ bytes[i]!, 0x01000193) >>> 0;
+	}
+	return hash;
+}
+
+/**
+ * Run `c` through every engine the module exports (cell lists, dense planes,
+ * span runs). Returns the common output, or null when an engine declines,
+ * throws, or disagrees with another.
+ */
+function kernelOutput(c: VerifyCase): Uint8Array | null {
+	const { cmd, count, width, height, fillRule } = c;
+	const out = new Uint8Array(width * height);
+	const other = new Uint8Array(width * height);
+	const previousMax = denseMaxPixels;
+	try {
+		denseMaxPixels = 0;
+		if (!fillGlyphGrayWasm(cmd, count, width, height, fillRule, out)) {
+			return null;
 		}
-		if (!ok) continue; // overflow / memory: not a correctness failure
-
-		// scalar ground truth
-		const bmp = createBitmap(width, height, PixelMode.Gray);
-		raster.setClip(0, 0, width, height);
-		raster.setBandBounds(0, height);
-		raster.reset();
-		for (let c = 0; c < count; c++) {
-			const op = cmdA[c * 3]!;
-			const x = cmdA[c * 3 + 1]!;
-			const y = cmdA[c * 3 + 2]!;
-			if (op === 0) raster.moveTo(x, y);
-			else raster.lineTo(x, y);
+		if (denseFn) {
+			denseMaxPixels = Infinity;
+			if (!fillGlyphGrayWasm(cmd, count, width, height, fillRule, other)) {
+				return null;
+			}
+			if (!sameBytes(out, other)) return null;
 		}
-		raster.sweep(bmp, fr);
+		if (spansFn) {
+			const spans = fillGlyphSpansWasm(cmd, count, width, height, fillRule);
+			if (!spans) return null;
+			other.fill(0);
+			for (let i = 0; i < spans.length; i += 4) {
+				const start = spans[i]! * width + spans[i + 1]!;
+				other.fill(spans[i + 3]!, start, start + spans[i + 2]!);
+			}
+			if (!sameBytes(out, other)) return null;
+		}
+		return out;
+	} catch {
+		return null;
+	} finally {
+		denseMaxPixels = previousMax;
+	}
+}
 
-		const js = bmp.buffer;
-		if (js.length !== ws.length) return false;
-		for (let i = 0; i < js.length; i++) if (js[i] !== ws[i]) return false;
+function sameBytes(a: Uint8Array, b: Uint8Array): boolean {
+	if (a.length !== b.length) return false;
+	for (let i = 0; i < a.length; i++) if (a[i] !== b[i]) return false;
+	return true;
+}
+
+function scalarOutput(raster: GrayRaster, c: VerifyCase): Uint8Array {
+	const bmp = createBitmap(c.width, c.height, PixelMode.Gray);
+	raster.setClip(0, 0, c.width, c.height);
+	raster.setBandBounds(0, c.height);
+	raster.reset();
+	for (let i = 0; i < c.count; i++) {
+		const x = c.cmd[i * 3 + 1]!;
+		const y = c.cmd[i * 3 + 2]!;
+		if (c.cmd[i * 3] === 0) raster.moveTo(x, y);
+		else raster.lineTo(x, y);
+	}
+	raster.sweep(bmp, c.fillRule);
+	return bmp.buffer;
+}
+
+function goldenVerify(): boolean {
+	const next = verifyCases();
+	let hash = 0x811c9dc5;
+	for (let t = 0; t < GOLDEN_CASES; t++) {
+		const out = kernelOutput(next());
+		if (!out) return false;
+		hash = fnv1a(hash, out);
+	}
+	return hash === GOLDEN_HASH;
+}
+
+/** Check the next `count` cases against the scalar sweep */
+function fullVerifyRange(
+	next: () => VerifyCase,
+	raster: GrayRaster,
+	count: number,
+): boolean {
+	for (let t = 0; t < count; t++) {
+		const c = next();
+		const out = kernelOutput(c);
+		if (!out || !sameBytes(out, scalarOutput(raster, c))) return false;
 	}
 	return true;
 }
 
+function disable(): void {
+	enabled = false;
+	fillFn = null;
+	denseFn = null;
+	spansFn = null;
+	memory = null;
+	status = "disabled";
+}
+
+/** Run `verify` with the kernel provisionally enabled */
+function withKernelEnabled(verify: () => boolean): boolean {
+	// Ignore the external force-disable switch during verification; otherwise
+	// disabling before first init could mark an unverified module as ready.
+	const previousForceDisabled = forceDisabled;
+	const previousEnabled = enabled;
+	enabled = true;
+	forceDisabled = false;
+	try {
+		return verify();
+	} finally {
+		forceDisabled = previousForceDisabled;
+		enabled = previousEnabled;
+	}
+}
+
+/**
+ * Replay the full differential corpus against the scalar GrayRaster. Opt-in:
+ * init only runs the golden-hash check. Disables the kernel on a mismatch and
+ * returns whether it is still ready.
+ */
+export function verifyFillWasm(): boolean {
+	ensureFillWasmReady();
+	if (status !== "ready") return false;
+	const raster = new GrayRaster();
+	const next = verifyCases();
+	if (!withKernelEnabled(() => fullVerifyRange(next, raster, FULL_CASES))) {
+		disable();
+	}
+	return status === "ready";
+}
+
 /**
- * Idempotent: compiles + self-verifies once. The module is < 4KB so the
+ * verifyFillWasm in chunks that yield to the event loop between them, for
+ * warming up in the background after the first glyphs have been served.
+ */
+export async function verifyFillWasmAsync(chunk = 50): Promise<boolean> {
+	ensureFillWasmReady();
+	const raster = new GrayRaster();
+	const next = verifyCases();
+	for (let done = 0; done < FULL_CASES; done += chunk) {
+		if (status !== "ready") return false;
+		const count = Math.min(chunk, FULL_CASES - done);
+		if (!withKernelEnabled(() => fullVerifyRange(next, raster, count))) {
+			disable();
+			return false;
+		}
+		await new Promise((resolve) => setTimeout(resolve, 0));
+	}
+	return status === "ready";
+}
+
+/**
+ * The compiled module once the kernel is ready, for sharing with workers:
+ * post it and pass it to ensureFillWasmReady there to skip decoding and
+ * compiling. Null until ready.
+ */
+export function getFillWasmModule(): WebAssembly.Module | null {
+	return status === "ready" ? compiledModule : null;
+}
+
+/**
+ * Idempotent: compiles + golden-hash verifies once. The module is < 4KB so the
  * synchronous compile succeeds on the browser main thread too (no async path
- * needed, unlike the larger blur kernel).
+ * needed, unlike the larger blur kernel). Pass a module from
+ * getFillWasmModule() (e.g. posted to a worker) to skip decode + compile.
  */
-export function ensureFillWasmReady(): void {
+export function ensureFillWasmReady(module?: WebAssembly.Module): void {
 	if (status !== "uninit") return;
 	if (typeof WebAssembly === "undefined") {
 		status = "disabled";
 		return;
 	}
 	try {
-		const bytes = b64ToBytes(FILL_WASM_BASE64) as Uint8Array<ArrayBuffer>;
-		const mod = new WebAssembly.Module(bytes);
+		const mod =
+			module ?? new WebAssembly.Module(decodeBase64(FILL_WASM_BASE64));
 		const inst = new WebAssembly.Instance(mod, {});
 		if (!setupInstance(inst)) {
 			status = "disabled";
 			return;
 		}
-		// Enable provisionally so fillGlyphGrayWasm runs inside selfVerify.
-		// Ignore the external force-disable switch during verification; otherwise
-		// disabling before first init could mark an unverified module as ready.
-		const previousForceDisabled = forceDisabled;
-		enabled = true;
-		forceDisabled = false;
-		let verified = false;
-		try {
-			verified = selfVerify();
-		} finally {
-			forceDisabled = previousForceDisabled;
-		}
-		if (verified) {
+		if (withKernelEnabled(goldenVerify)) {
+			compiledModule = mod;
+			enabled = true;
 			status = "ready";
 		} else {
-			enabled = false;
-			fillFn = null;
-			memory = null;
-			status = "disabled";
+			disable();
 		}
 	} catch {
-		enabled = false;
-		fillFn = null;
-		memory = null;
-		status = "disabled";
+		disable();
 	}
 }
@@ -1,4 +1,4 @@
 // AUTO-GENERATED by build.sh from fill.c. Do not edit by hand.
 // Freestanding wasm32+SIMD fill scan-conversion kernel, base64-embedded.
 export const FILL_WASM_BASE64 =
-	"AGFzbQEAAAABHQNgCX9/f39/f39/fwF/YAJ/fwF/YAV/f39/fwF/AwQDAAECBAUBcAEBAQUFAQEQgEAGDwJ/AUGAgAQLfwBBsIAECwc3BAZtZW1vcnkCAA9fX3N0YWNrX3BvaW50ZXIDAApmaWxsX2dseXBoAAALX19oZWFwX2Jhc2UDAQrSFwPBDgUCfwF7C38FfgF/QQAhCUEAIAY2AoSAhIAAQQAgBTYCgICEgABBACACNgKIgISAAEEAIAM2AoyAhIAAQQBB/////wc2ApiAhIAAQQBBgYCAgHg2ApyAhIAAQQBBfzYCqICEgABBACAIQX9qIgo2ApCAhIAAQQBBADYClICEgABBAEEANgKggISAAEEAQQA2AqSAhIAAAkAgA0EBSA0AAkACQCADQQRJDQAgCv0RIQsgBiECIANB/P///wdxIgkhCANAIAIgC/0LAgAgAkEQaiECIAhBfGoiCA0ACyADIAlGDQELIAMgCWshCCAGIAlBAnRqIQIDQCACIAo2AgAgAkEEaiECIAhBf2oiCA0ACwtBACgCkICEgAAhCgsgBSAKQQR0av0M////fwAAAAAAAAAA//////0LAgACQAJAIAFBAUgNAEEAIQlBACEKQQAhDANAIAwhDSAJIQ4gACAKQQxsaiICKAIIIgxBCHUhCCACKAIEIQkCQAJAIAIoAgANACAJQQh1IAgQgYCAgAANAUEADwsgCCANQQh1IgJxQQBIDQAgAiADSCAIIANIckUNACAMQf8BcSEPIA1B/wFxIRACQAJAIAIgCEcNACACIA4gECAJIA8QgoCAgAAhAgwBCyAMIA1rIQ0CQCAJIA5HDQBBACERIA5BCHUiEiACEIGAgIAARQ0FQQFBfyANQQBKIhMbIQ1BgAJBACATGyEUIA5BAXRB/gNxIRUCQEEAKAKogISAACIOQQBIDQAgBSAOQQR0aiIOIA4oAgQgFCAQayIQIBVsajYCBCAOIA4oAgggEGo2AggLIBIgDSACahCBgICAAEUNBSAIIA1rIQ4gDUEBdCEQIBRBAXRBgH5qIhYgFWwhD0EAKAKAgISAACETAkADQEEAKAKogISAACEIIA4gAkYNAQJAIAhBAEgNACATIAhBBHRqIgggCCgCBCAPajYCBCAIIAgoAgggFmo2AggLIBAgAmohCCACIA1qIQIgEiAIEIGAgIAADQAMBwsLIAhBAEgNAiATIAhBBHRqIgIgAigCBCAUIAxBgH5yaiIIIBVsajYCBCACIAIoAgggCGo2AggMAgtBACERIAIgDiAQIA4gCSAOa6wiF0GAAiAQayAQIA1BAEoiEhutfiIYIBggDSANQR91IhNzIBNrrSIZfyIYIBl+fSIaQj+HIhsgGHynaiINQYACQQAgEhsiExCCgICAAEUNBCANQQh1QQFBfyASGyIWIAJqIg4QgYCAgABFDQQCQAJAIA4gCEcNAEGAAiATayEUDAELIBsgGYMgGnwhGCAXQgiGIhcgFyAZfyIaIBl+fSIXQj+HIhsgGYMgF3whFyAbIBp8IRogFiAIayEVIBZBAXQhHEGAAiATayEUA0AgFSACakUNASAWIAJqIhIgDSAUIA0gGiAXIBh8IhggGVkiEK18p2oiDiATEIKAgIAARQ0GIBggGUIAIBAbfSEYIBwgAmohECASIQIgDiENIA5BCHUgEBCBgICAAA0ADAYLCyAIIA0gFCAJIA8QgoCAgAAhAgsgAg0AQQAPCyAKQQFqIgogAUcNAAsLQQEhEUEAKAKcgISAACICQQAoApiAhIAAIhBIDQAgECACQQFqQQAoAoyAhIAAIhMgAiATSBsiAE4NAEEAKAKQgISAACESIAcgEEEAKAKIgISAACIDbGohDSAEQQFGIQ4DQAJAIAYgEEECdGooAgAiCCASRg0AIBAgE04NACAHIBAgA2xqIQFBACECQgAhGQNAIAUgCEEEdGoiCSgCACEKAkAgGVANACAKIAJMDQBBgAQgGadBCXUiCCAIQR91IghzIAhrIgxB/wNxIghrIAggCEGAAksbIAwgDhsiEUUNACAKIAMgCiADSBsiDCACQQAgAkEAShsiCEwNACARQf8BIBFB/wFJGyERAkAgCEEQaiAMSw0AIBH9DyELA0AgDSAIIgJqIAv9CwAAIAJBEGohCCACQSBqIAxMDQALCyAMIAhNDQAgDCAIayICRQ0AIAEgCGogESAC/AsACyAJQQhqNAIAQgmGIBl8IhmnIQwCQCAKQQBIDQBBgAQgDCAJQQRqKAIAa0EJdSICIAJBH3UiAnMgAmsiCEH/A3EiAmsgAiACQYACSxsgCCAOGyICRQ0AIAogA04NACABIApqIAJB/wEgAkH/AUkbOgAACyAKQQFqIQIgCUEMaigCACIIIBJHDQALIAIgA04NACAZUA0AQYAEIAxBCXUiCCAIQR91IghzIAhrIglB/wNxIghrIAggCEGAAksbIAkgDhsiCEUNACAIQf8BIAhB/wFJGyEJAkAgCkERaiIIIANKDQAgCf0PIQsDQCANIAhqQXBqIAv9CwAAIAhBEGoiCCADTA0ACyAIQXBqIQILIAMgAkwNACADIAJrIghFDQAgASACaiAJIAj8CwALIA0gA2ohDUEBIREgEEEBaiIQIABHDQALCyARC+QDAQd/QQEhAgJAAkBBACgCqICEgABBAEgNAEEAKAKggISAACAARw0AQQAoAqSAhIAAIAFGDQELAkACQCABQQBIDQAgAEEASA0AIAFBACgCjICEgABODQAgAEEAKAKIgISAAEgNAQtBACAANgKggISAAEEAIAE2AqSAhIAAQQBBACgCkICEgAA2AqiAhIAAQQEPC0EAIAE2AqSAhIAAQQAgADYCoICEgABBACgCgICEgAAhA0F/IQRBACgCkICEgAAiBSEGAkBBACgChICEgAAgAUECdGoiBygCACICIAVGDQBBfyEEA0ACQCADIAIiBkEEdGoiCCgCACICIABHDQBBACAGNgKogISAAEEBDwsgAiAASg0BIAYhBCAIQQxqKAIAIgIgBUcNAAsgBiEEIAUhBgtBACECQQAoApSAhIAAIgggBU4NAEEAIAhBAWo2ApSAhIAAIAMgCEEEdGoiAiAANgIAIAJBBGpCADcCACACQQxqIAY2AgACQAJAIARBf0cNACAHIAg2AgAMAQsgAyAEQQR0akEMaiAINgIAC0EAIAg2AqiAhIAAAkAgAUEAKAKYgISAAE4NAEEAIAE2ApiAhIAAC0EBIQIgAUEAKAKcgISAAEwNAEEAIAE2ApyAhIAACyACC6YFBAV/An4DfwN+IANBCHUhBQJAIAQgAkcNACAFIAAQgYCAgAAPCyADQf8BcSEGIAFB/wFxIQcCQAJAIAFBCHUiCCAFRw0AAkAgCCAAEIGAgIAADQBBAA8LQQEhCUEAKAKogISAACIIQQBIDQFBACgCgICEgAAgCEEEdGoiCCAIKAIEIAQgAmsiACAGIAdqbGo2AgQgCCAIKAIIIABqNgIIQQEPC0EAIQkgBCACa6wiCkGAAiAHayAHIAMgAWsiA0EASiIBG61+IgunIAMgA0EfdSIMcyAMayINbSEDIAggABCBgICAAEUNAEEBQX8gARshDEGAAkEAIAEbIQ4gAyALIAOsIA2tIg9+fSILQj+HIhCnaiEDQQAhCQJAQQAoAqiAhIAAIgFBAEgNAEEAKAKAgISAACABQQR0aiIBIAEoAgQgAyAOIAdybGo2AgQgASABKAIIIANqNgIICyAMIAhqIgcgABCBgICAAEUNACADIAJqIQECQCAHIAVGDQAgECAPgyALfCELIApCCIYiCiAKpyANbawiCiAPfn0iEEI/hyIRIA+DIBB8IRAgESAKfCERIAUgDGshBSAMQQF0IQdBACgCgICEgAAhDQNAIAUgCEYNASAPQgAgECALfCILIA9ZIgMbIQogESADrXynIQMCQEEAKAKogISAACICQQBIDQAgDSACQQR0aiICIAIoAgQgA0EIdGo2AgQgAiACKAIIIANqNgIICyALIAp9IQsgASADaiEBIAcgCGohA0EAIQkgCCAMaiEIIAMgABCBgICAAA0ADAILC0EBIQlBACgCqICEgAAiCEEASA0AQQAoAoCAhIAAIAhBBHRqIgggCCgCBCAEIAFrIgAgBkGAAnIgDmtsajYCBCAIIAgoAgggAGo2AggLIAkLAFkEbmFtZQAKCWZpbGwud2FzbQEyAwAKZmlsbF9nbHlwaAETc2V0Q3VycmVudENlbGxQaXhlbAIOcmVuZGVyU2NhbmxpbmUHEgEAD19fc3RhY2tfcG9pbnRlcgApCXByb2R1Y2VycwEMcHJvY2Vzc2VkLWJ5AQVjbGFuZwkyMy4wLjBnaXQAnQEPdGFyZ2V0X2ZlYXR1cmVzCSsLYnVsay1tZW1vcnkrD2J1bGstbWVtb3J5LW9wdCsWY2FsbC1pbmRpcmVjdC1vdmVybG9uZysKbXVsdGl2YWx1ZSsPbXV0YWJsZS1nbG9iYWxzKxNub250cmFwcGluZy1mcHRvaW50Kw9yZWZlcmVuY2UtdHlwZXMrCHNpZ24tZXh0KwdzaW1kMTI4";
+	"AGFzbQEAAAABNwVgCX9/f39/f39/fwF/YAJ/fwF/YAV/f39/fwF/YAp/f39/f39/f39/AX9gCH9/f39/f39/AX8DBwYAAQECAwQEBQFwAQEBBQUBARCAQAYPAn8BQdCIBAt/AEHQiAQLB0sFBm1lbW9yeQIACmZpbGxfZ2x5cGgAABBmaWxsX2dseXBoX3NwYW5zAAQQZmlsbF9nbHlwaF9kZW5zZQAFC19faGVhcF9iYXNlAwEKqT8G6gwFBH8Bewd/AX4Df0EAIQlBACAGNgKEiICAAEEAIAU2AoCIgIAAQQAgAjYCnIiAgABBACADNgKgiICAAEEAIAM2AqSIgIAAQQBB/////wc2AqiIgIAAQQBBgYCAgHg2AqyIgIAAQQBBfzYCuIiAgABBACAIQX9qIgo2AryIgIAAQQBBADYCiIiAgABBAEEANgKMiICAAEEAQQA2ArCIgIAAQQBBADYCtIiAgABBAEEANgLAiICAAAJAIANBAUgNAEEAIQsCQCADQQRJDQAgA0F8cSILQXxqIghBAnZBAWoiDEEHcSECIAr9ESENQQAhDgJAIAhBHEkNACAGQcAAaiEIIAxB+P///wdxIQxBACEOA0AgCCAN/QsCACAIQTBqIA39CwIAIAhBIGogDf0LAgAgCEEQaiAN/QsCACAIQXBqIA39CwIAIAhBYGogDf0LAgAgCEFQaiAN/QsCACAIQUBqIA39CwIAIAhBgAFqIQggDkEgaiEOIAxBeGoiDA0ACwsCQCACRQ0AIAYgDkECdGohCANAIAggDf0LAgAgCEEQaiEIIAJBf2oiAg0ACwsgCyADRg0BCyADIAtrIQIgBiALQQJ0aiEIA0AgCCAKNgIAIAhBBGohCCACQX9qIgINAAsLIAUgCkEEdGr9DP///38AAAAAAAAAAP/////9CwIAAkAgACABEIGAgIAARQ0AQQEhCUEAKAKsiICAACIIQQAoAqiIgIAAIg9IDQAgDyAIQQFqQQAoAqCIgIAAIhAgCCAQSBsiEU4NAEEAKAK8iICAACESQQAoAoCIgIAAIQwgByAPQQAoApyIgIAAIgtsaiEOQQAoAoSIgIAAIRMgBEEBRiEBA0ACQCATIA9BAnRqKAIAIgggEkYNACAPIBBODQAgDyALbCEUQQAhCkIAIRUDQCAIQQJ0IQUCQCAMIAhBBHRqKAIAIgkgCkwNACAVUA0AQYAEIBWnIghBCXUgCEEfdSIIaiAIcyICQf8DcSIIayAIIAhBgAJLGyACIAEbIghB/wEgCEH/AUkbIgNFDQAgCyAJIAkgC0obIgIgCkEAIApBAEobIghMDQAgA/0PIQ0CQCAIQRBqIAJKDQADQCAOIAhqIA39CwAAIAhBIGohCiAIQRBqIQggCiACTA0ACwsgAiAITA0AAkAgAiAIayIWQRBJDQAgFkFwcSIXQXBqIgpBBHZBAWoiBEEDcSEAQQAhBgJAIApBMEkNACAOIAhqIRggBEH8////AXEhBEEAIQYDQCAYIAZqIgogDf0LAAAgCkEwaiAN/QsAACAKQSBqIA39CwAAIApBEGogDf0LAAAgBkHAAGohBiAEQXxqIgQNAAsLAkAgAEUNACAOIAggBmpqIQoDQCAKIA39CwAAIApBEGohCiAAQX9qIgANAAsLIBYgF0YNASAIIBdqIQgLA0AgDiAIaiADOgAAIAIgCEEBaiIIRw0ACwsCQEGABCAMIAVBAnQiCEEIcmo0AgBCCYYgFXwiFaciAyAMIAhBBHJqKAIAayICQQl1IAJBH3UiAmogAnMiCkH/A3EiAmsgAiACQYACSxsgCiABGyICQf8BIAJB/wFJGyICRQ0AIAlBAEgNACAJIAtODQAgByAJIBRqaiACOgAACyAJQQFqIQogDCAIQQxyaigCACIIIBJHDQALIAogC04NACAVUA0AQYAEIANBCXUgA0EfdSIIaiAIcyICQf8DcSIIayAIIAhBgAJLGyACIAEbIghB/wEgCEH/AUkbIgJFDQAgAv0PIQ0CQCAJQRFqIgggC0oNAANAIA4gCGpBcGogDf0LAAAgCEEQaiIIIAtMDQALIAhBcGohCgsgCyAKTA0AAkAgCyAKayIAQRBJDQAgAEFwcSIEQXBqIghBBHZBAWoiBUEDcSEDQQAhCQJAIAhBMEkNACAOIApqIQYgBUH8////AXEhBUEAIQkDQCAGIAlqIgggDf0LAAAgCEEwaiAN/QsAACAIQSBqIA39CwAAIAhBEGogDf0LAAAgCUHAAGohCSAFQXxqIgUNAAsLAkAgA0UNACAOIAogCWpqIQgDQCAIIA39CwAAIAhBEGohCCADQX9qIgMNAAsLIAAgBEYNASAKIARqIQoLA0AgDiAKaiACOgAAIAsgCkEBaiIKRw0ACwsgDiALaiEOQQEhCSAPQQFqIg8gEUcNAAsLIAkLpgkDD38FfgF/AkACQCABQQFODQBBACECDAELQQEhAkEAIQNBACEEQQAhBQNAIAQhBiADIQcgACAFQQxsaiIIQQhqKAIAIQQgCEEEaigCACEDAkACQCAIKAIADQAgA0EIdSAEQQh1EIKAgIAADQEMAwsgBCAGcUEASA0AIAZBCHUiCEEAKAKkiICAACIJTiAEQQh1IgogCU5xDQAgBEH/AXEhCyAGQf8BcSEMAkAgCCAKRw0AIAggByAMIAMgCxCDgICAAA0BDAMLIAQgBmshBgJAIAMgB2siCQ0AIAdBCHUiDSAIEIKAgIAARQ0DQQFBfyAGQQBKIgYbIQkgBkEIdCIOIAxrIg8gB0EBdEH+A3EiC2whB0EAKAK4iICAACEGAkACQAJAQQAoAoiIgIAAIhBFDQAgBkEASA0CIBAgBkECdCIGaiIQIBAoAgAgB2o2AgBBACgCjIiAgAAgBmohBgwBCyAGQQBIDQFBACgCgIiAgAAgBkEEdGoiBkEEaiIQIBAoAgAgB2o2AgAgBkEIaiEGCyAGIAYoAgAgD2o2AgALIA0gCSAIahCCgICAAEUNAyAKIAlrIQogCUEBdCEPIA5BAXRBgH5qIgwgC2whEAJAA0AgCiAIIgZGDQFBACgCuIiAgAAhCAJAAkACQEEAKAKIiICAACIHRQ0AIAhBAEgNAiAHIAhBAnQiCGoiByAHKAIAIBBqNgIAQQAoAoyIgIAAIAhqIQgMAQsgCEEASA0BQQAoAoCIgIAAIAhBBHRqIghBBGoiByAHKAIAIBBqNgIAIAhBCGohCAsgCCAIKAIAIAxqNgIACyAGIAlqIQggDSAPIAZqEIKAgIAADQAMBQsLIA4gBEGAfnJqIgYgC2whB0EAKAK4iICAACEIAkACQEEAKAKIiICAACICRQ0AIAhBAEgNAyACIAhBAnQiCGoiAiACKAIAIAdqNgIAQQAoAoyIgIAAIAhqIQgMAQsgCEEASA0CQQAoAoCIgIAAIAhBBHRqIghBBGoiAiACKAIAIAdqNgIAIAhBCGohCAsgCCAIKAIAIAZqNgIADAELIAYgBkEfdSINaiANcyENAkACQCAGQQFIDQBBgAIhD0GAAiAMa60hESAJrCESQQEhEAwBCyAJrCERIAytIRJBACEPQX8hEAsgCCAHIAwgByARIBJ+IhIgEiANrSIRfyISIBF+fSITQj+HIhQgEnynaiIGIA8Qg4CAgABFDQIgBkEIdSAQIAhqIgcQgoCAgABFDQICQAJAIAcgCkcNAEGAAiAPayEMDAELIBQgEYMgE3whEiAJrEIIhiITIBMgEX8iFCARfn0iE0I/hyIVIBGDIBN8IRMgFSAUfCEUIBAgCmshDiAQQQF0IRZBgAIgD2shDANAIA4gCGpFDQEgECAIaiIJIAYgDCAGIBQgEyASfCISIBFZrXynaiIHIA8Qg4CAgABFDQQgEkIAIBEgEiARUxt9IRIgFiAIaiENIAkhCCAHIQYgB0EIdSANEIKAgIAADQAMBAsLIAogBiAMIAMgCxCDgICAAEEARg0CCyAFQQFqIgUgAUghAiAFIAFHDQALCyACQX9zQQFxC8MEAQd/QQEhAgJAAkBBACgCuIiAgABBAEgNAEEAKAKwiICAACAARw0AQQAoArSIgIAAIAFGDQELAkACQCABQQBIDQAgAEEASA0AQQAoAqCIgIAAIAFMDQBBACgCnIiAgAAiAyAASg0BC0EAIAA2ArCIgIAAQQAgATYCtIiAgABBAEF/QQAoAryIgIAAQQAoAoiIgIAAGzYCuIiAgABBAQ8LQQAgATYCtIiAgABBACAANgKwiICAAAJAQQAoAoiIgIAARQ0AQQAgAyABbCAAajYCuIiAgAACQEEAKAKoiICAACABTA0AQQAgATYCqIiAgAALQQAoAqyIgIAAIAFODQFBACABNgKsiICAAEEBDwtBACgCgIiAgAAhBEF/IQVBACgCvIiAgAAiBiEDAkBBACgChIiAgAAgAUECdGoiBygCACICIAZGDQBBfyEFA0ACQCAEIAIiA0EEdGooAgAiAiAARw0AQQAgAzYCuIiAgABBAQ8LIAIgAEoNASADIQUgBCADQQJ0QQJ0QQxyaigCACICIAZHDQALIAMhBSAGIQMLQQAhAkEAKALAiICAACIIIAZODQBBASECQQAgCEEBajYCwIiAgAAgBCAIQQR0aiIGIAA2AgAgBkEEakIANwIAIAZBDGogAzYCACAHIAQgBUEEdGpBDGogBUF/RhsgCDYCAEEAIAg2AriIgIAAAkBBACgCqIiAgAAgAUwNAEEAIAE2AqiIgIAAC0EAKAKsiICAACABTg0AQQAgATYCrIiAgAALIAIL6gcHBX8CfgF/An4BfwF+AX8gA0EIdSEFAkAgBCACRw0AIAUgABCCgICAAEEARw8LIANB/wFxIQYgAUH/AXEhBwJAAkACQCABQQh1IgggBUcNAAJAIAggABCCgICAAA0AQQAPCyAEIAJrIgMgBiAHamwhCEEAKAK4iICAACEAAkACQEEAKAKIiICAACICRQ0AIABBAEgNAyACIABBAnQiAGoiAiACKAIAIAhqNgIAQQAoAoyIgIAAIABqIQAMAQsgAEEASA0CQQAoAoCIgIAAIABBBHRqIgBBBGoiAiACKAIAIAhqNgIAIABBCGohAAsgACAAKAIAIANqNgIADAELQQAhCSAEIAJrrCIKQYACIAdrIAcgAyABayIDQQBKIgEbrX4iCyADIANBH3UiDGogDHOtIg1/IQ4gCCAAEIKAgIAARQ0BQQFBfyABGyEMIAFBCHQiDyAHciALIA4gDX59IgtCP4ciECAOfKciAWwhCUEAKAK4iICAACEDAkACQAJAQQAoAoiIgIAAIgdFDQAgA0EASA0CIAcgA0ECdCIDaiIHIAcoAgAgCWo2AgBBACgCjIiAgAAgA2ohAwwBCyADQQBIDQFBACgCgIiAgAAgA0EEdGoiA0EEaiIHIAcoAgAgCWo2AgAgA0EIaiEDCyADIAMoAgAgAWo2AgALAkAgDCAIaiIDIAAQgoCAgAANAEEADwsgASACaiEBAkAgAyAFRg0AIBAgDYMgC3whDiAKQgiGIgsgCyANfyILIA1+fSIKQj+HIhAgDYMgCnwhCiAQIAt8IRAgBSAMayEHIAxBAXQhEQNAIAcgCCIDRg0BQgAgDSAKIA58Ig4gDVMbIQsgECAOIA1ZrXynIgJBCHQhBUEAKAK4iICAACEIAkACQAJAQQAoAoiIgIAAIglFDQAgCEEASA0CIAkgCEECdCIIaiIJIAkoAgAgBWo2AgBBACgCjIiAgAAgCGohCAwBCyAIQQBIDQFBACgCgIiAgAAgCEEEdGoiCEEEaiIJIAkoAgAgBWo2AgAgCEEIaiEICyAIIAgoAgAgAmo2AgALIA4gC30hDiADIAxqIQggASACaiEBQQAhCSARIANqIAAQgoCAgAANAAwDCwsgBCABayIDIAZBgAJyIA9rbCEIQQAoAriIgIAAIQACQAJAQQAoAoiIgIAAIgJFDQAgAEEASA0CIAIgAEECdCIAaiICIAIoAgAgCGo2AgBBACgCjIiAgAAgAGohAAwBCyAAQQBIDQFBACgCgIiAgAAgAEEEdGoiAEEEaiICIAIoAgAgCGo2AgAgAEEIaiEACyAAIAAoAgAgA2o2AgALQQEhCQsgCQv3CwUDfwF7BH8BfgJ/QQAhCkEAIAY2AoSIgIAAQQAgBTYCgIiAgABBACAHNgKQiICAAEEAIAg2ApiIgIAAQQAgAjYCnIiAgABBACADNgKgiICAAEEAIAM2AqSIgIAAQQBB/////wc2AqiIgIAAQQBBgYCAgHg2AqyIgIAAQX8hC0EAQX82AriIgIAAQQAgCUF/aiIINgK8iICAAEEAQQA2ApSIgIAAQQBBADYCiIiAgABBAEEANgKMiICAAEEAQQA2ArCIgIAAQQBBADYCtIiAgABBAEEANgLAiICAAAJAIANBAUgNAAJAIANBBEkNACADQXxxIgpBfGoiCUECdkEBaiIMQQdxIQIgCP0RIQ1BACEHAkAgCUEcSQ0AIAZBwABqIQkgDEH4////B3EhDEEAIQcDQCAJIA39CwIAIAlBMGogDf0LAgAgCUEgaiAN/QsCACAJQRBqIA39CwIAIAlBcGogDf0LAgAgCUFgaiAN/QsCACAJQVBqIA39CwIAIAlBQGogDf0LAgAgCUGAAWohCSAHQSBqIQcgDEF4aiIMDQALCwJAIAJFDQAgBiAHQQJ0aiEJA0AgCSAN/QsCACAJQRBqIQkgAkF/aiICDQALCyAKIANGDQELIAMgCmshAiAGIApBAnRqIQkDQCAJIAg2AgAgCUEEaiEJIAJBf2oiAg0ACwsgBSAIQQR0av0M////fwAAAAAAAAAA//////0LAgACQCAAIAEQgYCAgABFDQACQEEAKAKsiICAACIJQQAoAqiIgIAAIgVODQBBACgClIiAgAAPC0EAKAKUiICAACELIAUgCUEBakEAKAKgiICAACICIAkgAkgbIg5ODQBBACgCnIiAgAAhBkEAKAK8iICAACEAQQAoAoCIgIAAIQJBACgCmIiAgAAhD0EAKAKQiICAACEKQQAoAoSIgIAAIRBBASERAkADQAJAIBAgBUECdGooAgAiByAARg0AQQAhDEIAIRIgCyEIA0ACQCACIAdBBHRqKAIAIgkgDEwNACASUA0AQYAEIBKnIgNBCXUgA0EfdSIDaiADcyIBQf8DcSIDayADIANBgAJLGyABIARBAUYbIgNB/wEgA0H/AUkbIgNFDQAgBiAJIAkgBkobIgEgDEwNACABIAxrIQECQCAIQQFIDQAgCEEEdCAKakFwaiITKAIAIAVHDQAgEygCCCIUIBMoAgRqIAxHDQAgEygCDCADRw0AIBMgFCABajYCCAwBCyAIIA9ODQRBACAIQQFqIgs2ApSIgIAAIAogCEEEdGoiCCADNgIMIAggATYCCCAIIAw2AgQgCCAFNgIAIAshCAsCQEGABCACIAdBAnRBAnQiA0EIcmo0AgBCCYYgEnwiEqciASACIANBBHJqKAIAayIHQQl1IAdBH3UiB2ogB3MiDEH/A3EiB2sgByAHQYACSxsgDCAEQQFGIhMbIgdB/wEgB0H/AUkbIgdFDQAgCUEASA0AIAkgBk4NAAJAIAhBAUgNACAIQQR0IApqQXBqIgwoAgAgBUcNACAMKAIIIhQgDCgCBGogCUcNACAMKAIMIAdHDQAgDCAUQQFqNgIIDAELIAggD04NBEEAIAhBAWoiCzYClIiAgAAgCiAIQQR0aiIIIAc2AgwgCEEBNgIIIAggCTYCBCAIIAU2AgAgCyEICyAJQQFqIQwgAiADQQxyaigCACIHIABHDQALIAYgDEwNACASUA0AQYAEIAFBCXUgAUEfdSIJaiAJcyIIQf8DcSIJayAJIAlBgAJLGyAIIBMbIglB/wEgCUH/AUkbIghFDQAgBiAMayEHAkAgC0EBSA0AIAtBBHQgCmpBcGoiCSgCACAFRw0AIAkoAggiAyAJKAIEaiAMRw0AIAkoAgwgCEcNACAJIAMgB2o2AggMAQsgCyAPTg0CQQAgC0EBaiIDNgKUiICAACAKIAtBBHRqIgkgCDYCDCAJIAc2AgggCSAMNgIEIAkgBTYCACADIQsLIAVBAWoiBSAOSCERIAUgDkcNAAsLQX4gCyARQQFxGyELCyALC+gQBAN/AXsIfwZ7QQAhCEEAIAY2AoyIgIAAQQAgBTYCiIiAgABBACACNgKciICAAEEAIAM2AqCIgIAAQQAgAzYCpIiAgABBAEH/////BzYCqIiAgABBAEGBgICAeDYCrIiAgABBAEF/NgK4iICAAEEAQQA2ArCIgIAAQQBBADYCtIiAgAACQCADIAJsIglBBEgNAEEAIQMgBiECIAUhCgNAIAr9DAAAAAAAAAAAAAAAAAAAAAAiC/0LAAAgAiAL/QsAACACQRBqIQIgCkEQaiEKIANBCGohDCADQQRqIgghAyAMIAlMDQALCwJAIAkgCEwNAAJAIAkgCGsiDUEESQ0AAkAgBSAIQQJ0IgNqIAYgCUECdCICak8NACAGIANqIAUgAmpJDQELIA1BfHEiDkF8aiIDQQJ2QQFqIgJBA3EhD0EAIRACQCADQQxJDQAgCEECdCERIAJB/P///wdxIRJBACEQIAUhCiAGIQwDQCAMIBFqIgP9DAAAAAAAAAAAAAAAAAAAAAAiC/0LAgAgCiARaiICIAv9CwIAIAJBEGogC/0LAgAgA0EQaiAL/QsCACACQSBqIAv9CwIAIANBIGogC/0LAgAgAkEwaiAL/QsCACADQTBqIAv9CwIAIApBwABqIQogDEHAAGohDCAQQRBqIRAgEkF8aiISDQALCwJAIA9FDQAgBSAIIBBqQQJ0IgJqIQMgBiACaiECA0AgAv0MAAAAAAAAAAAAAAAAAAAAACIL/QsCACADIAv9CwIAIANBEGohAyACQRBqIQIgD0F/aiIPDQALCyANIA5GDQEgCCAOaiEICyAJIAhBf3NqIQwCQCAJIAhrQQNxIgpFDQAgBSAIQQJ0IgJqIQMgBiACaiECA0AgA0EANgIAIAJBADYCACADQQRqIQMgAkEEaiECIAhBAWohCCAKQX9qIgoNAAsLIAxBA0kNACAIQQJ0IQogCSAIayEIA0AgBSAKaiIDQQA2AgAgBiAKaiICQQA2AgAgA0EEakEANgIAIAJBBGpBADYCACADQQhqQQA2AgAgAkEIakEANgIAIANBDGpBADYCACACQQxqQQA2AgAgBUEQaiEFIAZBEGohBiAIQXxqIggNAAsLIAAgARCBgICAABoCQEEAKAKsiICAACIDQQAoAqiIgIAAIhFIDQAgESADQQFqQQAoAqCIgIAAIgIgAyACSBsiDk4NAEEAKAKMiICAACEDQQAoAoiIgIAAIQICQEEAKAKciICAACIJQRBIDQAgCUFwaiETIAlBAnQhDSAHIBEgCWwiCmoiD0EQaiESIAIgCkECdCIKaiEAIAMgCmohASAEQQFGIQoDQEEAIQUgEiEGIAAhAyABIQL9DAAAAAAAAAAAAAAAAAAAAAAiCyEUA0AgDyAFIghqIAsgAv0AAAAiFf0NDA0ODxAREhMUFRYXGBkaGyAV/a4BIhUgFP2uASALIBX9DQgJCgsMDQ4PEBESExQVFhf9rgEiFkEJ/asBIAP9AAAA/bEBQQn9rAH9oAEiF/0M/wEAAP8BAAD/AQAA/wEAACIU/U4iGP0MAAIAAAACAAAAAgAAAAIAACIVIBj9sQH9twEgFyAKG/0M/wAAAP8AAAD/AAAA/wAAACIX/bYBIBYgC/0NDA0ODwwNDg8MDQ4PDA0ODyALIAJBEGr9AAAAIhb9DQwNDg8QERITFBUWFxgZGhsgFv2uASIW/a4BIAsgFv0NCAkKCwwNDg8QERITFBUWF/2uASIWQQn9qwEgA0EQav0AAAD9sQFBCf2sAf2gASIYIBT9TiIZIBUgGf2xAf23ASAYIAobIBf9tgH9hgEgCyALIAJBIGr9AAAAIhj9DQwNDg8QERITFBUWFxgZGhsgGP2uASIY/Q0ICQoLDA0ODxAREhMUFRYXIBj9rgEgFiAL/Q0MDQ4PDA0ODwwNDg8MDQ4P/a4BIhZBCf2rASADQSBq/QAAAP2xAUEJ/awB/aABIhggFP1OIhkgFSAZ/bEB/bcBIBggChsgF/22ASALIAsgAkEwav0AAAAiGP0NDA0ODxAREhMUFRYXGBkaGyAY/a4BIhj9DQgJCgsMDQ4PEBESExQVFhcgGP2uASAWIAv9DQwNDg8MDQ4PDA0ODwwNDg/9rgEiFkEJ/asBIANBMGr9AAAA/bEBQQn9rAH9oAEiGCAU/U4iFCAVIBT9sQH9twEgGCAKGyAX/bYB/YYB/Wb9CwAAIBYgC/0NDA0ODwwNDg8MDQ4PDA0ODyEUIAYiDEEQaiEGIANBwABqIQMgAkHAAGohAiAIQRBqIQUgCEEgaiAJTA0ACwJAIAUgCU4NACATIAhrIQYgFv0bAyEEQQAhCANAIAxBgAQgAiAIaigCACAEaiIEQQl0IAMgCGooAgBrIgVBCXUgBUEfdSIFaiAFcyIQQf8DcSIFayAFIAVBgAJLGyAQIAobIgVB/wEgBUH/AUkbOgAAIAhBBGohCCAMQQFqIQwgBkF/aiIGDQALCyASIAlqIRIgACANaiEAIAEgDWohASAPIAlqIQ8gEUEBaiIRIA5HDQAMAgsLIAlBAUgNACAJQQJ0IQAgByARIAlsIgpqIQ8gAyAKQQJ0IgpqIRAgAiAKaiESA0BBACEMIBAhAyASIQIgDyEKIAkhBQNAIApBgAQgAygCACAMaiIMQQl0IAIoAgBrIghBCXUgCEEfdSIIaiAIcyIGQf8DcSIIayAIIAhBgAJLGyAGIARBAUYbIghB/wEgCEH/AUkbOgAAIANBBGohAyACQQRqIQIgCkEBaiEKIAVBf2oiBQ0ACyAQIABqIRAgEiAAaiESIA8gCWohDyARQQFqIhEgDkcNAAsLQQBBADYCjIiAgABBAEEANgKIiICAAEEBCwCNAQRuYW1lAAoJZmlsbC53YXNtAWYGAApmaWxsX2dseXBoAQ5yZW5kZXJDb21tYW5kcwITc2V0Q3VycmVudENlbGxQaXhlbAMOcmVuZGVyU2NhbmxpbmUEEGZpbGxfZ2x5cGhfc3BhbnMFEGZpbGxfZ2x5cGhfZGVuc2UHEgEAD19fc3RhY2tfcG9pbnRlcgAtCXByb2R1Y2VycwEMcHJvY2Vzc2VkLWJ5AQxEZWJpYW4gY2xhbmcGMTQuMC42ABoPdGFyZ2V0X2ZlYXR1cmVzASsHc2ltZDEyOA==";
@@ -1,14 +1,22 @@
 /**
  * Gradient fill rendering for paths
+ *
+ * Paths are shaded during the coverage sweep: only covered spans are
+ * visited, and colors come from a 256-entry table sampled along the
+ * gradient, so no full-size gradient or coverage bitmap is built.
  */
 
 import type { GlyphPath } from "../render/path.ts";
+import { GrayRaster } from "./gray-raster.ts";
+import { decomposePath } from "./outline-decompose.ts";
 import { rasterizePath } from "./rasterize.ts";
 import {
 	type Bitmap,
 	createBitmap,
+	FillRule,
 	PixelMode,
 	type RasterizeOptions,
+	type Span,
 } from "./types.ts";
 
 /**
@@ -58,6 +66,14 @@ export interface RadialGradient {
  */
 export type Gradient = LinearGradient | RadialGradient;
 
+/**
+ * Options for rasterizePathWithGradient
+ */
+export interface GradientRasterizeOptions extends RasterizeOptions {
+	/** Write premultiplied RGBA instead of straight alpha (default: false) */
+	premultiplied?: boolean;
+}
+
 /**
  * Interpolate color between two stops
  */
@@ -118,8 +134,20 @@ export function interpolateGradient(
 
 	t = Math.max(0, Math.min(1, t));
 
-	const sortedStops = [...gradient.stops].sort((a, b) => a.offset - b.offset);
+	return sampleStops(sortStops(gradient.stops), t);
+}
+
+function sortStops(stops: ColorStop[]): ColorStop[] {
+	return [...stops].sort((a, b) => a.offset - b.offset);
+}
 
+/**
+ * Color at position t (0-1) along stops sorted by offset
+ */
+function sampleStops(
+	sortedStops: ColorStop[],
+	t: number,
+): [number, number, number, number] {
 	if (t <= sortedStops[0].offset) {
 		return sortedStops[0].color;
 	}
@@ -174,9 +202,124 @@ export function createGradientBitmap(
 	return bitmap;
 }
 
+/**
+ * Sample a gradient at 256 evenly spaced positions along its axis.
+ * @returns RGBA table, 4 bytes per entry; entry i is the color at t = i / 255
+ */
+function buildGradientLut(
+	gradient: Gradient,
+	premultiplied: boolean,
+): Uint8Array {
+	const lut = new Uint8Array(256 * 4);
+	const constant =
+		gradient.stops.length === 1 ||
+		(gradient.type === "linear" &&
+			gradient.x0 === gradient.x1 &&
+			gradient.y0 === gradient.y1);
+	const sorted = sortStops(gradient.stops);
+
+	for (let i = 0; i < 256; i++) {
+		const [r, g, b, a] = constant
+			? gradient.stops[0].color
+			: sampleStops(sorted, i / 255);
+		const o = i * 4;
+		if (premultiplied) {
+			lut[o] = Math.round((r * a) / 255);
+			lut[o + 1] = Math.round((g * a) / 255);
+			lut[o + 2] = Math.round((b * a) / 255);
+		} else {
+			lut[o] = r;
+			lut[o + 1] = g;
+			lut[o + 2] = b;
+		}
+		lut[o + 3] = a;
+	}
+	return lut;
+}
+
+/** State shared by the span callback of rasterizePathWithGradient */
+interface GradientSpanTarget {
+	buffer: Uint8Array;
+	width: number;
+	gradient: Gradient;
+	lut: Uint8Array;
+	premultiplied: boolean;
+}
+
+/** Shared rasterizer for gradient fills */
+let gradientRaster: GrayRaster | null = null;
+
+/**
+ * Shade one covered run of pixels with the gradient
+ */
+function shadeSpan(
+	target: GradientSpanTarget,
+	y: number,
+	x: number,
+	len: number,
+	coverage: number,
+): void {
+	const { buffer, gradient, lut, premultiplied } = target;
+	let out = (y * target.width + x) * 4;
+
+	// Gradient position: linear steps t per pixel, radial takes a distance
+	let t = 0;
+	let dt = 0;
+	let dy2 = 0;
+	let invRadius = 0;
+	if (gradient.type === "linear") {
+		const dx = gradient.x1 - gradient.x0;
+		const dy = gradient.y1 - gradient.y0;
+		const lengthSq = dx * dx + dy * dy;
+		if (lengthSq > 0) {
+			t = ((x - gradient.x0) * dx + (y - gradient.y0) * dy) / lengthSq;
+			dt = dx / lengthSq;
+		}
+	} else {
+		const dy = y - gradient.cy;
+		dy2 = dy * dy;
+		invRadius = gradient.radius > 0 ? 1 / gradient.radius : 0;
+	}
+
+	for (let i = 0; i < len; i++, out += 4) {
+		let u = t + i * dt;
+		if (gradient.type === "radial") {
+			const dx = x + i - gradient.cx;
+			u = Math.sqrt(dx * dx + dy2) * invRadius;
+		}
+		const entry = u <= 0 ? 0 : u >= 1 ? 1020 : ((u * 255 + 0.5) | 0) << 2;
+
+		if (premultiplied) {
+			buffer[out] = (lut[entry]! * coverage + 127) / 255;
+			buffer[out + 1] = (lut[entry + 1]! * coverage + 127) / 255;
+			buffer[out + 2] = (lut[entry + 2]! * coverage + 127) / 255;
+		} else {
+			buffer[out] = lut[entry]!;
+			buffer[out + 1] = lut[entry + 1]!;
+			buffer[out + 2] = lut[entry + 2]!;
+		}
+		buffer[out + 3] = (lut[entry + 3]! * coverage + 127) / 255;
+	}
+}
+
+function shadeSpans(
+	y: number,
+	spans: Span[],
+	target: GradientSpanTarget,
+): void {
+	for (let i = 0; i < spans.length; i++) {
+		const span = spans[i]!;
+		shadeSpan(target, y, span.x, span.len, span.coverage);
+	}
+}
+
 /**
  * Rasterize path with gradient fill
- * First rasterizes path to get coverage mask, then fills with gradient
+ * The path is swept into coverage spans and only covered pixels are shaded,
+ * with colors taken from a 256-entry gradient table. Alpha is the gradient
+ * alpha scaled by coverage; with `premultiplied` the color channels are
+ * scaled too. With a `clip` (or the libass rasterizer) coverage comes from a
+ * rasterizePath bitmap instead, so the clip applies as it does there.
  *
  * @param path Glyph path to rasterize
  * @param gradient Linear or radial gradient definition
@@ -186,35 +329,61 @@ export function createGradientBitmap(
 export function rasterizePathWithGradient(
 	path: GlyphPath,
 	gradient: Gradient,
-	options: RasterizeOptions,
+	options: GradientRasterizeOptions,
 ): Bitmap {
-	const { width, height } = options;
-
-	const coverageBitmap = rasterizePath(path, {
-		...options,
-		pixelMode: PixelMode.Gray,
-		flipY: options.flipY ?? false,
-	});
+	const {
+		width,
+		height,
+		scale,
+		offsetX = 0,
+		offsetY = 0,
+		fillRule = FillRule.NonZero,
+		flipY = false,
+		premultiplied = false,
+	} = options;
 
 	const resultBitmap = createBitmap(width, height, PixelMode.RGBA);
+	if (gradient.stops.length === 0 || width <= 0 || height <= 0) {
+		return resultBitmap;
+	}
 
-	for (let y = 0; y < height; y++) {
-		for (let x = 0; x < width; x++) {
-			const coverage = coverageBitmap.buffer[y * coverageBitmap.pitch + x] ?? 0;
-
-			if (coverage > 0) {
-				const color = interpolateGradient(gradient, x, y);
-				const idx = (y * width + x) * 4;
-
-				const alpha = (color[3] * coverage) / 255;
+	const target: GradientSpanTarget = {
+		buffer: resultBitmap.buffer,
+		width,
+		gradient,
+		lut: buildGradientLut(gradient, premultiplied),
+		premultiplied,
+	};
 
-				resultBitmap.buffer[idx] = color[0];
-				resultBitmap.buffer[idx + 1] = color[1];
-				resultBitmap.buffer[idx + 2] = color[2];
-				resultBitmap.buffer[idx + 3] = Math.round(alpha);
+	if (options.rasterizer === "libass" || options.clip) {
+		// Coverage comes from rasterizePath (the libass-style rasterizer, or a
+		// clipped fill); shade per pixel
+		const coverageBitmap = rasterizePath(path, {
+			...options,
+			pixelMode: PixelMode.Gray,
+			flipY,
+			out: undefined,
+		});
+		for (let y = 0; y < height; y++) {
+			const row = y * coverageBitmap.pitch;
+			for (let x = 0; x < width; x++) {
+				const coverage = coverageBitmap.buffer[row + x]!;
+				if (coverage > 0) shadeSpan(target, y, x, 1, coverage);
 			}
 		}
+		return resultBitmap;
 	}
 
+	if (!gradientRaster) gradientRaster = new GrayRaster();
+	const raster = gradientRaster;
+	raster.sweepSpansWithBands(
+		width,
+		() => decomposePath(raster, path, scale, offsetX, offsetY, flipY),
+		{ minY: 0, maxY: height },
+		shadeSpans,
+		fillRule,
+		target,
+	);
+
 	return resultBitmap;
 }
@@ -686,8 +686,11 @@ export class GrayRaster {
 		const cells = this.cells.getCells();
 		const nullIndex = this.cells.getNullIndex();
 		const bandMinY = this.cells.getBandMinY();
+		// ycells is reused across renders and may be longer than this band;
+		// rows past the band height hold stale lists
+		const bandHeight = this.cells.getBandHeight();
 
-		for (let i = 0; i < ycells.length; i++) {
+		for (let i = 0; i < bandHeight; i++) {
 			let cellIndex = ycells[i]!;
 			if (cellIndex === nullIndex) continue;
 
@@ -723,6 +726,19 @@ export class GrayRaster {
 				cellIndex = cells[base + 3]!;
 			}
 
+			// Cells right of the clip were dropped; cover still open at the end
+			// of the row runs to the clip edge (as in sweep)
+			if (cover !== 0 && spanStart + 1 < this.maxX) {
+				const gray = this.applyFillRule(cover >> (PIXEL_BITS + 1), fillRule);
+				if (gray > 0) {
+					spans.push({
+						x: spanStart + 1,
+						len: this.maxX - spanStart - 1,
+						coverage: gray,
+					});
+				}
+			}
+
 			if (spans.length > 0) {
 				callback(y, spans, userData as T);
 			}
@@ -750,8 +766,9 @@ export class GrayRaster {
 		const cells = this.cells.getCells();
 		const nullIndex = this.cells.getNullIndex();
 		const bandMinY = this.cells.getBandMinY();
+		const bandHeight = this.cells.getBandHeight();
 
-		for (let i = 0; i < ycells.length; i++) {
+		for (let i = 0; i < bandHeight; i++) {
 			let cellIndex = ycells[i]!;
 			if (cellIndex === nullIndex) continue;
 
@@ -829,6 +846,45 @@ export class GrayRaster {
 		decomposeFn: () => void,
 		bounds: { minY: number; maxY: number; minX?: number; maxX?: number },
 		fillRule: FillRule = FillRuleEnum.NonZero,
+	): void {
+		this.runBands(bitmap.width, decomposeFn, bounds, () =>
+			this.sweep(bitmap, fillRule),
+		);
+	}
+
+	/**
+	 * Band-processed sweepSpans for outlines that may overflow the cell pool.
+	 * Spans are clipped to [0, width) and delivered one band at a time (bands
+	 * are not visited in row order).
+	 *
+	 * @param width Clip width in pixels
+	 * @param decomposeFn Function that decomposes outline to rasterizer commands
+	 * @param bounds Row range to render
+	 * @param callback Span callback function
+	 * @param fillRule Fill rule to apply
+	 * @param userData User data passed to callback
+	 */
+	sweepSpansWithBands<T = void>(
+		width: number,
+		decomposeFn: () => void,
+		bounds: { minY: number; maxY: number },
+		callback: (y: number, spans: Span[], userData: T) => void,
+		fillRule: FillRule = FillRuleEnum.NonZero,
+		userData?: T,
+	): void {
+		this.runBands(width, decomposeFn, bounds, () =>
+			this.sweepSpans(callback, fillRule, userData),
+		);
+	}
+
+	/**
+	 * Decompose and sweep `bounds` in bands, bisecting bands that overflow
+	 */
+	private runBands(
+		width: number,
+		decomposeFn: () => void,
+		bounds: { minY: number; maxY: number },
+		sweepFn: () => void,
 	): void {
 		// Calculate initial band height based on pool size
 		// Aim for bands that use ~1/8 of pool to leave room for overflow
@@ -863,7 +919,7 @@ export class GrayRaster {
 			if (!band) break;
 
 			if (
-				this.renderBand(bitmap, decomposeFn, band.minY, band.maxY, fillRule)
+				this.renderBand(width, decomposeFn, band.minY, band.maxY, sweepFn)
 			) {
 				continue; // Success
 			}
@@ -904,13 +960,13 @@ export class GrayRaster {
 	 * @returns true on success, false on pool overflow
 	 */
 	private renderBand(
-		bitmap: Bitmap,
+		width: number,
 		decomposeFn: () => void,
 		minY: number,
 		maxY: number,
-		fillRule: FillRule,
+		sweepFn: () => void,
 	): boolean {
-		this.setClip(0, minY, bitmap.width, maxY);
+		this.setClip(0, minY, width, maxY);
 
 		// Set up band bounds
 		this.cells.setBandBounds(minY, maxY);
@@ -922,8 +978,7 @@ export class GrayRaster {
 			// Decompose outline (may throw PoolOverflowError)
 			decomposeFn();
 
-			// Sweep and render to bitmap.
-			this.sweep(bitmap, fillRule);
+			sweepFn();
 			return true;
 		} catch (e) {
 			if (e instanceof PoolOverflowError) {
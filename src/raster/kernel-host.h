@@ -0,0 +1,23 @@
+// Addressing shim shared by the freestanding raster kernels (fill-wasm,
+// ass-wasm) so the same sources build for wasm32 and for the host.
+//
+// Exported entry points take i32 byte offsets into wasm linear memory. In a
+// host build (native profiling and benchmarks, see tools/raster-bench) the
+// offsets are resolved against an arena the harness stores in
+// kernel_host_memory, so the kernels keep one ABI on both targets.
+
+#ifndef TEXT_SHAPER_KERNEL_HOST_H
+#define TEXT_SHAPER_KERNEL_HOST_H
+
+#include <stdint.h>
+
+#ifdef __wasm__
+#define KERNEL_EXPORT(name) __attribute__((export_name(name)))
+#define KERNEL_PTR(type, off) ((type *)(uintptr_t)(off))
+#else
+extern uint8_t *kernel_host_memory;
+#define KERNEL_EXPORT(name)
+#define KERNEL_PTR(type, off) ((type *)(kernel_host_memory + (off)))
+#endif
+
+#endif
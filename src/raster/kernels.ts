@@ -0,0 +1,103 @@
+/**
+ * One-call startup for the optional wasm raster kernels (fill-wasm, ass-wasm,
+ * bitmap-wasm), so a pool of workers compiles them once instead of once per
+ * worker.
+ *
+ * The main thread calls initRasterKernels() and posts the returned modules
+ * (WebAssembly.Module is structured-cloneable); each worker passes them back
+ * in as `modules` and only instantiates + runs the quick self-check.
+ */
+
+import {
+	assRasterWasmStatus,
+	ensureAssRasterWasmReady,
+	getAssRasterWasmModule,
+} from "./ass-wasm/index.ts";
+import { ASS_FILL_WASM_BASE64 } from "./ass-wasm/wasm-bytes.ts";
+import {
+	bitmapWasmStatus,
+	ensureBitmapWasmReady,
+	getBitmapWasmModule,
+} from "./bitmap-wasm/index.ts";
+import { BITMAP_WASM_BASE64 } from "./bitmap-wasm/wasm-bytes.ts";
+import {
+	ensureFillWasmReady,
+	fillWasmStatus,
+	getFillWasmModule,
+} from "./fill-wasm/index.ts";
+import { FILL_WASM_BASE64 } from "./fill-wasm/wasm-bytes.ts";
+import { decodeBase64 } from "./wasm-base64.ts";
+
+/** Compiled kernel modules; null for a kernel that is unavailable */
+export interface RasterKernelModules {
+	fill: WebAssembly.Module | null;
+	ass: WebAssembly.Module | null;
+	bitmap: WebAssembly.Module | null;
+}
+
+export interface RasterKernelInitOptions {
+	/** Modules compiled elsewhere (e.g. posted from the main thread) */
+	modules?: Partial<RasterKernelModules>;
+	/**
+	 * Compile missing modules with WebAssembly.compile instead of the
+	 * synchronous constructor (default true)
+	 */
+	async?: boolean;
+}
+
+async function compile(
+	status: "uninit" | "ready" | "disabled",
+	base64: string,
+	provided: WebAssembly.Module | null | undefined,
+	async: boolean,
+): Promise<WebAssembly.Module | undefined> {
+	// An initialized kernel ignores the module, so don't decode or compile one
+	if (status !== "uninit") return undefined;
+	if (provided) return provided;
+	if (base64.length === 0) return undefined;
+	const bytes = decodeBase64(base64);
+	try {
+		return async
+			? await WebAssembly.compile(bytes)
+			: new WebAssembly.Module(bytes);
+	} catch {
+		// Leave it to the kernel's own init, which disables it cleanly
+		return undefined;
+	}
+}
+
+/**
+ * Compile (or adopt) and verify every raster kernel. Resolves to the verified
+ * modules, ready to post to workers. Kernels that are already initialized are
+ * left as they are, and nothing is decoded or compiled for them.
+ */
+export async function initRasterKernels(
+	options: RasterKernelInitOptions = {},
+): Promise<RasterKernelModules> {
+	if (typeof WebAssembly !== "undefined") {
+		const { modules = {}, async = true } = options;
+		const [fill, ass, bitmap] = await Promise.all([
+			compile(fillWasmStatus().status, FILL_WASM_BASE64, modules.fill, async),
+			compile(
+				assRasterWasmStatus().status,
+				ASS_FILL_WASM_BASE64,
+				modules.ass,
+				async,
+			),
+			compile(
+				bitmapWasmStatus().status,
+				BITMAP_WASM_BASE64,
+				modules.bitmap,
+				async,
+			),
+		]);
+		ensureFillWasmReady(fill);
+		ensureAssRasterWasmReady(ass);
+		ensureBitmapWasmReady(bitmap);
+	}
+	return {
+		fill: getFillWasmModule(),
+		ass: getAssRasterWasmModule(),
+		bitmap: getBitmapWasmModule(),
+	};
+}
@@ -8,6 +8,7 @@
  */
 
 import type { GlyphPath } from "../render/path.ts";
+import { lcdToRGBAWasm } from "./bitmap-wasm/index.ts";
 import { GrayRaster } from "./gray-raster.ts";
 import { decomposePath } from "./outline-decompose.ts";
 import type { Bitmap } from "./types.ts";
@@ -295,40 +296,62 @@ function applyLcdFilterVertical(
  * @param lcd LCD bitmap to convert
  * @param bgColor Background color as RGB (0-255 each)
  * @param fgColor Foreground color as RGB (0-255 each)
+ * @param out Optional destination (at least width * rows * 4 bytes)
  * @returns RGBA pixel array (4 bytes per pixel)
  */
 export function lcdToRGBA(
 	lcd: Bitmap,
 	bgColor: [number, number, number] = [255, 255, 255],
 	fgColor: [number, number, number] = [0, 0, 0],
+	out?: Uint8Array,
 ): Uint8Array {
-	const rgba = new Uint8Array(lcd.width * lcd.rows * 4);
+	const { width, rows, pitch, buffer } = lcd;
+	const size = width * rows * 4;
+	const rgba = out ?? new Uint8Array(size);
+	if (rgba.length < size) {
+		throw new RangeError(`Output buffer too small: ${rgba.length} < ${size}`);
+	}
 	const [bgR, bgG, bgB] = bgColor;
 	const [fgR, fgG, fgB] = fgColor;
 
-	for (let y = 0; y < lcd.rows; y++) {
-		const srcRow = y * lcd.pitch;
-		const dstRow = y * lcd.width * 4;
-
-		for (let x = 0; x < lcd.width; x++) {
-			const srcIdx = srcRow + x * 3;
-			const dstIdx = dstRow + x * 4;
-
-			const r = lcd.buffer[srcIdx];
-			const g = lcd.buffer[srcIdx + 1];
-			const b = lcd.buffer[srcIdx + 2];
+	// Black on white is a plain inversion
+	if (
+		bgR === 255 &&
+		bgG === 255 &&
+		bgB === 255 &&
+		fgR === 0 &&
+		fgG === 0 &&
+		fgB === 0 &&
+		lcdToRGBAWasm(buffer, 0, pitch, width, rows, rgba)
+	) {
+		return rgba;
+	}
 
-			// Blend with foreground/background
-			rgba[dstIdx] = blendChannel(bgR, fgR, r);
-			rgba[dstIdx + 1] = blendChannel(bgG, fgG, g);
-			rgba[dstIdx + 2] = blendChannel(bgB, fgB, b);
-			rgba[dstIdx + 3] = 255; // Fully opaque
+	// Blend with foreground/background, one table per channel
+	const lutR = channelLut(bgR, fgR);
+	const lutG = channelLut(bgG, fgG);
+	const lutB = channelLut(bgB, fgB);
+
+	for (let y = 0; y < rows; y++) {
+		let src = y * pitch;
+		let dst = y * width * 4;
+		for (let x = 0; x < width; x++, src += 3, dst += 4) {
+			rgba[dst] = lutR[buffer[src]!]!;
+			rgba[dst + 1] = lutG[buffer[src + 1]!]!;
+			rgba[dst + 2] = lutB[buffer[src + 2]!]!;
+			rgba[dst + 3] = 255; // Fully opaque
 		}
 	}
 
 	return rgba;
 }
 
+function channelLut(bg: number, fg: number): Uint8Array {
+	const lut = new Uint8Array(256);
+	for (let a = 0; a < 256; a++) lut[a] = blendChannel(bg, fg, a);
+	return lut;
+}
+
 function blendChannel(bg: number, fg: number, alpha: number): number {
 	return Math.round(bg + ((fg - bg) * alpha) / 255);
 }
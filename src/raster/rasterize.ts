@@ -2,6 +2,14 @@
  * High-level rasterization API
  */
 
+import {
+	addCacheBytes,
+	OBJECT_BYTES,
+	OwnerCache,
+	registerCache,
+	SLOT_BYTES,
+	WeakCache,
+} from "../cache.ts";
 import type { Font } from "../font/font.ts";
 import { CompositeFlag } from "../font/tables/glyf.ts";
 import { getAdvanceWidthDelta, getLsbDelta } from "../font/tables/hvar.ts";
@@ -16,19 +24,32 @@ import {
 	setSize,
 } from "../hinting/programs.ts";
 import { scaleFUnits } from "../hinting/scale.ts";
+import { incrementCounter, instrumenting, recordTime } from "../instrument.ts";
 import type { Matrix2D, Matrix3x3 } from "../render/outline-transform.ts";
 import { type GlyphPath, getGlyphPath } from "../render/path.ts";
 import type { GlyphId } from "../types.ts";
 import {
 	ensureAssRasterWasmReady,
+	fillAssPathClipWasm,
 	fillAssPathWasm,
 	isAssRasterWasmEnabled,
 } from "./ass-wasm/index.ts";
-import { transformBitmap2D, transformBitmap3D } from "./bitmap-utils.ts";
+import {
+	mulBitmaps,
+	subBitmaps,
+	transformBitmap2D,
+	transformBitmap3D,
+} from "./bitmap-utils.ts";
+import {
+	GrayExpand,
+	grayToRGBAWasm,
+	lcdToRGBAWasm,
+} from "./bitmap-wasm/index.ts";
 import { PoolOverflowError } from "./cell.ts";
 import {
 	ensureFillWasmReady,
 	fillGlyphGrayWasm,
+	fillGlyphSpansWasm,
 	isFillWasmEnabled,
 } from "./fill-wasm/index.ts";
 import { GrayRaster } from "./gray-raster.ts";
@@ -46,13 +67,32 @@ import {
 	type GlyphRasterizeOptions,
 	type HintTarget,
 	PixelMode,
+	type RasterClip,
 	type RasterizedGlyph,
 	type RasterizeOptions,
+	type Span,
 	type TextRasterizeOptions,
 } from "./types.ts";
 
-/** Cached hinting engines per font */
-const hintingEngineCache = new WeakMap<Font, HintingEngine>();
+/** Fixed part of an execution context (graphics state, zones, call stack) */
+const HINTING_CONTEXT_BYTES = 4096;
+
+function hintingEngineBytes(engine: HintingEngine): number {
+	const ctx = engine.ctx;
+	return (
+		HINTING_CONTEXT_BYTES +
+		ctx.stack.byteLength +
+		ctx.storage.byteLength +
+		ctx.cvt.byteLength * 3 +
+		ctx.twilight.nPoints * 6 * SLOT_BYTES
+	);
+}
+
+/** Cached hinting engines per font; rebuilding reruns fpgm, so trim last */
+const hintingEngineCache = new WeakCache<Font, HintingEngine>(
+	"raster.hintingEngine",
+	{ sizeOf: hintingEngineBytes, priority: 4 },
+);
 
 /** Shared GrayRaster instance for reuse (avoids 2KB allocation per glyph) */
 let sharedRaster: GrayRaster | null = null;
@@ -89,6 +129,16 @@ export function getFillProfile(): { ms: number; count: number } {
 	return { ms: fillProfileMs, count: fillProfileCount };
 }
 
+/** Charge one fill started at `start` to the fill profile and raster.fill */
+function recordFill(start: number): void {
+	const ms = performance.now() - start;
+	if (fillProfileOn) {
+		fillProfileMs += ms;
+		fillProfileCount++;
+	}
+	if (instrumenting) recordTime("raster.fill", ms);
+}
+
 /** Get or create shared rasterizer */
 function getSharedRaster(): GrayRaster {
 	if (!sharedRaster) sharedRaster = new GrayRaster();
@@ -117,10 +167,36 @@ function getSharedBuffer(size: number): Uint8Array {
 	// Allocate new buffer (with some extra capacity for future reuse)
 	const allocSize = Math.max(size, 4096);
 	sharedBuffer = new Uint8Array(allocSize);
+	addCacheBytes(allocSize - sharedBufferSize);
 	sharedBufferSize = allocSize;
 	return sharedBuffer;
 }
 
+// The shared buffer only grows; trimming drops it so a one-off large glyph
+// does not pin its bitmap size for the life of the process
+registerCache({
+	name: "raster.sharedBuffer",
+	priority: 0,
+	get bytes() {
+		return sharedBufferSize;
+	},
+	stats() {
+		return {
+			name: "raster.sharedBuffer",
+			entries: sharedBuffer ? 1 : 0,
+			bytes: sharedBufferSize,
+			maxEntries: 1,
+			evictions: 0,
+		};
+	},
+	trim(fraction) {
+		if (fraction <= 0 || !sharedBuffer) return;
+		addCacheBytes(-sharedBufferSize);
+		sharedBuffer = null;
+		sharedBufferSize = 0;
+	},
+});
+
 /** Create bitmap with shared buffer */
 function createBitmapShared(
 	width: number,
@@ -152,8 +228,21 @@ function createBitmapShared(
 	};
 }
 
+function hintedGlyphBytes(glyph: HintedGlyph | null): number {
+	if (!glyph) return SLOT_BYTES;
+	return (
+		3 * OBJECT_BYTES +
+		(glyph.xCoords.length + glyph.yCoords.length) * SLOT_BYTES +
+		glyph.flags.byteLength +
+		glyph.contourEnds.length * SLOT_BYTES
+	);
+}
+
 /** Cached hinted glyphs per font */
-const hintedGlyphCache = new WeakMap<Font, Map<string, HintedGlyph | null>>();
+const hintedGlyphCache = new OwnerCache<Font, string, HintedGlyph | null>(
+	"raster.hintedGlyph",
+	{ sizeOf: hintedGlyphBytes, priority: 1 },
+);
 
 function shouldScaleComponentOffset(flags: number): boolean {
 	if (flags & CompositeFlag.UnscaledComponentOffset) return false;
@@ -400,24 +489,25 @@ function getCachedHintedGlyph(
 ): HintedGlyph | null {
 	const pointKey = Math.round(pointSize * 64);
 	const key = `${glyphId}:${ppem}:${pointKey}:${engine.ctx.lightMode ? "light" : "full"}`;
-	let cache = hintedGlyphCache.get(font);
-	if (!cache) {
-		cache = new Map();
-		hintedGlyphCache.set(font, cache);
+	const cached = hintedGlyphCache.get(font, key);
+	if (instrumenting) {
+		incrementCounter(
+			cached !== undefined
+				? "cache.hintedGlyph.hit"
+				: "cache.hintedGlyph.miss",
+		);
 	}
-
-	const cached = cache.get(key);
 	if (cached !== undefined) return cached;
 
 	const glyph = font.getGlyph(glyphId);
 	if (!glyph || glyph.type === "empty") {
-		cache.set(key, null);
+		hintedGlyphCache.set(font, key, null);
 		return null;
 	}
 
 	const error = setSize(engine, ppem, pointSize);
 	if (error) {
-		cache.set(key, null);
+		hintedGlyphCache.set(font, key, null);
 		return null;
 	}
 
@@ -430,7 +520,7 @@ function getCachedHintedGlyph(
 			depth,
 		);
 		if (compositeHinted && compositeHinted.xCoords.length > 0) {
-			cache.set(key, compositeHinted);
+			hintedGlyphCache.set(font, key, compositeHinted);
 			return compositeHinted;
 		}
 	}
@@ -438,17 +528,17 @@ function getCachedHintedGlyph(
 	// Compute hinted glyph from flattened outline
 	const outline = glyphToOutline(font, glyphId, engine.ctx.scale);
 	if (!outline) {
-		cache.set(key, null);
+		hintedGlyphCache.set(font, key, null);
 		return null;
 	}
 
 	const hinted = hintGlyph(engine, outline);
 	if (hinted.error || hinted.xCoords.length === 0) {
-		cache.set(key, null);
+		hintedGlyphCache.set(font, key, null);
 		return null;
 	}
 
-	cache.set(key, hinted);
+	hintedGlyphCache.set(font, key, hinted);
 	return hinted;
 }
 
@@ -690,6 +780,91 @@ function decomposeHintedGlyph(
 /** Threshold for using band processing (height in pixels) */
 const BAND_PROCESSING_THRESHOLD = 256;
 
+/**
+ * rasterizePath with a vector clip. The libass kernel intersects the clip per
+ * tile; otherwise both outlines are rasterized and combined.
+ */
+function rasterizeClipped(
+	path: GlyphPath,
+	clip: RasterClip,
+	options: RasterizeOptions,
+): Bitmap {
+	const unclipped = { ...options, clip: undefined };
+	const {
+		width,
+		height,
+		scale,
+		offsetX = 0,
+		offsetY = 0,
+		pixelMode = PixelMode.Gray,
+		fillRule = FillRule.NonZero,
+		flipY = true,
+		rasterizer = "freetype",
+		out,
+	} = options;
+	const inverse = clip.inverse ?? false;
+
+	if (
+		rasterizer === "libass" &&
+		pixelMode === PixelMode.Gray &&
+		fillRule === FillRule.NonZero
+	) {
+		initAssRasterWasm();
+		const bitmap =
+			out?.length === width * height
+				? {
+						width,
+						rows: height,
+						pitch: width,
+						buffer: out,
+						pixelMode,
+						numGrays: 256,
+					}
+				: createBitmap(width, height, pixelMode);
+		if (
+			isAssRasterWasmEnabled() &&
+			fillAssPathClipWasm(
+				path,
+				clip.path,
+				inverse,
+				width,
+				height,
+				scale,
+				offsetX,
+				offsetY,
+				flipY,
+				bitmap.buffer,
+			)
+		) {
+			return bitmap;
+		}
+	}
+
+	const bitmap = rasterizePath(path, unclipped);
+	const mask = rasterizePath(clip.path, { ...unclipped, out: undefined });
+	applyClipMask(bitmap, mask, inverse);
+	return bitmap;
+}
+
+/** Clip `bitmap` by a mask rendered with the same size and pixel mode */
+function applyClipMask(bitmap: Bitmap, mask: Bitmap, inverse: boolean): void {
+	if (bitmap.pixelMode === PixelMode.Mono) {
+		const dst = bitmap.buffer;
+		const src = mask.buffer;
+		for (let i = 0; i < dst.length; i++) {
+			dst[i] = inverse ? dst[i]! & ~src[i]! : dst[i]! & src[i]!;
+		}
+		return;
+	}
+	// LCD and RGBA store coverage per byte (RGBA in alpha, color zero), so
+	// they clip like a Gray bitmap one pitch wide
+	const dst: Bitmap = { ...bitmap, width: bitmap.pitch };
+	const src: Bitmap = { ...mask, width: mask.pitch };
+	dst.pixelMode = src.pixelMode = PixelMode.Gray;
+	if (inverse) subBitmaps(dst, src);
+	else mulBitmaps(dst, src);
+}
+
 /**
  * Rasterize a glyph path to a bitmap
  * @param path Glyph path to rasterize
@@ -710,8 +885,10 @@ export function rasterizePath(
 		fillRule = FillRule.NonZero,
 		flipY = true,
 		rasterizer = "freetype",
+		clip,
 		out,
 	} = options;
+	if (clip) return rasterizeClipped(path, clip, options);
 
 	// Create bitmap (non-shared since this is a public API and callers keep
 	// references). A caller-owned zeroed `out` buffer of the exact size is
@@ -752,7 +929,7 @@ export function rasterizePath(
 		fillRule === FillRule.NonZero &&
 		bitmap.pitch === width
 	) {
-		const profile = fillProfileOn;
+		const profile = fillProfileOn || instrumenting;
 		const start = profile ? performance.now() : 0;
 		initAssRasterWasm();
 		if (
@@ -768,10 +945,7 @@ export function rasterizePath(
 				bitmap.buffer,
 			)
 		) {
-			if (profile) {
-				fillProfileMs += performance.now() - start;
-				fillProfileCount++;
-			}
+			if (profile) recordFill(start);
 			return bitmap;
 		}
 	}
@@ -795,11 +969,13 @@ export function rasterizePath(
 		// Optional WASM fast path for the common gray, top-down fill: record the
 		// post-flatten polyline (bezier subdivision still runs in JS), then run the
 		// self-verified wasm kernel. Any decline falls back to the scalar sweep.
-		const profile = fillProfileOn;
+		const profile = fillProfileOn || instrumenting;
 		const tp = profile ? performance.now() : 0;
 		if (pixelMode === PixelMode.Gray && bitmap.pitch === width) {
 			initFillWasm();
-			if (isFillWasmEnabled()) {
+			if (!isFillWasmEnabled()) {
+				if (instrumenting) incrementCounter("wasm.fill.fallback.disabled");
+			} else {
 				raster.beginRecord();
 				decomposePath(raster, path, scale, offsetX, offsetY, flipY);
 				raster.endRecord();
@@ -813,10 +989,7 @@ export function rasterizePath(
 						bitmap.buffer,
 					)
 				) {
-					if (profile) {
-						fillProfileMs += performance.now() - tp;
-						fillProfileCount++;
-					}
+					if (profile) recordFill(tp);
 					return bitmap;
 				}
 			}
@@ -825,15 +998,118 @@ export function rasterizePath(
 		raster.reset();
 		decomposePath(raster, path, scale, offsetX, offsetY, flipY);
 		raster.sweep(bitmap, fillRule);
-		if (profile) {
-			fillProfileMs += performance.now() - tp;
-			fillProfileCount++;
-		}
+		if (profile) recordFill(tp);
 	}
 
 	return bitmap;
 }
 
+/**
+ * Rasterize a glyph path to coverage runs instead of a bitmap. Returns packed
+ * (y, x, len, coverage) quads in row-major order, clipped to width x height,
+ * with horizontally adjacent runs of equal coverage merged. Filling each run
+ * into a zeroed Gray bitmap gives exactly what rasterizePath produces, so
+ * compositors can blend sparse shapes without a width*height buffer.
+ * pixelMode, rasterizer and out are ignored.
+ * @param path Glyph path to rasterize
+ * @param options Rasterization options including dimensions and scale
+ * @returns Span quads, 4 Int32 words per run
+ */
+export function rasterizePathSpans(
+	path: GlyphPath,
+	options: RasterizeOptions,
+): Int32Array {
+	const {
+		width,
+		height,
+		scale,
+		offsetX = 0,
+		offsetY = 0,
+		fillRule = FillRule.NonZero,
+		flipY = true,
+	} = options;
+	if (width <= 0 || height <= 0) return new Int32Array(0);
+
+	const raster = getSharedRaster();
+	raster.setClip(0, 0, width, height);
+
+	if (height <= BAND_PROCESSING_THRESHOLD) {
+		initFillWasm();
+		if (isFillWasmEnabled()) {
+			raster.beginRecord();
+			decomposePath(raster, path, scale, offsetX, offsetY, flipY);
+			raster.endRecord();
+			const spans = fillGlyphSpansWasm(
+				raster.getCmd(),
+				raster.getCmdCount(),
+				width,
+				height,
+				fillRule,
+			);
+			if (spans) return spans;
+		}
+	}
+
+	const collector = new SpanCollector();
+	raster.sweepSpansWithBands(
+		width,
+		() => decomposePath(raster, path, scale, offsetX, offsetY, flipY),
+		{ minY: 0, maxY: height },
+		(y, spans) => collector.addRow(y, spans),
+		fillRule,
+	);
+	return collector.finish();
+}
+
+/** Packs span callbacks into the quad layout of fill_glyph_spans */
+class SpanCollector {
+	private words = new Int32Array(256);
+	private length = 0;
+	private lastY = -1;
+	private sorted = true;
+
+	addRow(y: number, spans: Span[]): void {
+		if (y < this.lastY) this.sorted = false;
+		this.lastY = y;
+		const rowStart = this.length;
+		for (const span of spans) {
+			const last = this.length - 4;
+			if (
+				last >= rowStart &&
+				this.words[last + 1]! + this.words[last + 2]! === span.x &&
+				this.words[last + 3] === span.coverage
+			) {
+				this.words[last + 2] = this.words[last + 2]! + span.len;
+				continue;
+			}
+			if (this.length + 4 > this.words.length) {
+				const grown = new Int32Array(this.words.length * 2);
+				grown.set(this.words);
+				this.words = grown;
+			}
+			this.words[this.length++] = y;
+			this.words[this.length++] = span.x;
+			this.words[this.length++] = span.len;
+			this.words[this.length++] = span.coverage;
+		}
+	}
+
+	finish(): Int32Array {
+		const words = this.words.slice(0, this.length);
+		if (this.sorted) return words;
+		// Bands arrive out of order; each row is contiguous, so a stable sort
+		// of runs by y restores row-major order
+		const count = this.length >> 2;
+		const order = Array.from({ length: count }, (_, i) => i);
+		order.sort((a, b) => words[a * 4]! - words[b * 4]! || a - b);
+		const out = new Int32Array(this.length);
+		for (let i = 0; i < count; i++) {
+			out.set(words.subarray(order[i]! * 4, order[i]! * 4 + 4), i * 4);
+		}
+		return out;
+	}
+}
+
 /**
  * Rasterize a glyph from a font
  * @param font Font containing the glyph
@@ -1452,64 +1728,79 @@ export function rasterizeText(
 /**
  * Export bitmap to raw RGBA pixels (for WebGL textures, etc.)
  * @param bitmap Source bitmap to convert
+ * @param out Optional destination (at least width * rows * 4 bytes), reused
+ * instead of allocating
  * @returns RGBA pixel array (4 bytes per pixel)
  */
-export function bitmapToRGBA(bitmap: Bitmap): Uint8Array {
+export function bitmapToRGBA(bitmap: Bitmap, out?: Uint8Array): Uint8Array {
 	// bitmap.width is always the pixel width
 	// For LCD mode, pitch = width * 3 (3 bytes per pixel for R, G, B subpixels)
-	const isLCD = bitmap.pixelMode === PixelMode.LCD;
-	const isLCDV = bitmap.pixelMode === PixelMode.LCD_V;
-	const rgba = new Uint8Array(bitmap.width * bitmap.rows * 4);
+	const width = bitmap.width;
+	const rows = bitmap.rows;
+	const size = width * rows * 4;
+	const rgba = out ?? new Uint8Array(size);
+	if (rgba.length < size) {
+		throw new RangeError(`Output buffer too small: ${rgba.length} < ${size}`);
+	}
 	const pitch = bitmap.pitch;
 	const absPitch = Math.abs(pitch);
-	const origin = pitch < 0 ? (bitmap.rows - 1) * absPitch : 0;
-
-	for (let y = 0; y < bitmap.rows; y++) {
-		const srcRow = origin + y * pitch;
-		for (let x = 0; x < bitmap.width; x++) {
-			const dstIdx = (y * bitmap.width + x) * 4;
-
-			if (bitmap.pixelMode === PixelMode.Gray) {
-				const srcIdx = srcRow + x;
-				const alpha = bitmap.buffer[srcIdx] ?? 0;
-				// Black text on white background
-				rgba[dstIdx] = 255 - alpha;
-				rgba[dstIdx + 1] = 255 - alpha;
-				rgba[dstIdx + 2] = 255 - alpha;
-				rgba[dstIdx + 3] = 255;
-			} else if (bitmap.pixelMode === PixelMode.Mono) {
-				const byteIdx = srcRow + (x >> 3);
-				const bitIdx = 7 - (x & 7);
-				const alpha = ((bitmap.buffer[byteIdx] ?? 0) >> bitIdx) & 1 ? 255 : 0;
-				rgba[dstIdx] = 255 - alpha;
-				rgba[dstIdx + 1] = 255 - alpha;
-				rgba[dstIdx + 2] = 255 - alpha;
-				rgba[dstIdx + 3] = 255;
-			} else if (isLCD || isLCDV) {
-				// LCD/LCD_V: 3 bytes per pixel (R, G, B subpixel coverage)
-				const srcIdx = srcRow + x * 3;
-				const r = bitmap.buffer[srcIdx] ?? 0;
-				const g = bitmap.buffer[srcIdx + 1] ?? 0;
-				const b = bitmap.buffer[srcIdx + 2] ?? 0;
-				// Black text on white background with subpixel colors
-				rgba[dstIdx] = 255 - r;
-				rgba[dstIdx + 1] = 255 - g;
-				rgba[dstIdx + 2] = 255 - b;
-				rgba[dstIdx + 3] = 255;
-			} else if (bitmap.pixelMode === PixelMode.RGBA) {
-				const srcIdx = srcRow + x * 4;
-				rgba[dstIdx] = bitmap.buffer[srcIdx] ?? 0;
-				rgba[dstIdx + 1] = bitmap.buffer[srcIdx + 1] ?? 0;
-				rgba[dstIdx + 2] = bitmap.buffer[srcIdx + 2] ?? 0;
-				rgba[dstIdx + 3] = bitmap.buffer[srcIdx + 3] ?? 0;
-			} else {
-				// Fallback for other modes (treat as gray mask)
-				const srcIdx = srcRow + x;
-				const alpha = bitmap.buffer[srcIdx] ?? 0;
-				rgba[dstIdx] = 255 - alpha;
-				rgba[dstIdx + 1] = 255 - alpha;
-				rgba[dstIdx + 2] = 255 - alpha;
-				rgba[dstIdx + 3] = 255;
+	const origin = pitch < 0 ? (rows - 1) * absPitch : 0;
+	const buffer = bitmap.buffer;
+	const mode = bitmap.pixelMode;
+
+	if (mode === PixelMode.LCD || mode === PixelMode.LCD_V) {
+		// LCD/LCD_V: 3 bytes per pixel (R, G, B subpixel coverage)
+		// Black text on white background with subpixel colors
+		if (pitch > 0 && lcdToRGBAWasm(buffer, 0, pitch, width, rows, rgba)) {
+			return rgba;
+		}
+		for (let y = 0; y < rows; y++) {
+			let src = origin + y * pitch;
+			let dst = y * width * 4;
+			for (let x = 0; x < width; x++, src += 3, dst += 4) {
+				rgba[dst] = 255 - (buffer[src] ?? 0);
+				rgba[dst + 1] = 255 - (buffer[src + 1] ?? 0);
+				rgba[dst + 2] = 255 - (buffer[src + 2] ?? 0);
+				rgba[dst + 3] = 255;
+			}
+		}
+	} else if (mode === PixelMode.RGBA) {
+		const rowBytes = width * 4;
+		for (let y = 0; y < rows; y++) {
+			const src = origin + y * pitch;
+			rgba.set(buffer.subarray(src, src + rowBytes), y * rowBytes);
+		}
+	} else if (mode === PixelMode.Mono) {
+		for (let y = 0; y < rows; y++) {
+			const srcRow = origin + y * pitch;
+			let dst = y * width * 4;
+			for (let x = 0; x < width; x++, dst += 4) {
+				const bit = ((buffer[srcRow + (x >> 3)] ?? 0) >> (7 - (x & 7))) & 1;
+				const v = bit ? 0 : 255;
+				rgba[dst] = v;
+				rgba[dst + 1] = v;
+				rgba[dst + 2] = v;
+				rgba[dst + 3] = 255;
+			}
+		}
+	} else {
+		// Gray, and the fallback for other modes (treat as gray mask):
+		// black text on white background
+		if (
+			pitch > 0 &&
+			grayToRGBAWasm(GrayExpand.Invert, buffer, 0, pitch, width, rows, rgba)
+		) {
+			return rgba;
+		}
+		for (let y = 0; y < rows; y++) {
+			let src = origin + y * pitch;
+			let dst = y * width * 4;
+			for (let x = 0; x < width; x++, src++, dst += 4) {
+				const v = 255 - (buffer[src] ?? 0);
+				rgba[dst] = v;
+				rgba[dst + 1] = v;
+				rgba[dst + 2] = v;
+				rgba[dst + 3] = 255;
 			}
 		}
 	}
@@ -1520,42 +1811,53 @@ export function bitmapToRGBA(bitmap: Bitmap): Uint8Array {
 /**
  * Export bitmap to grayscale array
  * @param bitmap Source bitmap to convert
+ * @param out Optional destination (at least width * rows bytes). Without it a
+ * tightly packed Gray bitmap returns its own buffer.
  * @returns Grayscale pixel array (1 byte per pixel)
  */
-export function bitmapToGray(bitmap: Bitmap): Uint8Array {
-	if (bitmap.pixelMode === PixelMode.Gray && bitmap.pitch === bitmap.width) {
-		return bitmap.buffer;
+export function bitmapToGray(bitmap: Bitmap, out?: Uint8Array): Uint8Array {
+	const width = bitmap.width;
+	const rows = bitmap.rows;
+	const size = width * rows;
+	if (out && out.length < size) {
+		throw new RangeError(`Output buffer too small: ${out.length} < ${size}`);
+	}
+	const mode = bitmap.pixelMode;
+	const buffer = bitmap.buffer;
+
+	if (mode === PixelMode.Gray && bitmap.pitch === width) {
+		if (!out) return buffer;
+		out.set(buffer.subarray(0, size));
+		return out;
 	}
 
-	const gray = new Uint8Array(bitmap.width * bitmap.rows);
+	const gray = out ?? new Uint8Array(size);
 	const pitch = bitmap.pitch;
 	const absPitch = Math.abs(pitch);
-	const origin = pitch < 0 ? (bitmap.rows - 1) * absPitch : 0;
+	const origin = pitch < 0 ? (rows - 1) * absPitch : 0;
 
-	for (let y = 0; y < bitmap.rows; y++) {
+	for (let y = 0; y < rows; y++) {
 		const srcRow = origin + y * pitch;
-		for (let x = 0; x < bitmap.width; x++) {
-			const dstIdx = y * bitmap.width + x;
-
-			if (bitmap.pixelMode === PixelMode.Gray) {
-				gray[dstIdx] = bitmap.buffer[srcRow + x] ?? 0;
-			} else if (bitmap.pixelMode === PixelMode.Mono) {
-				const byteIdx = srcRow + (x >> 3);
-				const bitIdx = 7 - (x & 7);
-				gray[dstIdx] = ((bitmap.buffer[byteIdx] ?? 0) >> bitIdx) & 1 ? 255 : 0;
-			} else if (
-				bitmap.pixelMode === PixelMode.LCD ||
-				bitmap.pixelMode === PixelMode.LCD_V
-			) {
-				const srcIdx = srcRow + x * 3;
-				const r = bitmap.buffer[srcIdx] ?? 0;
-				const g = bitmap.buffer[srcIdx + 1] ?? 0;
-				const b = bitmap.buffer[srcIdx + 2] ?? 0;
-				gray[dstIdx] = Math.round((r + g + b) / 3);
-			} else if (bitmap.pixelMode === PixelMode.RGBA) {
-				const srcIdx = srcRow + x * 4;
-				// Use alpha as coverage
-				gray[dstIdx] = bitmap.buffer[srcIdx + 3] ?? 0;
+		const dstRow = y * width;
+
+		if (mode === PixelMode.Gray) {
+			gray.set(buffer.subarray(srcRow, srcRow + width), dstRow);
+		} else if (mode === PixelMode.Mono) {
+			for (let x = 0; x < width; x++) {
+				const bit = ((buffer[srcRow + (x >> 3)] ?? 0) >> (7 - (x & 7))) & 1;
+				gray[dstRow + x] = bit ? 255 : 0;
+			}
+		} else if (mode === PixelMode.LCD || mode === PixelMode.LCD_V) {
+			for (let x = 0, src = srcRow; x < width; x++, src += 3) {
+				const sum =
+					(buffer[src] ?? 0) + (buffer[src + 1] ?? 0) + (buffer[src + 2] ?? 0);
+				// round(sum / 3) for 0 <= sum <= 765
+				gray[dstRow + x] = ((sum + 1) * 21846) >>> 16;
+			}
+		} else if (mode === PixelMode.RGBA) {
+			// Use alpha as coverage
+			for (let x = 0, src = srcRow + 3; x < width; x++, src += 4) {
+				gray[dstRow + x] = buffer[src] ?? 0;
 			}
 		}
 	}
@@ -1593,6 +1895,7 @@ export {
 	type ColorStop,
 	createGradientBitmap,
 	type Gradient,
+	type GradientRasterizeOptions,
 	interpolateGradient,
 	type LinearGradient,
 	type RadialGradient,
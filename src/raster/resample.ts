@@ -0,0 +1,290 @@
+/**
+ * Scanline-incremental bilinear resampler used by the bitmap transforms.
+ *
+ * The source is copied once into a buffer with a one-pixel border, so every
+ * tap of the 2x2 filter is in bounds and the inner loop has no clipping.
+ * Source coordinates are fixed point (`shift` fraction bits, 8-bit filter
+ * weights). Affine mappings step them with integer adds and only visit the
+ * span of each destination row whose footprint touches the source; the rest
+ * of the row stays zero. Perspective mappings step homogeneous coordinates
+ * and divide per pixel.
+ *
+ * Precision: the 8-bit weights truncate each tap fraction by less than 1/256,
+ * so results are within +-2 levels of exact float bilinear sampling (identity
+ * and integer translations are exact). Mono sources are resampled as 0/255
+ * coverage and thresholded at 128, so a bit can differ from a float resampler
+ * only where the float coverage is within 2 of the threshold.
+ *
+ * Single-channel images go through the wasm SIMD kernels in bitmap-wasm when
+ * they are available; the loops here are bit-identical to them.
+ */
+
+import {
+	resampleAffineWasm,
+	resamplePerspectiveWasm,
+} from "./bitmap-wasm/index.ts";
+import { type Bitmap, PixelMode } from "./types.ts";
+
+/** Source image with a one-pixel border, ready for resampling */
+export interface ResampleSource {
+	/** Padded pixels: (x, y) lives at (y + 1) * stride + (x + 1) * channels */
+	data: Uint8Array;
+	/** Bytes per padded row */
+	stride: number;
+	/** Unpadded width in pixels */
+	width: number;
+	/** Unpadded height in pixels */
+	rows: number;
+	/** Bytes per pixel (Mono sources are expanded to 1-channel coverage) */
+	channels: number;
+	/** Fraction bits of the fixed-point coordinates */
+	shift: number;
+}
+
+/**
+ * Copy a bitmap into a padded resampling source.
+ * @param edge "zero" treats pixels outside the bitmap as empty, "clamp"
+ * repeats the edge pixels
+ */
+export function createResampleSource(
+	bitmap: Bitmap,
+	edge: "zero" | "clamp",
+): ResampleSource {
+	const { width, rows, pitch, buffer, pixelMode } = bitmap;
+	const channels =
+		pixelMode === PixelMode.LCD || pixelMode === PixelMode.LCD_V
+			? 3
+			: pixelMode === PixelMode.RGBA
+				? 4
+				: 1;
+	const stride = (width + 2) * channels;
+	const data = new Uint8Array(stride * (rows + 2));
+	const origin = pitch < 0 ? (rows - 1) * -pitch : 0;
+	const rowBytes = width * channels;
+
+	for (let y = 0; y < rows; y++) {
+		const src = origin + y * pitch;
+		const dst = (y + 1) * stride + channels;
+		if (pixelMode === PixelMode.Mono) {
+			for (let x = 0; x < width; x++) {
+				const bit = ((buffer[src + (x >> 3)] ?? 0) >> (7 - (x & 7))) & 1;
+				data[dst + x] = bit ? 255 : 0;
+			}
+		} else {
+			data.set(buffer.subarray(src, src + rowBytes), dst);
+		}
+	}
+
+	if (edge === "clamp" && width > 0 && rows > 0) {
+		for (let y = 1; y <= rows; y++) {
+			const row = y * stride;
+			data.copyWithin(row, row + channels, row + 2 * channels);
+			data.copyWithin(
+				row + stride - channels,
+				row + stride - 2 * channels,
+				row + stride - channels,
+			);
+		}
+		data.copyWithin(0, stride, 2 * stride);
+		data.copyWithin((rows + 1) * stride, rows * stride, (rows + 1) * stride);
+	}
+
+	// 16 fraction bits keep (width << 16) inside int32; larger images trade
+	// coordinate precision for range
+	const shift = Math.max(width, rows) < 32767 ? 16 : 8;
+	return { data, stride, width, rows, channels, shift };
+}
+
+const INT32_MAX = 0x7fffffff;
+
+function toFixed(value: number, scale: number): number {
+	const v = Math.round(value * scale);
+	return v > INT32_MAX ? INT32_MAX : v < -INT32_MAX ? -INT32_MAX : v;
+}
+
+/**
+ * Narrow [start, end) to the x where lo <= a + x * d < hi (integers)
+ */
+function clipSpan(
+	a: number,
+	d: number,
+	lo: number,
+	hi: number,
+	start: number,
+	end: number,
+): [number, number] {
+	if (d === 0) return a >= lo && a < hi ? [start, end] : [start, start];
+	let first: number;
+	let last: number;
+	if (d > 0) {
+		first = Math.ceil((lo - a) / d);
+		last = Math.ceil((hi - a) / d);
+	} else {
+		first = Math.floor((hi - a) / d) + 1;
+		last = Math.floor((lo - a) / d) + 1;
+	}
+	if (first > start) start = first;
+	if (last < end) end = last;
+	return [start, end < start ? start : end];
+}
+
+/**
+ * Resample with an affine mapping. Destination pixel (x, y) samples source
+ * position (u0 + x * du + y * duRow, v0 + x * dv + y * dvRow), where integer
+ * source coordinates address pixel centers.
+ * `dst` must be zeroed; `channels` bytes are written per destination pixel.
+ */
+export function resampleAffine(
+	src: ResampleSource,
+	dst: Uint8Array,
+	dstPitch: number,
+	width: number,
+	height: number,
+	u0: number,
+	v0: number,
+	du: number,
+	dv: number,
+	duRow: number,
+	dvRow: number,
+): void {
+	const scale = 2 ** src.shift;
+	const fdu = toFixed(du, scale);
+	const fdv = toFixed(dv, scale);
+	const hiU = src.width * scale;
+	const hiV = src.rows * scale;
+
+	// [xStart, xEnd, u, v] per row, u/v at xStart
+	const spans = new Int32Array(height * 4);
+	for (let y = 0; y < height; y++) {
+		const fu = toFixed(u0 + y * duRow, scale);
+		const fv = toFixed(v0 + y * dvRow, scale);
+		let [start, end] = clipSpan(fu, fdu, -scale, hiU, 0, width);
+		[start, end] = clipSpan(fv, fdv, -scale, hiV, start, end);
+		const s = y * 4;
+		spans[s] = start;
+		spans[s + 1] = end;
+		spans[s + 2] = fu + start * fdu;
+		spans[s + 3] = fv + start * fdv;
+	}
+
+	if (
+		src.channels === 1 &&
+		resampleAffineWasm(src, spans, fdu, fdv, dst, dstPitch, width, height)
+	) {
+		return;
+	}
+
+	const data = src.data;
+	const stride = src.stride;
+	const channels = src.channels;
+	const shift = src.shift;
+	const fracShift = shift - 8;
+	for (let y = 0; y < height; y++) {
+		const s = y * 4;
+		const end = spans[s + 1]!;
+		let u = spans[s + 2]!;
+		let v = spans[s + 3]!;
+		let out = y * dstPitch + spans[s]! * channels;
+		for (let x = spans[s]!; x < end; x++, u += fdu, v += fdv) {
+			const fx = (u >> fracShift) & 255;
+			const fy = (v >> fracShift) & 255;
+			const p = ((v >> shift) + 1) * stride + ((u >> shift) + 1) * channels;
+			if (channels === 1) {
+				const top = data[p]! * (256 - fx) + data[p + 1]! * fx;
+				const bot =
+					data[p + stride]! * (256 - fx) + data[p + stride + 1]! * fx;
+				dst[out++] = (top * (256 - fy) + bot * fy + 32768) >> 16;
+				continue;
+			}
+			for (let c = 0; c < channels; c++) {
+				const q = p + c;
+				const top = data[q]! * (256 - fx) + data[q + channels]! * fx;
+				const bot =
+					data[q + stride]! * (256 - fx) +
+					data[q + stride + channels]! * fx;
+				dst[out++] = (top * (256 - fy) + bot * fy + 32768) >> 16;
+			}
+		}
+	}
+}
+
+/**
+ * Perspective mapping: homogeneous coordinates (X, Y, W) are affine in the
+ * destination pixel (x, y) as `m[0] + x * m[3] + y * m[6]` (X), `m[1] + x *
+ * m[4] + y * m[7]` (Y), `m[2] + x * m[5] + y * m[8]` (W). The source position
+ * is (X / W - m[9], m[10] - Y / W).
+ */
+export type PerspectiveMapping = readonly [
+	number,
+	number,
+	number,
+	number,
+	number,
+	number,
+	number,
+	number,
+	number,
+	number,
+	number,
+];
+
+/** |W| below this is clamped, matching transformPoint3x3Safe */
+const MIN_W = 1e-6;
+
+/**
+ * Resample with a perspective mapping. `dst` must be zeroed; pixels whose
+ * footprint misses the source stay zero.
+ */
+export function resamplePerspective(
+	src: ResampleSource,
+	dst: Uint8Array,
+	dstPitch: number,
+	width: number,
+	height: number,
+	m: PerspectiveMapping,
+): void {
+	if (
+		src.channels === 1 &&
+		resamplePerspectiveWasm(src, m, dst, dstPitch, width, height)
+	) {
+		return;
+	}
+
+	const data = src.data;
+	const stride = src.stride;
+	const channels = src.channels;
+	const shift = src.shift;
+	const scale = 2 ** shift;
+	const fracShift = shift - 8;
+	const srcW = src.width;
+	const srcH = src.rows;
+	const [x0, y0, w0, dx, dy, dw, dxRow, dyRow, dwRow, bx, by] = m;
+
+	for (let y = 0; y < height; y++) {
+		const xr = x0 + y * dxRow;
+		const yr = y0 + y * dyRow;
+		const wr = w0 + y * dwRow;
+		let out = y * dstPitch;
+		for (let x = 0; x < width; x++, out += channels) {
+			let w = wr + x * dw;
+			if (Math.abs(w) < MIN_W) w = w < 0 ? -MIN_W : MIN_W;
+			const sx = (xr + x * dx) / w - bx;
+			const sy = by - (yr + x * dy) / w;
+			if (!(sx >= -1 && sx < srcW && sy >= -1 && sy < srcH)) continue;
+
+			const u = Math.floor(sx * scale);
+			const v = Math.floor(sy * scale);
+			const fx = (u >> fracShift) & 255;
+			const fy = (v >> fracShift) & 255;
+			const p = ((v >> shift) + 1) * stride + ((u >> shift) + 1) * channels;
+			for (let c = 0; c < channels; c++) {
+				const q = p + c;
+				const top = data[q]! * (256 - fx) + data[q + channels]! * fx;
+				const bot =
+					data[q + stride]! * (256 - fx) +
+					data[q + stride + channels]! * fx;
+				dst[out + c] = (top * (256 - fy) + bot * fy + 32768) >> 16;
+			}
+		}
+	}
+}
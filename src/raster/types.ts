@@ -38,6 +38,14 @@ export type HintTarget = "auto" | "light" | "normal";
 /** Scan converter used for path coverage. */
 export type RasterizerMode = "freetype" | "libass";
 
+/** Vector clip applied to a rasterized path (ASS \clip / \iclip) */
+export interface RasterClip {
+	/** Clip outline, in the same coordinate space as the clipped path */
+	path: GlyphPath;
+	/** Keep coverage outside the clip instead of inside (\iclip) */
+	inverse?: boolean;
+}
+
 /**
  * Options for rasterizing a glyph from a font
  */
@@ -158,6 +166,13 @@ export interface RasterizeOptions {
 	flipY?: boolean;
 	/** Scan converter. The default preserves the FreeType-style API output. */
 	rasterizer?: RasterizerMode;
+	/**
+	 * Coverage is multiplied by the clip's coverage (mulBitmaps), or the
+	 * clip's coverage is subtracted when inverse (subBitmaps). LCD and RGBA
+	 * clip per byte, Mono per bit. The libass rasterizer intersects it per
+	 * tile instead of rasterizing a full mask.
+	 */
+	clip?: RasterClip;
 	/**
 	 * Optional caller-owned output buffer. When provided and its length equals
 	 * the computed pitch*height for this rasterization, the returned bitmap
@@ -0,0 +1,23 @@
+// Base64 decoding for the embedded wasm kernels (fill-wasm, ass-wasm,
+// bitmap-wasm). Prefers the runtime's native decoders: Uint8Array.fromBase64
+// (Bun, current browsers), then Buffer (Node), which are several times faster
+// than atob plus a per-byte charCodeAt copy. That pair stays as the fallback;
+// a table-driven JS decoder measured slower than it under V8.
+
+type FromBase64 = (value: string) => Uint8Array<ArrayBuffer>;
+type BufferLike = {
+	from(value: string, encoding: "base64"): Uint8Array<ArrayBuffer>;
+};
+
+const NativeUint8Array = Uint8Array as unknown as { fromBase64?: FromBase64 };
+const NodeBuffer = (globalThis as { Buffer?: BufferLike }).Buffer;
+
+/** Decode standard base64 (as embedded by the kernels' build.sh) */
+export function decodeBase64(value: string): Uint8Array<ArrayBuffer> {
+	if (NativeUint8Array.fromBase64) return NativeUint8Array.fromBase64(value);
+	if (NodeBuffer) return NodeBuffer.from(value, "base64");
+	const binary = atob(value);
+	const bytes = new Uint8Array(binary.length);
+	for (let i = 0; i < binary.length; i++) bytes[i] = binary.charCodeAt(i);
+	return bytes;
+}
@@ -1,6 +1,8 @@
 import type { GlyphBuffer } from "../buffer/glyph-buffer.ts";
+import { OBJECT_BYTES, OwnerCache, SLOT_BYTES, WeakCache } from "../cache.ts";
 import type { Font } from "../font/font.ts";
 import type { Contour, GlyphPoint } from "../font/tables/glyf.ts";
+import { incrementCounter, instrumenting } from "../instrument.ts";
 import type { GlyphId } from "../types.ts";
 import {
 	type Matrix2D,
@@ -396,30 +398,41 @@ function contourToPathQuadratic(contour: Contour): PathCommand[] {
 /**
  * Get path commands for a glyph
  */
-// Path cache: WeakMap allows garbage collection when Font is no longer referenced
-const pathCache = new WeakMap<Font, Map<GlyphId, GlyphPath | null>>();
-const sizedPathCache = new WeakMap<Font, Map<string, GlyphPath | null>>();
+/** A path command object ({type, x, y, ...}) and its array slot */
+const COMMAND_BYTES = OBJECT_BYTES + 7 * SLOT_BYTES;
+
+function glyphPathBytes(path: GlyphPath | null): number {
+	if (!path) return SLOT_BYTES;
+	return 4 * OBJECT_BYTES + path.commands.length * COMMAND_BYTES;
+}
+
+// Path caches are held weakly per Font and accounted by the cache registry
+const pathCache = new OwnerCache<Font, GlyphId, GlyphPath | null>(
+	"render.path",
+	{ sizeOf: glyphPathBytes, priority: 1 },
+);
+const sizedPathCache = new OwnerCache<Font, string, GlyphPath | null>(
+	"render.sizedPath",
+	{ sizeOf: glyphPathBytes, priority: 0 },
+);
 
 /**
  * Get cached glyph path, computing and caching if not already cached
  */
 export function getGlyphPath(font: Font, glyphId: GlyphId): GlyphPath | null {
 	// Check cache first
-	let fontCache = pathCache.get(font);
-	if (fontCache) {
-		const cached = fontCache.get(glyphId);
-		if (cached !== undefined) return cached;
+	const cached = pathCache.get(font, glyphId);
+	if (cached !== undefined) {
+		if (instrumenting) incrementCounter("cache.path.hit");
+		return cached;
 	}
+	if (instrumenting) incrementCounter("cache.path.miss");
 
 	// Compute path
 	const result = font.getGlyphContoursAndBounds(glyphId);
 	if (!result) {
 		// Cache null result too to avoid recomputing
-		if (!fontCache) {
-			fontCache = new Map();
-			pathCache.set(font, fontCache);
-		}
-		fontCache.set(glyphId, null);
+		pathCache.set(font, glyphId, null);
 		return null;
 	}
 
@@ -432,11 +445,7 @@ export function getGlyphPath(font: Font, glyphId: GlyphId): GlyphPath | null {
 	const path: GlyphPath = { commands, bounds: result.bounds };
 
 	// Cache and return
-	if (!fontCache) {
-		fontCache = new Map();
-		pathCache.set(font, fontCache);
-	}
-	fontCache.set(glyphId, path);
+	pathCache.set(font, glyphId, path);
 	return path;
 }
 
@@ -456,16 +465,12 @@ export function getGlyphPathAtSize(
 ): GlyphPath | null {
 	if (!Number.isFinite(sizePx) || sizePx <= 0) return null;
 	const key = `${glyphId}|${sizePx}|${mode}`;
-	let fontCache = sizedPathCache.get(font);
-	if (fontCache?.has(key)) return fontCache.get(key) ?? null;
+	const cached = sizedPathCache.get(font, key);
+	if (cached !== undefined) return cached;
 
 	const result = font.getGlyphContoursAndBounds(glyphId);
 	if (!result) {
-		if (!fontCache) {
-			fontCache = new Map();
-			sizedPathCache.set(font, fontCache);
-		}
-		fontCache.set(key, null);
+		sizedPathCache.set(font, key, null);
 		return null;
 	}
 
@@ -501,11 +506,7 @@ export function getGlyphPathAtSize(
 					yMax: maxY / 64,
 				};
 	const path: GlyphPath = { commands, bounds };
-	if (!fontCache) {
-		fontCache = new Map();
-		sizedPathCache.set(font, fontCache);
-	}
-	fontCache.set(key, path);
+	sizedPathCache.set(font, key, path);
 	return path;
 }
 
@@ -517,7 +518,10 @@ export function getGlyphPathAtSize(
 export const SVG_SCALE = 10;
 
 // Cache for default SVG strings (flipY=true, scale=1)
-const svgCache = new WeakMap<GlyphPath, string>();
+const svgCache = new WeakCache<GlyphPath, string>("render.svg", {
+	sizeOf: (svg) => OBJECT_BYTES + svg.length,
+	priority: 0,
+});
 
 /**
  * Convert path commands to SVG path data string
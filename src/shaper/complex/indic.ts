@@ -1,4 +1,12 @@
+import { moveElement, rotateElements } from "../../buffer/glyph-buffer.ts";
 import type { GlyphInfo } from "../../types.ts";
+import {
+	compileSyllableMachine,
+	SyllableAction,
+	SyllableFlag,
+	SyllableScan,
+	scanSyllables,
+} from "./syllable-machine.ts";
 
 /**
  * Indic syllable categories based on Unicode and OpenType spec
@@ -254,6 +262,16 @@ export function getIndicCategory(cp: number): IndicCategory {
 	return IndicCategory.X;
 }
 
+/**
+ * Indic syllable types reported by the syllable machine
+ */
+export enum IndicSyllableType {
+	Consonant = 0, // Consonant-based syllable
+	Vowel = 1, // Independent vowel syllable
+	Broken = 2, // Starts with a dependent sign
+	NonIndic = 3, // Non-Indic character (plus any trailing signs)
+}
+
 /**
  * Syllable structure for Indic scripts
  */
@@ -264,154 +282,142 @@ interface Syllable {
 	baseConsonant: number;
 }
 
+/** Category byte used for missing glyph slots */
+const INDIC_SKIP = 19;
+
+// Syllable machine states (0 = dead, 1 = start)
+const S_LOOP = 2; // Consonant loop, no consonant yet (start or after reph)
+const S_CONS = 3; // After consonant
+const S_RA = 4; // After Ra at syllable start
+const S_REPH = 5; // After Ra + Halant at syllable start
+const S_NUKTA = 6; // After consonant + nukta
+const S_HALANT = 7; // After consonant + halant
+const S_CLUSTER = 8; // Consonant loop after a halant
+const S_MATRA = 9; // Trailing matras and modifiers
+const S_MATRA_V = 10;
+const S_MATRA_B = 11;
+const S_MATRA_X = 12;
+const S_FINAL = 13; // After final halant
+
+const C = IndicCategory;
+
 /**
- * Find syllable boundaries in the glyph buffer
+ * Indic syllable grammar:
+ *   [Ra H] (C [N] [H [ZWJ|ZWNJ]])* (C [N] | V)? (M|SM|A|N)* [H]
  */
-export function findSyllables(infos: GlyphInfo[]): Syllable[] {
-	const syllables: Syllable[] = [];
-	const n = infos.length;
-	if (n === 0) return syllables;
-
-	let start = 0;
-
-	while (start < n) {
-		const syllable = parseSyllable(infos, start);
-		syllables.push(syllable);
-		start = syllable.end;
-	}
-
-	return syllables;
-}
+const indicMachine = compileSyllableMachine(
+	20,
+	[
+		{},
+		{ like: S_LOOP, on: [[[C.Ra], S_RA]] },
+		{
+			on: [
+				[[C.C, C.Ra], S_CONS],
+				[[C.V], S_MATRA_V],
+				[[C.N, INDIC_SKIP], S_LOOP],
+				[[C.H, C.M, C.SM, C.A, C.VD], S_MATRA_B],
+				[
+					[
+						C.X,
+						C.ZWNJ,
+						C.ZWJ,
+						C.Placeholder,
+						C.Dotted_Circle,
+						C.RS,
+						C.Coeng,
+						C.CM,
+						C.Symbol,
+						C.CS,
+					],
+					S_MATRA_X,
+				],
+			],
+			type: IndicSyllableType.Broken,
+		},
+		{
+			like: S_MATRA,
+			on: [
+				[[C.N], S_NUKTA],
+				[[C.H], S_HALANT],
+			],
+			action: SyllableAction.SetBase,
+			type: IndicSyllableType.Consonant,
+		},
+		{
+			like: S_CONS,
+			on: [[[C.H], S_REPH]],
+			action: SyllableAction.SetBase,
+			type: IndicSyllableType.Consonant,
+		},
+		{
+			like: S_LOOP,
+			action: SyllableAction.ClearBase | SyllableAction.Reph,
+		},
+		{ like: S_MATRA, on: [[[C.H], S_HALANT]] },
+		{ like: S_CLUSTER, on: [[[C.ZWJ, C.ZWNJ], S_CLUSTER]] },
+		{
+			like: S_MATRA,
+			on: [
+				[[C.C, C.Ra], S_CONS],
+				[[C.V], S_MATRA],
+				[[C.N, INDIC_SKIP], S_CLUSTER],
+			],
+		},
+		{
+			on: [
+				[[C.M, C.SM, C.A, C.N, INDIC_SKIP], S_MATRA],
+				[[C.H], S_FINAL],
+			],
+		},
+		{ like: S_MATRA, type: IndicSyllableType.Vowel },
+		{ like: S_MATRA, type: IndicSyllableType.Broken },
+		{ like: S_MATRA, type: IndicSyllableType.NonIndic },
+		{},
+	],
+	IndicSyllableType.NonIndic,
+);
+
+/** Shared scan scratch (shaping is synchronous, so one is enough) */
+const indicScan = new SyllableScan();
 
 /**
- * Parse a single syllable starting at the given position
+ * Categorize `infos` and run the syllable machine over them.
+ * Results are left in the shared scan; `baseConsonant` falls back to the
+ * syllable start when the machine did not record a base.
  */
-function parseSyllable(infos: GlyphInfo[], start: number): Syllable {
+function scanIndicSyllables(infos: GlyphInfo[]): SyllableScan {
 	const n = infos.length;
-	let pos = start;
-
-	// Check for initial consonant cluster with halant
-	let baseConsonant = -1;
-	let hasReph = false;
-
-	// Look for Ra + H at the start (potential Reph)
-	if (pos + 1 < n) {
-		const info1 = infos[pos];
-		const info2 = infos[pos + 1];
-		if (info1 && info2) {
-			const cat1 = getIndicCategory(info1.codepoint ?? 0);
-			const cat2 = getIndicCategory(info2.codepoint ?? 0);
-			if (cat1 === IndicCategory.Ra && cat2 === IndicCategory.H) {
-				hasReph = true;
-				pos += 2;
-			}
-		}
-	}
-
-	// Find base consonant (last consonant before matras/end)
-	let lastConsonant = -1;
-	while (pos < n) {
-		const info = infos[pos];
-		if (!info) {
-			pos++;
-			continue;
-		}
-		const cp = info.codepoint ?? 0;
-		const cat = getIndicCategory(cp);
-
-		if (cat === IndicCategory.C || cat === IndicCategory.Ra) {
-			lastConsonant = pos;
-			pos++;
-			// Check for nukta
-			if (pos < n) {
-				const nextInfo = infos[pos];
-				if (
-					nextInfo &&
-					getIndicCategory(nextInfo.codepoint ?? 0) === IndicCategory.N
-				) {
-					pos++;
-				}
-			}
-			// Check for halant (may continue consonant cluster)
-			if (pos < n) {
-				const hInfo = infos[pos];
-				if (
-					hInfo &&
-					getIndicCategory(hInfo.codepoint ?? 0) === IndicCategory.H
-				) {
-					pos++;
-					// After halant, might have ZWJ/ZWNJ or another consonant
-					if (pos < n) {
-						const afterH = infos[pos];
-						if (afterH) {
-							const nextCat = getIndicCategory(afterH.codepoint ?? 0);
-							if (
-								nextCat === IndicCategory.ZWJ ||
-								nextCat === IndicCategory.ZWNJ
-							) {
-								pos++;
-							}
-						}
-					}
-					continue; // Look for more consonants
-				}
-			}
-			break;
-		} else if (cat === IndicCategory.V) {
-			// Independent vowel as syllable base
-			pos++;
-			break;
-		} else if (cat === IndicCategory.N) {
-			// Standalone nukta - skip
-			pos++;
-		} else {
-			// Non-syllable character, end here
-			if (lastConsonant === -1) {
-				pos++;
-			}
-			break;
-		}
+	const scan = indicScan;
+	scan.reserve(n);
+	const cats = scan.categories;
+	for (let i = 0; i < n; i++) {
+		const info = infos[i];
+		cats[i] = info ? getIndicCategory(info.codepoint ?? 0) : INDIC_SKIP;
 	}
-
-	baseConsonant = lastConsonant >= 0 ? lastConsonant : start;
-
-	// Consume matras, anusvara, visarga
-	while (pos < n) {
-		const info = infos[pos];
-		if (!info) {
-			pos++;
-			continue;
-		}
-		const cp = info.codepoint ?? 0;
-		const cat = getIndicCategory(cp);
-
-		if (
-			cat === IndicCategory.M ||
-			cat === IndicCategory.SM ||
-			cat === IndicCategory.A ||
-			cat === IndicCategory.N
-		) {
-			pos++;
-		} else if (cat === IndicCategory.H) {
-			// Halant at end (final form)
-			pos++;
-			break;
-		} else {
-			break;
-		}
+	const count = scanSyllables(indicMachine, scan, n);
+	const bases = scan.bases;
+	const starts = scan.starts;
+	for (let s = 0; s < count; s++) {
+		if (bases[s]! < 0) bases[s] = starts[s]!;
 	}
+	return scan;
+}
 
-	// Ensure we advance at least one position
-	if (pos === start) {
-		pos = start + 1;
+/**
+ * Find syllable boundaries in the glyph buffer
+ */
+export function findSyllables(infos: GlyphInfo[]): Syllable[] {
+	const scan = scanIndicSyllables(infos);
+	const syllables: Syllable[] = [];
+	for (let s = 0; s < scan.count; s++) {
+		syllables.push({
+			start: scan.starts[s]!,
+			end: scan.ends[s]!,
+			hasReph: (scan.flags[s]! & SyllableFlag.Reph) !== 0,
+			baseConsonant: scan.bases[s]!,
+		});
 	}
-
-	return {
-		start,
-		end: pos,
-		hasReph,
-		baseConsonant,
-	};
+	return syllables;
 }
 
 /**
@@ -547,18 +553,22 @@ export function getMatraPosition(cp: number): MatraPosition {
  * Set up masks and syllable indices for Indic shaping
  */
 export function setupIndicMasks(infos: GlyphInfo[]): void {
-	const syllables = findSyllables(infos);
-
-	for (let i = 0; i < syllables.length; i++) {
-		const syllable = syllables[i]!;
+	const scan = scanIndicSyllables(infos);
+	const cats = scan.categories;
+
+	for (let i = 0; i < scan.count; i++) {
+		const start = scan.starts[i]!;
+		const end = scan.ends[i]!;
+		const baseConsonant = scan.bases[i]!;
+		const hasReph = (scan.flags[i]! & SyllableFlag.Reph) !== 0;
 		// Mark syllable boundaries in mask
-		for (let j = syllable.start; j < syllable.end; j++) {
+		for (let j = start; j < end; j++) {
 			const info = infos[j];
 			if (info) {
 				// Store syllable index in upper bits
 				info.mask = (info.mask & 0x0000ffff) | ((i & 0xffff) << 16);
 
-				const cat = getIndicCategory(info.codepoint);
+				const cat = cats[j]!;
 
 				// Nukta - always apply nukt feature
 				if (cat === IndicCategory.N) {
@@ -568,10 +578,10 @@ export function setupIndicMasks(infos: GlyphInfo[]): void {
 				// Halant handling
 				if (cat === IndicCategory.H) {
 					// Check position relative to base
-					if (j < syllable.baseConsonant) {
+					if (j < baseConsonant) {
 						// Pre-base halant - half forms
 						info.mask |= IndicFeatureMask.half;
-					} else if (j > syllable.baseConsonant) {
+					} else if (j > baseConsonant) {
 						// Post-base halant - below/post forms
 						info.mask |= IndicFeatureMask.blwf | IndicFeatureMask.pstf;
 					}
@@ -579,10 +589,10 @@ export function setupIndicMasks(infos: GlyphInfo[]): void {
 
 				// Consonant handling
 				if (cat === IndicCategory.C || cat === IndicCategory.Ra) {
-					if (j < syllable.baseConsonant) {
+					if (j < baseConsonant) {
 						// Pre-base consonant
 						info.mask |= IndicFeatureMask.half | IndicFeatureMask.cjct;
-					} else if (j > syllable.baseConsonant) {
+					} else if (j > baseConsonant) {
 						// Post-base consonant
 						info.mask |=
 							IndicFeatureMask.blwf |
@@ -592,7 +602,7 @@ export function setupIndicMasks(infos: GlyphInfo[]): void {
 				}
 
 				// Reph handling
-				if (syllable.hasReph && j < syllable.start + 2) {
+				if (hasReph && j < start + 2) {
 					info.mask |= IndicFeatureMask.rphf;
 				}
 
@@ -631,49 +641,44 @@ export function setupIndicMasks(infos: GlyphInfo[]): void {
  * - Moving reph to its final position
  */
 export function reorderIndic(infos: GlyphInfo[]): void {
-	const syllables = findSyllables(infos);
-
-	for (let i = 0; i < syllables.length; i++) {
-		const syllable = syllables[i]!;
-		reorderSyllable(infos, syllable);
+	const scan = scanIndicSyllables(infos);
+
+	for (let i = 0; i < scan.count; i++) {
+		reorderSyllable(
+			infos,
+			scan.categories,
+			scan.starts[i]!,
+			scan.ends[i]!,
+			scan.bases[i]!,
+			(scan.flags[i]! & SyllableFlag.Reph) !== 0,
+		);
 	}
 }
 
 /**
  * Reorder a single syllable
  */
-function reorderSyllable(infos: GlyphInfo[], syllable: Syllable): void {
-	const { start, end, baseConsonant, hasReph } = syllable;
-
-	// Collect pre-base matras that need to move
-	const preBaseMatras: { index: number; info: GlyphInfo }[] = [];
-
+function reorderSyllable(
+	infos: GlyphInfo[],
+	cats: Uint8Array,
+	start: number,
+	end: number,
+	baseConsonant: number,
+	hasReph: boolean,
+): void {
+	// Move pre-base matras before the base (or before reph if present),
+	// keeping their relative order. Each move is a rotation bounded by the
+	// syllable, and glyphs after `i` keep their indices.
+	let insertPos = hasReph ? start + 2 : start;
 	for (let i = baseConsonant + 1; i < end; i++) {
 		const info = infos[i];
 		if (!info) continue;
 
-		const cat = getIndicCategory(info.codepoint);
-		if (cat === IndicCategory.M) {
-			const matraPos = getMatraPosition(info.codepoint);
-			if (matraPos === MatraPosition.PreBase) {
-				preBaseMatras.push({ index: i, info });
-			}
-		}
-	}
-
-	// Move pre-base matras before the base (or before reph if present)
-	if (preBaseMatras.length > 0) {
-		// Sort by original index descending to process from right to left
-		preBaseMatras.sort((a, b) => b.index - a.index);
-
-		for (let i = 0; i < preBaseMatras.length; i++) {
-			const { index, info } = preBaseMatras[i]!;
-			// Remove from current position
-			infos.splice(index, 1);
-
-			// Insert before base (accounting for reph)
-			const insertPos = hasReph ? start + 2 : start;
-			infos.splice(insertPos, 0, info);
+		if (
+			cats[i] === IndicCategory.M &&
+			getMatraPosition(info.codepoint) === MatraPosition.PreBase
+		) {
+			moveElement(infos, i, insertPos++);
 		}
 	}
 
@@ -704,14 +709,10 @@ function reorderSyllable(infos: GlyphInfo[], syllable: Syllable): void {
 				}
 			}
 
-			// Only move if target is different from current position
+			// Only move if target is different from current position:
+			// rotate Ra + Halant past [start + 2, rephTarget]
 			if (rephTarget > start + 1) {
-				// Remove Ra + Halant from start
-				infos.splice(start, 2);
-
-				// Insert at new position (adjusted for removal)
-				const adjustedTarget = rephTarget - 2;
-				infos.splice(adjustedTarget + 1, 0, rephRa, rephH);
+				rotateElements(infos, start, start + 2, rephTarget + 1);
 			}
 		}
 	}
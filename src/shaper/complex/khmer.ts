@@ -1,4 +1,11 @@
+import { moveElement } from "../../buffer/glyph-buffer.ts";
 import type { GlyphInfo } from "../../types.ts";
+import {
+	compileSyllableMachine,
+	SyllableAction,
+	SyllableScan,
+	scanSyllables,
+} from "./syllable-machine.ts";
 
 /**
  * Khmer shaper
@@ -91,108 +98,164 @@ export function isKhmer(cp: number): boolean {
 }
 
 /**
- * Setup Khmer masks for feature application
+ * Khmer syllable types reported by the syllable machine
  */
-export function setupKhmerMasks(infos: GlyphInfo[]): void {
-	let i = 0;
-
-	while (i < infos.length) {
-		const info = infos[i];
-		if (!info) {
-			i++;
-			continue;
-		}
-		const cat = getKhmerCategory(info.codepoint);
+export enum KhmerSyllableType {
+	Consonant = 0, // Starts with a consonant (the base)
+	Broken = 1, // Starts with a dependent sign
+	NonKhmer = 2, // Single non-Khmer character
+}
 
-		if (cat === KhmerCategory.Other) {
-			i++;
-			continue;
-		}
+/** Category byte used for missing glyph slots */
+const KHMER_SKIP = 10;
+
+// Syllable machine states (0 = dead, 1 = start)
+const S_OTHER = 2; // Non-Khmer character (always a syllable of its own)
+const S_BODY = 3; // Inside a syllable
+const S_BODY_BASE = 4;
+const S_BODY_BROKEN = 5;
+const S_COENG = 6; // After coeng: a consonant becomes a subscript
+const S_COENG_START = 7; // Syllable starting with coeng
+const S_BODY_LATE_BASE = 8; // First consonant of a syllable without a base
+
+const K = KhmerCategory;
+
+/** Categories that never start a new syllable */
+const KHMER_MARKS = [
+	K.IndependentVowel,
+	K.DependentVowel,
+	K.Register,
+	K.Robat,
+	K.Sign,
+	K.Anusvara,
+	K.Visarga,
+];
 
-		// Find syllable extent
-		const _syllableStart = i;
-		let _base = -1;
+/**
+ * Khmer syllable grammar: a run of Khmer characters where a consonant
+ * starts a new syllable unless it follows a coeng.
+ */
+const khmerMachine = compileSyllableMachine(
+	11,
+	[
+		{},
+		{
+			on: [
+				[KHMER_MARKS, S_BODY_BROKEN],
+				[[K.Other, KHMER_SKIP], S_OTHER],
+				[[K.Consonant], S_BODY_BASE],
+				[[K.Coeng], S_COENG_START],
+			],
+		},
+		{},
+		{
+			on: [
+				[KHMER_MARKS, S_BODY],
+				[[KHMER_SKIP], S_BODY],
+				[[K.Coeng], S_COENG],
+			],
+		},
+		{
+			like: S_BODY,
+			action: SyllableAction.SetBase,
+			type: KhmerSyllableType.Consonant,
+		},
+		{ like: S_BODY, type: KhmerSyllableType.Broken },
+		{ like: S_BODY, on: [[[K.Consonant], S_BODY_LATE_BASE]] },
+		{
+			like: S_COENG,
+			type: KhmerSyllableType.Broken,
+		},
+		{ like: S_BODY, action: SyllableAction.SetFirstBase },
+	],
+	KhmerSyllableType.NonKhmer,
+);
+
+/** Shared scan scratch (shaping is synchronous, so one is enough) */
+const khmerScan = new SyllableScan();
 
-		// Find base consonant
-		if (cat === KhmerCategory.Consonant) {
-			_base = i;
-		}
+/**
+ * Categorize `infos` and run the Khmer syllable machine over them
+ */
+function scanKhmerSyllables(infos: GlyphInfo[]): SyllableScan {
+	const n = infos.length;
+	const scan = khmerScan;
+	scan.reserve(n);
+	const cats = scan.categories;
+	for (let i = 0; i < n; i++) {
+		const info = infos[i];
+		cats[i] = info ? getKhmerCategory(info.codepoint) : KHMER_SKIP;
+	}
+	scanSyllables(khmerMachine, scan, n);
+	return scan;
+}
 
-		// Process syllable
-		let j = i + 1;
-		while (j < infos.length) {
-			const nextInfo = infos[j];
-			if (!nextInfo) {
-				j++;
-				continue;
-			}
-			const nextCat = getKhmerCategory(nextInfo.codepoint);
-
-			if (nextCat === KhmerCategory.Other) break;
-			if (nextCat === KhmerCategory.Consonant) {
-				// Check if followed by coeng
-				const prevInfo = infos[j - 1];
-				if (
-					prevInfo &&
-					getKhmerCategory(prevInfo.codepoint) !== KhmerCategory.Coeng
-				) {
-					break;
+/**
+ * Setup Khmer masks for feature application
+ */
+export function setupKhmerMasks(infos: GlyphInfo[]): void {
+	const scan = scanKhmerSyllables(infos);
+	const cats = scan.categories;
+
+	for (let s = 0; s < scan.count; s++) {
+		if (scan.types[s] === KhmerSyllableType.NonKhmer) continue;
+		const start = scan.starts[s]!;
+		const end = scan.ends[s]!;
+
+		// The first character of a syllable keeps its mask
+		for (let j = start + 1; j < end; j++) {
+			const info = infos[j];
+			if (!info) continue;
+			const cat = cats[j]!;
+
+			// Coeng + consonant = subscript consonant, marked for below-base forms
+			if (cat === KhmerCategory.Coeng) {
+				if (j + 1 < end && cats[j + 1] === KhmerCategory.Consonant) {
+					info.mask |= KhmerFeatureMask.blwf;
 				}
+				continue;
 			}
-
-			// Coeng + consonant = subscript consonant
-			if (nextCat === KhmerCategory.Coeng && j + 1 < infos.length) {
-				const afterCoeng = infos[j + 1];
-				if (
-					afterCoeng &&
-					getKhmerCategory(afterCoeng.codepoint) === KhmerCategory.Consonant
-				) {
-					// Mark for below-base forms
-					nextInfo.mask |= KhmerFeatureMask.blwf;
-					afterCoeng.mask |= KhmerFeatureMask.blwf;
-					j += 2;
-					continue;
+			if (cat === KhmerCategory.Consonant) {
+				if (j - 1 > start && cats[j - 1] === KhmerCategory.Coeng) {
+					info.mask |= KhmerFeatureMask.blwf;
 				}
+				continue;
 			}
 
 			// Dependent vowels
-			if (nextCat === KhmerCategory.DependentVowel) {
+			if (cat === KhmerCategory.DependentVowel) {
 				// Pre-base vowels: ◌េ ◌ែ ◌ៃ
-				if (nextInfo.codepoint >= 0x17c1 && nextInfo.codepoint <= 0x17c3) {
-					nextInfo.mask |= KhmerFeatureMask.pref;
+				if (info.codepoint >= 0x17c1 && info.codepoint <= 0x17c3) {
+					info.mask |= KhmerFeatureMask.pref;
 				}
 				// Above-base vowels
-				else if (nextInfo.codepoint >= 0x17b7 && nextInfo.codepoint <= 0x17ba) {
-					nextInfo.mask |= KhmerFeatureMask.abvf;
+				else if (info.codepoint >= 0x17b7 && info.codepoint <= 0x17ba) {
+					info.mask |= KhmerFeatureMask.abvf;
 				}
 				// Below-base vowels
 				else if (
-					nextInfo.codepoint === 0x17bb ||
-					nextInfo.codepoint === 0x17bc ||
-					nextInfo.codepoint === 0x17bd
+					info.codepoint === 0x17bb ||
+					info.codepoint === 0x17bc ||
+					info.codepoint === 0x17bd
 				) {
-					nextInfo.mask |= KhmerFeatureMask.blwf;
+					info.mask |= KhmerFeatureMask.blwf;
 				}
 				// Post-base vowels
 				else {
-					nextInfo.mask |= KhmerFeatureMask.pstf;
+					info.mask |= KhmerFeatureMask.pstf;
 				}
 			}
 
 			// Register shifters (above)
-			if (nextCat === KhmerCategory.Register) {
-				nextInfo.mask |= KhmerFeatureMask.abvs;
+			if (cat === KhmerCategory.Register) {
+				info.mask |= KhmerFeatureMask.abvs;
 			}
 
 			// Robat (above)
-			if (nextCat === KhmerCategory.Robat) {
-				nextInfo.mask |= KhmerFeatureMask.abvs;
+			if (cat === KhmerCategory.Robat) {
+				info.mask |= KhmerFeatureMask.abvs;
 			}
-
-			j++;
 		}
-
-		i = j;
 	}
 }
 
@@ -205,51 +268,25 @@ export function reorderKhmer(infos: GlyphInfo[]): void {
 
 	while (i < infos.length) {
 		const info = infos[i];
-		if (!info) {
-			i++;
-			continue;
-		}
-		const cat = getKhmerCategory(info.codepoint);
-
-		if (cat !== KhmerCategory.Consonant) {
+		if (!info || getKhmerCategory(info.codepoint) !== KhmerCategory.Consonant) {
 			i++;
 			continue;
 		}
 
-		// Found base consonant, look for pre-base vowels after it
+		// Found base consonant; skip coeng + consonant pairs after it
 		const base = i;
 		let j = i + 1;
-
-		// Skip coeng sequences
-		while (j < infos.length) {
-			const jInfo = infos[j];
-			if (!jInfo) break;
-			const jCat = getKhmerCategory(jInfo.codepoint);
-			if (jCat === KhmerCategory.Coeng && j + 1 < infos.length) {
-				j += 2; // Skip coeng + consonant
-			} else {
-				break;
-			}
+		while (
+			j + 1 < infos.length &&
+			infos[j] &&
+			getKhmerCategory(infos[j]!.codepoint) === KhmerCategory.Coeng
+		) {
+			j += 2;
 		}
 
-		// Check for pre-base vowel
-		if (j < infos.length) {
-			const jInfo = infos[j];
-			if (jInfo) {
-				const cp = jInfo.codepoint;
-				if (cp >= 0x17c1 && cp <= 0x17c3) {
-					// Move pre-base vowel before base
-					const vowel = jInfo;
-					for (let k = j; k > base; k--) {
-						const prevInfo = infos[k - 1];
-						if (prevInfo) {
-							infos[k] = prevInfo;
-						}
-					}
-					infos[base] = vowel;
-				}
-			}
-		}
+		// A pre-base vowel right after them moves in front of the base
+		const cp = infos[j]?.codepoint ?? 0;
+		if (cp >= 0x17c1 && cp <= 0x17c3) moveElement(infos, j, base);
 
 		i = j + 1;
 	}
@@ -1,4 +1,11 @@
+import { moveElement } from "../../buffer/glyph-buffer.ts";
 import type { GlyphInfo } from "../../types.ts";
+import {
+	compileSyllableMachine,
+	SyllableAction,
+	SyllableScan,
+	scanSyllables,
+} from "./syllable-machine.ts";
 
 /**
  * Myanmar shaper
@@ -136,132 +143,183 @@ export function isMyanmar(cp: number): boolean {
 }
 
 /**
- * Setup Myanmar masks for feature application
+ * Myanmar syllable types reported by the syllable machine
  */
-export function setupMyanmarMasks(infos: GlyphInfo[]): void {
-	let i = 0;
+export enum MyanmarSyllableType {
+	Consonant = 0, // Starts with a consonant (the base)
+	Broken = 1, // Starts with a dependent sign
+	NonMyanmar = 2, // Single non-Myanmar character
+}
 
-	while (i < infos.length) {
-		const info = infos[i];
-		if (!info) {
-			i++;
-			continue;
-		}
-		const cat = getMyanmarCategory(info.codepoint);
+/** Category byte used for missing glyph slots */
+const MYANMAR_SKIP = 11;
+
+// Syllable machine states (0 = dead, 1 = start)
+const S_OTHER = 2; // Non-Myanmar character (always a syllable of its own)
+const S_BODY = 3; // Inside a syllable
+const S_BODY_BASE = 4;
+const S_BODY_BROKEN = 5;
+const S_ASAT = 6; // After asat: a consonant stacks instead of starting anew
+const S_ASAT_START = 7; // Syllable starting with asat
+const S_STACKED = 8; // After asat + consonant: one more consonant may join
+const S_BODY_LATE_BASE = 9; // First consonant of a syllable starting with asat
+
+const M = MyanmarCategory;
+
+/** Categories that never start a new syllable */
+const MYANMAR_MARKS = [
+	M.IndependentVowel,
+	M.DependentVowel,
+	M.Medial,
+	M.Anusvara,
+	M.Visarga,
+	M.Sign,
+	M.Number,
+	M.Placeholder,
+];
 
-		if (cat === MyanmarCategory.Other) {
-			i++;
-			continue;
-		}
+/**
+ * Myanmar syllable grammar: a run of Myanmar characters where a consonant
+ * starts a new syllable unless it follows an asat.
+ */
+const myanmarMachine = compileSyllableMachine(
+	12,
+	[
+		{},
+		{
+			on: [
+				[MYANMAR_MARKS, S_BODY_BROKEN],
+				[[M.Other, MYANMAR_SKIP], S_OTHER],
+				[[M.Consonant], S_BODY_BASE],
+				[[M.Asat], S_ASAT_START],
+			],
+		},
+		{},
+		{
+			on: [
+				[MYANMAR_MARKS, S_BODY],
+				[[MYANMAR_SKIP], S_BODY],
+				[[M.Asat], S_ASAT],
+			],
+		},
+		{
+			like: S_BODY,
+			action: SyllableAction.SetBase,
+			type: MyanmarSyllableType.Consonant,
+		},
+		{ like: S_BODY, type: MyanmarSyllableType.Broken },
+		{ like: S_BODY, on: [[[M.Consonant], S_STACKED]] },
+		{
+			like: S_BODY,
+			on: [[[M.Consonant], S_BODY_LATE_BASE]],
+			type: MyanmarSyllableType.Broken,
+		},
+		{
+			like: S_BODY,
+			on: [[[M.Consonant], S_BODY]],
+			action: SyllableAction.SetFirstBase,
+		},
+		{ like: S_BODY, action: SyllableAction.SetFirstBase },
+	],
+	MyanmarSyllableType.NonMyanmar,
+);
+
+/** Shared scan scratch (shaping is synchronous, so one is enough) */
+const myanmarScan = new SyllableScan();
 
-		// Find syllable extent
-		let _base = -1;
-		let hasAsat = false;
+/**
+ * Categorize `infos` and run the Myanmar syllable machine over them
+ */
+function scanMyanmarSyllables(infos: GlyphInfo[]): SyllableScan {
+	const n = infos.length;
+	const scan = myanmarScan;
+	scan.reserve(n);
+	const cats = scan.categories;
+	for (let i = 0; i < n; i++) {
+		const info = infos[i];
+		cats[i] = info ? getMyanmarCategory(info.codepoint) : MYANMAR_SKIP;
+	}
+	scanSyllables(myanmarMachine, scan, n);
+	return scan;
+}
 
-		if (cat === MyanmarCategory.Consonant) {
-			_base = i;
-		}
+/**
+ * Setup Myanmar masks for feature application
+ */
+export function setupMyanmarMasks(infos: GlyphInfo[]): void {
+	const scan = scanMyanmarSyllables(infos);
+	const cats = scan.categories;
 
-		let j = i + 1;
-		while (j < infos.length) {
-			const nextInfo = infos[j];
-			if (!nextInfo) {
-				j++;
-				continue;
-			}
-			const nextCat = getMyanmarCategory(nextInfo.codepoint);
+	for (let s = 0; s < scan.count; s++) {
+		if (scan.types[s] === MyanmarSyllableType.NonMyanmar) continue;
+		const start = scan.starts[s]!;
+		const end = scan.ends[s]!;
 
-			if (nextCat === MyanmarCategory.Other) break;
+		// The first character of a syllable keeps its mask
+		for (let j = start + 1; j < end; j++) {
+			const info = infos[j];
+			if (!info) continue;
+			const cat = cats[j]!;
 
 			// Asat (killer) marks a stacked consonant
-			if (nextCat === MyanmarCategory.Asat) {
-				hasAsat = true;
-				nextInfo.mask |= MyanmarFeatureMask.blwf;
-
-				// Check for following consonant (stacking)
-				if (j + 1 < infos.length) {
-					const afterAsat = infos[j + 1];
-					if (
-						afterAsat &&
-						getMyanmarCategory(afterAsat.codepoint) ===
-							MyanmarCategory.Consonant
-					) {
-						afterAsat.mask |= MyanmarFeatureMask.blwf;
-						j += 2;
-						continue;
-					}
+			if (cat === MyanmarCategory.Asat) {
+				info.mask |= MyanmarFeatureMask.blwf;
+				continue;
+			}
+			if (cat === MyanmarCategory.Consonant) {
+				if (j - 1 > start && cats[j - 1] === MyanmarCategory.Asat) {
+					info.mask |= MyanmarFeatureMask.blwf;
 				}
+				continue;
 			}
 
 			// Medials
-			if (nextCat === MyanmarCategory.Medial) {
-				const cp = nextInfo.codepoint;
+			if (cat === MyanmarCategory.Medial) {
+				const cp = info.codepoint;
 				// ျ (ya) - pre-base
 				if (cp === 0x103b) {
-					nextInfo.mask |= MyanmarFeatureMask.pref;
+					info.mask |= MyanmarFeatureMask.pref;
 				}
 				// ြ (ra) - pre-base
 				else if (cp === 0x103c) {
-					nextInfo.mask |= MyanmarFeatureMask.pref;
+					info.mask |= MyanmarFeatureMask.pref;
 				}
 				// ွ (wa) - below-base
 				else if (cp === 0x103d) {
-					nextInfo.mask |= MyanmarFeatureMask.blwf;
+					info.mask |= MyanmarFeatureMask.blwf;
 				}
 				// ှ (ha) - below-base
 				else if (cp === 0x103e) {
-					nextInfo.mask |= MyanmarFeatureMask.blwf;
+					info.mask |= MyanmarFeatureMask.blwf;
 				}
 			}
 
 			// Dependent vowels
-			if (nextCat === MyanmarCategory.DependentVowel) {
-				const cp = nextInfo.codepoint;
+			if (cat === MyanmarCategory.DependentVowel) {
+				const cp = info.codepoint;
 				// Pre-base vowels: ေ
 				if (cp === 0x1031) {
-					nextInfo.mask |= MyanmarFeatureMask.pref;
+					info.mask |= MyanmarFeatureMask.pref;
 				}
 				// Above-base vowels
 				else if (cp === 0x102d || cp === 0x102e || cp === 0x1032) {
-					nextInfo.mask |= MyanmarFeatureMask.abvs;
+					info.mask |= MyanmarFeatureMask.abvs;
 				}
 				// Below-base vowels
 				else if (cp === 0x102f || cp === 0x1030) {
-					nextInfo.mask |= MyanmarFeatureMask.blws;
+					info.mask |= MyanmarFeatureMask.blws;
 				}
 				// Post-base vowels
 				else {
-					nextInfo.mask |= MyanmarFeatureMask.psts;
+					info.mask |= MyanmarFeatureMask.psts;
 				}
 			}
 
 			// Signs above
-			if (
-				nextCat === MyanmarCategory.Anusvara ||
-				nextCat === MyanmarCategory.Sign
-			) {
-				nextInfo.mask |= MyanmarFeatureMask.abvs;
-			}
-
-			// New syllable on consonant without asat
-			if (nextCat === MyanmarCategory.Consonant && !hasAsat) {
-				// Check if previous was asat
-				if (j > 0) {
-					const prevInfo = infos[j - 1];
-					if (prevInfo) {
-						const prevCat = getMyanmarCategory(prevInfo.codepoint);
-						if (prevCat !== MyanmarCategory.Asat) {
-							break;
-						}
-					}
-				}
+			if (cat === MyanmarCategory.Anusvara || cat === MyanmarCategory.Sign) {
+				info.mask |= MyanmarFeatureMask.abvs;
 			}
-
-			hasAsat = false;
-			j++;
 		}
-
-		i = j;
 	}
 }
 
@@ -274,62 +332,31 @@ export function reorderMyanmar(infos: GlyphInfo[]): void {
 
 	while (i < infos.length) {
 		const info = infos[i];
-		if (!info) {
-			i++;
-			continue;
-		}
-		const cat = getMyanmarCategory(info.codepoint);
-
-		if (cat !== MyanmarCategory.Consonant) {
+		if (
+			!info ||
+			getMyanmarCategory(info.codepoint) !== MyanmarCategory.Consonant
+		) {
 			i++;
 			continue;
 		}
 
-		// Found base consonant
-		const base = i;
-		const preBase: GlyphInfo[] = [];
-
-		// Collect pre-base elements that follow base
-		let j = i + 1;
-		while (j < infos.length) {
+		// Found base consonant; move the pre-base elements that follow it,
+		// up to the next consonant, in front of it in order
+		let insert = i;
+		for (let j = i + 1; j < infos.length; j++) {
 			const jInfo = infos[j];
-			if (!jInfo) {
-				j++;
-				continue;
-			}
-			const jCat = getMyanmarCategory(jInfo.codepoint);
-
-			// Pre-base vowel (ေ)
-			if (jInfo.codepoint === 0x1031) {
-				preBase.push(jInfo);
-				infos.splice(j, 1);
-				continue;
-			}
-
-			// Pre-base medial (ြ ra)
-			if (jInfo.codepoint === 0x103c) {
-				preBase.push(jInfo);
-				infos.splice(j, 1);
+			if (!jInfo) continue;
+			// Pre-base vowel (ေ) or pre-base medial (ြ ra)
+			if (jInfo.codepoint === 0x1031 || jInfo.codepoint === 0x103c) {
+				moveElement(infos, j, insert++);
 				continue;
 			}
-
-			// Stop at next syllable
-			if (
-				jCat === MyanmarCategory.Consonant ||
-				jCat === MyanmarCategory.Other
-			) {
+			const cat = getMyanmarCategory(jInfo.codepoint);
+			if (cat === MyanmarCategory.Consonant || cat === MyanmarCategory.Other) {
 				break;
 			}
-
-			j++;
-		}
-
-		// Insert pre-base elements before base
-		if (preBase.length > 0) {
-			infos.splice(base, 0, ...preBase);
-			i += preBase.length;
 		}
 
-		i++;
+		i = insert + 1;
 	}
 }
@@ -0,0 +1,205 @@
+/**
+ * Table-driven syllable machines for the syllable-based complex shapers
+ * (Indic, USE, Myanmar, Khmer).
+ *
+ * Each script describes its syllable grammar as a small DFA over category
+ * bytes. The description is compiled once at module load into a flat
+ * Uint8Array transition table indexed by `state * classes + category`, the
+ * same shape as HarfBuzz's Ragel-generated machines. Scanning is a single
+ * linear pass that writes syllable ranges into a reusable SyllableScan, so no
+ * object is allocated per syllable.
+ *
+ * State 0 is the dead state and state 1 is the start state. Every other state
+ * is accepting: the grammars here end a syllable at the first character that
+ * cannot extend it, so the scanner never backtracks.
+ */
+
+/** Actions applied when a transition enters a state */
+export const SyllableAction = {
+	/** Record the consumed character as the syllable base */
+	SetBase: 1,
+	/** Forget any base recorded so far */
+	ClearBase: 2,
+	/** Mark the syllable as starting with a reph sequence */
+	Reph: 4,
+	/** Record the consumed character as the base unless one is recorded */
+	SetFirstBase: 8,
+} as const;
+
+/** Syllable flag bits stored in SyllableScan.flags */
+export const SyllableFlag = {
+	Reph: 1,
+} as const;
+
+/** Dead state (no transition) */
+export const DEAD_STATE = 0;
+
+/** Start state */
+export const START_STATE = 1;
+
+/**
+ * One state of a syllable grammar
+ */
+export interface SyllableStateSpec {
+	/** Copy all transitions of this state before applying `on` */
+	like?: number;
+	/** Transitions: categories consumed and the target state */
+	on?: [categories: number[], target: number][];
+	/** SyllableAction bits applied when this state is entered */
+	action?: number;
+	/** Syllable type reported once this state is entered (sticky) */
+	type?: number;
+}
+
+/**
+ * Compiled syllable machine
+ */
+export interface SyllableMachine {
+	/** Number of category classes (row stride of the transition table) */
+	readonly classes: number;
+	/** Transition table: trans[state * classes + category] = next state */
+	readonly trans: Uint8Array;
+	/** Per-state SyllableAction bits */
+	readonly actions: Uint8Array;
+	/** Per-state syllable type + 1 (0 = keep current type) */
+	readonly types: Uint8Array;
+	/** Type reported when the start state has no transition */
+	readonly fallbackType: number;
+}
+
+/**
+ * Compile a grammar description into transition tables.
+ * `states[0]` must be the dead state and `states[1]` the start state.
+ */
+export function compileSyllableMachine(
+	classes: number,
+	states: SyllableStateSpec[],
+	fallbackType: number,
+): SyllableMachine {
+	const count = states.length;
+	if (count > 256) throw new Error("Syllable machine has too many states");
+
+	const trans = new Uint8Array(count * classes);
+	const actions = new Uint8Array(count);
+	const types = new Uint8Array(count);
+	const done = new Uint8Array(count);
+
+	const fill = (s: number): void => {
+		if (done[s] === 1) return;
+		if (done[s] === 2) throw new Error("Cyclic `like` in syllable machine");
+		done[s] = 2;
+		const spec = states[s]!;
+		const row = s * classes;
+		if (spec.like !== undefined) {
+			fill(spec.like);
+			trans.copyWithin(row, spec.like * classes, (spec.like + 1) * classes);
+		}
+		if (spec.on) {
+			for (let i = 0; i < spec.on.length; i++) {
+				const [cats, target] = spec.on[i]!;
+				for (let j = 0; j < cats.length; j++) {
+					trans[row + cats[j]!] = target;
+				}
+			}
+		}
+		actions[s] = spec.action ?? 0;
+		types[s] = spec.type === undefined ? 0 : spec.type + 1;
+		done[s] = 1;
+	};
+
+	for (let s = 0; s < count; s++) fill(s);
+	return { classes, trans, actions, types, fallbackType };
+}
+
+/**
+ * Reusable structure-of-arrays scan result.
+ * Holds per-glyph category bytes and per-syllable ranges.
+ */
+export class SyllableScan {
+	/** Number of syllables found by the last scan */
+	count = 0;
+	/** Per-glyph category bytes (input to the machine) */
+	categories = new Uint8Array(64);
+	/** Syllable start index (inclusive) */
+	starts = new Int32Array(64);
+	/** Syllable end index (exclusive) */
+	ends = new Int32Array(64);
+	/** Base index recorded by SetBase actions, -1 if none */
+	bases = new Int32Array(64);
+	/** Syllable type reported by the machine */
+	types = new Uint8Array(64);
+	/** SyllableFlag bits */
+	flags = new Uint8Array(64);
+
+	/** Ensure capacity for `n` glyphs (and therefore at most `n` syllables) */
+	reserve(n: number): void {
+		if (this.categories.length >= n) return;
+		let cap = this.categories.length;
+		while (cap < n) cap *= 2;
+		this.categories = new Uint8Array(cap);
+		this.starts = new Int32Array(cap);
+		this.ends = new Int32Array(cap);
+		this.bases = new Int32Array(cap);
+		this.types = new Uint8Array(cap);
+		this.flags = new Uint8Array(cap);
+	}
+}
+
+/**
+ * Split `scan.categories[0..n)` into syllables with a single linear pass.
+ * @returns The number of syllables written to `scan`
+ */
+export function scanSyllables(
+	machine: SyllableMachine,
+	scan: SyllableScan,
+	n: number,
+): number {
+	const { classes, trans, actions, types, fallbackType } = machine;
+	const cats = scan.categories;
+	const starts = scan.starts;
+	const ends = scan.ends;
+	const bases = scan.bases;
+	const outTypes = scan.types;
+	const outFlags = scan.flags;
+
+	let count = 0;
+	let pos = 0;
+	while (pos < n) {
+		const start = pos;
+		let state = START_STATE;
+		let base = -1;
+		let flags = 0;
+		let type = fallbackType;
+
+		while (pos < n) {
+			const next = trans[state * classes + cats[pos]!]!;
+			if (next === DEAD_STATE) break;
+			const action = actions[next]!;
+			if (action !== 0) {
+				if (action & SyllableAction.SetBase) base = pos;
+				if (action & SyllableAction.ClearBase) base = -1;
+				if (action & SyllableAction.Reph) flags |= SyllableFlag.Reph;
+				if ((action & SyllableAction.SetFirstBase) !== 0 && base < 0) {
+					base = pos;
+				}
+			}
+			const t = types[next]!;
+			if (t !== 0) type = t - 1;
+			state = next;
+			pos++;
+		}
+
+		// Always make progress, even on characters the grammar rejects
+		if (pos === start) pos++;
+
+		starts[count] = start;
+		ends[count] = pos;
+		bases[count] = base;
+		outTypes[count] = type;
+		outFlags[count] = flags;
+		count++;
+	}
+
+	scan.count = count;
+	return count;
+}
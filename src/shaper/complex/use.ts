@@ -1,4 +1,12 @@
+import { moveElement, rotateElements } from "../../buffer/glyph-buffer.ts";
 import type { GlyphInfo } from "../../types.ts";
+import {
+	compileSyllableMachine,
+	SyllableAction,
+	SyllableFlag,
+	SyllableScan,
+	scanSyllables,
+} from "./syllable-machine.ts";
 
 /**
  * Universal Shaping Engine (USE) categories
@@ -228,247 +236,196 @@ export const UseFeatureMask = {
 } as const;
 
 /**
- * USE syllable structure
+ * USE syllable types reported by the syllable machine
  */
-interface UseSyllable {
-	start: number;
-	end: number;
-	base: number;
-	hasReph: boolean;
+export enum UseSyllableType {
+	Standard = 0, // Cluster with a base character
+	Broken = 1, // Cluster without a base
+	NonCluster = 2, // Other / symbol (plus any trailing marks)
 }
 
-/**
- * Find syllable boundaries in USE text
- */
-function findUseSyllables(infos: GlyphInfo[]): UseSyllable[] {
-	const syllables: UseSyllable[] = [];
-	const n = infos.length;
-	if (n === 0) return syllables;
+/** Category byte used for missing glyph slots */
+const USE_SKIP = 41;
 
-	let start = 0;
+// Syllable machine states (0 = dead, 1 = start)
+const S_BASE_SEARCH = 2; // Before base (start, after reph, pre-base signs)
+const S_R = 3; // After R at syllable start
+const S_REPH = 4; // After R + H at syllable start
+const S_CLUSTER = 5; // Consonant cluster after the base
+const S_CLUSTER_BASE = 6;
+const S_CLUSTER_BROKEN = 7;
+const S_CLUSTER_OTHER = 8;
+const S_HALANT = 9; // After halant in the cluster
+const S_MATRA = 10; // Vowels, medials, modifiers and finals
 
-	while (start < n) {
-		const syllable = parseUseSyllable(infos, start);
-		syllables.push(syllable);
-		start = syllable.end;
-	}
+const U = UseCategory;
 
-	return syllables;
-}
+/**
+ * USE syllable grammar (simplified):
+ *   [R H] (VPre|VMPre|MPre)* Base (H (B|CS|SUB|ZWJ|ZWNJ)? | SUB | CS | N | HN)*
+ *   (V* | M* | VM* | SM* | F* | CGJ | VS)*
+ */
+const useMachine = compileSyllableMachine(
+	42,
+	[
+		{},
+		{ like: S_BASE_SEARCH, on: [[[U.R], S_R]] },
+		{
+			on: [
+				[
+					[
+						U.CGJ,
+						U.CM,
+						U.CS,
+						U.F,
+						U.FM,
+						U.H,
+						U.HN,
+						U.J,
+						U.N,
+						U.R,
+						U.SE,
+						U.SUB,
+						U.VS,
+						U.ZWJ,
+						U.ZWNJ,
+						U.VD,
+						U.VMAbv,
+						U.VMBlw,
+						U.VMPst,
+						U.VAbv,
+						U.VBlw,
+						U.VPst,
+						U.SMAbv,
+						U.SMBlw,
+						U.FAbv,
+						U.FBlw,
+						U.FPst,
+						U.MAbv,
+						U.MBlw,
+						U.MPst,
+					],
+					S_CLUSTER_BROKEN,
+				],
+				[[U.O, U.S, U.SB, U.WJ], S_CLUSTER_OTHER],
+				[[U.B, U.IND, U.GB, U.V], S_CLUSTER_BASE],
+				[[U.VMPre, U.VPre, U.MPre, USE_SKIP], S_BASE_SEARCH],
+			],
+			type: UseSyllableType.Broken,
+		},
+		{
+			like: S_CLUSTER,
+			on: [[[U.H], S_REPH]],
+			type: UseSyllableType.Broken,
+		},
+		{ like: S_BASE_SEARCH, action: SyllableAction.Reph },
+		{
+			like: S_MATRA,
+			on: [
+				[[U.H], S_HALANT],
+				[[U.SUB, U.CS, U.N, U.HN, USE_SKIP], S_CLUSTER],
+			],
+		},
+		{
+			like: S_CLUSTER,
+			action: SyllableAction.SetBase,
+			type: UseSyllableType.Standard,
+		},
+		{ like: S_CLUSTER, type: UseSyllableType.Broken },
+		{ like: S_CLUSTER, type: UseSyllableType.NonCluster },
+		{
+			like: S_CLUSTER,
+			on: [[[U.B, U.CS, U.SUB, U.ZWJ, U.ZWNJ], S_CLUSTER]],
+		},
+		{
+			on: [
+				[
+					[
+						U.VAbv,
+						U.VBlw,
+						U.VPre,
+						U.VPst,
+						U.VD,
+						U.MAbv,
+						U.MBlw,
+						U.MPre,
+						U.MPst,
+						U.VMAbv,
+						U.VMBlw,
+						U.VMPre,
+						U.VMPst,
+						U.SMAbv,
+						U.SMBlw,
+						U.FAbv,
+						U.FBlw,
+						U.FPst,
+						U.F,
+						U.FM,
+						U.CGJ,
+						U.VS,
+						USE_SKIP,
+					],
+					S_MATRA,
+				],
+			],
+		},
+	],
+	UseSyllableType.NonCluster,
+);
+
+/** Shared scan scratch (shaping is synchronous, so one is enough) */
+const useScan = new SyllableScan();
 
 /**
- * Parse a single USE syllable
+ * Categorize `infos` and run the USE syllable machine over them.
+ * Syllables without a recorded base use their start as the base.
  */
-function parseUseSyllable(infos: GlyphInfo[], start: number): UseSyllable {
+function scanUseSyllables(infos: GlyphInfo[]): SyllableScan {
 	const n = infos.length;
-	let pos = start;
-	let base = -1;
-	let hasReph = false;
-
-	// Check for Repha (R + H at start)
-	if (pos + 1 < n) {
-		const info1 = infos[pos];
-		const info2 = infos[pos + 1];
-		if (info1 && info2) {
-			const cat1 = getUseCategory(info1.codepoint ?? 0);
-			const cat2 = getUseCategory(info2.codepoint ?? 0);
-			if (cat1 === UseCategory.R && cat2 === UseCategory.H) {
-				hasReph = true;
-				pos += 2;
-			}
-		}
-	}
-
-	// Find base character
-	while (pos < n) {
-		const info = infos[pos];
-		if (!info) {
-			pos++;
-			continue;
-		}
-		const cat = getUseCategory(info.codepoint ?? 0);
-
-		// Base characters
-		if (
-			cat === UseCategory.B ||
-			cat === UseCategory.IND ||
-			cat === UseCategory.GB ||
-			cat === UseCategory.V
-		) {
-			base = pos;
-			pos++;
-			break;
-		}
-
-		// Non-base starters - continue looking
-		if (
-			cat === UseCategory.VMPre ||
-			cat === UseCategory.VPre ||
-			cat === UseCategory.MPre
-		) {
-			pos++;
-			continue;
-		}
-
-		// End of valid cluster start
-		if (base === -1) {
-			pos++;
-		}
-		break;
-	}
-
-	if (base === -1) base = start;
-
-	// Consume consonant cluster
-	while (pos < n) {
-		const posInfo = infos[pos];
-		if (!posInfo) {
-			pos++;
-			continue;
-		}
-		const cat = getUseCategory(posInfo.codepoint ?? 0);
-
-		// Halant + Consonant continues cluster
-		if (cat === UseCategory.H) {
-			pos++;
-			if (pos < n) {
-				const nextInfo = infos[pos];
-				if (nextInfo) {
-					const nextCat = getUseCategory(nextInfo.codepoint ?? 0);
-					if (
-						nextCat === UseCategory.B ||
-						nextCat === UseCategory.CS ||
-						nextCat === UseCategory.SUB
-					) {
-						pos++;
-						continue;
-					}
-					// ZWJ/ZWNJ after halant
-					if (nextCat === UseCategory.ZWJ || nextCat === UseCategory.ZWNJ) {
-						pos++;
-					}
-				}
-			}
-			continue;
-		}
-
-		// Subjoined consonants
-		if (cat === UseCategory.SUB || cat === UseCategory.CS) {
-			pos++;
-			continue;
-		}
-
-		// Nukta
-		if (cat === UseCategory.N || cat === UseCategory.HN) {
-			pos++;
-			continue;
-		}
-
-		break;
-	}
-
-	// Consume matras and modifiers
-	while (pos < n) {
-		const posInfo = infos[pos];
-		if (!posInfo) {
-			pos++;
-			continue;
-		}
-		const cat = getUseCategory(posInfo.codepoint ?? 0);
-
-		// Vowel signs
-		if (
-			cat === UseCategory.VAbv ||
-			cat === UseCategory.VBlw ||
-			cat === UseCategory.VPre ||
-			cat === UseCategory.VPst ||
-			cat === UseCategory.VD
-		) {
-			pos++;
-			continue;
-		}
-
-		// Medials
-		if (
-			cat === UseCategory.MAbv ||
-			cat === UseCategory.MBlw ||
-			cat === UseCategory.MPre ||
-			cat === UseCategory.MPst
-		) {
-			pos++;
-			continue;
-		}
-
-		// Vowel modifiers
-		if (
-			cat === UseCategory.VMAbv ||
-			cat === UseCategory.VMBlw ||
-			cat === UseCategory.VMPre ||
-			cat === UseCategory.VMPst
-		) {
-			pos++;
-			continue;
-		}
-
-		// Syllable modifiers
-		if (cat === UseCategory.SMAbv || cat === UseCategory.SMBlw) {
-			pos++;
-			continue;
-		}
-
-		// Finals
-		if (
-			cat === UseCategory.FAbv ||
-			cat === UseCategory.FBlw ||
-			cat === UseCategory.FPst ||
-			cat === UseCategory.F ||
-			cat === UseCategory.FM
-		) {
-			pos++;
-			continue;
-		}
-
-		// CGJ, VS
-		if (cat === UseCategory.CGJ || cat === UseCategory.VS) {
-			pos++;
-			continue;
-		}
-
-		break;
+	const scan = useScan;
+	scan.reserve(n);
+	const cats = scan.categories;
+	for (let i = 0; i < n; i++) {
+		const info = infos[i];
+		cats[i] = info ? getUseCategory(info.codepoint ?? 0) : USE_SKIP;
 	}
-
-	// Ensure we advance at least one position
-	if (pos === start) {
-		pos = start + 1;
+	const count = scanSyllables(useMachine, scan, n);
+	const bases = scan.bases;
+	const starts = scan.starts;
+	for (let s = 0; s < count; s++) {
+		if (bases[s]! < 0) bases[s] = starts[s]!;
 	}
-
-	return { start, end: pos, base, hasReph };
+	return scan;
 }
 
 /**
  * Set up masks for USE shaping
  */
 export function setupUseMasks(infos: GlyphInfo[]): void {
-	const syllables = findUseSyllables(infos);
-
-	for (let i = 0; i < syllables.length; i++) {
-		const syllable = syllables[i]!;
-		for (let j = syllable.start; j < syllable.end; j++) {
+	const scan = scanUseSyllables(infos);
+	const cats = scan.categories;
+
+	for (let i = 0; i < scan.count; i++) {
+		const start = scan.starts[i]!;
+		const end = scan.ends[i]!;
+		const base = scan.bases[i]!;
+		const hasReph = (scan.flags[i]! & SyllableFlag.Reph) !== 0;
+		for (let j = start; j < end; j++) {
 			const info = infos[j];
 			if (!info) continue;
 
 			// Store syllable index in upper mask bits
 			info.mask = (info.mask & 0x0000ffff) | ((i & 0xffff) << 16);
 
-			const cat = getUseCategory(info.codepoint);
+			const cat = cats[j]!;
 
 			// Reph handling
-			if (syllable.hasReph && j < syllable.start + 2) {
+			if (hasReph && j < start + 2) {
 				info.mask |= UseFeatureMask.rphf;
 			}
 
 			// Pre-base handling
-			if (j < syllable.base) {
+			if (j < base) {
 				if (
 					cat === UseCategory.B ||
 					cat === UseCategory.CS ||
@@ -479,7 +436,7 @@ export function setupUseMasks(infos: GlyphInfo[]): void {
 			}
 
 			// Post-base handling
-			if (j > syllable.base) {
+			if (j > base) {
 				if (
 					cat === UseCategory.B ||
 					cat === UseCategory.CS ||
@@ -492,7 +449,7 @@ export function setupUseMasks(infos: GlyphInfo[]): void {
 
 			// Halant
 			if (cat === UseCategory.H || cat === UseCategory.HN) {
-				if (j < syllable.base) {
+				if (j < base) {
 					info.mask |= UseFeatureMask.half;
 				} else {
 					info.mask |= UseFeatureMask.haln;
@@ -548,42 +505,40 @@ export function setupUseMasks(infos: GlyphInfo[]): void {
  * Reorder USE syllables (pre-base vowels, reph)
  */
 export function reorderUSE(infos: GlyphInfo[]): void {
-	const syllables = findUseSyllables(infos);
-
-	for (let i = 0; i < syllables.length; i++) {
-		const syllable = syllables[i]!;
-		reorderUseSyllable(infos, syllable);
+	const scan = scanUseSyllables(infos);
+
+	for (let i = 0; i < scan.count; i++) {
+		reorderUseSyllable(
+			infos,
+			scan.categories,
+			scan.starts[i]!,
+			scan.ends[i]!,
+			scan.bases[i]!,
+			(scan.flags[i]! & SyllableFlag.Reph) !== 0,
+		);
 	}
 }
 
 /**
  * Reorder a single USE syllable
  */
-function reorderUseSyllable(infos: GlyphInfo[], syllable: UseSyllable): void {
-	const { start, end, base, hasReph } = syllable;
-
-	// Collect pre-base vowels that need to move
-	const preBaseVowels: { index: number; info: GlyphInfo }[] = [];
-
+function reorderUseSyllable(
+	infos: GlyphInfo[],
+	cats: Uint8Array,
+	start: number,
+	end: number,
+	base: number,
+	hasReph: boolean,
+): void {
+	// Move pre-base vowels before the base, keeping their relative order.
+	// Each move is a rotation bounded by the syllable.
+	let insertPos = hasReph ? start + 2 : start;
 	for (let i = base + 1; i < end; i++) {
-		const info = infos[i];
-		if (!info) continue;
+		if (!infos[i]) continue;
 
-		const cat = getUseCategory(info.codepoint);
+		const cat = cats[i];
 		if (cat === UseCategory.VPre || cat === UseCategory.MPre) {
-			preBaseVowels.push({ index: i, info });
-		}
-	}
-
-	// Move pre-base vowels before the base
-	if (preBaseVowels.length > 0) {
-		preBaseVowels.sort((a, b) => b.index - a.index);
-
-		for (let i = 0; i < preBaseVowels.length; i++) {
-			const { index, info } = preBaseVowels[i]!;
-			infos.splice(index, 1);
-			const insertPos = hasReph ? start + 2 : start;
-			infos.splice(insertPos, 0, info);
+			moveElement(infos, i, insertPos++);
 		}
 	}
 
@@ -616,10 +571,9 @@ function reorderUseSyllable(infos: GlyphInfo[], syllable: UseSyllable): void {
 				}
 			}
 
+			// Rotate R + H past [start + 2, rephTarget]
 			if (rephTarget > start + 1) {
-				infos.splice(start, 2);
-				const adjustedTarget = rephTarget - 2;
-				infos.splice(adjustedTarget + 1, 0, rephStart, rephH);
+				rotateElements(infos, start, start + 2, rephTarget + 1);
 			}
 		}
 	}
@@ -1,5 +1,5 @@
 import type { Font } from "../font/font.ts";
-import { getGlyphClass } from "../font/tables/gdef.ts";
+import { classAt, getGlyphClass } from "../font/tables/gdef.ts";
 import { getKernValue } from "../font/tables/kern.ts";
 import type { GlyphId, GlyphInfo, GlyphPosition } from "../types.ts";
 import { GlyphClass } from "../types.ts";
@@ -50,20 +50,15 @@ export function applyFallbackMarkPositioning(
 	font: Font,
 	infos: GlyphInfo[],
 	positions: GlyphPosition[],
+	advancesOnly = false,
 ): void {
 	// Fast path: skip entirely if no marks detected
 	if (!hasAnyMarks(infos)) return;
 
-	// Cache glyph classes to avoid repeated GDEF lookups
-	const glyphClassCache = new Map<GlyphId, number>();
-	const getClass = (glyphId: GlyphId): number => {
-		let cls = glyphClassCache.get(glyphId);
-		if (cls === undefined) {
-			cls = font.gdef ? getGlyphClass(font.gdef, glyphId) : 0;
-			glyphClassCache.set(glyphId, cls);
-		}
-		return cls;
-	};
+	// GDEF keeps glyph classes in a dense per-font array
+	const glyphClasses = font.gdef?.glyphClasses;
+	const getClass = (glyphId: GlyphId): number =>
+		glyphClasses ? classAt(glyphClasses, glyphId) : 0;
 
 	for (let i = 0; i < infos.length; i++) {
 		const info = infos[i]!;
@@ -90,15 +85,26 @@ export function applyFallbackMarkPositioning(
 
 		if (baseIndex < 0) continue;
 
-		const baseInfo = infos[baseIndex]!;
-		const basePos = positions[baseIndex]!;
+		// Measurement only needs the zeroed advance below
+		if (!advancesOnly) {
+			const baseInfo = infos[baseIndex]!;
+			const basePos = positions[baseIndex]!;
 
-		// Get base glyph metrics
-		const baseAdvance = font.advanceWidth(baseInfo.glyphId);
+			// Get base glyph metrics
+			const baseAdvance = font.advanceWidth(baseInfo.glyphId);
 
-		// Position mark relative to base based on combining class
-		// This is a simplified heuristic - real mark positioning uses anchors
-		positionMarkFallback(font, info, pos, baseInfo, basePos, baseAdvance, ccc);
+			// Position mark relative to base based on combining class
+			// This is a simplified heuristic - real mark positioning uses anchors
+			positionMarkFallback(
+				font,
+				info,
+				pos,
+				baseInfo,
+				basePos,
+				baseAdvance,
+				ccc,
+			);
+		}
 
 		// Mark has zero advance (already accounted for in base)
 		pos.xAdvance = 0;
@@ -1,6 +1,14 @@
+import { OBJECT_BYTES, OwnerCache, SLOT_BYTES } from "../cache.ts";
 import type { Font } from "../font/font.ts";
-import type { AnyGposLookup, GposTable } from "../font/tables/gpos.ts";
+import {
+	type AnyGposLookup,
+	GposLookupType,
+	type GposTable,
+	isKerningOnlyPairPos,
+	type PairPosLookup,
+} from "../font/tables/gpos.ts";
 import type { AnyGsubLookup, GsubTable } from "../font/tables/gsub.ts";
+import { incrementCounter, instrumenting } from "../instrument.ts";
 import {
 	type FeatureVariations,
 	findMatchingFeatureVariation,
@@ -19,11 +27,19 @@ import { getTibetanFeatures, usesTibetan } from "./complex/tibetan.ts";
 import type { Tag, uint16 } from "../types.ts";
 import { tag, tagToString } from "../types.ts";
 
-/** Shape plan cache for reusing computed plans */
-const shapePlanCache = new WeakMap<Font, Map<string, ShapePlan>>();
+/** A lookup entry and its slots in the lookup list and index map */
+const LOOKUP_ENTRY_BYTES = 2 * OBJECT_BYTES + 8 * SLOT_BYTES;
+
+function shapePlanBytes(plan: ShapePlan): number {
+	const lookups = plan.gsubLookups.length + plan.gposLookups.length;
+	return 8 * OBJECT_BYTES + lookups * LOOKUP_ENTRY_BYTES;
+}
 
-/** Maximum cache size per font */
-const MAX_CACHE_SIZE = 64;
+/** Shape plan cache for reusing computed plans, at most 64 per font */
+const shapePlanCache = new OwnerCache<Font, string, ShapePlan>(
+	"shaper.shapePlan",
+	{ sizeOf: shapePlanBytes, maxEntries: 64, priority: 3 },
+);
 
 /** Feature with optional value */
 export interface ShapeFeature {
@@ -54,6 +70,13 @@ export interface ShapePlan {
 
 	/** Fast O(1) lookup by index for nested GPOS lookups */
 	gposLookupMap: Map<number, LookupEntry<AnyGposLookup>>;
+
+	/**
+	 * PairPos lookups of a kerning-only plan, in order. Set when every GPOS
+	 * lookup is either an xAdvance-only PairPos or a mark attachment (a no-op
+	 * without marks), so the pair lookups can be merged into one pass.
+	 */
+	kerningLookups: PairPosLookup[] | null;
 }
 
 function buildLookupMap<T>(lookups: T[] | undefined): Map<number, LookupEntry<T>> {
@@ -168,15 +191,11 @@ export function getOrCreateShapePlan(
 		axisCoords,
 	);
 
-	// Get or create font's cache map
-	let fontCache = shapePlanCache.get(font);
-	if (!fontCache) {
-		fontCache = new Map();
-		shapePlanCache.set(font, fontCache);
-	}
-
 	// Check cache
-	const cached = fontCache.get(cacheKey);
+	const cached = shapePlanCache.get(font, cacheKey);
+	if (instrumenting) {
+		incrementCounter(cached ? "shapePlan.hit" : "shapePlan.miss");
+	}
 	if (cached) {
 		return cached;
 	}
@@ -191,15 +210,8 @@ export function getOrCreateShapePlan(
 		axisCoords,
 	);
 
-	// Evict if cache is too large
-	if (fontCache.size >= MAX_CACHE_SIZE) {
-		const firstKey = fontCache.keys().next().value;
-		if (firstKey !== undefined) {
-			fontCache.delete(firstKey);
-		}
-	}
-
-	fontCache.set(cacheKey, plan);
+	// Oldest plan is evicted once the font has 64
+	shapePlanCache.set(font, cacheKey, plan);
 	return plan;
 }
 
@@ -288,9 +300,33 @@ function createShapePlanInternal(
 		gposLookups,
 		gsubLookupMap,
 		gposLookupMap,
+		kerningLookups: collectKerningLookups(gposLookups),
 	};
 }
 
+/** Collect the PairPos lookups of a kerning-only plan, or null */
+function collectKerningLookups(
+	lookups: LookupEntry<AnyGposLookup>[],
+): PairPosLookup[] | null {
+	const kerning: PairPosLookup[] = [];
+	for (let i = 0; i < lookups.length; i++) {
+		const lookup = lookups[i]!.lookup;
+		switch (lookup.type) {
+			case GposLookupType.Pair:
+				if (!isKerningOnlyPairPos(lookup)) return null;
+				kerning.push(lookup);
+				break;
+			case GposLookupType.MarkToBase:
+			case GposLookupType.MarkToLigature:
+			case GposLookupType.MarkToMark:
+				break;
+			default:
+				return null;
+		}
+	}
+	return kerning;
+}
+
 function collectLookups<T extends { lookups: unknown[] }>(
 	table: T | null,
 	scriptTag: Tag,
@@ -7,17 +7,24 @@ import {
 } from "../aat/state-machine.ts";
 import { GlyphBuffer } from "../buffer/glyph-buffer.ts";
 import type { UnicodeBuffer } from "../buffer/unicode-buffer.ts";
+import { OBJECT_BYTES, WeakCache } from "../cache.ts";
 import { Face } from "../font/face.ts";
 import type { Font } from "../font/font.ts";
-import { getGlyphClass } from "../font/tables/gdef.ts";
+import {
+	classAt,
+	type GdefTable,
+	inBitset,
+} from "../font/tables/gdef.ts";
 import {
 	type AnyGposLookup,
-	applyKerningDirect,
+	applyPairKerning,
 	type CursivePosLookup,
 	GposLookupType,
+	getPairKerning,
 	type MarkBasePosLookup,
 	type MarkLigaturePosLookup,
 	type MarkMarkPosLookup,
+	type PairKerning,
 	type PairPosLookup,
 	type SinglePosLookup,
 } from "../font/tables/gpos.ts";
@@ -35,12 +42,13 @@ import type {
 import {
 	type AlternateSubstLookup,
 	type AnyGsubLookup,
-	applyLigatureSubstDirect,
 	applySingleSubst,
 	type ChainingContextSubstLookup,
 	type ContextSubstLookup,
 	GsubLookupType,
 	type LigatureSubstLookup,
+	type LigatureTrieNode,
+	ligatureTrie,
 	type MultipleSubstLookup,
 	type ReverseChainingSingleSubstLookup,
 	type SingleSubstLookup,
@@ -63,14 +71,20 @@ import {
 	type MorxRearrangementSubtable,
 	MorxSubtableType,
 } from "../font/tables/morx.ts";
+import { incrementCounter, instrumenting } from "../instrument.ts";
 import type { ClassDef } from "../layout/structures/class-def.ts";
 import {
 	getMarkAttachmentType,
 	LookupFlag,
 } from "../layout/structures/layout-common.ts";
+import {
+	candidateRules,
+	classRuleIndex,
+	glyphRuleIndex,
+} from "../layout/structures/rule-index.ts";
 import { SetDigest } from "../layout/structures/set-digest.ts";
 import type { GlyphId, GlyphInfo, GlyphPosition } from "../types.ts";
-import { GlyphClass, tag } from "../types.ts";
+import { Direction, GlyphClass, tag } from "../types.ts";
 import { setupArabicMasks } from "./complex/arabic.ts";
 import {
 	isKorean,
@@ -120,12 +134,9 @@ export interface ShapeOptions {
 	features?: ShapeFeature[];
 }
 
-/**
- * Pre-allocated arrays for ligature matching to avoid per-glyph allocations.
- * Max 16 components per ligature is a reasonable limit.
- */
-const _ligMatchIndices = new Uint16Array(16);
-const _ligMatchGlyphs = new Uint16Array(16);
+/** Result of the last successful matchLigatureTrie (avoids an object) */
+let _ligMatchGlyph = 0;
+let _ligMatchComponents = 0;
 
 /**
  * Union type accepting either Font or Face instances.
@@ -140,7 +151,10 @@ function getFont(fontLike: FontLike): Font {
 }
 
 /** Cached Face per Font for avoiding allocation overhead */
-const _faceCache = new WeakMap<Font, Face>();
+const _faceCache = new WeakCache<Font, Face>("shaper.face", {
+	sizeOf: () => 16 * OBJECT_BYTES,
+	priority: 3,
+});
 
 /** Get Face (cached for non-variable fonts) */
 function getFace(fontLike: FontLike): Face {
@@ -182,21 +196,28 @@ function precomputeSkipMarkers(
 	const ignoreLig = lookupFlag & LookupFlag.IgnoreLigatures;
 	const ignoreMark = lookupFlag & LookupFlag.IgnoreMarks;
 	const markAttachmentType = getMarkAttachmentType(lookupFlag);
+	const markSet = markFilteringSetOf(gdef, lookupFlag);
+	const glyphClasses = gdef.glyphClasses;
+	const markAttachClasses = gdef.markAttachClasses;
 
 	for (let i = 0; i < buffer.infos.length; i++) {
 		const info = buffer.infos[i];
 		if (!info) continue;
 
-		const glyphClass = getGlyphClass(gdef, info.glyphId);
+		const glyphClass = classAt(glyphClasses, info.glyphId);
 
 		if (ignoreBase && glyphClass === GlyphClass.Base) {
 			markers[i] = 1;
 		} else if (ignoreLig && glyphClass === GlyphClass.Ligature) {
 			markers[i] = 1;
-		} else if (ignoreMark && glyphClass === GlyphClass.Mark) {
+		} else if (glyphClass !== GlyphClass.Mark) {
+			// Not filtered
+		} else if (ignoreMark) {
 			markers[i] = 1;
-		} else if (markAttachmentType !== 0 && glyphClass === GlyphClass.Mark) {
-			const glyphMarkClass = gdef.markAttachClassDef.get(info.glyphId);
+		} else if (markSet) {
+			if (!inBitset(markSet, info.glyphId)) markers[i] = 1;
+		} else if (markAttachmentType !== 0) {
+			const glyphMarkClass = classAt(markAttachClasses, info.glyphId);
 			if (glyphMarkClass !== markAttachmentType) {
 				markers[i] = 1;
 			}
@@ -206,6 +227,33 @@ function precomputeSkipMarkers(
 	return markers;
 }
 
+/**
+ * Lookup flag plus, when UseMarkFilteringSet is set, the set index in the
+ * high 16 bits. Skip checks take this in place of the bare flag.
+ */
+function lookupProps(lookup: {
+	flag: number;
+	markFilteringSet?: number;
+}): number {
+	return lookup.flag & LookupFlag.UseMarkFilteringSet
+		? lookup.flag | ((lookup.markFilteringSet ?? 0) << 16)
+		: lookup.flag;
+}
+
+/**
+ * Mark set bitset selected by lookup props, or null without
+ * UseMarkFilteringSet. A missing set filters out every mark.
+ */
+function markFilteringSetOf(
+	gdef: GdefTable,
+	props: number,
+): Uint32Array | null {
+	if (!(props & LookupFlag.UseMarkFilteringSet)) return null;
+	return gdef.markGlyphSets?.bitsets[props >>> 16] ?? _emptyMarkSet;
+}
+
+const _emptyMarkSet = new Uint32Array(0);
+
 /**
  * Pre-compute next non-skip index array for O(1) pair lookups.
  * nextNonSkip[i] = index of next non-skipped glyph after i, or -1 if none.
@@ -237,12 +285,13 @@ function buildNextNonSkipArray(skip: SkipMarkers, length: number): Int16Array {
  */
 function hasAnyMarks(buffer: GlyphBuffer, font: Font): boolean {
 	if (!font.gdef) return false;
+	const glyphClasses = font.gdef.glyphClasses;
 	const infos = buffer.infos;
 	const len = buffer.length;
 	for (let i = 0; i < len; i++) {
 		const info = infos[i];
 		if (!info) continue;
-		const cls = getGlyphClass(font.gdef, info.glyphId);
+		const cls = classAt(glyphClasses, info.glyphId);
 		if (cls === GlyphClass.Mark) return true;
 	}
 	return false;
@@ -254,8 +303,7 @@ function hasAnyMarks(buffer: GlyphBuffer, font: Font): boolean {
  */
 function buildBaseIndexArray(
 	buffer: GlyphBuffer,
-	glyphClassCache: GlyphClassCache,
-	font: Font,
+	glyphClasses: Uint8Array,
 ): Int16Array {
 	const baseIndex = new Int16Array(buffer.infos.length);
 	baseIndex.fill(-1);
@@ -266,7 +314,7 @@ function buildBaseIndexArray(
 		const info = buffer.infos[i];
 		if (!info) continue;
 
-		const cls = getCachedGlyphClass(font, info.glyphId, glyphClassCache);
+		const cls = classAt(glyphClasses, info.glyphId);
 
 		if (cls === GlyphClass.Base || cls === 0 || cls === GlyphClass.Ligature) {
 			// This is a base or ligature, update the last base
@@ -361,11 +409,230 @@ export function shapeInto(
 	glyphBuffer: GlyphBuffer,
 	options: ShapeOptions = {},
 ): void {
+	const context = resolveShapeContext(
+		fontLike,
+		options,
+		buffer.script,
+		buffer.language,
+	);
+	shapeCodepoints(
+		context,
+		glyphBuffer,
+		buffer.direction,
+		buffer.codepoints,
+		buffer.clusters,
+		buffer.codepoints.length,
+	);
+}
+
+/**
+ * Packed output of shapeBatch. Glyphs of string i occupy
+ * [offsets[i], offsets[i + 1]); positions holds xAdvance, yAdvance, xOffset
+ * and yOffset for each glyph.
+ */
+export interface ShapeBatchResult {
+	offsets: Uint32Array;
+	glyphIds: Uint16Array;
+	clusters: Uint32Array;
+	positions: Float32Array;
+}
+
+// shapeBatch scratch: one string's codepoints, and clusters 0, 1, 2, ...
+let _batchCodepoints = new Uint32Array(256);
+let _batchClusters = new Uint32Array(0);
+
+/** Decode a string into _batchCodepoints; returns the codepoint count */
+function decodeBatchString(text: string): number {
+	const len = text.length;
+	if (_batchCodepoints.length < len) {
+		_batchCodepoints = new Uint32Array(
+			Math.max(len, _batchCodepoints.length * 2),
+		);
+	}
+	const codepoints = _batchCodepoints;
+	let count = 0;
+	for (let i = 0; i < len; i++) {
+		const code = text.charCodeAt(i);
+		if (code >= 0xd800 && code <= 0xdbff && i + 1 < len) {
+			const low = text.charCodeAt(i + 1);
+			if (low >= 0xdc00 && low <= 0xdfff) {
+				codepoints[count++] =
+					((code - 0xd800) << 10) + (low - 0xdc00) + 0x10000;
+				i++;
+				continue;
+			}
+		}
+		codepoints[count++] = code;
+	}
+	if (_batchClusters.length < count) {
+		_batchClusters = new Uint32Array(_batchCodepoints.length);
+		for (let i = 0; i < _batchClusters.length; i++) _batchClusters[i] = i;
+	}
+	return count;
+}
+
+/**
+ * Shape many strings with one font and options, returning packed typed
+ * arrays instead of a GlyphBuffer per string.
+ *
+ * The plan is resolved once, every string is decoded into one pooled buffer
+ * and shaped through one pooled GlyphBuffer. Each string is shaped as
+ * shape() would shape a fresh UnicodeBuffer holding it, so clusters are
+ * codepoint indices within the string.
+ *
+ * @param fontLike - Font or Face instance
+ * @param strings - Strings to shape, independently of each other
+ * @param options - Shaping parameters shared by every string
+ * @returns Packed glyphs plus a per-string offset table
+ */
+export function shapeBatch(
+	fontLike: FontLike,
+	strings: readonly string[],
+	options: ShapeOptions = {},
+): ShapeBatchResult {
+	// Same script/language defaults as a fresh UnicodeBuffer
+	const context = resolveShapeContext(fontLike, options, "Zyyy", null);
+	const glyphBuffer = _glyphBufferPool.pop() ?? GlyphBuffer.withCapacity(64);
+
+	const offsets = new Uint32Array(strings.length + 1);
+	let capacity = 16;
+	for (let i = 0; i < strings.length; i++) capacity += strings[i]!.length;
+	let glyphIds = new Uint16Array(capacity);
+	let clusters = new Uint32Array(capacity);
+	let positions = new Float32Array(capacity * 4);
+
+	let count = 0;
+	for (let s = 0; s < strings.length; s++) {
+		const length = decodeBatchString(strings[s]!);
+		shapeCodepoints(
+			context,
+			glyphBuffer,
+			Direction.LTR,
+			_batchCodepoints,
+			_batchClusters,
+			length,
+		);
+		const n = glyphBuffer.length;
+		if (count + n > capacity) {
+			// Multiple substitution can emit more glyphs than codepoints
+			capacity = Math.max(capacity * 2, count + n);
+			const grownIds = new Uint16Array(capacity);
+			grownIds.set(glyphIds);
+			glyphIds = grownIds;
+			const grownClusters = new Uint32Array(capacity);
+			grownClusters.set(clusters);
+			clusters = grownClusters;
+			const grownPositions = new Float32Array(capacity * 4);
+			grownPositions.set(positions);
+			positions = grownPositions;
+		}
+		const infos = glyphBuffer.infos;
+		const glyphPositions = glyphBuffer.positions;
+		for (let i = 0; i < n; i++) {
+			const info = infos[i]!;
+			const pos = glyphPositions[i]!;
+			const o = count + i;
+			glyphIds[o] = info.glyphId;
+			clusters[o] = info.cluster;
+			positions[o * 4] = pos.xAdvance;
+			positions[o * 4 + 1] = pos.yAdvance;
+			positions[o * 4 + 2] = pos.xOffset;
+			positions[o * 4 + 3] = pos.yOffset;
+		}
+		count += n;
+		offsets[s + 1] = count;
+	}
+	releaseBuffer(glyphBuffer);
+
+	return {
+		offsets,
+		glyphIds: glyphIds.subarray(0, count),
+		clusters: clusters.subarray(0, count),
+		positions: positions.subarray(0, count * 4),
+	};
+}
+
+/**
+ * Measure text without positioning it: GSUB runs as in shapeInto, but only
+ * the GPOS lookups that can change advances, and glyph offsets are never
+ * computed. Horizontal advances are summed per cluster into `out`:
+ * out[c - first] for cluster c, where first is the buffer's first cluster
+ * (so out[i] is codepoint i for text added with addStr), and out[n] holds
+ * the total width, n being the codepoint count. Nothing is allocated.
+ *
+ * @param fontLike - Font or Face instance
+ * @param buffer - UnicodeBuffer containing the input text
+ * @param options - Shaping parameters, as for shape()
+ * @param out - Receives n + 1 values; must hold at least that many
+ * @returns The total width in font units
+ */
+export function measureInto(
+	fontLike: FontLike,
+	buffer: UnicodeBuffer,
+	options: ShapeOptions,
+	out: Float32Array,
+): number {
+	const length = buffer.codepoints.length;
+	if (out.length < length + 1) {
+		throw new RangeError(
+			`measureInto needs ${length + 1} output slots, got ${out.length}`,
+		);
+	}
+	const context = resolveShapeContext(
+		fontLike,
+		options,
+		buffer.script,
+		buffer.language,
+	);
+	const glyphBuffer = _glyphBufferPool.pop() ?? GlyphBuffer.withCapacity(64);
+	shapeCodepoints(
+		context,
+		glyphBuffer,
+		buffer.direction,
+		buffer.codepoints,
+		buffer.clusters,
+		length,
+		true,
+	);
+
+	out.fill(0, 0, length + 1);
+	const first = length > 0 ? buffer.clusters[0]! : 0;
+	const infos = glyphBuffer.infos;
+	const positions = glyphBuffer.positions;
+	let total = 0;
+	for (let i = 0; i < infos.length; i++) {
+		const advance = positions[i]!.xAdvance;
+		const slot = infos[i]!.cluster - first;
+		if (slot >= 0 && slot < length) out[slot] += advance;
+		total += advance;
+	}
+	out[length] = total;
+	releaseBuffer(glyphBuffer);
+	return total;
+}
+
+/** Font, plan and options resolved once per shapeInto/shapeBatch call */
+interface ShapeContext {
+	font: Font;
+	face: Face;
+	plan: ShapePlan;
+	script: string;
+	language: string | null;
+	direction: "ltr" | "rtl";
+	kernEnabled: boolean;
+}
+
+function resolveShapeContext(
+	fontLike: FontLike,
+	options: ShapeOptions,
+	bufferScript: string | null,
+	bufferLanguage: string | null,
+): ShapeContext {
 	const font = getFont(fontLike);
 	const face = getFace(fontLike);
 
-	const script = options.script ?? buffer.script ?? "latn";
-	const language = options.language ?? buffer.language ?? null;
+	const script = options.script ?? bufferScript ?? "latn";
+	const language = options.language ?? bufferLanguage ?? null;
 	const direction = options.direction ?? "ltr";
 	const features = options.features ?? [];
 	let kernEnabled = true;
@@ -392,19 +659,29 @@ export function shapeInto(
 		features,
 		axisCoords,
 	);
+	return { font, face, plan, script, language, direction, kernEnabled };
+}
+
+/** Shape the first `length` codepoints into glyphBuffer */
+function shapeCodepoints(
+	context: ShapeContext,
+	glyphBuffer: GlyphBuffer,
+	bufferDirection: Direction,
+	codepoints: ArrayLike<number>,
+	clusters: ArrayLike<number>,
+	length: number,
+	advancesOnly = false,
+): void {
+	const { font, face, plan, script } = context;
 
 	// Reset and reuse buffer
 	glyphBuffer.reset();
-	glyphBuffer.direction = buffer.direction;
+	glyphBuffer.direction = bufferDirection;
 	glyphBuffer.script = script;
-	glyphBuffer.language = language;
+	glyphBuffer.language = context.language;
 
 	// Use pooled object initialization - inline glyphId lookup to avoid closure
-	glyphBuffer.initFromCodepointsWithFont(
-		buffer.codepoints,
-		buffer.clusters,
-		font,
-	);
+	glyphBuffer.initFromCodepointsWithFont(codepoints, clusters, font, length);
 
 	// Resolve <base, variation selector> pairs via cmap format 14
 	const hasVariationSelectors = applyVariationSelectors(font, glyphBuffer);
@@ -433,10 +710,10 @@ export function shapeInto(
 	// Apply GPOS or fallback positioning
 	const hasGpos = font.gpos !== null && plan.gposLookups.length > 0;
 	if (hasGpos) {
-		applyGpos(font, glyphBuffer, plan);
+		applyGpos(font, glyphBuffer, plan, advancesOnly);
 	} else {
 		// Fallback kerning using kern table
-		if (kernEnabled) {
+		if (context.kernEnabled) {
 			applyFallbackKerning(font, glyphBuffer.infos, glyphBuffer.positions);
 		}
 		// Fallback mark positioning using combining classes
@@ -444,11 +721,12 @@ export function shapeInto(
 			font,
 			glyphBuffer.infos,
 			glyphBuffer.positions,
+			advancesOnly,
 		);
 	}
 
-	// Reverse for RTL
-	if (direction === "rtl") {
+	// Reverse for RTL; measurement only sums advances per cluster
+	if (context.direction === "rtl" && !advancesOnly) {
 		glyphBuffer.reverse();
 	}
 }
@@ -618,73 +896,102 @@ function applyGsub(font: Font, buffer: GlyphBuffer, plan: ShapePlan): void {
 
 	// Build buffer digest for fast lookup skipping
 	// Same-length substitutions still change which later lookups can match,
-	// so the digest must track glyph-id changes, not just buffer length changes.
-	let bufferDigest = new SetDigest();
-	const infos = buffer.infos;
-	for (let i = 0; i < buffer.length; i++) {
-		bufferDigest.add(infos[i]!.glyphId);
-	}
+	// so every substitution ORs the glyph it writes into the digest. Glyphs
+	// that were replaced keep their bits, which only costs false positives.
+	const bufferDigest = new SetDigest();
+	fillBufferDigest(bufferDigest, buffer);
 
+	let staleLookups = 0;
 	for (let i = 0; i < lookups.length; i++) {
 		const entry = lookups[i]!;
 		// Skip entire lookup if no glyph in buffer could match
-		if (!bufferDigest.mayIntersect(entry.lookup.digest)) continue;
+		if (!bufferDigest.mayIntersect(entry.lookup.digest)) {
+			if (instrumenting) incrementCounter("gsub.lookup.skipped");
+			continue;
+		}
+		if (instrumenting) incrementCounter("gsub.lookup.applied");
 
-		applyGsubLookup(font, buffer, entry.lookup, plan);
+		if (!applyGsubLookup(font, buffer, entry.lookup, plan, bufferDigest)) {
+			continue;
+		}
 
-		// Rebuild after every lookup so staged same-length substitutions
-		// can unlock later digest-filtered lookups in the same shaping pass.
-		bufferDigest = new SetDigest();
-		for (let j = 0; j < buffer.length; j++) {
-			bufferDigest.add(infos[j]!.glyphId);
+		// Resync occasionally so bits of replaced glyphs don't pile up
+		if (++staleLookups >= GSUB_DIGEST_RESYNC_INTERVAL) {
+			bufferDigest.clear();
+			fillBufferDigest(bufferDigest, buffer);
+			staleLookups = 0;
 		}
 	}
 	// Compact buffer after all GSUB lookups to remove marked-deleted glyphs
 	buffer.compact();
 }
 
+/** Changing lookups applied before the GSUB buffer digest is rebuilt */
+const GSUB_DIGEST_RESYNC_INTERVAL = 16;
+
+function fillBufferDigest(digest: SetDigest, buffer: GlyphBuffer): void {
+	const infos = buffer.infos;
+	for (let i = 0; i < buffer.length; i++) {
+		digest.add(infos[i]!.glyphId);
+	}
+}
+
+/**
+ * Apply one GSUB lookup.
+ * Every glyph ID written is added to `added` (if given).
+ * @returns true if any glyph was substituted, inserted or deleted
+ */
 function applyGsubLookup(
 	font: Font,
 	buffer: GlyphBuffer,
 	lookup: AnyGsubLookup,
 	plan: ShapePlan,
-): void {
+	added: SetDigest | null = null,
+): boolean {
 	switch (lookup.type) {
 		case GsubLookupType.Single:
-			applySingleSubstLookup(font, buffer, lookup);
-			break;
+			return applySingleSubstLookup(font, buffer, lookup, added);
 		case GsubLookupType.Multiple:
-			applyMultipleSubstLookup(font, buffer, lookup);
-			break;
+			return applyMultipleSubstLookup(font, buffer, lookup, added);
 		case GsubLookupType.Alternate:
 			// Alternate requires user selection - use first alternate as default
-			applyAlternateSubstLookup(font, buffer, lookup);
-			break;
+			return applyAlternateSubstLookup(font, buffer, lookup, added);
 		case GsubLookupType.Ligature:
-			applyLigatureSubstLookup(font, buffer, lookup);
-			break;
+			return applyLigatureSubstLookup(font, buffer, lookup, added);
 		case GsubLookupType.Context:
-			applyContextSubstLookup(font, buffer, lookup, plan);
-			break;
+			return applyContextSubstLookup(font, buffer, lookup, plan, added);
 		case GsubLookupType.ChainingContext:
-			applyChainingContextSubstLookup(font, buffer, lookup, plan);
-			break;
+			return applyChainingContextSubstLookup(
+				font,
+				buffer,
+				lookup,
+				plan,
+				added,
+			);
 		// Note: Extension lookups (Type 7) are unwrapped during parsing
 		// and converted to their actual lookup types, so no case needed here
 		case GsubLookupType.ReverseChainingSingle:
-			applyReverseChainingSingleSubstLookup(font, buffer, lookup);
-			break;
+			return applyReverseChainingSingleSubstLookup(
+				font,
+				buffer,
+				lookup,
+				added,
+			);
 	}
+	return false;
 }
 
 function applySingleSubstLookup(
 	font: Font,
 	buffer: GlyphBuffer,
 	lookup: SingleSubstLookup,
-): void {
+	added: SetDigest | null = null,
+): boolean {
+	const lookupFlag = lookupProps(lookup);
 	const infos = buffer.infos;
 	const len = infos.length;
 	const digest = lookup.digest;
+	let changed = false;
 
 	// FAST PATH: No skip checking needed
 	if (lookup.flag === 0 || !font.gdef) {
@@ -699,6 +1006,8 @@ function applySingleSubstLookup(
 					if (!digest.mayHave(info.glyphId)) continue;
 					if (subtable.coverage.get(info.glyphId) !== null) {
 						info.glyphId = (info.glyphId + delta) & 0xffff;
+						added?.add(info.glyphId);
+						changed = true;
 					}
 				}
 			} else if (subtable.format === 2 && subtable.substituteGlyphIds) {
@@ -710,11 +1019,15 @@ function applySingleSubstLookup(
 					const idx = subtable.coverage.get(info.glyphId);
 					if (idx !== null) {
 						const rep = subs[idx];
-						if (rep !== undefined) info.glyphId = rep;
+						if (rep !== undefined) {
+							info.glyphId = rep;
+							added?.add(rep);
+							changed = true;
+						}
 					}
 				}
 			}
-			return;
+			return changed;
 		}
 		// Multiple subtables - use function
 		for (let i = 0; i < len; i++) {
@@ -724,13 +1037,15 @@ function applySingleSubstLookup(
 			const replacement = applySingleSubst(lookup, info.glyphId);
 			if (replacement !== null) {
 				info.glyphId = replacement;
+				added?.add(replacement);
+				changed = true;
 			}
 		}
-		return;
+		return changed;
 	}
 
 	// WITH SKIP: Need to check each glyph
-	const skip = precomputeSkipMarkers(font, buffer, lookup.flag);
+	const skip = precomputeSkipMarkers(font, buffer, lookupFlag);
 	for (let i = 0; i < len; i++) {
 		if (skip[i]) continue;
 		const info = infos[i]!;
@@ -739,16 +1054,22 @@ function applySingleSubstLookup(
 		const replacement = applySingleSubst(lookup, info.glyphId);
 		if (replacement !== null) {
 			info.glyphId = replacement;
+			added?.add(replacement);
+			changed = true;
 		}
 	}
+	return changed;
 }
 
 function applyMultipleSubstLookup(
 	font: Font,
 	buffer: GlyphBuffer,
 	lookup: MultipleSubstLookup,
-): void {
+	added: SetDigest | null = null,
+): boolean {
+	const lookupFlag = lookupProps(lookup);
 	const digest = lookup.digest;
+	let changed = false;
 	let i = 0;
 	while (i < buffer.infos.length) {
 		const info = buffer.infos[i];
@@ -756,7 +1077,7 @@ function applyMultipleSubstLookup(
 			i++;
 			continue;
 		}
-		if (shouldSkipGlyph(font, info.glyphId, lookup.flag)) {
+		if (shouldSkipGlyph(font, info.glyphId, lookupFlag)) {
 			i++;
 			continue;
 		}
@@ -781,10 +1102,12 @@ function applyMultipleSubstLookup(
 
 			// Replace with first glyph
 			info.glyphId = firstGlyph;
+			added?.add(firstGlyph);
 
 			// Insert remaining glyphs (avoid array destructuring allocation)
 			for (let j = 1; j < sequence.length; j++) {
 				const glyphId = sequence[j]!;
+				added?.add(glyphId);
 				const newInfo: GlyphInfo = {
 					glyphId,
 					cluster: info.cluster,
@@ -802,26 +1125,31 @@ function applyMultipleSubstLookup(
 
 			i += sequence.length;
 			applied = true;
+			changed = true;
 			break;
 		}
 
 		if (!applied) i++;
 	}
+	return changed;
 }
 
 function applyAlternateSubstLookup(
 	font: Font,
 	buffer: GlyphBuffer,
 	lookup: AlternateSubstLookup,
-): void {
+	added: SetDigest | null = null,
+): boolean {
+	const lookupFlag = lookupProps(lookup);
 	// Alternate substitution allows selecting from multiple alternates
 	// By default, use the first alternate (index 0)
 	const infos = buffer.infos;
 	const subtables = lookup.subtables;
 	const digest = lookup.digest;
+	let changed = false;
 	for (let i = 0; i < infos.length; i++) {
 		const info = infos[i]!;
-		if (shouldSkipGlyph(font, info.glyphId, lookup.flag)) continue;
+		if (shouldSkipGlyph(font, info.glyphId, lookupFlag)) continue;
 		// Fast digest check before expensive Coverage lookup
 		if (!digest.mayHave(info.glyphId)) continue;
 
@@ -838,25 +1166,31 @@ function applyAlternateSubstLookup(
 
 			// Use first alternate by default
 			info.glyphId = firstAlternate;
+			added?.add(firstAlternate);
+			changed = true;
 			break;
 		}
 	}
+	return changed;
 }
 
 function applyLigatureSubstLookup(
 	font: Font,
 	buffer: GlyphBuffer,
 	lookup: LigatureSubstLookup,
-): void {
+	added: SetDigest | null = null,
+): boolean {
+	const lookupFlag = lookupProps(lookup);
 	const infos = buffer.infos;
 	const len = infos.length;
 	const needsSkipCheck = lookup.flag !== 0 && font.gdef !== null;
 	const digest = lookup.digest;
+	let changed = false;
 
 	// Pre-compute skip markers only if needed
 	let skip: Uint8Array | null = null;
 	if (needsSkipCheck) {
-		skip = precomputeSkipMarkers(font, buffer, lookup.flag);
+		skip = precomputeSkipMarkers(font, buffer, lookupFlag);
 	}
 
 	let i = 0;
@@ -882,50 +1216,86 @@ function applyLigatureSubstLookup(
 			continue;
 		}
 
-		// Collect matchable glyphs using pre-allocated arrays
-		let matchLen = 1;
-		_ligMatchIndices[0] = i;
-		_ligMatchGlyphs[0] = info.glyphId;
-
-		for (let j = i + 1; j < len && matchLen < 16; j++) {
-			// Skip deleted glyphs
-			if (buffer.isDeleted(j)) continue;
-			const nextInfo = infos[j];
-			if (!nextInfo) continue;
-			// Use pre-computed skip markers
-			if (skip?.[j]) continue;
-			_ligMatchIndices[matchLen] = j;
-			_ligMatchGlyphs[matchLen] = nextInfo.glyphId;
-			matchLen++;
-		}
-
-		// Use direct Uint16Array version to avoid Array.from allocation
-		const result = applyLigatureSubstDirect(
-			lookup,
-			_ligMatchGlyphs,
-			matchLen,
-			0,
-		);
-		if (result) {
+		// Walk the covering subtable's ligature trie; a subtable whose
+		// coverage matches but whose ligatures don't falls through to the next
+		const subtables = lookup.subtables;
+		for (let s = 0; s < subtables.length; s++) {
+			const subtable = subtables[s]!;
+			const coverageIndex = subtable.coverage.get(info.glyphId);
+			if (coverageIndex === null) continue;
+			const ligatureSet = subtable.ligatureSets[coverageIndex];
+			if (!ligatureSet) continue;
+			if (!matchLigatureTrie(ligatureTrie(ligatureSet), buffer, skip, i)) {
+				continue;
+			}
+
 			// Replace first glyph with ligature
-			info.glyphId = result.ligatureGlyph;
+			info.glyphId = _ligMatchGlyph;
+			added?.add(_ligMatchGlyph);
+			changed = true;
 
 			// Merge clusters and mark consumed glyphs for deletion
-			for (let k = 1; k < result.consumed; k++) {
-				const idx = _ligMatchIndices[k];
-				if (idx !== undefined) {
-					const targetInfo = infos[idx];
-					if (targetInfo) {
-						info.cluster = Math.min(info.cluster, targetInfo.cluster);
-					}
-					// Mark for deferred deletion instead of immediate removal
-					buffer.markDeleted(idx);
-				}
+			let remaining = _ligMatchComponents;
+			for (let j = i + 1; remaining > 0; j++) {
+				if (buffer.isDeleted(j) || skip?.[j]) continue;
+				const targetInfo = infos[j]!;
+				info.cluster = Math.min(info.cluster, targetInfo.cluster);
+				// Mark for deferred deletion instead of immediate removal
+				buffer.markDeleted(j);
+				remaining--;
 			}
+			break;
 		}
 
 		i++;
 	}
+	return changed;
+}
+
+/**
+ * Longest-path walk of a ligature trie from the glyph at `start`, keeping the
+ * earliest rule in the set that matches (OpenType order, not longest match).
+ * On success sets _ligMatchGlyph and _ligMatchComponents (glyphs consumed
+ * after the first).
+ */
+function matchLigatureTrie(
+	root: LigatureTrieNode,
+	buffer: GlyphBuffer,
+	skip: Uint8Array | null,
+	start: number,
+): boolean {
+	const infos = buffer.infos;
+	const len = infos.length;
+	let best = root.ligatureGlyph === -1 ? null : root;
+	let bestDepth = 0;
+	let node = root;
+	let depth = 0;
+	let pos = start + 1;
+	while (node.glyphs.length > 0 && (!best || node.minRule < best.rule)) {
+		while (pos < len && (buffer.isDeleted(pos) || skip?.[pos])) pos++;
+		if (pos >= len) break;
+		const glyphId = infos[pos]!.glyphId;
+		const glyphs = node.glyphs;
+		let next: LigatureTrieNode | null = null;
+		for (let c = 0; c < glyphs.length; c++) {
+			if (glyphs[c] === glyphId) {
+				next = node.children[c]!;
+				break;
+			}
+		}
+		if (!next) break;
+		node = next;
+		depth++;
+		pos++;
+		if (node.ligatureGlyph !== -1 && (!best || node.rule < best.rule)) {
+			best = node;
+			bestDepth = depth;
+		}
+	}
+	if (!best) return false;
+	_ligMatchGlyph = best.ligatureGlyph;
+	_ligMatchComponents = bestDepth;
+	return true;
 }
 
 function applyContextSubstLookup(
@@ -933,15 +1303,18 @@ function applyContextSubstLookup(
 	buffer: GlyphBuffer,
 	lookup: ContextSubstLookup,
 	plan: ShapePlan,
-): void {
+	added: SetDigest | null = null,
+): boolean {
+	const lookupFlag = lookupProps(lookup);
 	const infos = buffer.infos;
 	const len = infos.length;
 	const digest = lookup.digest;
+	let changed = false;
 
 	// Pre-compute skip markers only if needed
 	let skip: Uint8Array | null = null;
 	if (lookup.flag !== 0 && font.gdef !== null) {
-		skip = precomputeSkipMarkers(font, buffer, lookup.flag);
+		skip = precomputeSkipMarkers(font, buffer, lookupFlag);
 	}
 
 	// Context substitution - matches input sequence and applies nested lookups
@@ -964,7 +1337,7 @@ function applyContextSubstLookup(
 					buffer,
 					i,
 					subtable,
-					lookup.flag,
+					lookupFlag,
 				);
 				if (result) {
 					matched = true;
@@ -976,25 +1349,30 @@ function applyContextSubstLookup(
 					buffer,
 					i,
 					subtable,
-					lookup.flag,
+					lookupFlag,
 				);
 				if (result) {
 					matched = true;
 					lookupRecords = result;
 				}
 			} else if (subtable.format === 3) {
-				if (matchContextFormat3(font, buffer, i, subtable, lookup.flag)) {
+				if (matchContextFormat3(font, buffer, i, subtable, lookupFlag)) {
 					matched = true;
 					lookupRecords = subtable.lookupRecords;
 				}
 			}
 
 			if (matched) {
-				applyNestedLookups(font, buffer, i, lookupRecords, plan);
+				if (
+					applyNestedLookups(font, buffer, i, lookupRecords, plan, added)
+				) {
+					changed = true;
+				}
 				break;
 			}
 		}
 	}
+	return changed;
 }
 
 function applyChainingContextSubstLookup(
@@ -1002,15 +1380,18 @@ function applyChainingContextSubstLookup(
 	buffer: GlyphBuffer,
 	lookup: ChainingContextSubstLookup,
 	plan: ShapePlan,
-): void {
+	added: SetDigest | null = null,
+): boolean {
+	const lookupFlag = lookupProps(lookup);
 	const infos = buffer.infos;
 	const len = infos.length;
 	const digest = lookup.digest;
+	let changed = false;
 
 	// Pre-compute skip markers only if needed
 	let skip: Uint8Array | null = null;
 	if (lookup.flag !== 0 && font.gdef !== null) {
-		skip = precomputeSkipMarkers(font, buffer, lookup.flag);
+		skip = precomputeSkipMarkers(font, buffer, lookupFlag);
 	}
 
 	const subtables = lookup.subtables;
@@ -1032,7 +1413,7 @@ function applyChainingContextSubstLookup(
 					buffer,
 					i,
 					subtable,
-					lookup.flag,
+					lookupFlag,
 				);
 				if (result) {
 					matched = true;
@@ -1044,40 +1425,48 @@ function applyChainingContextSubstLookup(
 					buffer,
 					i,
 					subtable,
-					lookup.flag,
+					lookupFlag,
 				);
 				if (result) {
 					matched = true;
 					lookupRecords = result;
 				}
 			} else if (subtable.format === 3) {
-				if (matchChainingFormat3(font, buffer, i, subtable, lookup.flag)) {
+				if (matchChainingFormat3(font, buffer, i, subtable, lookupFlag)) {
 					matched = true;
 					lookupRecords = subtable.lookupRecords;
 				}
 			}
 
 			if (matched) {
-				applyNestedLookups(font, buffer, i, lookupRecords, plan);
+				if (
+					applyNestedLookups(font, buffer, i, lookupRecords, plan, added)
+				) {
+					changed = true;
+				}
 				break;
 			}
 		}
 	}
+	return changed;
 }
 
 function applyReverseChainingSingleSubstLookup(
 	font: Font,
 	buffer: GlyphBuffer,
 	lookup: ReverseChainingSingleSubstLookup,
-): void {
+	added: SetDigest | null = null,
+): boolean {
+	const lookupFlag = lookupProps(lookup);
 	const infos = buffer.infos;
 	const subtables = lookup.subtables;
 	const digest = lookup.digest;
+	let changed = false;
 	// Process in reverse order
 	for (let i = infos.length - 1; i >= 0; i--) {
 		const info = infos[i];
 		if (!info) continue;
-		if (shouldSkipGlyph(font, info.glyphId, lookup.flag)) continue;
+		if (shouldSkipGlyph(font, info.glyphId, lookupFlag)) continue;
 		// Fast digest check before expensive Coverage lookup
 		if (!digest.mayHave(info.glyphId)) continue;
 
@@ -1094,7 +1483,7 @@ function applyReverseChainingSingleSubstLookup(
 				const backCov = backtrackCoverages[b]!;
 				while (
 					backtrackPos < infos.length &&
-					shouldSkipGlyph(font, infos[backtrackPos]?.glyphId, lookup.flag)
+					shouldSkipGlyph(font, infos[backtrackPos]?.glyphId, lookupFlag)
 				) {
 					backtrackPos++;
 				}
@@ -1117,7 +1506,7 @@ function applyReverseChainingSingleSubstLookup(
 				const lookCov = lookaheadCoverages[l]!;
 				while (
 					lookaheadPos >= 0 &&
-					shouldSkipGlyph(font, infos[lookaheadPos]?.glyphId, lookup.flag)
+					shouldSkipGlyph(font, infos[lookaheadPos]?.glyphId, lookupFlag)
 				) {
 					lookaheadPos--;
 				}
@@ -1136,10 +1525,13 @@ function applyReverseChainingSingleSubstLookup(
 			const substitute = subtable.substituteGlyphIds[coverageIndex];
 			if (substitute !== undefined) {
 				info.glyphId = substitute;
+				added?.add(substitute);
+				changed = true;
 			}
 			break;
 		}
 	}
+	return changed;
 }
 
 // Note: Extension lookups (Type 7) are unwrapped during parsing,
@@ -1160,8 +1552,20 @@ function matchContextFormat1(
 	const ruleSet = subtable.ruleSets[coverageIndex];
 	if (!ruleSet) return null;
 
-	for (let r = 0; r < ruleSet.length; r++) {
-		const rule = ruleSet[r]!;
+	let rules = ruleSet;
+	const index = glyphRuleIndex(
+		(subtable.ruleIndexes ??= []),
+		coverageIndex,
+		ruleSet,
+	);
+	if (index) {
+		const next = nextInputGlyph(font, buffer, startIndex + 1, lookupFlag);
+		rules = candidateRules(index, next);
+	}
+	const available = buffer.infos.length - startIndex - 1;
+	for (let r = 0; r < rules.length; r++) {
+		const rule = rules[r]!;
+		if (rule.inputSequence.length > available) continue;
 		if (
 			matchGlyphSequence(
 				font,
@@ -1193,8 +1597,23 @@ function matchContextFormat2(
 	const classRuleSet = subtable.classRuleSets[firstClass];
 	if (!classRuleSet) return null;
 
-	for (let r = 0; r < classRuleSet.length; r++) {
-		const rule = classRuleSet[r]!;
+	let rules = classRuleSet;
+	const index = classRuleIndex(
+		(subtable.ruleIndexes ??= []),
+		firstClass,
+		classRuleSet,
+	);
+	if (index) {
+		const next = nextInputGlyph(font, buffer, startIndex + 1, lookupFlag);
+		rules = candidateRules(
+			index,
+			next === null ? null : subtable.classDef.get(next),
+		);
+	}
+	const available = buffer.infos.length - startIndex - 1;
+	for (let r = 0; r < rules.length; r++) {
+		const rule = rules[r]!;
+		if (rule.inputClasses.length > available) continue;
 		if (
 			matchClassSequence(
 				font,
@@ -1252,8 +1671,26 @@ function matchChainingFormat1(
 	const chainRuleSet = subtable.chainRuleSets[coverageIndex];
 	if (!chainRuleSet) return null;
 
-	for (let r = 0; r < chainRuleSet.length; r++) {
-		const rule = chainRuleSet[r]!;
+	let rules = chainRuleSet;
+	const index = glyphRuleIndex(
+		(subtable.ruleIndexes ??= []),
+		coverageIndex,
+		chainRuleSet,
+	);
+	if (index) {
+		const next = nextInputGlyph(font, buffer, startIndex + 1, lookupFlag);
+		rules = candidateRules(index, next);
+	}
+	const available = buffer.infos.length - startIndex - 1;
+	for (let r = 0; r < rules.length; r++) {
+		const rule = rules[r]!;
+		// Skipped glyphs only lengthen a match: too few glyphs rejects early
+		if (
+			rule.backtrackSequence.length > startIndex ||
+			rule.inputSequence.length + rule.lookaheadSequence.length > available
+		) {
+			continue;
+		}
 		// Check backtrack (reversed order, before startIndex)
 		if (
 			!matchGlyphSequenceBackward(
@@ -1326,8 +1763,29 @@ function matchChainingFormat2(
 	const chainClassRuleSet = subtable.chainClassRuleSets[firstClass];
 	if (!chainClassRuleSet) return null;
 
-	for (let r = 0; r < chainClassRuleSet.length; r++) {
-		const rule = chainClassRuleSet[r]!;
+	let rules = chainClassRuleSet;
+	const index = classRuleIndex(
+		(subtable.ruleIndexes ??= []),
+		firstClass,
+		chainClassRuleSet,
+	);
+	if (index) {
+		const next = nextInputGlyph(font, buffer, startIndex + 1, lookupFlag);
+		rules = candidateRules(
+			index,
+			next === null ? null : subtable.inputClassDef.get(next),
+		);
+	}
+	const available = buffer.infos.length - startIndex - 1;
+	for (let r = 0; r < rules.length; r++) {
+		const rule = rules[r]!;
+		// Skipped glyphs only lengthen a match: too few glyphs rejects early
+		if (
+			rule.backtrackClasses.length > startIndex ||
+			rule.inputClasses.length + rule.lookaheadClasses.length > available
+		) {
+			continue;
+		}
 		// Check backtrack classes (reversed order)
 		if (
 			!matchClassSequenceBackward(
@@ -1454,19 +1912,20 @@ function applyNestedLookups(
 	startIndex: number,
 	lookupRecords: Array<{ sequenceIndex: number; lookupListIndex: number }>,
 	plan: ShapePlan,
-): void {
+	added: SetDigest | null = null,
+): boolean {
 	const len = lookupRecords.length;
-	if (len === 0) return;
+	if (len === 0) return false;
 
 	// Fast path for single record (common case)
 	if (len === 1) {
 		const record = lookupRecords[0]!;
 		const lookupEntry = plan.gsubLookupMap.get(record.lookupListIndex);
-		if (!lookupEntry) return;
+		if (!lookupEntry) return false;
 		const pos = startIndex + record.sequenceIndex;
-		if (pos >= buffer.infos.length) return;
+		if (pos >= buffer.infos.length) return false;
 		const targetInfo = buffer.infos[pos];
-		if (!targetInfo) return;
+		if (!targetInfo) return false;
 		if (lookupEntry.lookup.type === GsubLookupType.Single) {
 			const replacement = applySingleSubst(
 				lookupEntry.lookup as SingleSubstLookup,
@@ -1474,14 +1933,17 @@ function applyNestedLookups(
 			);
 			if (replacement !== null) {
 				targetInfo.glyphId = replacement;
+				added?.add(replacement);
+				return true;
 			}
 		}
-		return;
+		return false;
 	}
 
 	// For multiple records, apply in descending sequence index order
 	// Use selection approach for small arrays (typical case) to avoid alloc
 	const applied = new Uint8Array(len);
+	let changed = false;
 	for (let round = 0; round < len; round++) {
 		// Find max unapplied sequence index
 		let maxIdx = -1;
@@ -1512,9 +1974,12 @@ function applyNestedLookups(
 			);
 			if (replacement !== null) {
 				targetInfo.glyphId = replacement;
+				added?.add(replacement);
+				changed = true;
 			}
 		}
 	}
+	return changed;
 }
 
 // GPOS application
@@ -1547,28 +2012,16 @@ function initializePositions(face: Face, buffer: GlyphBuffer): void {
 }
 
 /**
- * Glyph class cache for efficient repeated lookups during GPOS positioning.
- * Map from GlyphId to GlyphClass (avoids repeated GDEF lookups for same glyph).
+ * Apply the plan's GPOS lookups. With advancesOnly, lookups that can only
+ * move glyphs (cursive, mark-to-mark) are skipped, as are mark attachments
+ * once every mark already has a zero advance.
  */
-type GlyphClassCache = Map<GlyphId, number>;
-
-/**
- * Get glyph class with caching for O(1) repeated lookups.
- */
-function getCachedGlyphClass(
+function applyGpos(
 	font: Font,
-	glyphId: GlyphId,
-	cache: GlyphClassCache,
-): number {
-	let cls = cache.get(glyphId);
-	if (cls === undefined) {
-		cls = getGlyphClass(font.gdef, glyphId);
-		cache.set(glyphId, cls);
-	}
-	return cls;
-}
-
-function applyGpos(font: Font, buffer: GlyphBuffer, plan: ShapePlan): void {
+	buffer: GlyphBuffer,
+	plan: ShapePlan,
+	advancesOnly = false,
+): void {
 	// Build buffer digest for fast lookup skipping
 	const bufferDigest = new SetDigest();
 	const infos = buffer.infos;
@@ -1580,47 +2033,117 @@ function applyGpos(font: Font, buffer: GlyphBuffer, plan: ShapePlan): void {
 	// Quick check for marks - avoid expensive base index build for simple Latin text
 	const hasMarks = hasAnyMarks(buffer, font);
 
-	// Only build base index and glyph class cache if we have marks
+	// Only build the base index if we have marks
 	// This saves ~0.4μs per call for simple Latin text
 	let baseIndexArray: Int16Array;
-	let glyphClassCache: GlyphClassCache;
+	let glyphClasses: Uint8Array;
 	if (hasMarks) {
-		glyphClassCache = new Map();
-		baseIndexArray = buildBaseIndexArray(buffer, glyphClassCache, font);
+		// hasMarks implies GDEF; its dense class array is built once per font
+		glyphClasses = font.gdef!.glyphClasses;
+		baseIndexArray = buildBaseIndexArray(buffer, glyphClasses);
 	} else {
 		// Provide empty placeholders - these won't be used since hasMarks is false
 		baseIndexArray = _emptyBaseIndex;
-		glyphClassCache = _emptyGlyphClassCache;
+		glyphClasses = _emptyGlyphClasses;
+	}
+
+	// Kerning-only plans without marks: every remaining lookup is an xAdvance
+	// pair adjustment, so apply them all in a single pass
+	const kerningLookups = plan.kerningLookups;
+	if (kerningLookups && !hasMarks) {
+		const merged = _mergedLookups;
+		let count = 0;
+		for (let i = 0; i < kerningLookups.length; i++) {
+			const lookup = kerningLookups[i]!;
+			if (bufferDigest.mayIntersect(lookup.digest)) merged[count++] = lookup;
+		}
+		if (instrumenting) {
+			incrementCounter("gpos.lookup.applied", count);
+			const skipped = kerningLookups.length - count;
+			incrementCounter("gpos.lookup.skipped", skipped);
+		}
+		if (count > 0) applyMergedKerning(buffer, merged, count);
+		merged.length = 0;
+		return;
 	}
 
+	// Whether a mark attachment still has an advance to zero, scanned once.
+	// Attachments only clear advances (a stale true just runs a lookup that
+	// could have been skipped), so it is rescanned only after an adjustment
+	// lookup may have given a mark an advance.
+	let advancingMark =
+		advancesOnly && hasMarks && hasAdvancingMark(buffer, glyphClasses);
+	let adjusted = false;
+
 	const lookups = plan.gposLookups;
 	for (let i = 0; i < lookups.length; i++) {
 		const entry = lookups[i]!;
 		// Skip entire lookup if no glyph in buffer could match
-		if (!bufferDigest.mayIntersect(entry.lookup.digest)) continue;
+		if (!bufferDigest.mayIntersect(entry.lookup.digest)) {
+			if (instrumenting) incrementCounter("gpos.lookup.skipped");
+			continue;
+		}
+		if (advancesOnly) {
+			const type = entry.lookup.type;
+			if (
+				type === GposLookupType.Cursive ||
+				type === GposLookupType.MarkToMark
+			)
+				continue;
+			if (
+				type === GposLookupType.MarkToBase ||
+				type === GposLookupType.MarkToLigature
+			) {
+				if (adjusted) {
+					advancingMark = hasMarks && hasAdvancingMark(buffer, glyphClasses);
+					adjusted = false;
+				}
+				if (!advancingMark) continue;
+			} else if (!advancingMark) {
+				adjusted = true;
+			}
+		}
+		if (instrumenting) incrementCounter("gpos.lookup.applied");
 
 		applyGposLookup(
 			font,
 			buffer,
 			entry.lookup,
 			plan,
-			glyphClassCache,
+			glyphClasses,
 			baseIndexArray,
 			hasMarks,
 		);
 	}
 }
 
+/** Whether any mark still has an advance for an attachment to zero */
+function hasAdvancingMark(
+	buffer: GlyphBuffer,
+	glyphClasses: Uint8Array,
+): boolean {
+	const infos = buffer.infos;
+	const positions = buffer.positions;
+	for (let i = 0; i < infos.length; i++) {
+		if (
+			positions[i]!.xAdvance !== 0 &&
+			classAt(glyphClasses, infos[i]!.glyphId) === GlyphClass.Mark
+		)
+			return true;
+	}
+	return false;
+}
+
 // Empty placeholders for non-mark text to avoid allocation
 const _emptyBaseIndex = new Int16Array(0);
-const _emptyGlyphClassCache: GlyphClassCache = new Map();
+const _emptyGlyphClasses = new Uint8Array(0);
 
 function applyGposLookup(
 	font: Font,
 	buffer: GlyphBuffer,
 	lookup: AnyGposLookup,
 	plan: ShapePlan,
-	glyphClassCache: GlyphClassCache,
+	glyphClasses: Uint8Array,
 	baseIndexArray: Int16Array,
 	hasMarks: boolean,
 ): void {
@@ -1641,7 +2164,7 @@ function applyGposLookup(
 				font,
 				buffer,
 				lookup,
-				glyphClassCache,
+				glyphClasses,
 				baseIndexArray,
 			);
 			break;
@@ -1652,14 +2175,14 @@ function applyGposLookup(
 				font,
 				buffer,
 				lookup,
-				glyphClassCache,
+				glyphClasses,
 				baseIndexArray,
 			);
 			break;
 		case GposLookupType.MarkToMark:
 			// Skip mark-to-mark if no marks in buffer
 			if (!hasMarks) break;
-			applyMarkMarkPosLookup(font, buffer, lookup, glyphClassCache);
+			applyMarkMarkPosLookup(font, buffer, lookup, glyphClasses);
 			break;
 		case GposLookupType.Context:
 			applyContextPosLookup(
@@ -1667,7 +2190,7 @@ function applyGposLookup(
 				buffer,
 				lookup as ContextPosLookup,
 				plan,
-				glyphClassCache,
+				glyphClasses,
 				baseIndexArray,
 				hasMarks,
 			);
@@ -1678,7 +2201,7 @@ function applyGposLookup(
 				buffer,
 				lookup as ChainingContextPosLookup,
 				plan,
-				glyphClassCache,
+				glyphClasses,
 				baseIndexArray,
 				hasMarks,
 			);
@@ -1693,6 +2216,7 @@ function applySinglePosLookup(
 	lookup: SinglePosLookup,
 	hasMarks: boolean,
 ): void {
+	const lookupFlag = lookupProps(lookup);
 	const infos = buffer.infos;
 	const positions = buffer.positions;
 	const len = infos.length;
@@ -1766,7 +2290,7 @@ function applySinglePosLookup(
 	}
 
 	// WITH SKIP: Need to check each glyph
-	const skip = precomputeSkipMarkers(font, buffer, lookup.flag);
+	const skip = precomputeSkipMarkers(font, buffer, lookupFlag);
 	for (let i = 0; i < len; i++) {
 		if (skip[i]) continue;
 		applySingle(i);
@@ -1779,165 +2303,35 @@ function applyPairPosLookup(
 	lookup: PairPosLookup,
 	hasMarks: boolean,
 ): void {
+	const lookupFlag = lookupProps(lookup);
 	const infos = buffer.infos;
 	const positions = buffer.positions;
 	const len = infos.length;
 	const digest = lookup.digest;
-	const subtables = lookup.subtables;
-	const subtableCount = subtables.length;
+	// Typed-array form of the lookup (dense class-pair matrices for format 2)
+	const kerning = getPairKerning(lookup);
 
 	// FAST PATH: No skip checking needed (no flags, no GDEF, or no marks to skip)
 	// This handles simple Latin text - O(n) with zero allocation
 	const needsSkip = hasMarks && lookup.flag !== 0 && font.gdef !== null;
 	if (!needsSkip) {
-		// SUPER-FAST PATH: Single subtable (very common for kerning)
-		// Inline all logic to avoid function call overhead
-		if (subtableCount === 1) {
-			const subtable = subtables[0]!;
-			const coverage = subtable.coverage;
-
-			if (subtable.format === 1) {
-				// Format 1: Per-glyph pair sets with binary search
-				const pairSets = subtable.pairSets;
-				for (let i = 0; i < len - 1; i++) {
-					const gid1 = infos[i]!.glyphId;
-					if (!digest.mayHave(gid1)) continue;
-					const coverageIndex = coverage.get(gid1);
-					if (coverageIndex === null) continue;
-					const pairSet = pairSets[coverageIndex];
-					if (!pairSet) continue;
-
-					const gid2 = infos[i + 1]!.glyphId;
-					const records = pairSet.pairValueRecords;
-					// Binary search for secondGlyph
-					let low = 0;
-					let high = records.length - 1;
-					while (low <= high) {
-						const mid = (low + high) >>> 1;
-						const record = records[mid]!;
-						const sg = record.secondGlyph;
-						if (sg < gid2) {
-							low = mid + 1;
-						} else if (sg > gid2) {
-							high = mid - 1;
-						} else {
-							const xAdv1 = record.value1.xAdvance;
-							if (xAdv1) positions[i]!.xAdvance += xAdv1;
-							break;
-						}
-					}
-				}
-			} else {
-				// Format 2: Class-based kerning
-				const classDef1 = subtable.classDef1;
-				const classDef2 = subtable.classDef2;
-				const class1Records = subtable.class1Records;
-				const class1Count = class1Records.length;
-
-				for (let i = 0; i < len - 1; i++) {
-					const gid1 = infos[i]!.glyphId;
-					if (!digest.mayHave(gid1)) continue;
-					if (coverage.get(gid1) === null) continue;
-
-					const class1 = classDef1.get(gid1);
-					if (class1 >= class1Count) continue;
-					const class1Record = class1Records[class1]!;
-
-					const gid2 = infos[i + 1]!.glyphId;
-					const class2 = classDef2.get(gid2);
-					const class2Records = class1Record.class2Records;
-					if (class2 >= class2Records.length) continue;
-
-					const xAdv1 = class2Records[class2]!.value1.xAdvance;
-					if (xAdv1) positions[i]!.xAdvance += xAdv1;
-				}
-			}
-			return;
-		}
-
-		// FAST PATH: Two subtables (Format 1 + Format 2) - common for kerning
-		// Inline both lookups to avoid function call overhead
-		if (subtableCount === 2) {
-			const st0 = subtables[0]!;
-			const st1 = subtables[1]!;
-
-			// Common case: Format 1 (specific pairs) + Format 2 (class-based)
-			if (st0.format === 1 && st1.format === 2) {
-				const cov0 = st0.coverage;
-				const pairSets = st0.pairSets;
-				const cov1 = st1.coverage;
-				const classDef1 = st1.classDef1;
-				const classDef2 = st1.classDef2;
-				const class1Records = st1.class1Records;
-				const class1Count = class1Records.length;
-
-				for (let i = 0; i < len - 1; i++) {
-					const gid1 = infos[i]!.glyphId;
-					if (!digest.mayHave(gid1)) continue;
-
-					const gid2 = infos[i + 1]!.glyphId;
-
-					// Try Format 1 first (specific pairs)
-					const covIdx0 = cov0.get(gid1);
-					if (covIdx0 !== null) {
-						const pairSet = pairSets[covIdx0];
-						if (pairSet) {
-							const records = pairSet.pairValueRecords;
-							let low = 0;
-							let high = records.length - 1;
-							let found = false;
-							while (low <= high) {
-								const mid = (low + high) >>> 1;
-								const record = records[mid]!;
-								const sg = record.secondGlyph;
-								if (sg < gid2) {
-									low = mid + 1;
-								} else if (sg > gid2) {
-									high = mid - 1;
-								} else {
-									const xAdv1 = record.value1.xAdvance;
-									if (xAdv1) positions[i]!.xAdvance += xAdv1;
-									found = true;
-									break;
-								}
-							}
-							if (found) continue;
-						}
-					}
-
-					// Fall back to Format 2 (class-based)
-					if (cov1.get(gid1) !== null) {
-						const class1 = classDef1.get(gid1);
-						if (class1 < class1Count) {
-							const class1Record = class1Records[class1]!;
-							const class2 = classDef2.get(gid2);
-							const class2Records = class1Record.class2Records;
-							if (class2 < class2Records.length) {
-								const xAdv1 = class2Records[class2]!.value1.xAdvance;
-								if (xAdv1) positions[i]!.xAdvance += xAdv1;
-							}
-						}
-					}
-				}
-				return;
-			}
-		}
-
-		// Multiple subtables - use function call
 		for (let i = 0; i < len - 1; i++) {
-			const info1 = infos[i]!;
-			if (!digest.mayHave(info1.glyphId)) continue;
-			const info2 = infos[i + 1]!;
-			const pos1 = positions[i]!;
-			const pos2 = positions[i + 1]!;
-			applyKerningDirect(lookup, info1.glyphId, info2.glyphId, pos1, pos2);
+			const gid1 = infos[i]!.glyphId;
+			if (!digest.mayHave(gid1)) continue;
+			applyPairKerning(
+				kerning,
+				gid1,
+				infos[i + 1]!.glyphId,
+				positions[i]!,
+				positions[i + 1]!,
+			);
 		}
 		return;
 	}
 
 	// OPTIMIZED PATH: With skip markers - O(n) with precomputed arrays
 	// Used for complex text with marks that need to be skipped
-	const skip = precomputeSkipMarkers(font, buffer, lookup.flag);
+	const skip = precomputeSkipMarkers(font, buffer, lookupFlag);
 	const nextNonSkip = buildNextNonSkipArray(skip, len);
 
 	for (let i = 0; i < len - 1; i++) {
@@ -1946,22 +2340,59 @@ function applyPairPosLookup(
 		const j = nextNonSkip[i];
 		if (j < 0) break;
 
-		const info1 = infos[i]!;
+		const gid1 = infos[i]!.glyphId;
 		// Fast digest check before expensive Coverage lookup
-		if (!digest.mayHave(info1.glyphId)) continue;
-		const info2 = infos[j]!;
+		if (!digest.mayHave(gid1)) continue;
+		applyPairKerning(
+			kerning,
+			gid1,
+			infos[j]!.glyphId,
+			positions[i]!,
+			positions[j]!,
+		);
+	}
+}
+
+/**
+ * Apply several kerning-only PairPos lookups in one pass over the buffer.
+ * Their xAdvance adjustments commute, so the result matches applying them
+ * one after another. Only valid when no glyph needs to be skipped.
+ */
+function applyMergedKerning(
+	buffer: GlyphBuffer,
+	lookups: PairPosLookup[],
+	count: number,
+): void {
+	const infos = buffer.infos;
+	const positions = buffer.positions;
+	const len = infos.length;
+	const kernings = _mergedKernings;
+	for (let k = 0; k < count; k++) kernings[k] = getPairKerning(lookups[k]!);
+
+	for (let i = 0; i < len - 1; i++) {
+		const gid1 = infos[i]!.glyphId;
+		const gid2 = infos[i + 1]!.glyphId;
 		const pos1 = positions[i]!;
-		const pos2 = positions[j]!;
-		applyKerningDirect(lookup, info1.glyphId, info2.glyphId, pos1, pos2);
+		const pos2 = positions[i + 1]!;
+		for (let k = 0; k < count; k++) {
+			if (!lookups[k]!.digest.mayHave(gid1)) continue;
+			applyPairKerning(kernings[k]!, gid1, gid2, pos1, pos2);
+		}
 	}
+	kernings.length = 0;
 }
 
+// Scratch arrays for applyMergedKerning
+const _mergedLookups: PairPosLookup[] = [];
+const _mergedKernings: PairKerning[] = [];
+
 function applyCursivePosLookup(
 	font: Font,
 	buffer: GlyphBuffer,
 	lookup: CursivePosLookup,
 	hasMarks: boolean,
 ): void {
+	const lookupFlag = lookupProps(lookup);
 	const infos = buffer.infos;
 	const positions = buffer.positions;
 	const len = infos.length;
@@ -2010,7 +2441,7 @@ function applyCursivePosLookup(
 	}
 
 	// OPTIMIZED PATH: With skip markers
-	const skip = precomputeSkipMarkers(font, buffer, lookup.flag);
+	const skip = precomputeSkipMarkers(font, buffer, lookupFlag);
 	const nextNonSkip = buildNextNonSkipArray(skip, len);
 
 	for (let i = 0; i < len - 1; i++) {
@@ -2027,7 +2458,7 @@ function applyMarkBasePosLookup(
 	font: Font,
 	buffer: GlyphBuffer,
 	lookup: MarkBasePosLookup,
-	glyphClassCache: GlyphClassCache,
+	glyphClasses: Uint8Array,
 	baseIndexArray: Int16Array,
 ): void {
 	const digest = lookup.digest;
@@ -2044,7 +2475,7 @@ function applyMarkBasePosLookup(
 
 		// Must be a mark glyph
 		if (
-			getCachedGlyphClass(font, markInfo.glyphId, glyphClassCache) !==
+			classAt(glyphClasses, markInfo.glyphId) !==
 			GlyphClass.Mark
 		)
 			continue;
@@ -2096,7 +2527,7 @@ function applyMarkLigaturePosLookup(
 	font: Font,
 	buffer: GlyphBuffer,
 	lookup: MarkLigaturePosLookup,
-	glyphClassCache: GlyphClassCache,
+	glyphClasses: Uint8Array,
 	baseIndexArray: Int16Array,
 ): void {
 	const digest = lookup.digest;
@@ -2112,7 +2543,7 @@ function applyMarkLigaturePosLookup(
 		if (!digest.mayHave(markInfo.glyphId)) continue;
 
 		if (
-			getCachedGlyphClass(font, markInfo.glyphId, glyphClassCache) !==
+			classAt(glyphClasses, markInfo.glyphId) !==
 			GlyphClass.Mark
 		)
 			continue;
@@ -2126,7 +2557,7 @@ function applyMarkLigaturePosLookup(
 
 		// Must be a ligature
 		if (
-			getCachedGlyphClass(font, ligInfo.glyphId, glyphClassCache) !==
+			classAt(glyphClasses, ligInfo.glyphId) !==
 			GlyphClass.Ligature
 		)
 			continue;
@@ -2137,7 +2568,7 @@ function applyMarkLigaturePosLookup(
 			const midInfo = infos[j];
 			if (
 				midInfo &&
-				getCachedGlyphClass(font, midInfo.glyphId, glyphClassCache) ===
+				classAt(glyphClasses, midInfo.glyphId) ===
 					GlyphClass.Mark
 			) {
 				componentIndex++;
@@ -2188,7 +2619,7 @@ function applyMarkMarkPosLookup(
 	font: Font,
 	buffer: GlyphBuffer,
 	lookup: MarkMarkPosLookup,
-	glyphClassCache: GlyphClassCache,
+	glyphClasses: Uint8Array,
 ): void {
 	const digest = lookup.digest;
 	const infos = buffer.infos;
@@ -2203,7 +2634,7 @@ function applyMarkMarkPosLookup(
 		if (!digest.mayHave(mark1Info.glyphId)) continue;
 
 		if (
-			getCachedGlyphClass(font, mark1Info.glyphId, glyphClassCache) !==
+			classAt(glyphClasses, mark1Info.glyphId) !==
 			GlyphClass.Mark
 		)
 			continue;
@@ -2213,11 +2644,7 @@ function applyMarkMarkPosLookup(
 		if (i > 0) {
 			const prevInfo = infos[i - 1];
 			if (prevInfo) {
-				const prevClass = getCachedGlyphClass(
-					font,
-					prevInfo.glyphId,
-					glyphClassCache,
-				);
+				const prevClass = classAt(glyphClasses, prevInfo.glyphId);
 				if (prevClass === GlyphClass.Mark) {
 					mark2Index = i - 1;
 				}
@@ -2265,10 +2692,11 @@ function applyContextPosLookup(
 	buffer: GlyphBuffer,
 	lookup: ContextPosLookup,
 	plan: ShapePlan,
-	glyphClassCache: GlyphClassCache,
+	glyphClasses: Uint8Array,
 	baseIndexArray: Int16Array,
 	hasMarks: boolean,
 ): void {
+	const lookupFlag = lookupProps(lookup);
 	const infos = buffer.infos;
 	const len = infos.length;
 	const digest = lookup.digest;
@@ -2277,7 +2705,7 @@ function applyContextPosLookup(
 	// Pre-compute skip markers only if needed
 	let skip: Uint8Array | null = null;
 	if (lookup.flag !== 0 && font.gdef !== null) {
-		skip = precomputeSkipMarkers(font, buffer, lookup.flag);
+		skip = precomputeSkipMarkers(font, buffer, lookupFlag);
 	}
 
 	for (let i = 0; i < len; i++) {
@@ -2298,7 +2726,7 @@ function applyContextPosLookup(
 					buffer,
 					i,
 					subtable,
-					lookup.flag,
+					lookupFlag,
 				);
 				if (result) {
 					matched = true;
@@ -2310,14 +2738,14 @@ function applyContextPosLookup(
 					buffer,
 					i,
 					subtable,
-					lookup.flag,
+					lookupFlag,
 				);
 				if (result) {
 					matched = true;
 					lookupRecords = result;
 				}
 			} else if (subtable.format === 3) {
-				if (matchContextPosFormat3(font, buffer, i, subtable, lookup.flag)) {
+				if (matchContextPosFormat3(font, buffer, i, subtable, lookupFlag)) {
 					matched = true;
 					lookupRecords = subtable.lookupRecords;
 				}
@@ -2330,7 +2758,7 @@ function applyContextPosLookup(
 					i,
 					lookupRecords,
 					plan,
-					glyphClassCache,
+					glyphClasses,
 					baseIndexArray,
 					hasMarks,
 				);
@@ -2345,10 +2773,11 @@ function applyChainingContextPosLookup(
 	buffer: GlyphBuffer,
 	lookup: ChainingContextPosLookup,
 	plan: ShapePlan,
-	glyphClassCache: GlyphClassCache,
+	glyphClasses: Uint8Array,
 	baseIndexArray: Int16Array,
 	hasMarks: boolean,
 ): void {
+	const lookupFlag = lookupProps(lookup);
 	const infos = buffer.infos;
 	const len = infos.length;
 	const digest = lookup.digest;
@@ -2357,7 +2786,7 @@ function applyChainingContextPosLookup(
 	// Pre-compute skip markers only if needed
 	let skip: Uint8Array | null = null;
 	if (lookup.flag !== 0 && font.gdef !== null) {
-		skip = precomputeSkipMarkers(font, buffer, lookup.flag);
+		skip = precomputeSkipMarkers(font, buffer, lookupFlag);
 	}
 
 	for (let i = 0; i < len; i++) {
@@ -2378,7 +2807,7 @@ function applyChainingContextPosLookup(
 					buffer,
 					i,
 					subtable,
-					lookup.flag,
+					lookupFlag,
 				);
 				if (result) {
 					matched = true;
@@ -2390,7 +2819,7 @@ function applyChainingContextPosLookup(
 					buffer,
 					i,
 					subtable,
-					lookup.flag,
+					lookupFlag,
 				);
 				if (result) {
 					matched = true;
@@ -2398,7 +2827,7 @@ function applyChainingContextPosLookup(
 				}
 			} else if (subtable.format === 3) {
 				if (
-					matchChainingContextPosFormat3(font, buffer, i, subtable, lookup.flag)
+					matchChainingContextPosFormat3(font, buffer, i, subtable, lookupFlag)
 				) {
 					matched = true;
 					lookupRecords = subtable.lookupRecords;
@@ -2412,7 +2841,7 @@ function applyChainingContextPosLookup(
 					i,
 					lookupRecords,
 					plan,
-					glyphClassCache,
+					glyphClasses,
 					baseIndexArray,
 					hasMarks,
 				);
@@ -2437,8 +2866,20 @@ function matchContextPosFormat1(
 	const ruleSet = subtable.ruleSets[coverageIndex];
 	if (!ruleSet) return null;
 
-	for (let r = 0; r < ruleSet.length; r++) {
-		const rule = ruleSet[r]!;
+	let rules = ruleSet;
+	const index = glyphRuleIndex(
+		(subtable.ruleIndexes ??= []),
+		coverageIndex,
+		ruleSet,
+	);
+	if (index) {
+		const next = nextInputGlyph(font, buffer, startIndex + 1, lookupFlag);
+		rules = candidateRules(index, next);
+	}
+	const available = buffer.infos.length - startIndex - 1;
+	for (let r = 0; r < rules.length; r++) {
+		const rule = rules[r]!;
+		if (rule.inputSequence.length > available) continue;
 		if (
 			matchGlyphSequence(
 				font,
@@ -2470,8 +2911,23 @@ function matchContextPosFormat2(
 	const classRuleSet = subtable.classRuleSets[firstClass];
 	if (!classRuleSet) return null;
 
-	for (let r = 0; r < classRuleSet.length; r++) {
-		const rule = classRuleSet[r]!;
+	let rules = classRuleSet;
+	const index = classRuleIndex(
+		(subtable.ruleIndexes ??= []),
+		firstClass,
+		classRuleSet,
+	);
+	if (index) {
+		const next = nextInputGlyph(font, buffer, startIndex + 1, lookupFlag);
+		rules = candidateRules(
+			index,
+			next === null ? null : subtable.classDef.get(next),
+		);
+	}
+	const available = buffer.infos.length - startIndex - 1;
+	for (let r = 0; r < rules.length; r++) {
+		const rule = rules[r]!;
+		if (rule.inputClasses.length > available) continue;
 		if (
 			matchClassSequence(
 				font,
@@ -2529,8 +2985,26 @@ function matchChainingContextPosFormat1(
 	const chainRuleSet = subtable.chainRuleSets[coverageIndex];
 	if (!chainRuleSet) return null;
 
-	for (let r = 0; r < chainRuleSet.length; r++) {
-		const rule = chainRuleSet[r]!;
+	let rules = chainRuleSet;
+	const index = glyphRuleIndex(
+		(subtable.ruleIndexes ??= []),
+		coverageIndex,
+		chainRuleSet,
+	);
+	if (index) {
+		const next = nextInputGlyph(font, buffer, startIndex + 1, lookupFlag);
+		rules = candidateRules(index, next);
+	}
+	const available = buffer.infos.length - startIndex - 1;
+	for (let r = 0; r < rules.length; r++) {
+		const rule = rules[r]!;
+		// Skipped glyphs only lengthen a match: too few glyphs rejects early
+		if (
+			rule.backtrackSequence.length > startIndex ||
+			rule.inputSequence.length + rule.lookaheadSequence.length > available
+		) {
+			continue;
+		}
 		// Check backtrack (reversed order, before startIndex)
 		if (
 			!matchGlyphSequenceBackward(
@@ -2603,8 +3077,29 @@ function matchChainingContextPosFormat2(
 	const chainClassRuleSet = subtable.chainClassRuleSets[firstClass];
 	if (!chainClassRuleSet) return null;
 
-	for (let r = 0; r < chainClassRuleSet.length; r++) {
-		const rule = chainClassRuleSet[r]!;
+	let rules = chainClassRuleSet;
+	const index = classRuleIndex(
+		(subtable.ruleIndexes ??= []),
+		firstClass,
+		chainClassRuleSet,
+	);
+	if (index) {
+		const next = nextInputGlyph(font, buffer, startIndex + 1, lookupFlag);
+		rules = candidateRules(
+			index,
+			next === null ? null : subtable.inputClassDef.get(next),
+		);
+	}
+	const available = buffer.infos.length - startIndex - 1;
+	for (let r = 0; r < rules.length; r++) {
+		const rule = rules[r]!;
+		// Skipped glyphs only lengthen a match: too few glyphs rejects early
+		if (
+			rule.backtrackClasses.length > startIndex ||
+			rule.inputClasses.length + rule.lookaheadClasses.length > available
+		) {
+			continue;
+		}
 		// Check backtrack classes (reversed order)
 		if (
 			!matchClassSequenceBackward(
@@ -2732,7 +3227,7 @@ function applyNestedPosLookups(
 	startIndex: number,
 	lookupRecords: PosLookupRecord[],
 	plan: ShapePlan,
-	glyphClassCache: GlyphClassCache,
+	glyphClasses: Uint8Array,
 	baseIndexArray: Int16Array,
 	hasMarks: boolean,
 ): void {
@@ -2751,7 +3246,7 @@ function applyNestedPosLookups(
 			buffer,
 			lookupEntry.lookup,
 			plan,
-			glyphClassCache,
+			glyphClasses,
 			baseIndexArray,
 			hasMarks,
 		);
@@ -2785,7 +3280,7 @@ function applyNestedPosLookups(
 			buffer,
 			lookupEntry.lookup,
 			plan,
-			glyphClassCache,
+			glyphClasses,
 			baseIndexArray,
 			hasMarks,
 		);
@@ -2794,6 +3289,23 @@ function applyNestedPosLookups(
 
 // Sequence matching helpers
 
+/** Glyph at the first position from `pos` the lookup doesn't skip, or null */
+function nextInputGlyph(
+	font: Font,
+	buffer: GlyphBuffer,
+	pos: number,
+	lookupFlag: number,
+): GlyphId | null {
+	const infos = buffer.infos;
+	while (
+		pos < infos.length &&
+		shouldSkipGlyph(font, infos[pos]!.glyphId, lookupFlag)
+	) {
+		pos++;
+	}
+	return pos < infos.length ? infos[pos]!.glyphId : null;
+}
+
 /** Match a sequence of specific glyphs forward */
 function matchGlyphSequence(
 	font: Font,
@@ -2896,14 +3408,14 @@ function shouldSkipGlyph(
 	glyphId: GlyphId,
 	lookupFlag: number,
 ): boolean {
-	// Fast path: if no ignore flags are set, nothing to skip
+	// Fast path: if no ignore or mark filtering flags are set, nothing to skip
 	// This avoids GDEF lookup for the common case of lookupFlag === 0
-	if ((lookupFlag & 0x000e) === 0 && (lookupFlag & 0xff00) === 0) return false;
+	if ((lookupFlag & 0xff1e) === 0) return false;
 
 	const gdef = font.gdef;
 	if (!gdef) return false;
 
-	const glyphClass = getGlyphClass(gdef, glyphId);
+	const glyphClass = classAt(gdef.glyphClasses, glyphId);
 
 	if (
 		lookupFlag & LookupFlag.IgnoreBaseGlyphs &&
@@ -2915,12 +3427,15 @@ function shouldSkipGlyph(
 		glyphClass === GlyphClass.Ligature
 	)
 		return true;
-	if (lookupFlag & LookupFlag.IgnoreMarks && glyphClass === GlyphClass.Mark)
-		return true;
+	if (glyphClass !== GlyphClass.Mark) return false;
+	if (lookupFlag & LookupFlag.IgnoreMarks) return true;
+
+	const markSet = markFilteringSetOf(gdef, lookupFlag);
+	if (markSet) return !inBitset(markSet, glyphId);
 
 	const markAttachmentType = getMarkAttachmentType(lookupFlag);
-	if (markAttachmentType !== 0 && glyphClass === GlyphClass.Mark) {
-		const glyphMarkClass = gdef.markAttachClassDef.get(glyphId);
+	if (markAttachmentType !== 0) {
+		const glyphMarkClass = classAt(gdef.markAttachClasses, glyphId);
 		if (glyphMarkClass !== markAttachmentType) return true;
 	}
 
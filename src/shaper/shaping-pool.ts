@@ -0,0 +1,368 @@
+/**
+ * Shaping across worker threads. A ShapingPool splits a document's
+ * independent paragraphs or runs into contiguous shards, shapes each shard
+ * with shapeBatch on a worker, and reassembles the packed results in
+ * document order.
+ *
+ * The pool is runtime-agnostic: the caller creates the workers, and each
+ * worker module calls serveShapingWorker():
+ *
+ *   // shape-worker.ts
+ *   import { serveShapingWorker } from "text-shaper";
+ *   serveShapingWorker();
+ *
+ *   const pool = new ShapingPool({
+ *     fonts: { body: fontBytes },
+ *     createWorker: () =>
+ *       new Worker(new URL("./shape-worker.ts", import.meta.url), {
+ *         type: "module",
+ *       }),
+ *   });
+ *   const glyphs = await pool.shape("body", paragraphs);
+ */
+
+import { Font } from "../font/font.ts";
+import {
+	type ShapeBatchResult,
+	type ShapeOptions,
+	shapeBatch,
+} from "./shaper.ts";
+
+/**
+ * The subset of Worker / MessagePort / node:worker_threads used here: either
+ * addEventListener (web) or on (Node) delivers messages and failures.
+ */
+export interface ShapingWorkerLike {
+	postMessage(message: unknown, transfer?: Transferable[]): void;
+	addEventListener?(
+		type: "message" | "messageerror" | "error",
+		listener: (event: { data?: unknown; message?: string }) => void,
+	): void;
+	on?(
+		type: "message" | "messageerror" | "error" | "exit",
+		listener: (value: unknown) => void,
+	): void;
+	terminate?(): unknown;
+}
+
+export interface ShapingPoolOptions {
+	/** Creates one worker whose module calls serveShapingWorker() */
+	createWorker: () => ShapingWorkerLike;
+	/** Number of workers (default 4) */
+	size?: number;
+	/**
+	 * Fonts to load in every worker, by name. A SharedArrayBuffer is shared by
+	 * all workers; an ArrayBuffer is copied to each; a file path is loaded by
+	 * each worker with Font.loadFile, sharing the mapped file under Bun.
+	 */
+	fonts?: Record<string, FontSource>;
+}
+
+/** Font bytes, or a path for workers to load with Font.loadFile */
+export type FontSource = ArrayBuffer | SharedArrayBuffer | string;
+
+type PoolMessage =
+	| { type: "font"; name: string; data: FontSource }
+	| {
+			type: "shape";
+			id: number;
+			font: string;
+			strings: string[];
+			options: ShapeOptions;
+	  };
+
+type WorkerMessage =
+	| { type: "result"; id: number; result: ShapeBatchResult }
+	| { type: "error"; id: number; message: string };
+
+function listen(
+	target: ShapingWorkerLike,
+	listener: (message: unknown) => void,
+): void {
+	if (target.addEventListener) {
+		target.addEventListener("message", (event) => listener(event.data));
+		// MessagePort only delivers queued messages once started
+		(target as { start?: () => void }).start?.();
+	} else if (target.on) {
+		target.on("message", listener);
+	} else {
+		throw new Error("Worker has neither addEventListener nor on");
+	}
+}
+
+/**
+ * Report a worker failure: an uncaught error, a message that could not be
+ * deserialized, or (Node) the worker exiting
+ */
+function listenForFailure(
+	target: ShapingWorkerLike,
+	listener: (error: Error) => void,
+): void {
+	const failed = (reason: string) =>
+		listener(new Error(`Shaping worker failed: ${reason}`));
+	if (target.addEventListener) {
+		target.addEventListener("error", (event) =>
+			failed(event.message ?? "uncaught error"),
+		);
+		target.addEventListener("messageerror", () =>
+			failed("message could not be deserialized"),
+		);
+	} else if (target.on) {
+		target.on("error", (error) =>
+			failed(error instanceof Error ? error.message : String(error)),
+		);
+		target.on("messageerror", () =>
+			failed("message could not be deserialized"),
+		);
+		target.on("exit", (code) => failed(`exited with code ${code}`));
+	}
+}
+
+/**
+ * Serve shaping requests from a ShapingPool. Call it at the top level of the
+ * worker module; pass parentPort under node:worker_threads.
+ */
+export function serveShapingWorker(
+	port: ShapingWorkerLike = globalThis as unknown as ShapingWorkerLike,
+): void {
+	const fonts = new Map<string, Promise<Font>>();
+	listen(port, async (data) => {
+		const message = data as PoolMessage;
+		if (message.type === "font") {
+			const loading =
+				typeof message.data === "string"
+					? Font.loadFile(message.data)
+					: Font.loadAsync(message.data as ArrayBuffer);
+			// A load error is reported by the shape requests that use the font
+			loading.catch(() => {});
+			fonts.set(message.name, loading);
+			return;
+		}
+		try {
+			const font = await fonts.get(message.font);
+			if (!font) throw new Error(`Unknown font "${message.font}"`);
+			const result = shapeBatch(font, message.strings, message.options);
+			const reply: WorkerMessage = {
+				type: "result",
+				id: message.id,
+				result,
+			};
+			port.postMessage(reply, [
+				result.offsets.buffer,
+				result.glyphIds.buffer,
+				result.clusters.buffer,
+				result.positions.buffer,
+			]);
+		} catch (error) {
+			const reply: WorkerMessage = {
+				type: "error",
+				id: message.id,
+				message: error instanceof Error ? error.message : String(error),
+			};
+			port.postMessage(reply);
+		}
+	});
+}
+
+interface Shard {
+	font: string;
+	strings: string[];
+	options: ShapeOptions;
+	resolve: (result: ShapeBatchResult) => void;
+	reject: (error: Error) => void;
+}
+
+// Shards per worker, so a slow shard doesn't leave the other workers idle
+const SHARDS_PER_WORKER = 4;
+
+/**
+ * Shards shapeBatch work across workers; see the module comment. A worker
+ * that fails (uncaught error, undeliverable message, exit) is dropped and
+ * the shape waiting on its shard is rejected; the other workers carry on.
+ */
+export class ShapingPool {
+	private readonly workers: ShapingWorkerLike[] = [];
+	/** Workers with no shard in flight */
+	private readonly idle: number[] = [];
+	/** Id of the shard each worker is running, -1 when idle */
+	private readonly running: number[] = [];
+	/** Workers dropped after a failure */
+	private readonly dropped: boolean[] = [];
+	private readonly queue: Shard[] = [];
+	private readonly pending = new Map<number, Shard>();
+	private nextId = 0;
+	private live = 0;
+	private terminated = false;
+
+	constructor(options: ShapingPoolOptions) {
+		const size = Math.max(1, options.size ?? 4);
+		for (let i = 0; i < size; i++) {
+			const worker = options.createWorker();
+			listen(worker, (data) => this.settle(i, data as WorkerMessage));
+			listenForFailure(worker, (error) => this.fail(i, error));
+			this.workers.push(worker);
+			this.running.push(-1);
+			this.dropped.push(false);
+			this.idle.push(i);
+		}
+		this.live = size;
+		for (const [name, data] of Object.entries(options.fonts ?? {})) {
+			this.addFont(name, data);
+		}
+	}
+
+	/** Number of workers */
+	get size(): number {
+		return this.workers.length;
+	}
+
+	/** Load a font in every worker under `name` */
+	addFont(name: string, data: FontSource): void {
+		const message: PoolMessage = { type: "font", name, data };
+		for (const worker of this.workers) worker.postMessage(message);
+	}
+
+	/**
+	 * Shape independent strings (paragraphs, runs) with the named font.
+	 * Resolves to one packed result in input order, as shapeBatch would
+	 * return on this thread. Rejects if a worker running one of its shards
+	 * fails, or if the pool is terminated or has no workers left.
+	 */
+	async shape(
+		font: string,
+		strings: readonly string[],
+		options: ShapeOptions = {},
+	): Promise<ShapeBatchResult> {
+		if (this.terminated) throw new Error("ShapingPool terminated");
+		if (this.live === 0) throw new Error("ShapingPool has no live workers");
+		const shards = splitShards(
+			strings,
+			this.workers.length * SHARDS_PER_WORKER,
+		);
+		const results = shards.map(
+			(shard) =>
+				new Promise<ShapeBatchResult>((resolve, reject) => {
+					this.queue.push({
+						font,
+						strings: shard,
+						options,
+						resolve,
+						reject,
+					});
+				}),
+		);
+		this.pump();
+		return concatResults(await Promise.all(results));
+	}
+
+	/** Terminate every worker; pending shapes are rejected */
+	terminate(): void {
+		this.terminated = true;
+		for (const worker of this.workers) worker.terminate?.();
+		const error = new Error("ShapingPool terminated");
+		for (const shard of this.pending.values()) shard.reject(error);
+		for (const shard of this.queue) shard.reject(error);
+		this.pending.clear();
+		this.queue.length = 0;
+		this.idle.length = 0;
+	}
+
+	/** Hand queued shards to idle workers, one shard per worker at a time */
+	private pump(): void {
+		while (this.idle.length > 0 && this.queue.length > 0) {
+			const worker = this.idle.pop()!;
+			const shard = this.queue.shift()!;
+			const id = this.nextId++;
+			this.pending.set(id, shard);
+			this.running[worker] = id;
+			const message: PoolMessage = {
+				type: "shape",
+				id,
+				font: shard.font,
+				strings: shard.strings,
+				options: shard.options,
+			};
+			this.workers[worker]!.postMessage(message);
+		}
+	}
+
+	private settle(worker: number, message: WorkerMessage): void {
+		const shard = this.pending.get(message.id);
+		if (!shard || this.dropped[worker]) return;
+		this.pending.delete(message.id);
+		this.running[worker] = -1;
+		this.idle.push(worker);
+		if (message.type === "result") shard.resolve(message.result);
+		else shard.reject(new Error(message.message));
+		this.pump();
+	}
+
+	/** Drop a failed worker and reject the shard it was running */
+	private fail(worker: number, error: Error): void {
+		// Terminated workers may still report an exit
+		if (this.terminated || this.dropped[worker]) return;
+		this.dropped[worker] = true;
+		this.live--;
+		this.workers[worker]!.terminate?.();
+		const idle = this.idle.indexOf(worker);
+		if (idle >= 0) this.idle.splice(idle, 1);
+
+		const id = this.running[worker]!;
+		const shard = this.pending.get(id);
+		if (shard) {
+			this.pending.delete(id);
+			shard.reject(error);
+		}
+		if (this.live === 0) {
+			for (const queued of this.queue) queued.reject(error);
+			this.queue.length = 0;
+		}
+	}
+}
+
+/** Contiguous shards of roughly equal total length, at most `count` */
+function splitShards(strings: readonly string[], count: number): string[][] {
+	let total = 0;
+	for (let i = 0; i < strings.length; i++) total += strings[i]!.length;
+	const target = total / count;
+	const shards: string[][] = [];
+	let shard: string[] = [];
+	let length = 0;
+	for (let i = 0; i < strings.length; i++) {
+		shard.push(strings[i]!);
+		length += strings[i]!.length;
+		const last = shards.length === count - 1;
+		if (!last && length >= target * (shards.length + 1)) {
+			shards.push(shard);
+			shard = [];
+		}
+	}
+	if (shard.length > 0 || shards.length === 0) shards.push(shard);
+	return shards;
+}
+
+function concatResults(results: ShapeBatchResult[]): ShapeBatchResult {
+	if (results.length === 1) return results[0]!;
+	let strings = 0;
+	let glyphs = 0;
+	for (const result of results) {
+		strings += result.offsets.length - 1;
+		glyphs += result.glyphIds.length;
+	}
+	const offsets = new Uint32Array(strings + 1);
+	const glyphIds = new Uint16Array(glyphs);
+	const clusters = new Uint32Array(glyphs);
+	const positions = new Float32Array(glyphs * 4);
+	let s = 0;
+	let g = 0;
+	for (const result of results) {
+		const count = result.offsets.length - 1;
+		for (let i = 1; i <= count; i++) offsets[s + i] = result.offsets[i]! + g;
+		glyphIds.set(result.glyphIds, g);
+		clusters.set(result.clusters, g);
+		positions.set(result.positions, g * 4);
+		s += count;
+		g += result.glyphIds.length;
+	}
+	return { offsets, glyphIds, clusters, positions };
+}
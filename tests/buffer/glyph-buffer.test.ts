@@ -1,5 +1,9 @@
 import { describe, expect, test } from "bun:test";
-import { GlyphBuffer } from "../../src/buffer/glyph-buffer.ts";
+import {
+	GlyphBuffer,
+	moveElement,
+	rotateElements,
+} from "../../src/buffer/glyph-buffer.ts";
 import { Direction, type GlyphInfo, type GlyphPosition } from "../../src/types.ts";
 
 function createInfo(glyphId: number, cluster: number, codepoint = 0): GlyphInfo {
@@ -338,6 +342,41 @@ describe("GlyphBuffer", () => {
 		});
 	});
 
+	describe("moveElement", () => {
+		test("moves an element backward, shifting the ones between", () => {
+			const items = [1, 2, 3, 4, 5];
+			moveElement(items, 3, 1);
+			expect(items).toEqual([1, 4, 2, 3, 5]);
+		});
+
+		test("moves an element forward", () => {
+			const items = [1, 2, 3, 4, 5];
+			moveElement(items, 0, 3);
+			expect(items).toEqual([2, 3, 4, 1, 5]);
+		});
+
+		test("works on typed arrays", () => {
+			const items = Uint8Array.of(0, 0, 1);
+			moveElement(items, 2, 0);
+			expect(Array.from(items)).toEqual([1, 0, 0]);
+		});
+	});
+
+	describe("rotateElements", () => {
+		test("moves trailing block before leading block", () => {
+			const items = [1, 2, 3, 4, 5, 6];
+			rotateElements(items, 1, 3, 5);
+			expect(items).toEqual([1, 4, 5, 2, 3, 6]);
+		});
+
+		test("ignores empty blocks", () => {
+			const items = [1, 2, 3];
+			rotateElements(items, 0, 0, 3);
+			rotateElements(items, 0, 3, 3);
+			expect(items).toEqual([1, 2, 3]);
+		});
+	});
+
 	describe("getTotalAdvance", () => {
 		test("sums advances", () => {
 			const buffer = new GlyphBuffer();
@@ -0,0 +1,115 @@
+import { afterEach, beforeAll, describe, expect, test } from "bun:test";
+import {
+	type CacheStats,
+	getCacheStats,
+	OwnerCache,
+	setCacheBudget,
+	trimCaches,
+	WeakCache,
+} from "../src/cache.ts";
+import { Font } from "../src/font/font.ts";
+import { getGlyphPath } from "../src/render/path.ts";
+
+function statsFor(name: string): CacheStats {
+	const stats = getCacheStats().caches.find((c) => c.name === name);
+	if (!stats) throw new Error(`no cache named ${name}`);
+	return stats;
+}
+
+describe("cache registry", () => {
+	let font: Font;
+
+	beforeAll(async () => {
+		font = await Font.fromFile("tests/fixtures/NotoSansCoptic-Regular.ttf");
+	});
+
+	afterEach(() => {
+		setCacheBudget(256 * 1024 * 1024);
+	});
+
+	test("accounts glyph paths and trims them", () => {
+		trimCaches(1);
+		for (let gid = 1; gid < 40; gid++) getGlyphPath(font, gid);
+		const before = statsFor("render.path");
+		expect(before.entries).toBe(39);
+		expect(before.bytes).toBeGreaterThan(0);
+
+		trimCaches(0.5);
+		const after = statsFor("render.path");
+		expect(after.entries).toBeLessThan(before.entries);
+		expect(after.bytes).toBeLessThan(before.bytes);
+
+		trimCaches(1);
+		const cleared = statsFor("render.path");
+		expect(cleared.entries).toBe(0);
+		expect(cleared.bytes).toBe(0);
+		// Trimmed paths are rebuilt on demand
+		expect(getGlyphPath(font, 5)).toEqual(getGlyphPath(font, 5));
+	});
+
+	test("enforces the byte budget", () => {
+		trimCaches(1);
+		setCacheBudget(16 * 1024);
+		for (let gid = 1; gid < font.numGlyphs; gid++) getGlyphPath(font, gid);
+		expect(getCacheStats().bytes).toBeLessThanOrEqual(16 * 1024);
+		expect(statsFor("render.path").evictions).toBeGreaterThan(0);
+	});
+
+	test("evicts the oldest entry past maxEntries", () => {
+		const owner = {};
+		const cache = new OwnerCache<object, number, string>("test.small", {
+			sizeOf: (value) => value.length,
+			maxEntries: 2,
+		});
+		cache.set(owner, 1, "a");
+		cache.set(owner, 2, "bb");
+		cache.set(owner, 3, "ccc");
+		expect(cache.get(owner, 1)).toBeUndefined();
+		expect(cache.get(owner, 3)).toBe("ccc");
+		const stats = cache.stats();
+		expect([stats.entries, stats.bytes, stats.evictions]).toEqual([2, 5, 1]);
+
+		cache.set(owner, 3, "c");
+		expect(cache.stats().bytes).toBe(3);
+	});
+
+	test("evicts the least recently used entry", () => {
+		const owner = {};
+		const cache = new OwnerCache<object, number, string>("test.lru", {
+			sizeOf: (value) => value.length,
+			maxEntries: 2,
+		});
+		cache.set(owner, 1, "a");
+		cache.set(owner, 2, "b");
+		expect(cache.get(owner, 1)).toBe("a");
+		cache.set(owner, 3, "c");
+		expect(cache.has(owner, 2)).toBe(false);
+		expect(cache.get(owner, 1)).toBe("a");
+		expect(cache.get(owner, 3)).toBe("c");
+
+		// Trimming also goes by recency
+		cache.get(owner, 1);
+		cache.trim(0.5);
+		expect([cache.has(owner, 1), cache.has(owner, 3)]).toEqual([true, false]);
+	});
+
+	test("trims the least recently used owners of a WeakCache", () => {
+		const cache = new WeakCache<object, string>("test.weak", {
+			sizeOf: (value) => value.length,
+		});
+		const owners = [{}, {}, {}];
+		owners.forEach((owner, i) => cache.set(owner, `v${i}`));
+		expect(cache.get(owners[0]!)).toBe("v0");
+		cache.trim(1 / 3);
+		expect(owners.map((owner) => cache.get(owner))).toEqual([
+			"v0",
+			undefined,
+			"v2",
+		]);
+	});
+
+	test("rejects invalid budgets", () => {
+		expect(() => setCacheBudget(-1)).toThrow(RangeError);
+		expect(() => setCacheBudget(Number.NaN)).toThrow(RangeError);
+	});
+});
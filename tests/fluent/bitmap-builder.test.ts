@@ -0,0 +1,91 @@
+import { describe, expect, test } from "bun:test";
+import { BitmapBuilder } from "../../src/fluent/bitmap-builder.ts";
+import {
+	addBitmaps,
+	copyBitmap,
+	padBitmap,
+	shiftBitmap,
+} from "../../src/raster/bitmap-utils.ts";
+import { gaussianBlur } from "../../src/raster/blur.ts";
+import { createBitmap, PixelMode } from "../../src/raster/types.ts";
+
+function ramp(width: number, rows: number, mode = PixelMode.Gray) {
+	const bitmap = createBitmap(width, rows, mode);
+	for (let i = 0; i < bitmap.buffer.length; i++) {
+		bitmap.buffer[i] = (i * 37 + 11) & 255;
+	}
+	return bitmap;
+}
+
+describe("fluent/BitmapBuilder", () => {
+	test("fused pad/shift runs match the individual operations", () => {
+		for (const mode of [PixelMode.Gray, PixelMode.LCD, PixelMode.Mono]) {
+			const bitmap = ramp(6, 5, mode);
+			const result = BitmapBuilder.fromBitmapWithBearing(bitmap, 1, 4)
+				.pad(2, 1, 0, 3)
+				.shift(-3, 2)
+				.pad(1)
+				.shift(4, -1)
+				.toRasterizedGlyph();
+
+			let expected = padBitmap(bitmap, 2, 1, 0, 3);
+			expected = shiftBitmap(expected, -3, 2);
+			expected = padBitmap(expected, 1, 1, 1, 1);
+			expected = shiftBitmap(expected, 4, -1);
+
+			expect(result.bitmap.width).toBe(expected.width);
+			expect(result.bitmap.rows).toBe(expected.rows);
+			expect(Array.from(result.bitmap.buffer)).toEqual(
+				Array.from(expected.buffer),
+			);
+			expect(result.bearingX).toBe(1 - 2 - 3 - 1 + 4);
+			expect(result.bearingY).toBe(4 + 1 - 2 + 1 + 1);
+		}
+	});
+
+	test("chains run in place without touching their inputs", () => {
+		const bitmap = ramp(8, 8);
+		const other = ramp(4, 4);
+		const before = Array.from(bitmap.buffer);
+
+		const base = BitmapBuilder.fromBitmap(bitmap);
+		const blurred = base.blur(1);
+		const result = blurred.add(other, 2, 2).add(blurred, 1, 0).toBitmap();
+
+		const step = gaussianBlur(copyBitmap(bitmap), 1);
+		const expected = copyBitmap(step);
+		addBitmaps(expected, other, 2, 2);
+		addBitmaps(expected, step, 1, 0);
+
+		expect(Array.from(result.buffer)).toEqual(Array.from(expected.buffer));
+		expect(Array.from(bitmap.buffer)).toEqual(before);
+		expect(Array.from(blurred.toBitmap().buffer)).toEqual(
+			Array.from(step.buffer),
+		);
+		expect(Array.from(base.toBitmap().buffer)).toEqual(before);
+	});
+
+	test("operations are deferred until a result is requested", () => {
+		const bitmap = ramp(3, 3);
+		const builder = BitmapBuilder.fromBitmap(bitmap).pad(1).shift(1, 0);
+		// fromBitmap copies, so later edits to the source are not observed
+		bitmap.buffer.fill(0);
+		expect(builder.width).toBe(5);
+		expect(builder.bearingX).toBe(0);
+		expect(builder.toBitmap().buffer[1 * 5 + 2]).toBe(11);
+	});
+
+	test("compositing operands are validated and copied when recorded", () => {
+		const base = BitmapBuilder.create(4, 4);
+		expect(() => base.add(null as never)).toThrow(TypeError);
+		expect(() => base.blend({} as never, 0, 0)).toThrow(TypeError);
+
+		// Editing the operand after recording must not reach the result, as
+		// with eager evaluation
+		const other = createBitmap(4, 4, PixelMode.Gray);
+		other.buffer.fill(5);
+		const added = base.add(other).max(other);
+		other.buffer.fill(9);
+		expect(Array.from(added.toBitmap().buffer)).toEqual(Array(16).fill(5));
+	});
+});
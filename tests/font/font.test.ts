@@ -1,4 +1,5 @@
 import { describe, expect, test, beforeAll } from "bun:test";
+import { readFileSync } from "node:fs";
 import { Face } from "../../src/font/face.ts";
 import { Font } from "../../src/font/font.ts";
 import { Tags, tag } from "../../src/types.ts";
@@ -904,3 +905,22 @@ describe("Font table access patterns", () => {
 		expect(() => font.cmap).not.toThrow();
 	});
 });
+
+describe("Font.loadFile", () => {
+	const path = "tests/fixtures/NotoSansCoptic-Regular.ttf";
+
+	test("loads a mapped file like its bytes", async () => {
+		const mapped = await Font.loadFile(path);
+		const read = Font.load(new Uint8Array(readFileSync(path)).buffer);
+		const glyphId = read.glyphId(0x2c80);
+		expect(mapped.numGlyphs).toBe(read.numGlyphs);
+		expect(mapped.glyphId(0x2c80)).toBe(glyphId);
+		expect(mapped.getGlyphContoursAndBounds(glyphId)).toEqual(
+			read.getGlyphContoursAndBounds(glyphId),
+		);
+	});
+
+	test("throws for missing file", async () => {
+		await expect(Font.loadFile("/nonexistent/font.ttf")).rejects.toThrow();
+	});
+});
@@ -2,7 +2,9 @@ import { describe, expect, test, beforeAll } from "bun:test";
 import { Font } from "../../../src/font/font.ts";
 import {
 	parseGdef,
+	classAt,
 	getGlyphClass,
+	inBitset,
 	isBaseGlyph,
 	isLigature,
 	isMark,
@@ -2176,3 +2178,42 @@ describe("gdef table - null GDEF tests", () => {
 		expect(isComponent(null, 0)).toBe(false);
 	});
 });
+
+describe("gdef table - dense class arrays", () => {
+	let font: Font;
+	let gdef: GdefTable;
+
+	beforeAll(async () => {
+		font = await Font.fromFile("tests/fixtures/NotoNaskhArabic[wght].ttf");
+		gdef = font.gdef!;
+	});
+
+	test("glyphClasses and markAttachClasses match the class defs", () => {
+		for (let glyphId = 0; glyphId < font.numGlyphs + 8; glyphId++) {
+			expect(classAt(gdef.glyphClasses, glyphId)).toBe(
+				gdef.glyphClassDef.get(glyphId),
+			);
+			expect(classAt(gdef.markAttachClasses, glyphId)).toBe(
+				gdef.markAttachClassDef.get(glyphId),
+			);
+		}
+	});
+
+	test("mark set bitsets agree with has()", () => {
+		const sets = gdef.markGlyphSets!;
+		expect(sets.bitsets.length).toBeGreaterThan(0);
+		for (let set = 0; set < sets.bitsets.length; set++) {
+			let members = 0;
+			for (let glyphId = 0; glyphId < font.numGlyphs; glyphId++) {
+				const member = inBitset(sets.bitsets[set]!, glyphId);
+				expect(sets.has(set, glyphId)).toBe(member);
+				if (member) {
+					members++;
+					expect(getGlyphClass(gdef, glyphId)).toBe(GlyphClass.Mark);
+				}
+			}
+			expect(members).toBeGreaterThan(0);
+		}
+		expect(sets.has(sets.bitsets.length, 0)).toBe(false);
+	});
+});
@@ -6,6 +6,10 @@ import {
 	ValueFormat,
 	getKerning,
 	applyKerningDirect,
+	applyPairKerning,
+	getPairKerning,
+	isKerningOnlyPairPos,
+	MAX_DENSE_PAIR_CELLS,
 	type GposTable,
 	type SinglePosLookup,
 	type PairPosLookup,
@@ -16,7 +20,10 @@ import {
 	type ValueRecord,
 	type Anchor,
 } from "../../../src/font/tables/gpos.ts";
+import { ClassDef } from "../../../src/layout/structures/class-def.ts";
+import { Coverage } from "../../../src/layout/structures/coverage.ts";
 import { LookupFlag } from "../../../src/layout/structures/layout-common.ts";
+import { SetDigest } from "../../../src/layout/structures/set-digest.ts";
 
 const ARIAL_PATH = "/System/Library/Fonts/Supplemental/Arial.ttf";
 const NOTO_NEWA_PATH =
@@ -2639,3 +2646,149 @@ describe("applyKerningDirect", () => {
 		}
 	});
 });
+
+describe("compiled pair kerning", () => {
+	const newPos = () => ({ xAdvance: 500, yAdvance: 0, xOffset: 0, yOffset: 0 });
+
+	function pairLookup(subtables: PairPosLookup["subtables"]): PairPosLookup {
+		return {
+			type: GposLookupType.Pair,
+			flag: 0,
+			digest: new SetDigest(),
+			subtables,
+		};
+	}
+
+	function classLookup(
+		class1Count: number,
+		class2Count: number,
+		adv: (c1: number, c2: number) => number,
+		valueFormat2 = 0,
+	): PairPosLookup {
+		const class1Records = [];
+		for (let c1 = 0; c1 < class1Count; c1++) {
+			const class2Records = [];
+			for (let c2 = 0; c2 < class2Count; c2++) {
+				class2Records.push({
+					value1: { xAdvance: adv(c1, c2) },
+					value2: valueFormat2 ? { xAdvance: -adv(c1, c2) } : {},
+				});
+			}
+			class1Records.push({ class2Records });
+		}
+		// Glyph g (1..class1Count-1) is in class1 g; glyph 100 + c is in class2 c
+		const class1Values = new Uint16Array(class1Count);
+		for (let i = 0; i < class1Count; i++) class1Values[i] = i;
+		const class2Values = new Uint16Array(class2Count);
+		for (let i = 0; i < class2Count; i++) class2Values[i] = i;
+		const covered = new Uint16Array(class1Count);
+		for (let i = 0; i < class1Count; i++) covered[i] = i;
+		return pairLookup([
+			{
+				format: 2,
+				coverage: Coverage.format1(covered),
+				valueFormat1: ValueFormat.XAdvance,
+				valueFormat2,
+				classDef1: ClassDef.format1(0, class1Values),
+				classDef2: ClassDef.format1(100, class2Values),
+				class1Count,
+				class2Count,
+				class1Records,
+			},
+		]);
+	}
+
+	test("format 1 matches applyKerningDirect", () => {
+		const lookup = pairLookup([
+			{
+				format: 1,
+				coverage: Coverage.format1(new Uint16Array([5, 9])),
+				valueFormat1: ValueFormat.XAdvance,
+				valueFormat2: ValueFormat.XAdvance,
+				pairSets: [
+					{
+						pairValueRecords: [
+							{ secondGlyph: 3, value1: { xAdvance: -10 }, value2: { xAdvance: 4 } },
+							{ secondGlyph: 7, value1: { xAdvance: -20 }, value2: {} },
+						],
+					},
+					{
+						pairValueRecords: [
+							{ secondGlyph: 1, value1: { xAdvance: 15 }, value2: {} },
+						],
+					},
+				],
+			},
+		]);
+		const kerning = getPairKerning(lookup);
+
+		for (const first of [5, 9, 6]) {
+			for (const second of [1, 3, 7, 8]) {
+				const a1 = newPos();
+				const a2 = newPos();
+				const b1 = newPos();
+				const b2 = newPos();
+				const expected = applyKerningDirect(lookup, first, second, a1, a2);
+				expect(applyPairKerning(kerning, first, second, b1, b2)).toBe(expected);
+				expect(b1).toEqual(a1);
+				expect(b2).toEqual(a2);
+			}
+		}
+	});
+
+	test("format 2 uses a dense class matrix", () => {
+		const lookup = classLookup(4, 5, (c1, c2) => c1 * 10 - c2, ValueFormat.XAdvance);
+		const kerning = getPairKerning(lookup);
+		const st = kerning.subtables[0]!;
+		expect(st.format).toBe(2);
+		if (st.format === 2) {
+			expect(st.matrix1).toBeInstanceOf(Int16Array);
+			expect(st.matrix1!.length).toBe(20);
+			expect(st.sparse1).toBeNull();
+		}
+
+		const pos1 = newPos();
+		const pos2 = newPos();
+		expect(applyPairKerning(kerning, 3, 102, pos1, pos2)).toBe(true);
+		expect(pos1.xAdvance).toBe(528);
+		expect(pos2.xAdvance).toBe(472);
+	});
+
+	test("format 2 falls back to a sparse map for huge class counts", () => {
+		const class2Count = Math.ceil(MAX_DENSE_PAIR_CELLS / 2) + 1;
+		const lookup = classLookup(2, class2Count, (c1, c2) =>
+			c1 === 1 && c2 === 7 ? -42 : 0,
+		);
+		const kerning = getPairKerning(lookup);
+		const st = kerning.subtables[0]!;
+		if (st.format === 2) {
+			expect(st.matrix1).toBeNull();
+			expect(st.sparse1!.size).toBe(1);
+		}
+
+		const pos1 = newPos();
+		const pos2 = newPos();
+		expect(applyPairKerning(kerning, 1, 107, pos1, pos2)).toBe(true);
+		expect(pos1.xAdvance).toBe(458);
+
+		// Matched with a zero value still stops at this subtable
+		const pos3 = newPos();
+		expect(applyPairKerning(kerning, 1, 108, pos3, newPos())).toBe(true);
+		expect(pos3.xAdvance).toBe(500);
+	});
+
+	test("compiled form is cached per lookup", () => {
+		const lookup = classLookup(2, 2, () => -5);
+		expect(getPairKerning(lookup)).toBe(getPairKerning(lookup));
+	});
+
+	test("isKerningOnlyPairPos checks both value formats", () => {
+		const kern = classLookup(2, 2, () => -5, ValueFormat.XAdvance);
+		expect(isKerningOnlyPairPos(kern)).toBe(true);
+		expect(getPairKerning(kern).kerningOnly).toBe(true);
+
+		const placement = classLookup(2, 2, () => -5);
+		placement.subtables[0]!.valueFormat2 = ValueFormat.XPlacement;
+		expect(isKerningOnlyPairPos(placement)).toBe(false);
+	});
+});
@@ -6,6 +6,7 @@ import {
 	applySingleSubst,
 	applyLigatureSubst,
 	applyLigatureSubstDirect,
+	ligatureTrie,
 	__testing,
 	type GsubTable,
 	type SingleSubstLookup,
@@ -3819,3 +3820,37 @@ describe("GSUB Extension lookup unit tests", () => {
 		expect(lookup!.type).toBe(GsubLookupType.Context);
 	});
 });
+
+describe("ligatureTrie", () => {
+	const set = {
+		ligatures: [
+			{ ligatureGlyph: 100, componentGlyphIds: [2, 3] },
+			{ ligatureGlyph: 101, componentGlyphIds: [2] },
+			{ ligatureGlyph: 102, componentGlyphIds: [2, 3, 4] },
+			{ ligatureGlyph: 103, componentGlyphIds: [2, 3] },
+		],
+	};
+
+	test("shares component prefixes", () => {
+		const root = ligatureTrie(set);
+		expect(root.ligatureGlyph).toBe(-1);
+		expect(root.glyphs).toEqual([2]);
+		const two = root.children[0]!;
+		expect(two.ligatureGlyph).toBe(101);
+		expect(two.glyphs).toEqual([3]);
+		const three = two.children[0]!;
+		expect(three.children[0]!.ligatureGlyph).toBe(102);
+	});
+
+	test("keeps the earliest rule for each sequence", () => {
+		const three = ligatureTrie(set).children[0]!.children[0]!;
+		expect(three.ligatureGlyph).toBe(100);
+		expect(three.rule).toBe(0);
+		expect(three.minRule).toBe(0);
+		expect(three.children[0]!.minRule).toBe(2);
+	});
+
+	test("is built once per set", () => {
+		expect(ligatureTrie(set)).toBe(ligatureTrie(set));
+	});
+});
@@ -0,0 +1,65 @@
+import { afterEach, beforeAll, describe, expect, test } from "bun:test";
+import { UnicodeBuffer } from "../src/buffer/unicode-buffer.ts";
+import { Font } from "../src/font/font.ts";
+import {
+	getInstrumentationSnapshot,
+	recordTime,
+	resetInstrumentation,
+	setInstrumentation,
+} from "../src/instrument.ts";
+import { getGlyphPath } from "../src/render/path.ts";
+import { releaseBuffer, shape } from "../src/shaper/shaper.ts";
+
+describe("instrumentation", () => {
+	let font: Font;
+
+	beforeAll(async () => {
+		font = await Font.fromFile("tests/fixtures/NotoNaskhArabic[wght].ttf");
+	});
+
+	afterEach(() => {
+		setInstrumentation(false);
+		resetInstrumentation();
+	});
+
+	function shapeArabic(text: string): void {
+		const buffer = new UnicodeBuffer().addStr(text);
+		releaseBuffer(shape(font, buffer, { script: "arab", direction: "rtl" }));
+	}
+
+	test("records nothing while disabled", () => {
+		shapeArabic("مرحبا");
+		expect(getInstrumentationSnapshot()).toEqual({ counters: {}, timers: {} });
+	});
+
+	test("counts shape plan hits and lookups", () => {
+		setInstrumentation(true);
+		shapeArabic("مرحبا");
+		shapeArabic("بِسْمِ");
+		const { counters } = getInstrumentationSnapshot();
+		expect(counters["shapePlan.hit"]).toBeGreaterThanOrEqual(1);
+		expect(counters["gsub.lookup.applied"]).toBeGreaterThan(0);
+		expect(counters["gsub.lookup.skipped"]).toBeGreaterThan(0);
+		expect(counters["gpos.lookup.applied"]).toBeGreaterThan(0);
+	});
+
+	test("counts path cache hits and misses", () => {
+		setInstrumentation(true);
+		const glyphId = font.glyphId(0x0628);
+		getGlyphPath(font, glyphId);
+		getGlyphPath(font, glyphId);
+		const { counters } = getInstrumentationSnapshot();
+		expect(counters["cache.path.hit"]).toBeGreaterThanOrEqual(1);
+	});
+
+	test("snapshots are copies and reset clears them", () => {
+		recordTime("test.timer", 2);
+		recordTime("test.timer", 3);
+		const snapshot = getInstrumentationSnapshot();
+		expect(snapshot.timers["test.timer"]).toEqual({ ms: 5, count: 2 });
+		recordTime("test.timer", 1);
+		expect(snapshot.timers["test.timer"]).toEqual({ ms: 5, count: 2 });
+		resetInstrumentation();
+		expect(getInstrumentationSnapshot().timers).toEqual({});
+	});
+});
@@ -0,0 +1,64 @@
+import { describe, expect, test } from "bun:test";
+import {
+	candidateRules,
+	classRuleIndex,
+	glyphRuleIndex,
+	type RuleIndexSlots,
+} from "../../../src/layout/structures/rule-index.ts";
+
+type Rule = { name: string; inputSequence: number[] };
+
+function rule(name: string, ...inputSequence: number[]): Rule {
+	return { name, inputSequence };
+}
+
+function names(rules: Rule[]): string[] {
+	return rules.map((r) => r.name);
+}
+
+describe("glyphRuleIndex", () => {
+	const rules = [
+		rule("a", 10, 11),
+		rule("single"),
+		rule("b", 20),
+		rule("c", 10),
+		rule("d", 30, 31),
+	];
+
+	test("buckets by second input glyph, keeping rule order", () => {
+		const index = glyphRuleIndex([], 0, rules)!;
+		expect(names(candidateRules(index, 10))).toEqual(["a", "single", "c"]);
+		expect(names(candidateRules(index, 20))).toEqual(["single", "b"]);
+		expect(names(candidateRules(index, 30))).toEqual(["single", "d"]);
+	});
+
+	test("falls back to one-glyph rules", () => {
+		const index = glyphRuleIndex([], 0, rules)!;
+		expect(names(candidateRules(index, 99))).toEqual(["single"]);
+		expect(names(candidateRules(index, null))).toEqual(["single"]);
+	});
+
+	test("caches in the slot and skips small sets", () => {
+		const slots: RuleIndexSlots<Rule> = [];
+		const index = glyphRuleIndex(slots, 2, rules);
+		expect(slots[2]).toBe(index);
+		expect(glyphRuleIndex(slots, 2, rules)).toBe(index);
+		expect(glyphRuleIndex(slots, 0, rules.slice(0, 2))).toBeNull();
+		expect(slots[0]).toBeNull();
+	});
+});
+
+describe("classRuleIndex", () => {
+	test("buckets by second input class", () => {
+		const rules = [
+			{ id: 0, inputClasses: [1, 2] },
+			{ id: 1, inputClasses: [2] },
+			{ id: 2, inputClasses: [1] },
+			{ id: 3, inputClasses: [] },
+		];
+		const index = classRuleIndex([], 0, rules)!;
+		expect(candidateRules(index, 1).map((r) => r.id)).toEqual([0, 2, 3]);
+		expect(candidateRules(index, 2).map((r) => r.id)).toEqual([1, 3]);
+		expect(candidateRules(index, 0).map((r) => r.id)).toEqual([3]);
+	});
+});
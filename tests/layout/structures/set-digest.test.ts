@@ -52,6 +52,19 @@ describe("SetDigest", () => {
 		});
 	});
 
+	describe("clear", () => {
+		test("removes all glyphs", () => {
+			const digest = new SetDigest();
+			digest.add(10);
+			digest.add(300);
+			digest.clear();
+
+			expect(digest.mayHave(10)).toBe(false);
+			expect(digest.mayHave(300)).toBe(false);
+			expect(digest.getMasks()).toEqual({ mask0: 0, mask1: 0, mask2: 0 });
+		});
+	});
+
 	describe("addRange", () => {
 		test("adds small range individually (< 32)", () => {
 			const digest = new SetDigest();
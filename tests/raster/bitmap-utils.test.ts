@@ -1517,4 +1517,61 @@ describe("raster/bitmap-utils", () => {
 			expect(hasContent).toBe(true);
 		});
 	});
+
+	describe("blend operators - exact rounding", () => {
+		// Every (dst, src) byte pair: row = dst value, column = src value
+		function pairBitmaps(): { dst: Bitmap; src: Bitmap } {
+			const dst = createBitmap(256, 256, PixelMode.Gray);
+			const src = createBitmap(256, 256, PixelMode.Gray);
+			for (let d = 0; d < 256; d++) {
+				for (let s = 0; s < 256; s++) {
+					dst.buffer[d * 256 + s] = d;
+					src.buffer[d * 256 + s] = s;
+				}
+			}
+			return { dst, src };
+		}
+
+		test("mulBitmaps rounds dst * src / 255", () => {
+			const { dst, src } = pairBitmaps();
+			mulBitmaps(dst, src);
+			for (let d = 0; d < 256; d++) {
+				for (let s = 0; s < 256; s++) {
+					expect(dst.buffer[d * 256 + s]).toBe(
+						Math.floor((d * s + 127) / 255),
+					);
+				}
+			}
+		});
+
+		test("compositeBitmaps rounds src over dst", () => {
+			const { dst, src } = pairBitmaps();
+			compositeBitmaps(dst, src);
+			for (let d = 0; d < 256; d++) {
+				for (let s = 0; s < 256; s++) {
+					expect(dst.buffer[d * 256 + s]).toBe(
+						s + Math.floor((d * (255 - s) + 127) / 255),
+					);
+				}
+			}
+		});
+
+		test("clips on every edge and leaves the rest of dst untouched", () => {
+			const dst = createBitmap(8, 6, PixelMode.Gray);
+			dst.buffer.fill(10);
+			const src = createBitmap(12, 10, PixelMode.Gray);
+			src.buffer.fill(5);
+
+			addBitmaps(dst, src, -3, -2);
+			subBitmaps(dst, src, 6, 4);
+
+			for (let y = 0; y < 6; y++) {
+				for (let x = 0; x < 8; x++) {
+					const sub = x >= 6 && y >= 4 ? 5 : 0;
+					expect(dst.buffer[y * 8 + x]).toBe(15 - sub);
+				}
+			}
+		});
+	});
+
 });
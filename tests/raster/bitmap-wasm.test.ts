@@ -0,0 +1,133 @@
+import { afterEach, describe, expect, test } from "bun:test";
+import {
+	bitmapWasmStatus,
+	ensureBitmapWasmReady,
+	getBitmapWasmModule,
+	setBitmapWasmEnabled,
+} from "../../src/raster/bitmap-wasm/index.ts";
+import {
+	addBitmaps,
+	blendBitmap,
+	compositeBitmaps,
+	maxBitmaps,
+	mulBitmaps,
+	subBitmaps,
+	transformBitmap2D,
+	transformBitmap3D,
+} from "../../src/raster/bitmap-utils.ts";
+import { bitmapToRGBA } from "../../src/raster/rasterize.ts";
+import {
+	type Bitmap,
+	createBitmap,
+	PixelMode,
+} from "../../src/raster/types.ts";
+
+function noise(
+	width: number,
+	rows: number,
+	seed: number,
+	mode: PixelMode = PixelMode.Gray,
+): Bitmap {
+	const bitmap = createBitmap(width, rows, mode);
+	let s = seed;
+	for (let i = 0; i < bitmap.buffer.length; i++) {
+		s = (Math.imul(s, 1103515245) + 12345) >>> 0;
+		bitmap.buffer[i] = s >>> 24;
+	}
+	return bitmap;
+}
+
+/** Run `fn` with the kernels on and off and return both results */
+function bothPaths<T>(fn: () => T): { wasm: T; js: T } {
+	const wasm = fn();
+	setBitmapWasmEnabled(false);
+	try {
+		return { wasm, js: fn() };
+	} finally {
+		setBitmapWasmEnabled(true);
+	}
+}
+
+function same(a: Bitmap, b: Bitmap): boolean {
+	return Buffer.from(a.buffer).equals(Buffer.from(b.buffer));
+}
+
+describe("bitmap-wasm", () => {
+	afterEach(() => {
+		setBitmapWasmEnabled(true);
+	});
+
+	test("embedded module loads and passes self-verification", () => {
+		ensureBitmapWasmReady();
+		if (typeof WebAssembly === "undefined") {
+			expect(bitmapWasmStatus().status).toBe("disabled");
+			return;
+		}
+		expect(bitmapWasmStatus().status).toBe("ready");
+		expect(bitmapWasmStatus().enabled).toBe(true);
+		expect(getBitmapWasmModule()).toBeInstanceOf(WebAssembly.Module);
+	});
+
+	test("blend operators match the JS loops byte for byte", () => {
+		const blends = [
+			addBitmaps,
+			subBitmaps,
+			mulBitmaps,
+			maxBitmaps,
+			compositeBitmaps,
+		];
+		for (const blend of blends) {
+			// 131 x 97 at an offset: clipped, above the wasm size threshold,
+			// with a SIMD tail on every row
+			const src = noise(131, 97, 7);
+			const { wasm, js } = bothPaths(() => {
+				const dst = noise(160, 120, 3);
+				blend(dst, src, 17, -5);
+				return dst;
+			});
+			expect(same(wasm, js)).toBe(true);
+		}
+	});
+
+	test("blendBitmap matches the JS loop at every opacity", () => {
+		const src = noise(131, 97, 7);
+		for (const opacity of [0, 0.1, 0.3, 1 / 3, 0.5, 0.7, 1]) {
+			const { wasm, js } = bothPaths(() => {
+				const dst = noise(160, 120, 3);
+				blendBitmap(dst, src, 17, -5, opacity);
+				return dst;
+			});
+			expect(same(wasm, js)).toBe(true);
+		}
+	});
+
+	test("RGBA export matches the JS loops byte for byte", () => {
+		for (const mode of [PixelMode.Gray, PixelMode.LCD]) {
+			const bitmap = noise(93, 71, 11, mode);
+			const { wasm, js } = bothPaths(() => bitmapToRGBA(bitmap));
+			expect(Buffer.from(wasm).equals(Buffer.from(js))).toBe(true);
+		}
+	});
+
+	test("affine and perspective resampling match the JS loops", () => {
+		const bitmap = noise(90, 70, 5);
+		const affine = bothPaths(
+			() => transformBitmap2D(bitmap, [0.9, 0.35, -0.4, 1.1, 0, 0]).bitmap,
+		);
+		expect(affine.wasm.width * affine.wasm.rows).toBeGreaterThan(4096);
+		expect(same(affine.wasm, affine.js)).toBe(true);
+
+		const perspective = bothPaths(
+			() =>
+				transformBitmap3D(bitmap, [
+					[1.1, 0.2, 3],
+					[-0.15, 0.95, 2],
+					[0.002, -0.001, 1],
+				]).bitmap,
+		);
+		expect(perspective.wasm.width * perspective.wasm.rows).toBeGreaterThan(
+			4096,
+		);
+		expect(same(perspective.wasm, perspective.js)).toBe(true);
+	});
+});
@@ -0,0 +1,156 @@
+import { afterEach, describe, expect, test } from "bun:test";
+import {
+	ensureFillWasmReady,
+	fillWasmStatus,
+	getFillWasmModule,
+	setFillWasmDenseMaxPixels,
+	setFillWasmEnabled,
+	verifyFillWasm,
+	verifyFillWasmAsync,
+} from "../../src/raster/fill-wasm/index.ts";
+import {
+	getInstrumentationSnapshot,
+	resetInstrumentation,
+	setInstrumentation,
+} from "../../src/instrument.ts";
+import type { GlyphPath } from "../../src/render/path.ts";
+import {
+	rasterizePath,
+	rasterizePathSpans,
+} from "../../src/raster/rasterize.ts";
+import { FillRule, PixelMode } from "../../src/raster/types.ts";
+
+/** Self-intersecting star with a curved counter-wound hole */
+function testPath(size: number): GlyphPath {
+	const commands: GlyphPath["commands"] = [];
+	const c = size / 2;
+	for (let i = 0; i < 9; i++) {
+		const angle = (i * 4 * Math.PI) / 9 + 0.1;
+		const x = c + Math.cos(angle) * size * 0.47;
+		const y = c + Math.sin(angle) * size * 0.47;
+		commands.push({ type: i === 0 ? "M" : "L", x, y });
+	}
+	commands.push({ type: "Z" });
+	const r = size * 0.2;
+	commands.push({ type: "M", x: c + r, y: c });
+	commands.push({ type: "Q", x1: c + r, y1: c - r, x: c, y: c - r });
+	commands.push({ type: "Q", x1: c - r, y1: c - r, x: c - r, y: c });
+	commands.push({ type: "Q", x1: c - r, y1: c + r, x: c, y: c + r });
+	commands.push({ type: "Q", x1: c + r, y1: c + r, x: c + r, y: c });
+	commands.push({ type: "Z" });
+	return { bounds: null, commands };
+}
+
+function exportNames(): string[] {
+	const module = getFillWasmModule();
+	if (!module) return [];
+	return WebAssembly.Module.exports(module).map((e) => e.name);
+}
+
+describe("fill-wasm startup", () => {
+	test("golden check readies the kernel and full verification agrees", async () => {
+		ensureFillWasmReady();
+		const { status } = fillWasmStatus();
+		if (status === "disabled") {
+			// No WebAssembly in this runtime: nothing to share or verify
+			expect(getFillWasmModule()).toBeNull();
+			expect(verifyFillWasm()).toBe(false);
+			return;
+		}
+		expect(status).toBe("ready");
+		expect(getFillWasmModule()).toBeInstanceOf(WebAssembly.Module);
+		expect(verifyFillWasm()).toBe(true);
+		expect(await verifyFillWasmAsync(200)).toBe(true);
+		expect(fillWasmStatus().status).toBe("ready");
+	});
+});
+
+describe("fill-wasm dense engine", () => {
+	afterEach(() => {
+		setFillWasmDenseMaxPixels();
+		setFillWasmEnabled(true);
+		setInstrumentation(false);
+	});
+
+	test("dense planes match the cell engine and the TS sweep", () => {
+		ensureFillWasmReady();
+		if (fillWasmStatus().status === "disabled") return;
+		expect(fillWasmStatus().dense).toBe(true);
+		expect(exportNames()).toContain("fill_glyph_dense");
+
+		for (const size of [9, 31, 64, 150]) {
+			for (const fillRule of [FillRule.NonZero, FillRule.EvenOdd]) {
+				const options = {
+					width: size + 3,
+					height: size + 1,
+					scale: 1,
+					offsetX: 0.3,
+					offsetY: 0.6,
+					flipY: false,
+					fillRule,
+					pixelMode: PixelMode.Gray,
+				};
+				const path = testPath(size);
+				const render = (): Uint8Array =>
+					rasterizePath(path, options).buffer;
+
+				setInstrumentation(true);
+				resetInstrumentation();
+				setFillWasmDenseMaxPixels(Infinity);
+				const dense = render();
+				setFillWasmDenseMaxPixels(0);
+				const cells = render();
+				const { counters } = getInstrumentationSnapshot();
+				expect(counters["wasm.fill.calls"]).toBe(2);
+				setFillWasmEnabled(false);
+				const js = render();
+
+				expect(dense.some((v) => v > 0)).toBe(true);
+				expect(Buffer.from(dense).equals(Buffer.from(cells))).toBe(true);
+				expect(Buffer.from(dense).equals(Buffer.from(js))).toBe(true);
+				setFillWasmEnabled(true);
+			}
+		}
+	});
+});
+
+describe("fill-wasm spans", () => {
+	afterEach(() => {
+		setFillWasmEnabled(true);
+		setInstrumentation(false);
+	});
+
+	test("fill_glyph_spans matches the TS span sweep", () => {
+		ensureFillWasmReady();
+		if (fillWasmStatus().status === "disabled") return;
+		expect(exportNames()).toContain("fill_glyph_spans");
+
+		for (const size of [12, 47, 200]) {
+			for (const fillRule of [FillRule.NonZero, FillRule.EvenOdd]) {
+				const options = {
+					width: size + 5,
+					height: size + 2,
+					scale: 1,
+					offsetX: 1.7,
+					offsetY: 0.4,
+					flipY: false,
+					fillRule,
+					pixelMode: PixelMode.Gray,
+				};
+				const path = testPath(size);
+
+				setInstrumentation(true);
+				resetInstrumentation();
+				const wasm = rasterizePathSpans(path, options);
+				const { counters } = getInstrumentationSnapshot();
+				expect(counters["wasm.fill.calls"]).toBe(1);
+				setFillWasmEnabled(false);
+				const js = rasterizePathSpans(path, options);
+				setFillWasmEnabled(true);
+
+				expect(wasm.length).toBeGreaterThan(0);
+				expect(Array.from(wasm)).toEqual(Array.from(js));
+			}
+		}
+	});
+});
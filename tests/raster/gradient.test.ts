@@ -7,6 +7,7 @@ import {
 	type RadialGradient,
 	type ColorStop,
 } from "../../src/raster/gradient.ts";
+import { rasterizePath } from "../../src/raster/rasterize.ts";
 import { PixelMode } from "../../src/raster/types.ts";
 import type { GlyphPath } from "../../src/render/path.ts";
 
@@ -450,5 +451,140 @@ describe("raster/gradient", () => {
 			const outsideAlpha = bitmap.buffer[outsideIdx];
 			expect(outsideAlpha).toBe(0);
 		});
+
+		test("shades exactly the covered pixels, including tall paths", () => {
+			// Diamond taller than one band, clipped on the right edge
+			const path: GlyphPath = {
+				commands: [
+					{ type: "M", x: 60, y: 0 },
+					{ type: "L", x: 130, y: 300 },
+					{ type: "L", x: 60, y: 600 },
+					{ type: "L", x: 0, y: 300 },
+					{ type: "Z" },
+				],
+				bounds: { xMin: 0, yMin: 0, xMax: 130, yMax: 600 },
+			};
+			const gradient: LinearGradient = {
+				type: "linear",
+				x0: 0,
+				y0: 0,
+				x1: 0,
+				y1: 600,
+				stops: [
+					{ offset: 0, color: [255, 0, 0, 255] },
+					{ offset: 1, color: [0, 0, 255, 128] },
+				],
+			};
+			const options = { width: 100, height: 600, scale: 1 };
+
+			const bitmap = rasterizePathWithGradient(path, gradient, options);
+			const coverage = rasterizePath(path, {
+				...options,
+				pixelMode: PixelMode.Gray,
+				flipY: false,
+			});
+
+			for (let y = 0; y < 600; y += 7) {
+				for (let x = 0; x < 100; x++) {
+					const c = coverage.buffer[y * 100 + x]!;
+					const color = interpolateGradient(gradient, x, y);
+					const alpha = bitmap.buffer[(y * 100 + x) * 4 + 3]!;
+					if (c === 0) {
+						expect(alpha).toBe(0);
+					} else {
+						const expected = Math.round((color[3] * c) / 255);
+						expect(Math.abs(alpha - expected)).toBeLessThanOrEqual(1);
+					}
+				}
+			}
+		});
+
+		test("applies a vector clip on the default rasterizer", () => {
+			const path: GlyphPath = {
+				commands: [
+					{ type: "M", x: 2, y: 2 },
+					{ type: "L", x: 38, y: 2 },
+					{ type: "L", x: 38, y: 28 },
+					{ type: "L", x: 2, y: 28 },
+					{ type: "Z" },
+				],
+				bounds: { xMin: 2, yMin: 2, xMax: 38, yMax: 28 },
+			};
+			const clipPath: GlyphPath = {
+				commands: [
+					{ type: "M", x: 10.5, y: 0 },
+					{ type: "L", x: 30, y: 12.3 },
+					{ type: "L", x: 14, y: 30 },
+					{ type: "Z" },
+				],
+				bounds: { xMin: 10.5, yMin: 0, xMax: 30, yMax: 30 },
+			};
+			const gradient: LinearGradient = {
+				type: "linear",
+				x0: 0,
+				y0: 0,
+				x1: 40,
+				y1: 0,
+				stops: [{ offset: 0, color: [255, 255, 255, 255] }],
+			};
+			const options = { width: 40, height: 30, scale: 1, flipY: false };
+			const unclipped = rasterizePath(path, options).buffer;
+
+			for (const inverse of [false, true]) {
+				const clip = { path: clipPath, inverse };
+				const bitmap = rasterizePathWithGradient(path, gradient, {
+					...options,
+					clip,
+				});
+				const coverage = rasterizePath(path, { ...options, clip });
+				const alpha = bitmap.buffer.filter((_, i) => i % 4 === 3);
+				expect(alpha).toEqual(coverage.buffer);
+				expect(alpha.some((value) => value > 0)).toBe(true);
+				expect(alpha).not.toEqual(unclipped);
+			}
+		});
+
+		test("writes premultiplied color when requested", () => {
+			const path: GlyphPath = {
+				commands: [
+					{ type: "M", x: 2.5, y: 2 },
+					{ type: "L", x: 8, y: 2 },
+					{ type: "L", x: 8, y: 8 },
+					{ type: "L", x: 2.5, y: 8 },
+					{ type: "Z" },
+				],
+				bounds: { xMin: 2.5, yMin: 2, xMax: 8, yMax: 8 },
+			};
+			const gradient: LinearGradient = {
+				type: "linear",
+				x0: 0,
+				y0: 0,
+				x1: 10,
+				y1: 0,
+				stops: [{ offset: 0, color: [200, 100, 50, 128] }],
+			};
+			const options = { width: 10, height: 10, scale: 1 };
+
+			const straight = rasterizePathWithGradient(path, gradient, options);
+			const premultiplied = rasterizePathWithGradient(path, gradient, {
+				...options,
+				premultiplied: true,
+			});
+
+			// Full coverage inside, half coverage on the left edge column
+			const inside = (4 * 10 + 4) * 4;
+			expect(Array.from(straight.buffer.subarray(inside, inside + 4))).toEqual(
+				[200, 100, 50, 128],
+			);
+			expect(
+				Array.from(premultiplied.buffer.subarray(inside, inside + 4)),
+			).toEqual([100, 50, 25, 128]);
+
+			const edge = (4 * 10 + 2) * 4;
+			expect(straight.buffer[edge]).toBe(200);
+			expect(straight.buffer[edge + 3]).toBe(64);
+			expect(premultiplied.buffer[edge]).toBe(50);
+			expect(premultiplied.buffer[edge + 3]).toBe(64);
+		});
 	});
 });
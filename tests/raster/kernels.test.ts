@@ -0,0 +1,74 @@
+import { describe, expect, test } from "bun:test";
+import {
+	__testing as bitmapWasm,
+	bitmapWasmStatus,
+	getBitmapWasmModule,
+} from "../../src/raster/bitmap-wasm/index.ts";
+import { fillWasmStatus } from "../../src/raster/fill-wasm/index.ts";
+import { initRasterKernels } from "../../src/raster/kernels.ts";
+import { decodeBase64 } from "../../src/raster/wasm-base64.ts";
+
+describe("initRasterKernels", () => {
+	test("compiles asynchronously and returns shareable modules", async () => {
+		const modules = await initRasterKernels({ async: true });
+		if (typeof WebAssembly === "undefined") {
+			expect(modules).toEqual({ fill: null, ass: null, bitmap: null });
+			return;
+		}
+		expect(fillWasmStatus().status).toBe("ready");
+		expect(modules.fill).toBeInstanceOf(WebAssembly.Module);
+
+		// Adopting the same modules again (as a worker would) is a no-op here
+		const again = await initRasterKernels({ modules });
+		expect(again.fill).toBe(modules.fill);
+		expect(again.ass).toBe(modules.ass);
+	});
+
+	test("instantiates a posted module in an uninitialized kernel", async () => {
+		const modules = await initRasterKernels();
+		if (typeof WebAssembly === "undefined" || !modules.bitmap) return;
+
+		// A fresh worker: the bitmap kernel is uninitialized and adopts the
+		// posted module, while the ready kernels compile nothing
+		bitmapWasm.reset();
+		expect(bitmapWasmStatus().status).toBe("uninit");
+		const compile = WebAssembly.compile;
+		const Module = WebAssembly.Module;
+		let compiled = 0;
+		WebAssembly.compile = (bytes) => {
+			compiled++;
+			return compile(bytes);
+		};
+		WebAssembly.Module = class extends Module {
+			constructor(bytes: BufferSource) {
+				compiled++;
+				super(bytes);
+			}
+		};
+		try {
+			const again = await initRasterKernels({
+				modules: { bitmap: modules.bitmap },
+			});
+			expect(compiled).toBe(0);
+			expect(bitmapWasmStatus().status).toBe("ready");
+			expect(again.bitmap).toBe(modules.bitmap);
+			expect(getBitmapWasmModule()).toBe(modules.bitmap);
+		} finally {
+			WebAssembly.compile = compile;
+			WebAssembly.Module = Module;
+		}
+	});
+});
+
+describe("decodeBase64", () => {
+	test("decodes padded and unpadded input of every tail length", () => {
+		const bytes = Uint8Array.from({ length: 40 }, (_, i) => (i * 97) & 255);
+		for (let n = 0; n <= bytes.length; n++) {
+			const slice = bytes.subarray(0, n);
+			const padded = btoa(String.fromCharCode(...slice));
+			const unpadded = padded.replace(/=+$/, "");
+			expect(Array.from(decodeBase64(padded))).toEqual(Array.from(slice));
+			expect(Array.from(decodeBase64(unpadded))).toEqual(Array.from(slice));
+		}
+	});
+});
@@ -8,7 +8,7 @@ import {
 	LCD_FILTER_LEGACY,
 } from "../../src/raster/lcd-filter.ts";
 import type { GlyphPath } from "../../src/render/path.ts";
-import { PixelMode } from "../../src/raster/types.ts";
+import { createBitmap, PixelMode } from "../../src/raster/types.ts";
 
 describe("raster/lcd-filter", () => {
 	const createRectPath = (x: number, y: number, width: number, height: number): GlyphPath => ({
@@ -242,6 +242,28 @@ describe("raster/lcd-filter", () => {
 			expect(hasNonZero).toBe(true);
 		});
 
+		test("matches the per-channel blend formula and fills out", () => {
+			const lcd = createBitmap(2, 1, PixelMode.LCD);
+			lcd.buffer.set([0, 128, 255, 64, 32, 16]);
+			const bg: [number, number, number] = [200, 150, 100];
+			const fg: [number, number, number] = [10, 20, 30];
+			const out = new Uint8Array(8);
+
+			expect(lcdToRGBA(lcd, bg, fg, out)).toBe(out);
+			for (let x = 0; x < 2; x++) {
+				for (let c = 0; c < 3; c++) {
+					const a = lcd.buffer[x * 3 + c]!;
+					expect(out[x * 4 + c]).toBe(
+						Math.round(bg[c]! + ((fg[c]! - bg[c]!) * a) / 255),
+					);
+				}
+				expect(out[x * 4 + 3]).toBe(255);
+			}
+			expect(() => lcdToRGBA(lcd, bg, fg, new Uint8Array(7))).toThrow(
+				RangeError,
+			);
+		});
+
 		test("converts with custom background color", () => {
 			const path = createRectPath(0, 0, 5, 5);
 			const lcd = rasterizeLcd(path, 10, 10, 1.0, 2, 2);
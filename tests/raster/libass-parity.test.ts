@@ -1,8 +1,19 @@
 import { createHash } from "node:crypto";
 import { describe, expect, test } from "bun:test";
 import type { GlyphPath } from "../../src/render/path.ts";
+import {
+	ensureAssRasterWasmReady,
+	fillAssPathClipWasm,
+	fillAssPathWasm,
+	getAssRasterWasmModule,
+} from "../../src/raster/ass-wasm/index.ts";
+import { mulBitmaps, subBitmaps } from "../../src/raster/bitmap-utils.ts";
 import { rasterizePath } from "../../src/raster/rasterize.ts";
-import { FillRule, PixelMode } from "../../src/raster/types.ts";
+import {
+	createBitmap,
+	FillRule,
+	PixelMode,
+} from "../../src/raster/types.ts";
 
 const WIDTH = 640;
 const HEIGHT = 360;
@@ -11,18 +22,52 @@ function sha256(bytes: Uint8Array): string {
 	return createHash("sha256").update(bytes).digest("hex");
 }
 
+const OPTIONS = {
+	width: WIDTH,
+	height: HEIGHT,
+	scale: 1,
+	offsetX: 80,
+	offsetY: 80,
+	flipY: false,
+	fillRule: FillRule.NonZero,
+	pixelMode: PixelMode.Gray,
+	rasterizer: "libass",
+} as const;
+
+/** Random closed outline of lines and curves inside a w x h box */
+function randomPath(next: () => number, w: number, h: number): GlyphPath {
+	const commands: GlyphPath["commands"] = [];
+	const point = () => ({ x: next() * w, y: next() * h });
+	const start = point();
+	commands.push({ type: "M", ...start });
+	const count = 3 + Math.floor(next() * 6);
+	for (let i = 0; i < count; i++) {
+		const kind = next();
+		const end = i === count - 1 ? start : point();
+		if (kind < 0.4) {
+			commands.push({ type: "L", ...end });
+		} else if (kind < 0.7) {
+			const c = point();
+			commands.push({ type: "Q", x1: c.x, y1: c.y, ...end });
+		} else {
+			const c1 = point();
+			const c2 = point();
+			commands.push({
+				type: "C",
+				x1: c1.x,
+				y1: c1.y,
+				x2: c2.x,
+				y2: c2.y,
+				...end,
+			});
+		}
+	}
+	commands.push({ type: "Z" });
+	return { bounds: null, commands };
+}
+
 function render(path: GlyphPath): Uint8Array {
-	return rasterizePath(path, {
-		width: WIDTH,
-		height: HEIGHT,
-		scale: 1,
-		offsetX: 80,
-		offsetY: 80,
-		flipY: false,
-		fillRule: FillRule.NonZero,
-		pixelMode: PixelMode.Gray,
-		rasterizer: "libass",
-	}).buffer;
+	return rasterizePath(path, OPTIONS).buffer;
 }
 
 describe("libass raster parity", () => {
@@ -60,4 +105,127 @@ describe("libass raster parity", () => {
 			"f5bcd237d51389a56f2b4e5058bc9a99bc1a2985eae8555f1f75eb647b006455",
 		);
 	});
+
+	test("vector clip matches a full-frame clip mask", () => {
+		const path: GlyphPath = {
+			bounds: null,
+			commands: [
+				{ type: "M", x: 0, y: 30 },
+				{ type: "C", x1: 0, y1: -40, x2: 300, y2: -40, x: 300, y: 30 },
+				{ type: "C", x1: 300, y1: 100, x2: 0, y2: 100, x: 0, y: 30 },
+				{ type: "Z" },
+			],
+		};
+		const clipPath: GlyphPath = {
+			bounds: null,
+			commands: [
+				{ type: "M", x: 40.3, y: -10 },
+				{ type: "L", x: 180, y: 20.5 },
+				{ type: "L", x: 120, y: 200 },
+				{ type: "L", x: 20, y: 90 },
+				{ type: "Z" },
+			],
+		};
+		for (const inverse of [false, true]) {
+			const expected = rasterizePath(path, OPTIONS);
+			const mask = rasterizePath(clipPath, OPTIONS);
+			if (inverse) subBitmaps(expected, mask);
+			else mulBitmaps(expected, mask);
+			const clipped = rasterizePath(path, {
+				...OPTIONS,
+				clip: { path: clipPath, inverse },
+			});
+			expect(clipped.buffer.some((value) => value > 0)).toBe(true);
+			expect(Buffer.from(clipped.buffer).equals(expected.buffer)).toBe(true);
+		}
+	});
+
+	test("vector clip applies to Mono, LCD and RGBA bitmaps", () => {
+		// The libass rasterizer only renders Gray; the other modes always take
+		// the scanline rasterizer and the mask fallback
+		const options = {
+			...OPTIONS,
+			width: 97,
+			height: 61,
+			offsetX: 0,
+			offsetY: 0,
+			rasterizer: "freetype",
+		} as const;
+		const path: GlyphPath = {
+			bounds: null,
+			commands: [
+				{ type: "M", x: 3, y: 30 },
+				{ type: "C", x1: 3, y1: -10, x2: 94, y2: -10, x: 94, y: 30 },
+				{ type: "C", x1: 94, y1: 70, x2: 3, y2: 70, x: 3, y: 30 },
+				{ type: "Z" },
+			],
+		};
+		const clipPath: GlyphPath = {
+			bounds: null,
+			commands: [
+				{ type: "M", x: 20.3, y: -5 },
+				{ type: "L", x: 70, y: 10.5 },
+				{ type: "L", x: 55, y: 70 },
+				{ type: "L", x: 10, y: 45 },
+				{ type: "Z" },
+			],
+		};
+		for (const inverse of [false, true]) {
+			const clip = { path: clipPath, inverse };
+			const render = (pixelMode: PixelMode) =>
+				rasterizePath(path, { ...options, pixelMode, clip }).buffer;
+			const gray = render(PixelMode.Gray);
+			const lcd = render(PixelMode.LCD);
+			const rgba = render(PixelMode.RGBA);
+			expect(gray.some((value) => value > 0)).toBe(true);
+			expect(lcd.filter((_, i) => i % 3 === 1)).toEqual(gray);
+			expect(rgba.filter((_, i) => i % 4 === 3)).toEqual(gray);
+			expect(rgba.filter((_, i) => i % 4 !== 3).some(Boolean)).toBe(false);
+
+			const mono = { ...options, pixelMode: PixelMode.Mono };
+			const fill = rasterizePath(path, mono).buffer;
+			const mask = rasterizePath(clipPath, mono).buffer;
+			const expected = fill.map((bits, i) =>
+				inverse ? bits & ~mask[i]! : bits & mask[i]!,
+			);
+			expect(render(PixelMode.Mono)).toEqual(expected);
+			expect(expected).not.toEqual(fill);
+		}
+	});
+
+	test("wasm clip matches the unclipped fill masked by the clip", () => {
+		ensureAssRasterWasmReady();
+		const module = getAssRasterWasmModule();
+		if (!module) return;
+		const exported = WebAssembly.Module.exports(module).map((e) => e.name);
+		expect(exported).toContain("ass_fill_path_clip");
+
+		let seed = 12345;
+		const next = (): number => {
+			seed = (Math.imul(seed, 1103515245) + 12345) >>> 0;
+			return seed / 4294967296;
+		};
+		for (let i = 0; i < 300; i++) {
+			// Odd sizes leave partial tiles on the right and bottom edges
+			const width = 17 + Math.floor(next() * 90);
+			const height = 9 + Math.floor(next() * 70);
+			const path = randomPath(next, width, height);
+			const clipPath = randomPath(next, width * 1.2, height * 1.2);
+			const inverse = (i & 1) === 1;
+			const args = [width, height, 1, 0, 0, false] as const;
+
+			const clipped = new Uint8Array(width * height);
+			expect(
+				fillAssPathClipWasm(path, clipPath, inverse, ...args, clipped),
+			).toBe(true);
+
+			const expected = createBitmap(width, height, PixelMode.Gray);
+			const mask = createBitmap(width, height, PixelMode.Gray);
+			expect(fillAssPathWasm(path, ...args, expected.buffer)).toBe(true);
+			expect(fillAssPathWasm(clipPath, ...args, mask.buffer)).toBe(true);
+			if (inverse) subBitmaps(expected, mask);
+			else mulBitmaps(expected, mask);
+			expect(Buffer.from(clipped).equals(expected.buffer)).toBe(true);
+		}
+	});
 });
@@ -0,0 +1,93 @@
+import { describe, expect, test } from "bun:test";
+import { setFillWasmEnabled } from "../../src/raster/fill-wasm/index.ts";
+import type { GlyphPath } from "../../src/render/path.ts";
+import {
+	rasterizePath,
+	rasterizePathSpans,
+} from "../../src/raster/rasterize.ts";
+import { FillRule, PixelMode } from "../../src/raster/types.ts";
+
+function star(points: number, radius: number, cx: number, cy: number) {
+	const commands: GlyphPath["commands"] = [];
+	for (let i = 0; i < points; i++) {
+		// Skip two vertices each step so the outline self-intersects
+		const angle = (i * 2 * 2 * Math.PI) / points;
+		const x = cx + Math.cos(angle) * radius;
+		const y = cy + Math.sin(angle) * radius;
+		commands.push({ type: i === 0 ? "M" : "L", x, y });
+	}
+	commands.push({ type: "Z" });
+	return { bounds: null, commands } as GlyphPath;
+}
+
+function expand(spans: Int32Array, width: number, height: number) {
+	const out = new Uint8Array(width * height);
+	for (let i = 0; i < spans.length; i += 4) {
+		const start = spans[i]! * width + spans[i + 1]!;
+		out.fill(spans[i + 3]!, start, start + spans[i + 2]!);
+	}
+	return out;
+}
+
+describe("rasterizePathSpans", () => {
+	for (const [width, height] of [
+		[48, 40],
+		[300, 700],
+	] as const) {
+		for (const fillRule of [FillRule.NonZero, FillRule.EvenOdd]) {
+			test(`${width}x${height} fill rule ${fillRule} matches rasterizePath`, () => {
+				const path = star(7, height * 0.55, width / 2, height / 2);
+				const options = {
+					width,
+					height,
+					scale: 1,
+					flipY: false,
+					fillRule,
+					pixelMode: PixelMode.Gray,
+				};
+				const spans = rasterizePathSpans(path, options);
+				const bitmap = rasterizePath(path, options);
+
+				expect(spans.length % 4).toBe(0);
+				expect(Array.from(expand(spans, width, height))).toEqual(
+					Array.from(bitmap.buffer),
+				);
+				for (let i = 4; i < spans.length; i += 4) {
+					const prevY = spans[i - 4]!;
+					const y = spans[i]!;
+					expect(y).toBeGreaterThanOrEqual(prevY);
+					if (y === prevY) {
+						const prevEnd = spans[i - 3]! + spans[i - 2]!;
+						// Runs are ordered and adjacent equal runs are merged
+						expect(spans[i + 1]!).toBeGreaterThanOrEqual(prevEnd);
+						if (spans[i + 1] === prevEnd) {
+							expect(spans[i + 3]).not.toBe(spans[i - 1]);
+						}
+					}
+				}
+			});
+		}
+	}
+
+	test("TS sweep ignores rows left over from a taller render", () => {
+		const small = { width: 30, height: 24, scale: 1, flipY: false };
+		const path = star(5, 11, 15, 12);
+		setFillWasmEnabled(false);
+		try {
+			rasterizePath(star(7, 100, 120, 120), {
+				...small,
+				width: 240,
+				height: 240,
+			});
+			const spans = rasterizePathSpans(path, small);
+			for (let i = 0; i < spans.length; i += 4) {
+				expect(spans[i]!).toBeLessThan(24);
+			}
+			expect(Array.from(expand(spans, 30, 24))).toEqual(
+				Array.from(rasterizePath(path, small).buffer),
+			);
+		} finally {
+			setFillWasmEnabled(true);
+		}
+	});
+});
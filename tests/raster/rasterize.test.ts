@@ -1663,6 +1663,57 @@ describe("raster/rasterize", () => {
 		});
 	});
 
+	describe("bitmapToRGBA / bitmapToGray output buffers", () => {
+		const bitmap: Bitmap = {
+			buffer: new Uint8Array([200, 100, 0, 50, 25, 0]),
+			width: 2,
+			rows: 2,
+			pitch: 3,
+			pixelMode: PixelMode.Gray,
+			numGrays: 256,
+		};
+
+		test("bitmapToRGBA writes into the given buffer", () => {
+			const out = new Uint8Array(2 * 2 * 4 + 4).fill(7);
+			const rgba = bitmapToRGBA(bitmap, out);
+			expect(rgba).toBe(out);
+			expect(Array.from(out.subarray(0, 8))).toEqual([
+				55, 55, 55, 255, 155, 155, 155, 255,
+			]);
+			expect(out[12]).toBe(230);
+			expect(out[16]).toBe(7);
+		});
+
+		test("bitmapToRGBA rejects a short buffer", () => {
+			expect(() => bitmapToRGBA(bitmap, new Uint8Array(15))).toThrow(
+				RangeError,
+			);
+		});
+
+		test("bitmapToGray copies into the given buffer", () => {
+			const out = new Uint8Array(4);
+			expect(bitmapToGray(bitmap, out)).toBe(out);
+			expect(Array.from(out)).toEqual([200, 100, 50, 25]);
+
+			const packed: Bitmap = { ...bitmap, pitch: 2 };
+			const copy = new Uint8Array(4);
+			expect(bitmapToGray(packed, copy)).toBe(copy);
+			expect(Array.from(copy)).toEqual([200, 100, 0, 50]);
+		});
+
+		test("LCD to Gray rounds the subpixel average", () => {
+			const lcd: Bitmap = {
+				buffer: new Uint8Array([1, 0, 0, 1, 1, 0, 255, 255, 254]),
+				width: 3,
+				rows: 1,
+				pitch: 9,
+				pixelMode: PixelMode.LCD,
+				numGrays: 256,
+			};
+			expect(Array.from(bitmapToGray(lcd))).toEqual([0, 1, 255]);
+		});
+	});
+
 	describe("bitmapToGray fallback mode", () => {
 		test("converts LCD bitmap to Gray", () => {
 			const bitmap: Bitmap = {
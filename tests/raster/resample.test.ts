@@ -0,0 +1,260 @@
+import { describe, expect, test } from "bun:test";
+import { transformBitmap2D } from "../../src/raster/bitmap-utils.ts";
+import {
+	createResampleSource,
+	resampleAffine,
+	resamplePerspective,
+} from "../../src/raster/resample.ts";
+import { createBitmap, PixelMode } from "../../src/raster/types.ts";
+
+function ramp(width: number, rows: number, mode = PixelMode.Gray) {
+	const bitmap = createBitmap(width, rows, mode);
+	for (let i = 0; i < bitmap.buffer.length; i++) {
+		bitmap.buffer[i] = (i * 37 + 11) & 255;
+	}
+	return bitmap;
+}
+
+/** The float bilinear sampler the fixed-point path replaced (zero outside) */
+function floatSample(
+	pixels: Uint8Array,
+	width: number,
+	rows: number,
+	sx: number,
+	sy: number,
+): number {
+	const at = (x: number, y: number): number =>
+		x < 0 || y < 0 || x >= width || y >= rows ? 0 : pixels[y * width + x]!;
+	const x0 = Math.floor(sx);
+	const y0 = Math.floor(sy);
+	const wx = sx - x0;
+	const wy = sy - y0;
+	const value =
+		at(x0, y0) * (1 - wx) * (1 - wy) +
+		at(x0 + 1, y0) * wx * (1 - wy) +
+		at(x0, y0 + 1) * (1 - wx) * wy +
+		at(x0 + 1, y0 + 1) * wx * wy;
+	return Math.min(255, Math.max(0, Math.round(value)));
+}
+
+describe("raster/resample", () => {
+	describe("createResampleSource", () => {
+		test("pads with zeros or repeated edges", () => {
+			const bitmap = createBitmap(2, 1, PixelMode.Gray);
+			bitmap.buffer.set([10, 20]);
+
+			const zero = createResampleSource(bitmap, "zero");
+			expect(zero.stride).toBe(4);
+			expect(Array.from(zero.data)).toEqual([
+				0, 0, 0, 0, 0, 10, 20, 0, 0, 0, 0, 0,
+			]);
+
+			const clamp = createResampleSource(bitmap, "clamp");
+			expect(Array.from(clamp.data)).toEqual([
+				10, 10, 20, 20, 10, 10, 20, 20, 10, 10, 20, 20,
+			]);
+		});
+
+		test("expands Mono to coverage and honors negative pitch", () => {
+			const mono = createBitmap(3, 2, PixelMode.Mono);
+			mono.buffer.set([0b10100000, 0b01000000]);
+			mono.pitch = -1;
+
+			const src = createResampleSource(mono, "zero");
+			expect(src.channels).toBe(1);
+			expect(Array.from(src.data.subarray(6, 9))).toEqual([0, 255, 0]);
+			expect(Array.from(src.data.subarray(11, 14))).toEqual([255, 0, 255]);
+		});
+	});
+
+	describe("resampleAffine", () => {
+		test("identity copies every channel exactly", () => {
+			for (const mode of [PixelMode.Gray, PixelMode.LCD, PixelMode.RGBA]) {
+				const bitmap = ramp(7, 5, mode);
+				const out = new Uint8Array(bitmap.buffer.length);
+				resampleAffine(
+					createResampleSource(bitmap, "zero"),
+					out,
+					bitmap.pitch,
+					7,
+					5,
+					0,
+					0,
+					1,
+					0,
+					0,
+					1,
+				);
+				expect(Array.from(out)).toEqual(Array.from(bitmap.buffer));
+			}
+		});
+
+		test("half-pixel shift averages neighbours", () => {
+			const bitmap = createBitmap(2, 1, PixelMode.Gray);
+			bitmap.buffer.set([100, 200]);
+			const out = new Uint8Array(3);
+			resampleAffine(
+				createResampleSource(bitmap, "zero"),
+				out,
+				3,
+				3,
+				1,
+				-0.5,
+				0,
+				1,
+				0,
+				0,
+				1,
+			);
+			expect(Array.from(out)).toEqual([50, 150, 100]);
+		});
+
+		test("leaves pixels outside the source footprint untouched", () => {
+			const bitmap = ramp(4, 4);
+			const out = new Uint8Array(12 * 12).fill(9);
+			resampleAffine(
+				createResampleSource(bitmap, "zero"),
+				out,
+				12,
+				12,
+				12,
+				-4,
+				-4,
+				1,
+				0,
+				0,
+				1,
+			);
+			// Footprint is x, y in [3, 8): one pixel of filter support around 4x4
+			for (let y = 0; y < 12; y++) {
+				for (let x = 0; x < 12; x++) {
+					const inside = x >= 3 && x < 8 && y >= 3 && y < 8;
+					if (!inside) expect(out[y * 12 + x]).toBe(9);
+				}
+			}
+			expect(out[4 * 12 + 4]).toBe(bitmap.buffer[0]);
+		});
+	});
+
+	describe("resamplePerspective", () => {
+		test("identity mapping copies exactly", () => {
+			const bitmap = ramp(6, 4);
+			const out = new Uint8Array(24);
+			resamplePerspective(
+				createResampleSource(bitmap, "zero"),
+				out,
+				6,
+				6,
+				4,
+				[0, 0, 1, 1, 0, 0, 0, -1, 0, 0, 0],
+			);
+			expect(Array.from(out)).toEqual(Array.from(bitmap.buffer));
+		});
+
+		test("matches the affine path when W is constant", () => {
+			const bitmap = ramp(9, 7);
+			const src = createResampleSource(bitmap, "zero");
+			const affine = new Uint8Array(15 * 13);
+			const perspective = new Uint8Array(15 * 13);
+			resampleAffine(src, affine, 15, 15, 13, -2.25, -1.75, 0.75, 0, 0, 0.5);
+			resamplePerspective(src, perspective, 15, 15, 13, [
+				-2.25, 1.75, 1, 0.75, 0, 0, 0, -0.5, 0, 0, 0,
+			]);
+			expect(Array.from(perspective)).toEqual(Array.from(affine));
+		});
+	});
+
+	describe("tolerance against float bilinear", () => {
+		// 8-bit filter weights truncate each tap fraction by < 1/256, so a
+		// lerp is off by < 1 level; two lerps and the final rounding give +-2
+		const rotate = [0.83, 0.41, -0.37, 0.91] as const;
+
+		test("Gray stays within 2 levels for affine and perspective", () => {
+			const bitmap = ramp(37, 29);
+			const src = createResampleSource(bitmap, "zero");
+			const [a, b, c, d] = rotate;
+			const u0 = -6.3;
+			const v0 = -4.7;
+			const out = new Uint8Array(48 * 44);
+			resampleAffine(src, out, 48, 48, 44, u0, v0, a, b, c, d);
+			let maxDiff = 0;
+			for (let y = 0; y < 44; y++) {
+				for (let x = 0; x < 48; x++) {
+					const want = floatSample(
+						bitmap.buffer,
+						37,
+						29,
+						u0 + x * a + y * c,
+						v0 + x * b + y * d,
+					);
+					const diff = Math.abs(out[y * 48 + x]! - want);
+					if (diff > maxDiff) maxDiff = diff;
+				}
+			}
+			expect(maxDiff).toBeGreaterThan(0);
+			expect(maxDiff).toBeLessThanOrEqual(2);
+
+			const m = [
+				-3.1, 30.2, 1.05, 0.83, -0.21, 0.0021, 0.19, -0.77, -0.0013, 0.5, 30.5,
+			] as const;
+			out.fill(0);
+			resamplePerspective(src, out, 48, 48, 44, m);
+			maxDiff = 0;
+			for (let y = 0; y < 44; y++) {
+				for (let x = 0; x < 48; x++) {
+					const w = m[2] + x * m[5] + y * m[8];
+					const sx = (m[0] + x * m[3] + y * m[6]) / w - m[9];
+					const sy = m[10] - (m[1] + x * m[4] + y * m[7]) / w;
+					const inside = sx >= -1 && sx < 37 && sy >= -1 && sy < 29;
+					const want = inside
+						? floatSample(bitmap.buffer, 37, 29, sx, sy)
+						: 0;
+					const diff = Math.abs(out[y * 48 + x]! - want);
+					if (diff > maxDiff) maxDiff = diff;
+				}
+			}
+			expect(maxDiff).toBeLessThanOrEqual(2);
+		});
+
+		test("Mono bits only flip where float coverage is within 2 of 50%", () => {
+			const mono = createBitmap(29, 23, PixelMode.Mono);
+			const coverage = new Uint8Array(29 * 23);
+			for (let y = 0; y < 23; y++) {
+				for (let x = 0; x < 29; x++) {
+					// A disc with a notch: curved and straight edges at all angles
+					const on = (x - 14) ** 2 + (y - 11) ** 2 < 100 && x - y !== 3;
+					if (!on) continue;
+					coverage[y * 29 + x] = 255;
+					mono.buffer[y * mono.pitch + (x >> 3)]! |= 0x80 >> (x & 7);
+				}
+			}
+			const [a, b, c, d] = rotate;
+			const result = transformBitmap2D(mono, [a, b, c, d, 0, 0], {
+				bearingY: 23,
+			});
+			const out = result.bitmap;
+
+			// Invert the matrix to map destination centers back, as the
+			// transform does
+			const det = a * d - b * c;
+			const inv = [d / det, -b / det, -c / det, a / det];
+			let flips = 0;
+			for (let y = 0; y < out.rows; y++) {
+				for (let x = 0; x < out.width; x++) {
+					const gx = result.bearingX + x + 0.5;
+					const gy = result.bearingY - y - 0.5;
+					const sx = inv[0]! * gx + inv[2]! * gy - 0.5;
+					const sy = 23 - 0.5 - (inv[1]! * gx + inv[3]! * gy);
+					const value = floatSample(coverage, 29, 23, sx, sy);
+					const byte = out.buffer[y * out.pitch + (x >> 3)]!;
+					const bit = (byte >> (7 - (x & 7))) & 1;
+					if (bit === (value >= 128 ? 1 : 0)) continue;
+					flips++;
+					expect(Math.abs(value - 128)).toBeLessThanOrEqual(2);
+				}
+			}
+			expect(out.buffer.some((v) => v > 0)).toBe(true);
+			expect(flips).toBeLessThanOrEqual(out.width * out.rows * 0.01);
+		});
+	});
+});
@@ -529,6 +529,32 @@ describe("indic shaper", () => {
 			expect(infos[3].codepoint).toBe(0x094d); // Virama
 		});
 
+		test("keeps every glyph when several pre-base matras move", () => {
+			const infos = [
+				makeInfo(0x0915, 0), // KA
+				makeInfo(0x093f, 1), // I matra (pre-base)
+				makeInfo(0x093e, 2), // AA matra
+				makeInfo(0x093f, 3), // I matra (pre-base)
+			];
+
+			reorderIndic(infos);
+
+			expect(infos.map((info) => info.cluster)).toEqual([1, 3, 0, 2]);
+		});
+
+		test("reorders long unbroken runs", () => {
+			const infos: GlyphInfo[] = [];
+			for (let i = 0; i < 20000; i++) {
+				infos.push(makeInfo(0x0915, i * 2), makeInfo(0x093f, i * 2 + 1));
+			}
+
+			reorderIndic(infos);
+
+			expect(infos.length).toBe(40000);
+			expect(infos[0]!.codepoint).toBe(0x093f);
+			expect(infos[39999]!.codepoint).toBe(0x0915);
+		});
+
 		test("handles multiple pre-base matras", () => {
 			// Multiple pre-base matras (Bengali split vowels)
 			const infos = [
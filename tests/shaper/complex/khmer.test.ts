@@ -438,6 +438,18 @@ describe("khmer shaper", () => {
 			expect(infos[3]!.codepoint).toBe(0x1781); // Subscript consonant
 		});
 
+		test("only moves a pre-base vowel directly after the base", () => {
+			const infos = [
+				makeInfo(0x1780), // ក
+				makeInfo(0x17c9), // ៉ (register shifter)
+				makeInfo(0x17c1), // េ
+			];
+			reorderKhmer(infos);
+			expect(infos.map((info) => info.codepoint)).toEqual([
+				0x1780, 0x17c9, 0x17c1,
+			]);
+		});
+
 		test("does not move non-pre-base vowels", () => {
 			const infos = [
 				makeInfo(0x1780), // ក
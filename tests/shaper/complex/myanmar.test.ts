@@ -493,6 +493,19 @@ describe("myanmar shaper", () => {
 			expect(infos[2]!.codepoint).toBe(0x1000);
 		});
 
+		test("moves pre-base vowel before the nearest consonant", () => {
+			const infos = [
+				makeInfo(0x1000), // က
+				makeInfo(0x1039), // ္ (virama)
+				makeInfo(0x1001), // ခ (stacked)
+				makeInfo(0x1031), // ေ
+			];
+			reorderMyanmar(infos);
+			expect(infos.map((info) => info.codepoint)).toEqual([
+				0x1000, 0x1039, 0x1031, 0x1001,
+			]);
+		});
+
 		test("does not move non-pre-base vowels", () => {
 			const infos = [
 				makeInfo(0x1000), // က
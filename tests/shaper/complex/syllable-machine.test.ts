@@ -0,0 +1,92 @@
+import { describe, expect, test } from "bun:test";
+import {
+	compileSyllableMachine,
+	SyllableAction,
+	SyllableFlag,
+	SyllableScan,
+	scanSyllables,
+} from "../../../src/shaper/complex/syllable-machine.ts";
+
+// Toy grammar over categories 0 = other, 1 = base, 2 = mark, 3 = reph:
+//   [reph] base mark* | other
+function makeMachine() {
+	return compileSyllableMachine(
+		4,
+		[
+			{},
+			{
+				on: [
+					[[0], 2],
+					[[1], 3],
+					[[3], 4],
+				],
+			},
+			{ type: 2 },
+			{ on: [[[2], 3]], action: SyllableAction.SetFirstBase, type: 0 },
+			{ on: [[[1], 3]], action: SyllableAction.Reph, type: 1 },
+		],
+		2,
+	);
+}
+
+function scan(categories: number[]): SyllableScan {
+	const result = new SyllableScan();
+	result.reserve(categories.length);
+	result.categories.set(categories);
+	scanSyllables(makeMachine(), result, categories.length);
+	return result;
+}
+
+describe("syllable machine", () => {
+	test("compiles a flat transition table", () => {
+		const machine = makeMachine();
+		expect(machine.classes).toBe(4);
+		expect(machine.trans.length).toBe(5 * 4);
+		expect(machine.trans[1 * 4 + 1]).toBe(3);
+		expect(machine.trans[3 * 4 + 2]).toBe(3);
+		expect(machine.trans[3 * 4 + 1]).toBe(0);
+	});
+
+	test("copies transitions from `like` states", () => {
+		const machine = compileSyllableMachine(
+			2,
+			[{}, { like: 2, on: [[[0], 2]] }, { on: [[[1], 2]] }],
+			0,
+		);
+		expect(machine.trans[1 * 2 + 0]).toBe(2);
+		expect(machine.trans[1 * 2 + 1]).toBe(2);
+	});
+
+	test("handles empty input", () => {
+		expect(scan([]).count).toBe(0);
+	});
+
+	test("splits syllables in a single pass", () => {
+		const result = scan([1, 2, 2, 1, 0, 1]);
+		expect(result.count).toBe(4);
+		expect(Array.from(result.starts.subarray(0, 4))).toEqual([0, 3, 4, 5]);
+		expect(Array.from(result.ends.subarray(0, 4))).toEqual([3, 4, 5, 6]);
+		expect(Array.from(result.types.subarray(0, 4))).toEqual([0, 0, 2, 0]);
+	});
+
+	test("records base and reph", () => {
+		const result = scan([3, 1, 2]);
+		expect(result.count).toBe(1);
+		expect(result.bases[0]).toBe(1);
+		expect(result.flags[0]! & SyllableFlag.Reph).toBe(SyllableFlag.Reph);
+	});
+
+	test("always advances on rejected characters", () => {
+		const result = scan([2, 2]);
+		expect(result.count).toBe(2);
+		expect(result.bases[0]).toBe(-1);
+		expect(result.types[0]).toBe(2);
+	});
+
+	test("grows scratch capacity", () => {
+		const categories = new Array(300).fill(1);
+		const result = scan(categories);
+		expect(result.count).toBe(300);
+		expect(result.categories.length).toBeGreaterThanOrEqual(300);
+	});
+});
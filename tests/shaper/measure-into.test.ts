@@ -0,0 +1,87 @@
+import { beforeAll, describe, expect, test } from "bun:test";
+import { UnicodeBuffer } from "../../src/buffer/unicode-buffer.ts";
+import { Font } from "../../src/font/font.ts";
+import {
+	measureInto,
+	releaseBuffer,
+	type ShapeOptions,
+	shape,
+} from "../../src/shaper/shaper.ts";
+
+function expectMatchesShape(
+	font: Font,
+	text: string,
+	options: ShapeOptions,
+): void {
+	const buffer = new UnicodeBuffer().addStr(text);
+	const n = buffer.length;
+	const expected = new Float32Array(n + 1);
+	const glyphs = shape(font, buffer, options);
+	for (let i = 0; i < glyphs.length; i++) {
+		const advance = glyphs.positions[i]!.xAdvance;
+		expected[glyphs.infos[i]!.cluster] += advance;
+		expected[n] += advance;
+	}
+	releaseBuffer(glyphs);
+
+	// Stale values must be overwritten
+	const out = new Float32Array(n + 3).fill(7);
+	const total = measureInto(font, buffer, options, out);
+	expect(Array.from(out.subarray(0, n + 1))).toEqual(Array.from(expected));
+	expect(Math.fround(total)).toBe(expected[n]!);
+}
+
+describe("measureInto", () => {
+	let arabic: Font;
+	let coptic: Font;
+
+	beforeAll(async () => {
+		arabic = await Font.fromFile("tests/fixtures/NotoNaskhArabic[wght].ttf");
+		coptic = await Font.fromFile("tests/fixtures/NotoSansCoptic-Regular.ttf");
+	});
+
+	test("matches shape() cluster advances for RTL text with marks", () => {
+		const options: ShapeOptions = { script: "arab", direction: "rtl" };
+		for (const text of ["بب", "لا بِسْمِ", "مرحبا", "abc \u{1f600}", ""]) {
+			expectMatchesShape(arabic, text, options);
+		}
+	});
+
+	test("matches shape() cluster advances with default options", () => {
+		for (const text of ["ⲀⲁⲂ", "Coptic text", "Ϣϣ"]) {
+			expectMatchesShape(coptic, text, {});
+		}
+	});
+
+	test("matches shape() through kerning and stacked marks", async () => {
+		const cases: [string, string, ShapeOptions][] = [
+			["NotoSansLepcha-Regular.ttf", "ᰀᰤᰭ ᰁᰦᰶ ᰂᰧᰬᰵ", { script: "lepc" }],
+			[
+				"NotoSansSyriac-Regular.ttf",
+				"ܫܠܵܡܵܐ ܒ̈ܢܝ̈ܐ",
+				{ script: "syrc", direction: "rtl" },
+			],
+			["NotoSansNKo-Regular.ttf", "ߒߞߏ ߊ߫ߓ߬", { direction: "rtl" }],
+			["NotoSansNewa-Regular.ttf", "𑐣𑐾𑐰𑑂𑐳 𑐥𑐶𑐂", { script: "newa" }],
+		];
+		for (const [file, text, options] of cases) {
+			const font = await Font.fromFile(`tests/fixtures/${file}`);
+			expectMatchesShape(font, text, options);
+		}
+	});
+
+	test("indexes clusters from the buffer's first cluster", () => {
+		const plain = new Float32Array(4);
+		measureInto(coptic, new UnicodeBuffer().addStr("ⲀⲁⲂ"), {}, plain);
+		const shifted = new Float32Array(4);
+		measureInto(coptic, new UnicodeBuffer().addStr("ⲀⲁⲂ", 10), {}, shifted);
+		expect(Array.from(shifted)).toEqual(Array.from(plain));
+	});
+
+	test("rejects an output array without room for the total", () => {
+		const buffer = new UnicodeBuffer().addStr("abc");
+		expect(() => measureInto(coptic, buffer, {}, new Float32Array(3))).toThrow(
+			RangeError,
+		);
+	});
+});
@@ -0,0 +1,71 @@
+import { beforeAll, describe, expect, test } from "bun:test";
+import { UnicodeBuffer } from "../../src/buffer/unicode-buffer.ts";
+import { Font } from "../../src/font/font.ts";
+import {
+	releaseBuffer,
+	type ShapeOptions,
+	shape,
+	shapeBatch,
+} from "../../src/shaper/shaper.ts";
+
+const ARABIC = ["بب", "", "لا بِسْمِ", "مرحبا", "abc \u{1f600}"];
+
+function expectMatchesShape(
+	font: Font,
+	strings: string[],
+	options: ShapeOptions,
+): void {
+	const batch = shapeBatch(font, strings, options);
+	expect(batch.offsets.length).toBe(strings.length + 1);
+	expect(batch.offsets[strings.length]).toBe(batch.glyphIds.length);
+	expect(batch.positions.length).toBe(batch.glyphIds.length * 4);
+
+	for (let s = 0; s < strings.length; s++) {
+		const buffer = new UnicodeBuffer().addStr(strings[s]!);
+		const glyphs = shape(font, buffer, options);
+		const start = batch.offsets[s]!;
+		expect(batch.offsets[s + 1]! - start).toBe(glyphs.length);
+		for (let i = 0; i < glyphs.length; i++) {
+			const info = glyphs.infos[i]!;
+			const pos = glyphs.positions[i]!;
+			const o = start + i;
+			expect(batch.glyphIds[o]).toBe(info.glyphId);
+			expect(batch.clusters[o]).toBe(info.cluster);
+			const packed = batch.positions.subarray(o * 4, o * 4 + 4);
+			expect(Array.from(packed)).toEqual([
+				Math.fround(pos.xAdvance),
+				Math.fround(pos.yAdvance),
+				Math.fround(pos.xOffset),
+				Math.fround(pos.yOffset),
+			]);
+		}
+		releaseBuffer(glyphs);
+	}
+}
+
+describe("shapeBatch", () => {
+	let arabic: Font;
+	let coptic: Font;
+
+	beforeAll(async () => {
+		arabic = await Font.fromFile("tests/fixtures/NotoNaskhArabic[wght].ttf");
+		coptic = await Font.fromFile("tests/fixtures/NotoSansCoptic-Regular.ttf");
+	});
+
+	test("matches shape() per string for RTL text with marks", () => {
+		expectMatchesShape(arabic, ARABIC, { script: "arab", direction: "rtl" });
+	});
+
+	test("matches shape() per string with default options", () => {
+		const strings = ["ⲀⲁⲂ", "Coptic", "", "Ϣϣ"];
+		expectMatchesShape(coptic, strings, {});
+		// Long enough to outgrow the pooled scratch buffers
+		expectMatchesShape(coptic, [strings[0]!.repeat(200), "x"], {});
+	});
+
+	test("returns an empty result for no strings", () => {
+		const batch = shapeBatch(coptic, []);
+		expect(Array.from(batch.offsets)).toEqual([0]);
+		expect(batch.glyphIds.length).toBe(0);
+	});
+});
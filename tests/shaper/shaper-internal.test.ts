@@ -185,6 +185,36 @@ describe("shaper internal functions", () => {
 			// Glyphs 10, 20, 30 should still be substituted unless they're marks
 			expect(buffer.infos.length).toBe(3);
 		});
+
+		test("reports changes and adds new glyphs to the digest", () => {
+			const buffer = createBuffer([10, 20, 30]);
+			const lookup = {
+				type: GsubLookupType.Single as const,
+				flag: 0,
+				digest: createDigest([10, 20]),
+				subtables: [
+					{
+						format: 2 as const,
+						coverage: createCoverage([10, 20]),
+						substituteGlyphIds: [1000, 2000],
+					},
+				],
+			};
+			const added = new SetDigest();
+
+			expect(applySingleSubstLookup(mongolianFont, buffer, lookup, added)).toBe(
+				true,
+			);
+			expect(added.mayHave(1000)).toBe(true);
+			expect(added.mayHave(2000)).toBe(true);
+
+			// Nothing left to substitute
+			const idle = new SetDigest();
+			expect(applySingleSubstLookup(mongolianFont, buffer, lookup, idle)).toBe(
+				false,
+			);
+			expect(idle.mayHave(1000)).toBe(false);
+		});
 	});
 
 	describe("applyMultipleSubstLookup", () => {
@@ -0,0 +1,146 @@
+import { afterAll, beforeAll, describe, expect, test } from "bun:test";
+import { readFileSync } from "node:fs";
+import { Font } from "../../src/font/font.ts";
+import { shapeBatch } from "../../src/shaper/shaper.ts";
+import {
+	ShapingPool,
+	type ShapingWorkerLike,
+	serveShapingWorker,
+} from "../../src/shaper/shaping-pool.ts";
+
+const FONT_PATH = "tests/fixtures/NotoSansCoptic-Regular.ttf";
+
+// In-thread stand-in for a worker: a MessageChannel still structured-clones
+// and transfers every message
+function channelWorker(): ShapingWorkerLike {
+	const { port1, port2 } = new MessageChannel();
+	serveShapingWorker(port2 as unknown as ShapingWorkerLike);
+	return Object.assign(port1 as unknown as ShapingWorkerLike, {
+		terminate: () => {
+			port1.close();
+			port2.close();
+		},
+	});
+}
+
+type FailureEvent = "error" | "exit";
+
+// Stand-in for a worker that dies (crash, out of memory) on its first shard
+function failingWorker(event: FailureEvent): ShapingWorkerLike {
+	const listeners = new Map<string, (value: unknown) => void>();
+	return {
+		on: (type, listener) => {
+			listeners.set(type, listener);
+		},
+		postMessage: (message) => {
+			if ((message as { type: string }).type !== "shape") return;
+			const value = event === "error" ? new Error("out of memory") : 1;
+			queueMicrotask(() => listeners.get(event)?.(value));
+		},
+		terminate: () => {},
+	};
+}
+
+describe("ShapingPool", () => {
+	let bytes: ArrayBuffer;
+	let pool: ShapingPool;
+
+	beforeAll(() => {
+		bytes = new Uint8Array(readFileSync(FONT_PATH)).buffer;
+		pool = new ShapingPool({
+			size: 3,
+			createWorker: channelWorker,
+			fonts: { coptic: bytes },
+		});
+	});
+
+	afterAll(() => pool.terminate());
+
+	test("returns shapeBatch output in document order", async () => {
+		const strings: string[] = [];
+		for (let i = 0; i < 50; i++) {
+			strings.push("ⲀⲁⲂ ".repeat(i % 7), `Coptic ${i}`, "");
+		}
+		const expected = shapeBatch(Font.load(bytes), strings);
+		const result = await pool.shape("coptic", strings);
+		expect(Array.from(result.offsets)).toEqual(Array.from(expected.offsets));
+		expect(Array.from(result.glyphIds)).toEqual(Array.from(expected.glyphIds));
+		expect(Array.from(result.clusters)).toEqual(Array.from(expected.clusters));
+		expect(Array.from(result.positions)).toEqual(
+			Array.from(expected.positions),
+		);
+	});
+
+	test("handles an empty document", async () => {
+		const result = await pool.shape("coptic", []);
+		expect(Array.from(result.offsets)).toEqual([0]);
+		expect(result.glyphIds.length).toBe(0);
+	});
+
+	test("loads fonts by file path", async () => {
+		pool.addFont("copticFile", FONT_PATH);
+		const strings = ["ⲀⲁⲂ", "Coptic"];
+		const expected = await pool.shape("coptic", strings);
+		const result = await pool.shape("copticFile", strings);
+		expect(Array.from(result.glyphIds)).toEqual(Array.from(expected.glyphIds));
+		expect(Array.from(result.positions)).toEqual(
+			Array.from(expected.positions),
+		);
+	});
+
+	test("rejects an unknown font", async () => {
+		await expect(pool.shape("missing", ["abc"])).rejects.toThrow(
+			'Unknown font "missing"',
+		);
+	});
+});
+
+describe("ShapingPool failures", () => {
+	let bytes: ArrayBuffer;
+
+	beforeAll(() => {
+		bytes = new Uint8Array(readFileSync(FONT_PATH)).buffer;
+	});
+
+	for (const event of ["error", "exit"] as const) {
+		test(`rejects the shard of a worker that reports ${event}`, async () => {
+			const pool = new ShapingPool({
+				size: 1,
+				createWorker: () => failingWorker(event),
+			});
+			await expect(pool.shape("coptic", ["abc", "def"])).rejects.toThrow(
+				"Shaping worker failed",
+			);
+			// No worker is left to run anything
+			await expect(pool.shape("coptic", ["abc"])).rejects.toThrow(
+				"no live workers",
+			);
+		});
+	}
+
+	test("drops the failed worker and keeps shaping on the rest", async () => {
+		let created = 0;
+		const pool = new ShapingPool({
+			size: 2,
+			createWorker: () =>
+				created++ === 0 ? failingWorker("error") : channelWorker(),
+			fonts: { coptic: bytes },
+		});
+		const strings = ["ⲀⲁⲂ", "Coptic", "Ϣϣ"];
+		await expect(pool.shape("coptic", strings)).rejects.toThrow(
+			"out of memory",
+		);
+		const expected = shapeBatch(Font.load(bytes), strings);
+		const result = await pool.shape("coptic", strings);
+		expect(Array.from(result.glyphIds)).toEqual(Array.from(expected.glyphIds));
+		pool.terminate();
+	});
+
+	test("rejects shapes after terminate", async () => {
+		const pool = new ShapingPool({ size: 1, createWorker: channelWorker });
+		pool.terminate();
+		await expect(pool.shape("coptic", ["abc"])).rejects.toThrow(
+			"ShapingPool terminated",
+		);
+	});
+});
@@ -0,0 +1,227 @@
+/**
+ * Recorded glyph command streams for shaping-free raster benchmarks.
+ *
+ * Each glyph with an outline is laid out the way rasterizeGlyph does it
+ * (unhinted, no padding) and stored twice: as the flattened (op, x, y)
+ * stream GrayRaster records for fill-wasm, and as the 8-word 26.6 stream the
+ * ass-wasm kernel consumes. Read by bench/raster-replay.test.ts and by the
+ * native harness in raster-bench.c.
+ *
+ * File layout: "TSRC", u32 version, u32 section count (little endian), then
+ * per section (one font at one pixel size): varint pixel size, varint path
+ * length, UTF-8 font path, varint glyph count, and per glyph: varint gid,
+ * width, height, fill command count, ass command count, followed by the fill
+ * words and the ass words. Command words are zigzag varints holding the
+ * delta to the same word of the previous command, which keeps the file
+ * around a third of the raw Int32 size.
+ */
+
+import { encodeAssPath } from "../../src/raster/ass-wasm/index.ts"
+import { GrayRaster } from "../../src/raster/gray-raster.ts"
+import { decomposePath, getPathBounds } from "../../src/raster/outline-decompose.ts"
+import { getGlyphPath } from "../../src/render/path.ts"
+import type { Font } from "../../src/font/font.ts"
+
+export const CORPUS_VERSION = 2
+
+/** Where record.ts writes and the replay benchmark looks by default */
+export const DEFAULT_CORPUS = "bench/.cache/raster-corpus.bin"
+
+/** Words per fill command: op (0 move, 1 line), x, y in 24.8 subpixels */
+export const FILL_WORDS = 3
+/** Words per ass command: op, then up to three 26.6 points */
+export const ASS_WORDS = 8
+
+export interface CorpusGlyph {
+	gid: number
+	width: number
+	height: number
+	fill: Int32Array
+	ass: Int32Array
+}
+
+export interface CorpusSection {
+	fontPath: string
+	pixelSize: number
+	glyphs: CorpusGlyph[]
+}
+
+/** Record every outline glyph of `font` (or just `gids`) at `pixelSize` */
+export function recordSection(
+	font: Font,
+	fontPath: string,
+	pixelSize: number,
+	gids?: number[],
+): CorpusSection {
+	const scale = pixelSize / font.unitsPerEm
+	const raster = new GrayRaster()
+	const glyphs: CorpusGlyph[] = []
+	const ids = gids ?? Array.from({ length: font.numGlyphs }, (_, i) => i)
+
+	for (const gid of ids) {
+		const path = getGlyphPath(font, gid)
+		if (!path) continue
+		const bounds = getPathBounds(path, scale, true, true)
+		if (!bounds) continue
+		const width = bounds.maxX - bounds.minX
+		const height = bounds.maxY - bounds.minY
+		if (width <= 0 || height <= 0) continue
+		const offsetX = -bounds.minX
+		const offsetY = -bounds.minY
+
+		raster.setClip(0, 0, width, height)
+		raster.setBandBounds(0, height)
+		raster.reset()
+		raster.beginRecord()
+		decomposePath(raster, path, scale, offsetX, offsetY, true)
+		raster.endRecord()
+
+		glyphs.push({
+			gid,
+			width,
+			height,
+			fill: raster.getCmd().slice(0, raster.getCmdCount() * FILL_WORDS),
+			ass: encodeAssPath(path, scale, offsetX, offsetY, true),
+		})
+	}
+	return { fontPath, pixelSize, glyphs }
+}
+
+class ByteWriter {
+	bytes = new Uint8Array(1 << 16)
+	length = 0
+
+	private reserve(n: number): void {
+		if (this.length + n <= this.bytes.length) return
+		let capacity = this.bytes.length * 2
+		while (capacity < this.length + n) capacity *= 2
+		const grown = new Uint8Array(capacity)
+		grown.set(this.bytes.subarray(0, this.length))
+		this.bytes = grown
+	}
+
+	u32(value: number): void {
+		this.reserve(4)
+		new DataView(this.bytes.buffer).setUint32(this.length, value, true)
+		this.length += 4
+	}
+
+	varint(value: number): void {
+		this.reserve(5)
+		let v = value >>> 0
+		while (v >= 0x80) {
+			this.bytes[this.length++] = (v & 0x7f) | 0x80
+			v >>>= 7
+		}
+		this.bytes[this.length++] = v
+	}
+
+	raw(data: Uint8Array): void {
+		this.reserve(data.length)
+		this.bytes.set(data, this.length)
+		this.length += data.length
+	}
+
+	/** Delta + zigzag encode `words`, `stride` words per command */
+	stream(words: Int32Array, stride: number): void {
+		for (let i = 0; i < words.length; i++) {
+			const delta = (words[i]! - (i >= stride ? words[i - stride]! : 0)) | 0
+			this.varint((delta << 1) ^ (delta >> 31))
+		}
+	}
+}
+
+class ByteReader {
+	pos = 0
+	constructor(private readonly bytes: Uint8Array) {}
+
+	u32(): number {
+		const view = new DataView(this.bytes.buffer, this.bytes.byteOffset)
+		const value = view.getUint32(this.pos, true)
+		this.pos += 4
+		return value
+	}
+
+	varint(): number {
+		let value = 0
+		let shift = 0
+		for (;;) {
+			const byte = this.bytes[this.pos++]
+			if (byte === undefined) throw new Error("Truncated raster corpus")
+			value |= (byte & 0x7f) << shift
+			if (byte < 0x80) return value >>> 0
+			shift += 7
+		}
+	}
+
+	string(length: number): string {
+		const text = new TextDecoder().decode(
+			this.bytes.subarray(this.pos, this.pos + length),
+		)
+		this.pos += length
+		return text
+	}
+
+	stream(count: number, stride: number): Int32Array {
+		const words = new Int32Array(count * stride)
+		for (let i = 0; i < words.length; i++) {
+			const z = this.varint()
+			const delta = (z >>> 1) ^ -(z & 1)
+			words[i] = (i >= stride ? words[i - stride]! : 0) + delta
+		}
+		return words
+	}
+}
+
+export function encodeCorpus(sections: CorpusSection[]): Uint8Array {
+	const out = new ByteWriter()
+	out.raw(new TextEncoder().encode("TSRC"))
+	out.u32(CORPUS_VERSION)
+	out.u32(sections.length)
+	for (const section of sections) {
+		const name = new TextEncoder().encode(section.fontPath)
+		out.varint(section.pixelSize)
+		out.varint(name.length)
+		out.raw(name)
+		out.varint(section.glyphs.length)
+		for (const glyph of section.glyphs) {
+			out.varint(glyph.gid)
+			out.varint(glyph.width)
+			out.varint(glyph.height)
+			out.varint(glyph.fill.length / FILL_WORDS)
+			out.varint(glyph.ass.length / ASS_WORDS)
+			out.stream(glyph.fill, FILL_WORDS)
+			out.stream(glyph.ass, ASS_WORDS)
+		}
+	}
+	return out.bytes.slice(0, out.length)
+}
+
+export function decodeCorpus(bytes: Uint8Array): CorpusSection[] {
+	const input = new ByteReader(bytes)
+	if (input.string(4) !== "TSRC") throw new Error("Not a raster corpus")
+	const version = input.u32()
+	if (version !== CORPUS_VERSION) {
+		throw new Error(`Unsupported raster corpus version ${version}`)
+	}
+	const sections: CorpusSection[] = []
+	const sectionCount = input.u32()
+	for (let s = 0; s < sectionCount; s++) {
+		const pixelSize = input.varint()
+		const fontPath = input.string(input.varint())
+		const glyphs: CorpusGlyph[] = []
+		const glyphCount = input.varint()
+		for (let g = 0; g < glyphCount; g++) {
+			const gid = input.varint()
+			const width = input.varint()
+			const height = input.varint()
+			const fillCount = input.varint()
+			const assCount = input.varint()
+			const fill = input.stream(fillCount, FILL_WORDS)
+			const ass = input.stream(assCount, ASS_WORDS)
+			glyphs.push({ gid, width, height, fill, ass })
+		}
+		sections.push({ fontPath, pixelSize, glyphs })
+	}
+	return sections
+}
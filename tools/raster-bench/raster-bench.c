@@ -0,0 +1,494 @@
+// Native benchmark for the C raster kernels (fill-wasm/fill.c and
+// ass-wasm/ass-fill.c) built as host code, optionally against FreeType's
+// gray rasterizer on the same glyphs. Replays a corpus written by record.ts
+// (format in corpus.ts).
+//
+// usage: raster-bench <corpus> [--kernel fill|dense|ass|freetype|all] [--reps N]
+//
+// Reports the best of N passes over the corpus in cycles (rdtsc on x86,
+// nanoseconds elsewhere) per glyph and per output pixel, plus an FNV-1a hash
+// of the kernel output so behavior changes show up next to timing changes.
+// Build with -DWITH_FREETYPE and pkg-config freetype2 flags to enable the
+// FreeType comparison (run.sh does this when freetype2 is installed).
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define TICK_UNIT "cycles"
+static uint64_t ticks(void) { return __rdtsc(); }
+#else
+#define TICK_UNIT "ns"
+static uint64_t ticks(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+#endif
+
+#ifdef WITH_FREETYPE
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_OUTLINE_H
+#endif
+
+// Kernel entry points (see the .c sources for the argument layout)
+int fill_glyph(int32_t cmdOff, int32_t cmdCount, int32_t width, int32_t height,
+	int32_t fillRule, int32_t cellsOff, int32_t ycellsOff, int32_t outOff,
+	int32_t poolSize);
+int fill_glyph_dense(int32_t cmdOff, int32_t cmdCount, int32_t width,
+	int32_t height, int32_t fillRule, int32_t areaOff, int32_t coverOff,
+	int32_t outOff);
+int ass_fill_path(int32_t cmd_off, int32_t cmd_count, int32_t width,
+	int32_t height, int32_t line_off, int32_t line_capacity, int32_t arena_off,
+	int32_t arena_capacity, int32_t tile_off, int32_t out_off);
+
+// Arena the kernels address through kernel-host.h
+uint8_t *kernel_host_memory;
+
+#define ARENA_BYTES (256u << 20)
+// Must match POOL_SIZE in fill-wasm/index.ts
+#define FILL_POOL_SIZE 16384
+#define ASS_SEGMENT_BYTES 40
+
+typedef struct {
+	uint32_t gid;
+	int32_t width, height;
+	int32_t fill_count, ass_count;
+	int32_t *fill_cmd;
+	int32_t *ass_cmd;
+} Glyph;
+
+// One font at one pixel size
+typedef struct {
+	char *font_path;
+	uint32_t pixel_size;
+	uint32_t first, count;
+} Section;
+
+typedef struct {
+	Section *sections;
+	uint32_t section_count;
+	Glyph *glyphs;
+	uint32_t count;
+} Corpus;
+
+static uint32_t align16(uint32_t v) { return (v + 15u) & ~15u; }
+
+static uint32_t fnv1a(uint32_t hash, const uint8_t *bytes, size_t n) {
+	for (size_t i = 0; i < n; i++) hash = (hash ^ bytes[i]) * 0x01000193u;
+	return hash;
+}
+
+static uint32_t read_u32(const uint8_t *p) {
+	return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 |
+		(uint32_t)p[3] << 24;
+}
+
+typedef struct {
+	const uint8_t *p, *end;
+	int ok;
+} Reader;
+
+static uint32_t read_varint(Reader *r) {
+	uint32_t value = 0;
+	for (int shift = 0; shift < 35; shift += 7) {
+		if (r->p >= r->end) break;
+		uint8_t byte = *r->p++;
+		value |= (uint32_t)(byte & 0x7f) << shift;
+		if (byte < 0x80) return value;
+	}
+	r->ok = 0;
+	return 0;
+}
+
+// Undo the per-word delta + zigzag coding of a command stream
+static int32_t *read_stream(Reader *r, int32_t count, int stride) {
+	size_t n = (size_t)count * (size_t)stride;
+	int32_t *words = (int32_t *)malloc((n ? n : 1) * sizeof(int32_t));
+	for (size_t i = 0; i < n; i++) {
+		uint32_t z = read_varint(r);
+		uint32_t delta = (z >> 1) ^ (0u - (z & 1));
+		uint32_t prev = i >= (size_t)stride ? (uint32_t)words[i - stride] : 0;
+		words[i] = (int32_t)(prev + delta);
+	}
+	return words;
+}
+
+static int load_corpus(const char *path, Corpus *corpus) {
+	FILE *f = fopen(path, "rb");
+	if (!f) return 0;
+	fseek(f, 0, SEEK_END);
+	long size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	uint8_t *data = (uint8_t *)malloc((size_t)size);
+	if (!data || fread(data, 1, (size_t)size, f) != (size_t)size) {
+		fclose(f);
+		free(data);
+		return 0;
+	}
+	fclose(f);
+
+	if (size < 12 || memcmp(data, "TSRC", 4) != 0 || read_u32(data + 4) != 2) {
+		free(data);
+		return 0;
+	}
+	Reader r = {data + 12, data + size, 1};
+	corpus->section_count = read_u32(data + 8);
+	corpus->sections =
+		(Section *)calloc(corpus->section_count + 1, sizeof(Section));
+	corpus->glyphs = NULL;
+	corpus->count = 0;
+	uint32_t capacity = 0;
+
+	for (uint32_t s = 0; s < corpus->section_count && r.ok; s++) {
+		Section *section = &corpus->sections[s];
+		section->pixel_size = read_varint(&r);
+		uint32_t name_len = read_varint(&r);
+		if ((size_t)(r.end - r.p) < name_len) break;
+		section->font_path = (char *)calloc(name_len + 1, 1);
+		memcpy(section->font_path, r.p, name_len);
+		r.p += name_len;
+		section->first = corpus->count;
+		section->count = read_varint(&r);
+
+		for (uint32_t i = 0; i < section->count && r.ok; i++) {
+			if (corpus->count == capacity) {
+				capacity = capacity ? capacity * 2 : 1024;
+				corpus->glyphs =
+					(Glyph *)realloc(corpus->glyphs, capacity * sizeof(Glyph));
+			}
+			Glyph *g = &corpus->glyphs[corpus->count++];
+			g->gid = read_varint(&r);
+			g->width = (int32_t)read_varint(&r);
+			g->height = (int32_t)read_varint(&r);
+			g->fill_count = (int32_t)read_varint(&r);
+			g->ass_count = (int32_t)read_varint(&r);
+			g->fill_cmd = read_stream(&r, g->fill_count, 3);
+			g->ass_cmd = read_stream(&r, g->ass_count, 8);
+		}
+	}
+	free(data);
+	return r.ok;
+}
+
+typedef struct {
+	uint64_t best;
+	uint64_t pixels;
+	uint32_t hash;
+	uint32_t failed;
+} Result;
+
+// One pass of fill_glyph over the corpus. Layout mirrors fillGlyphGrayWasm.
+static uint64_t run_fill(const Corpus *c, uint32_t *hash, uint32_t *failed) {
+	uint64_t total = 0;
+	for (uint32_t i = 0; i < c->count; i++) {
+		const Glyph *g = &c->glyphs[i];
+		uint32_t p = 0;
+		uint32_t cmd_off = p;
+		p = align16(p + (uint32_t)g->fill_count * 12);
+		uint32_t cells_off = p;
+		p = align16(p + FILL_POOL_SIZE * 16);
+		uint32_t ycells_off = p;
+		p = align16(p + (uint32_t)g->height * 4);
+		uint32_t out_off = p;
+		size_t out_bytes = (size_t)g->width * (size_t)g->height;
+		if (p + out_bytes > ARENA_BYTES) {
+			(*failed)++;
+			continue;
+		}
+		memcpy(kernel_host_memory + cmd_off, g->fill_cmd,
+			(size_t)g->fill_count * 12);
+		memset(kernel_host_memory + out_off, 0, out_bytes);
+
+		uint64_t t0 = ticks();
+		int ok = fill_glyph((int32_t)cmd_off, g->fill_count, g->width, g->height,
+			0, (int32_t)cells_off, (int32_t)ycells_off, (int32_t)out_off,
+			FILL_POOL_SIZE);
+		total += ticks() - t0;
+
+		if (!ok) (*failed)++;
+		else *hash = fnv1a(*hash, kernel_host_memory + out_off, out_bytes);
+	}
+	return total;
+}
+
+// One pass of fill_glyph_dense over every glyph regardless of size (the
+// TS wrapper only picks it below DENSE_MAX_PIXELS).
+static uint64_t run_dense(const Corpus *c, uint32_t *hash, uint32_t *failed) {
+	uint64_t total = 0;
+	for (uint32_t i = 0; i < c->count; i++) {
+		const Glyph *g = &c->glyphs[i];
+		size_t pixels = (size_t)g->width * (size_t)g->height;
+		uint32_t p = 0;
+		uint32_t cmd_off = p;
+		p = align16(p + (uint32_t)g->fill_count * 12);
+		uint32_t area_off = p;
+		p = align16(p + (uint32_t)pixels * 4);
+		uint32_t cover_off = p;
+		p = align16(p + (uint32_t)pixels * 4);
+		uint32_t out_off = p;
+		if (p + pixels > ARENA_BYTES) {
+			(*failed)++;
+			continue;
+		}
+		memcpy(kernel_host_memory + cmd_off, g->fill_cmd,
+			(size_t)g->fill_count * 12);
+		memset(kernel_host_memory + out_off, 0, pixels);
+
+		uint64_t t0 = ticks();
+		fill_glyph_dense((int32_t)cmd_off, g->fill_count, g->width, g->height, 0,
+			(int32_t)area_off, (int32_t)cover_off, (int32_t)out_off);
+		total += ticks() - t0;
+
+		*hash = fnv1a(*hash, kernel_host_memory + out_off, pixels);
+	}
+	return total;
+}
+
+// One pass of ass_fill_path over the corpus. Layout mirrors fillAssPathWasm,
+// including the retry with a larger segment capacity.
+static uint64_t run_ass(const Corpus *c, uint32_t *hash, uint32_t *failed) {
+	uint64_t total = 0;
+	for (uint32_t i = 0; i < c->count; i++) {
+		const Glyph *g = &c->glyphs[i];
+		if (g->ass_count == 0) continue;
+		uint32_t width = align16((uint32_t)g->width);
+		uint32_t height = align16((uint32_t)g->height);
+		uint32_t capacity = g->ass_count * 16 > 64 ? g->ass_count * 16 : 64;
+		for (;;) {
+			uint32_t p = 0;
+			uint32_t cmd_off = p;
+			p = align16(p + (uint32_t)g->ass_count * 32);
+			uint32_t lines_off = p;
+			p = align16(p + capacity * ASS_SEGMENT_BYTES);
+			uint32_t arena_off = p;
+			p = align16(p + capacity * ASS_SEGMENT_BYTES);
+			uint32_t tile_off = p;
+			p = align16(p + 256);
+			uint32_t out_off = p;
+			p = align16(p + width * height);
+			if (p > ARENA_BYTES) {
+				(*failed)++;
+				break;
+			}
+			memcpy(kernel_host_memory + cmd_off, g->ass_cmd,
+				(size_t)g->ass_count * 32);
+
+			uint64_t t0 = ticks();
+			int ok = ass_fill_path((int32_t)cmd_off, g->ass_count, (int32_t)width,
+				(int32_t)height, (int32_t)lines_off, (int32_t)capacity,
+				(int32_t)arena_off, (int32_t)capacity, (int32_t)tile_off,
+				(int32_t)out_off);
+			total += ticks() - t0;
+
+			if (ok) {
+				for (int32_t y = 0; y < g->height; y++) {
+					*hash = fnv1a(*hash,
+						kernel_host_memory + out_off + (size_t)y * width,
+						(size_t)g->width);
+				}
+				break;
+			}
+			capacity *= 2;
+		}
+	}
+	return total;
+}
+
+#ifdef WITH_FREETYPE
+typedef struct {
+	FT_Library library;
+	FT_Outline *outlines;
+	FT_Bitmap *bitmaps;
+	uint32_t count;
+} FreeTypeSet;
+
+static int load_freetype_section(const Corpus *c, const Section *section,
+	FreeTypeSet *set) {
+	FT_Face face;
+	if (FT_New_Face(set->library, section->font_path, 0, &face)) {
+		fprintf(stderr, "failed to load font: %s\n", section->font_path);
+		return 0;
+	}
+	if (FT_Set_Pixel_Sizes(face, 0, section->pixel_size)) return 0;
+
+	for (uint32_t i = section->first; i < section->first + section->count; i++) {
+		if (FT_Load_Glyph(face, c->glyphs[i].gid,
+				FT_LOAD_NO_HINTING | FT_LOAD_NO_BITMAP)) {
+			continue;
+		}
+		FT_GlyphSlot slot = face->glyph;
+		if (slot->format != FT_GLYPH_FORMAT_OUTLINE) continue;
+		FT_Outline *outline = &set->outlines[set->count];
+		FT_Outline_New(set->library, (FT_UInt)slot->outline.n_points,
+			slot->outline.n_contours, outline);
+		FT_Outline_Copy(&slot->outline, outline);
+
+		FT_BBox box;
+		FT_Outline_Get_CBox(outline, &box);
+		FT_Pos x0 = box.xMin & ~63, y0 = box.yMin & ~63;
+		FT_Pos x1 = (box.xMax + 63) & ~63, y1 = (box.yMax + 63) & ~63;
+		if (x1 <= x0 || y1 <= y0) continue;
+		FT_Outline_Translate(outline, -x0, -y0);
+
+		FT_Bitmap *bitmap = &set->bitmaps[set->count];
+		bitmap->width = (unsigned)((x1 - x0) >> 6);
+		bitmap->rows = (unsigned)((y1 - y0) >> 6);
+		bitmap->pitch = (int)bitmap->width;
+		bitmap->pixel_mode = FT_PIXEL_MODE_GRAY;
+		bitmap->num_grays = 256;
+		bitmap->buffer = (unsigned char *)malloc(bitmap->width * bitmap->rows);
+		set->count++;
+	}
+	FT_Done_Face(face);
+	return 1;
+}
+
+// Load unhinted outlines once, one face per corpus section; only
+// FT_Outline_Get_Bitmap is timed.
+static int load_freetype(const Corpus *c, FreeTypeSet *set) {
+	if (FT_Init_FreeType(&set->library)) return 0;
+	set->outlines = (FT_Outline *)calloc(c->count + 1, sizeof(FT_Outline));
+	set->bitmaps = (FT_Bitmap *)calloc(c->count + 1, sizeof(FT_Bitmap));
+	set->count = 0;
+	for (uint32_t s = 0; s < c->section_count; s++) {
+		if (!load_freetype_section(c, &c->sections[s], set)) return 0;
+	}
+	return 1;
+}
+
+static uint64_t run_freetype(const FreeTypeSet *set, uint64_t *pixels,
+	uint32_t *hash, uint32_t *failed) {
+	uint64_t total = 0;
+	*pixels = 0;
+	for (uint32_t i = 0; i < set->count; i++) {
+		FT_Bitmap *bitmap = &set->bitmaps[i];
+		size_t bytes = (size_t)bitmap->width * bitmap->rows;
+		memset(bitmap->buffer, 0, bytes);
+
+		uint64_t t0 = ticks();
+		FT_Error error =
+			FT_Outline_Get_Bitmap(set->library, &set->outlines[i], bitmap);
+		total += ticks() - t0;
+
+		if (error) (*failed)++;
+		else *hash = fnv1a(*hash, bitmap->buffer, bytes);
+		*pixels += bytes;
+	}
+	return total;
+}
+#endif
+
+static void report(const char *name, uint32_t glyphs, const Result *r) {
+	printf("%-9s %6u glyphs %10.0f %s/glyph %8.2f %s/pixel  hash %08x",
+		name, glyphs, (double)r->best / (glyphs ? glyphs : 1), TICK_UNIT,
+		(double)r->best / (double)(r->pixels ? r->pixels : 1), TICK_UNIT,
+		r->hash);
+	if (r->failed) printf("  (%u failed)", r->failed);
+	printf("\n");
+}
+
+int main(int argc, char **argv) {
+	if (argc < 2) {
+		fprintf(stderr,
+			"usage: %s <corpus> [--kernel fill|dense|ass|freetype|all] [--reps N]\n",
+			argv[0]);
+		return 1;
+	}
+	const char *kernel = "all";
+	int reps = 20;
+	for (int i = 2; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "--kernel") == 0) kernel = argv[i + 1];
+		else if (strcmp(argv[i], "--reps") == 0) reps = atoi(argv[i + 1]);
+	}
+	if (reps < 1) reps = 1;
+	int all = strcmp(kernel, "all") == 0;
+
+	Corpus corpus;
+	if (!load_corpus(argv[1], &corpus)) {
+		fprintf(stderr, "failed to read corpus: %s\n", argv[1]);
+		return 1;
+	}
+	kernel_host_memory = (uint8_t *)malloc(ARENA_BYTES);
+	if (!kernel_host_memory) return 1;
+
+	uint64_t pixels = 0;
+	for (uint32_t i = 0; i < corpus.count; i++) {
+		pixels += (uint64_t)corpus.glyphs[i].width *
+			(uint64_t)corpus.glyphs[i].height;
+	}
+	for (uint32_t s = 0; s < corpus.section_count; s++) {
+		printf("%s @ %upx: %u glyphs\n", corpus.sections[s].font_path,
+			corpus.sections[s].pixel_size, corpus.sections[s].count);
+	}
+	printf("total: %u glyphs, %llu pixels, best of %d\n", corpus.count,
+		(unsigned long long)pixels, reps);
+
+	if (all || strcmp(kernel, "fill") == 0) {
+		Result r = {UINT64_MAX, pixels, 0, 0};
+		for (int rep = 0; rep < reps; rep++) {
+			uint32_t hash = 0x811c9dc5u, failed = 0;
+			uint64_t t = run_fill(&corpus, &hash, &failed);
+			if (t < r.best) r.best = t;
+			r.hash = hash;
+			r.failed = failed;
+		}
+		report("fill", corpus.count, &r);
+	}
+
+	if (all || strcmp(kernel, "dense") == 0) {
+		Result r = {UINT64_MAX, pixels, 0, 0};
+		for (int rep = 0; rep < reps; rep++) {
+			uint32_t hash = 0x811c9dc5u, failed = 0;
+			uint64_t t = run_dense(&corpus, &hash, &failed);
+			if (t < r.best) r.best = t;
+			r.hash = hash;
+			r.failed = failed;
+		}
+		report("dense", corpus.count, &r);
+	}
+
+	if (all || strcmp(kernel, "ass") == 0) {
+		Result r = {UINT64_MAX, pixels, 0, 0};
+		for (int rep = 0; rep < reps; rep++) {
+			uint32_t hash = 0x811c9dc5u, failed = 0;
+			uint64_t t = run_ass(&corpus, &hash, &failed);
+			if (t < r.best) r.best = t;
+			r.hash = hash;
+			r.failed = failed;
+		}
+		report("ass", corpus.count, &r);
+	}
+
+	if (all || strcmp(kernel, "freetype") == 0) {
+#ifdef WITH_FREETYPE
+		FreeTypeSet set;
+		if (!load_freetype(&corpus, &set)) {
+			fprintf(stderr, "failed to set up FreeType\n");
+			return 1;
+		}
+		Result r = {UINT64_MAX, 0, 0, 0};
+		for (int rep = 0; rep < reps; rep++) {
+			uint32_t hash = 0x811c9dc5u, failed = 0;
+			uint64_t t = run_freetype(&set, &r.pixels, &hash, &failed);
+			if (t < r.best) r.best = t;
+			r.hash = hash;
+			r.failed = failed;
+		}
+		report("freetype", set.count, &r);
+#else
+		if (!all) {
+			fprintf(stderr, "built without FreeType (-DWITH_FREETYPE)\n");
+			return 1;
+		}
+#endif
+	}
+	return 0;
+}
@@ -0,0 +1,61 @@
+#!/usr/bin/env bun
+/**
+ * Record a glyph command-stream corpus (format in corpus.ts).
+ * Usage: bun tools/raster-bench/record.ts [--out file] [--sizes 12,24,48,96]
+ *        [--gids 1,2,3] [font ...]
+ *
+ * Without font arguments every .ttf/.otf in the benchmark font directory is
+ * recorded. Each font/size pair becomes one corpus section.
+ */
+
+import { mkdirSync, readdirSync, readFileSync, writeFileSync } from "node:fs"
+import { dirname, join } from "node:path"
+import { Font } from "../../src/font/font.ts"
+import {
+	type CorpusSection,
+	DEFAULT_CORPUS,
+	encodeCorpus,
+	recordSection,
+} from "./corpus.ts"
+
+const FONTS_DIR = "reference/rustybuzz/benches/fonts"
+const DEFAULT_SIZES = [12, 24, 48, 96]
+
+const args = process.argv.slice(2)
+let outPath = DEFAULT_CORPUS
+let sizes = DEFAULT_SIZES
+let gids: number[] | undefined
+const fonts: string[] = []
+for (let i = 0; i < args.length; i++) {
+	const arg = args[i]!
+	if (arg === "--out") outPath = args[++i]!
+	else if (arg === "--sizes") sizes = args[++i]!.split(",").map(Number)
+	else if (arg === "--gids") gids = args[++i]!.split(",").map(Number)
+	else fonts.push(arg)
+}
+if (fonts.length === 0) {
+	for (const name of readdirSync(FONTS_DIR).sort()) {
+		if (/\.(ttf|otf)$/i.test(name)) fonts.push(join(FONTS_DIR, name))
+	}
+}
+
+const sections: CorpusSection[] = []
+let glyphs = 0
+for (const fontPath of fonts) {
+	const bytes = readFileSync(fontPath)
+	const font = Font.load(
+		bytes.buffer.slice(bytes.byteOffset, bytes.byteOffset + bytes.byteLength),
+	)
+	for (const size of sizes) {
+		const section = recordSection(font, fontPath, size, gids)
+		sections.push(section)
+		glyphs += section.glyphs.length
+	}
+}
+
+const corpus = encodeCorpus(sections)
+mkdirSync(dirname(outPath), { recursive: true })
+writeFileSync(outPath, corpus)
+console.log(
+	`recorded ${glyphs} glyphs in ${sections.length} sections to ${outPath} (${corpus.length} bytes)`,
+)
@@ -0,0 +1,40 @@
+#!/usr/bin/env bash
+# Record a glyph corpus, build the native raster kernel benchmark and run it.
+# usage: tools/raster-bench/run.sh [raster-bench args...]
+#
+# RASTER_BENCH_FONTS (space separated paths) and RASTER_BENCH_SIZES (comma
+# separated, default 12,24,48,96) choose what gets recorded; by default every
+# font in the benchmark font directory is used.
+# The kernels are compiled as host C from the same sources build.sh feeds to
+# wasm32, so the binary can be profiled directly, e.g.
+#   perf record "$OUT/raster-bench" "$OUT/corpus.bin" --kernel fill
+set -euo pipefail
+cd "$(dirname "$0")/../.."
+
+OUT="${RASTER_BENCH_OUT:-${TMPDIR:-/tmp}/text-shaper-raster-bench}"
+mkdir -p "$OUT"
+
+RECORD_ARGS=(--out "$OUT/corpus.bin")
+if [ -n "${RASTER_BENCH_SIZES:-}" ]; then
+	RECORD_ARGS+=(--sizes "$RASTER_BENCH_SIZES")
+fi
+# shellcheck disable=SC2206
+RECORD_ARGS+=(${RASTER_BENCH_FONTS:-})
+bun tools/raster-bench/record.ts "${RECORD_ARGS[@]}"
+
+CFLAGS=(-O3 -g -std=c99)
+LIBS=()
+if pkg-config --exists freetype2 2>/dev/null; then
+	CFLAGS+=(-DWITH_FREETYPE $(pkg-config --cflags freetype2))
+	LIBS+=($(pkg-config --libs freetype2))
+else
+	echo "freetype2 not found via pkg-config; skipping the FreeType comparison"
+fi
+
+"${CC:-cc}" "${CFLAGS[@]}" \
+	tools/raster-bench/raster-bench.c \
+	src/raster/fill-wasm/fill.c \
+	src/raster/ass-wasm/ass-fill.c \
+	"${LIBS[@]}" -o "$OUT/raster-bench"
+
+"$OUT/raster-bench" "$OUT/corpus.bin" "$@"